@@ -8,3 +8,7 @@ APP_ABI := arm64-v8a
 
 # Min runtime API level
 APP_PLATFORM=android-30
+
+# Uncomment this to build SDL, SDL_ttf and the app with trace recording
+# (see SDL_trace.h), e.g. to write a trace to the file named by SDL_TRACE_FILE
+# APP_CFLAGS += -DSDL_TRACE=1
@@ -351,6 +351,77 @@ extern DECLSPEC int SDLCALL SDL_AtomicAdd(SDL_atomic_t *a, int v);
 #define SDL_AtomicDecRef(a)    (SDL_AtomicAdd(a, -1) == 1)
 #endif
 
+/**
+ * Wait for an atomic variable to change from a value.
+ *
+ * If `a` still holds `value`, this puts the calling thread to sleep until
+ * another thread calls SDL_AtomicWake() or SDL_AtomicWakeAll() on `a`, or
+ * the timeout elapses. The check is atomic with respect to those calls, so
+ * a thread that changes the variable and then wakes waiters can't have the
+ * wake missed. The wait can also end spuriously, so check the variable
+ * again after it returns.
+ *
+ * On Linux and Android this is a futex wait. Elsewhere, threads wait on one
+ * of a fixed set of condition variables chosen by the address of `a`.
+ *
+ * \param a a pointer to an SDL_atomic_t variable
+ * \param value the value to wait for the variable to change from
+ * \param ms the length of the timeout, in milliseconds, or
+ *           SDL_MUTEX_MAXWAIT to wait indefinitely
+ * \returns 0 if the wait ended before the timeout, SDL_MUTEX_TIMEDOUT if the
+ *          timeout elapsed, or a negative error code on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \since This function is available since SDL 2.26.5.
+ *
+ * \sa SDL_AtomicWait
+ * \sa SDL_AtomicWake
+ * \sa SDL_AtomicWakeAll
+ */
+extern DECLSPEC int SDLCALL SDL_AtomicWaitTimeout(SDL_atomic_t *a, int value, Uint32 ms);
+
+/**
+ * Wait indefinitely for an atomic variable to change from a value.
+ *
+ * This is the same as SDL_AtomicWaitTimeout() with a timeout of
+ * SDL_MUTEX_MAXWAIT.
+ *
+ * \param a a pointer to an SDL_atomic_t variable
+ * \param value the value to wait for the variable to change from
+ * \returns 0 when the wait ends or a negative error code on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \since This function is available since SDL 2.26.5.
+ *
+ * \sa SDL_AtomicWaitTimeout
+ * \sa SDL_AtomicWake
+ */
+extern DECLSPEC int SDLCALL SDL_AtomicWait(SDL_atomic_t *a, int value);
+
+/**
+ * Wake one thread waiting on an atomic variable.
+ *
+ * \param a a pointer to an SDL_atomic_t variable
+ *
+ * \since This function is available since SDL 2.26.5.
+ *
+ * \sa SDL_AtomicWait
+ * \sa SDL_AtomicWakeAll
+ */
+extern DECLSPEC void SDLCALL SDL_AtomicWake(SDL_atomic_t *a);
+
+/**
+ * Wake all threads waiting on an atomic variable.
+ *
+ * \param a a pointer to an SDL_atomic_t variable
+ *
+ * \since This function is available since SDL 2.26.5.
+ *
+ * \sa SDL_AtomicWait
+ * \sa SDL_AtomicWake
+ */
+extern DECLSPEC void SDLCALL SDL_AtomicWakeAll(SDL_atomic_t *a);
+
 /**
  * Set a pointer to a new value if it is currently an old value.
  *
@@ -897,6 +897,142 @@ extern DECLSPEC SDL_AudioSpec *SDLCALL SDL_LoadWAV_RW(SDL_RWops * src,
  */
 extern DECLSPEC void SDLCALL SDL_FreeWAV(Uint8 * audio_buf);
 
+/**
+ * An incremental WAVE decoder, created with SDL_OpenWaveStream_RW().
+ *
+ * This is opaque data.
+ *
+ * \since This struct is available since SDL 2.26.5.
+ */
+struct SDL_WaveStream;
+typedef struct SDL_WaveStream SDL_WaveStream;
+
+/**
+ * Open a WAVE file for incremental decoding.
+ *
+ * This reads the headers of the file the same way SDL_LoadWAV_RW() does and
+ * supports the same formats and hints, but leaves the data portion in the
+ * data source. Call SDL_ReadWaveStream() to decode it a piece at a time, so
+ * memory use and the time until the first samples are available don't depend
+ * on the length of the file.
+ *
+ * The data source has to stay valid until the stream is closed, and shouldn't
+ * be used for anything else in the meantime. It needs to be seekable for
+ * SDL_SeekWaveStream().
+ *
+ * On success, `spec` is filled in exactly like SDL_LoadWAV_RW() would, and
+ * the data returned by SDL_ReadWaveStream() is in that format.
+ *
+ * \param src The data source for the WAVE data
+ * \param freesrc If non-zero, the data source is closed when the stream is
+ *                closed, or right away if this function fails
+ * \param spec An SDL_AudioSpec that will be filled in with the wave file's
+ *             format details
+ * \returns a new SDL_WaveStream, or NULL on error; call SDL_GetError() for
+ *          more information.
+ *
+ * \since This function is available since SDL 2.26.5.
+ *
+ * \sa SDL_CloseWaveStream
+ * \sa SDL_ReadWaveStream
+ * \sa SDL_SeekWaveStream
+ */
+extern DECLSPEC SDL_WaveStream *SDLCALL SDL_OpenWaveStream_RW(SDL_RWops * src,
+                                                             int freesrc,
+                                                             SDL_AudioSpec * spec);
+
+/**
+ *  Opens a WAV file for incremental decoding.
+ */
+#define SDL_OpenWaveStream(file, spec) \
+    SDL_OpenWaveStream_RW(SDL_RWFromFile(file, "rb"),1, spec)
+
+/**
+ * Decode the next piece of a WAVE stream.
+ *
+ * This decodes as many whole sample frames as fit into `len` bytes; asking
+ * for less than one sample frame is an error. ADPCM data is decoded one block
+ * at a time, everything else is read straight into `buf`.
+ *
+ * \param stream the stream to read from
+ * \param buf a buffer that receives the audio data
+ * \param len the size of `buf`, in bytes
+ * \returns the number of bytes written to `buf`, 0 at the end of the data, or
+ *          -1 on error; call SDL_GetError() for more information.
+ *
+ * \since This function is available since SDL 2.26.5.
+ *
+ * \sa SDL_OpenWaveStream_RW
+ * \sa SDL_SeekWaveStream
+ */
+extern DECLSPEC int SDLCALL SDL_ReadWaveStream(SDL_WaveStream * stream,
+                                               void *buf, int len);
+
+/**
+ * Move the read position of a WAVE stream.
+ *
+ * For ADPCM data, the block that holds `frame` is decoded again on the next
+ * read and the sample frames before it are dropped; other formats jump
+ * directly to the frame.
+ *
+ * \param stream the stream to seek in
+ * \param frame the sample frame to continue at, from 0 to the value of
+ *              SDL_GetWaveStreamLength()
+ * \returns 0 on success or a negative error code on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \since This function is available since SDL 2.26.5.
+ *
+ * \sa SDL_GetWaveStreamLength
+ * \sa SDL_TellWaveStream
+ */
+extern DECLSPEC int SDLCALL SDL_SeekWaveStream(SDL_WaveStream * stream,
+                                               Sint64 frame);
+
+/**
+ * Get the read position of a WAVE stream.
+ *
+ * \param stream the stream to query
+ * \returns the sample frame the next SDL_ReadWaveStream() starts at, or a
+ *          negative error code on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \since This function is available since SDL 2.26.5.
+ *
+ * \sa SDL_SeekWaveStream
+ */
+extern DECLSPEC Sint64 SDLCALL SDL_TellWaveStream(SDL_WaveStream * stream);
+
+/**
+ * Get the length of a WAVE stream.
+ *
+ * If the last ADPCM block of the file is truncated, the length can shrink
+ * once that block has been decoded and it is known how much of it is usable.
+ *
+ * \param stream the stream to query
+ * \returns the number of sample frames in the stream, or a negative error
+ *          code on failure; call SDL_GetError() for more information.
+ *
+ * \since This function is available since SDL 2.26.5.
+ *
+ * \sa SDL_SeekWaveStream
+ */
+extern DECLSPEC Sint64 SDLCALL SDL_GetWaveStreamLength(SDL_WaveStream * stream);
+
+/**
+ * Close a WAVE stream and free its resources.
+ *
+ * This also closes the data source if the stream was opened with `freesrc`
+ * set. It is safe to call this function with a NULL pointer.
+ *
+ * \param stream the stream to close
+ *
+ * \since This function is available since SDL 2.26.5.
+ *
+ * \sa SDL_OpenWaveStream_RW
+ */
+extern DECLSPEC void SDLCALL SDL_CloseWaveStream(SDL_WaveStream * stream);
+
 /**
  * Initialize an SDL_AudioCVT structure for conversion.
  *
@@ -1034,6 +1170,33 @@ extern DECLSPEC SDL_AudioStream * SDLCALL SDL_NewAudioStream(const SDL_AudioForm
  */
 extern DECLSPEC int SDLCALL SDL_AudioStreamPut(SDL_AudioStream *stream, const void *buf, int len);
 
+/**
+ * Add data to several streams at once, converting them in parallel.
+ *
+ * This does the same as calling SDL_AudioStreamPut() for each stream, but the
+ * conversions are spread over a pool of worker threads, one per extra CPU
+ * core. Each stream may only appear once in `streams`, and no other thread
+ * may use any of them until this function returns.
+ *
+ * All of the streams are processed even if some of them fail.
+ *
+ * \param streams an array of `num_streams` streams
+ * \param bufs an array of `num_streams` pointers to the audio data to add to
+ *             the corresponding stream
+ * \param lens an array of `num_streams` byte counts, one per stream
+ * \param num_streams the number of streams
+ * \returns 0 on success, or -1 if any of the streams failed; call
+ *          SDL_GetError() for the first failure.
+ *
+ * \since This function is available since SDL 2.26.5.
+ *
+ * \sa SDL_AudioStreamPut
+ */
+extern DECLSPEC int SDLCALL SDL_AudioStreamPutMultiple(SDL_AudioStream **streams,
+                                                       const void **bufs,
+                                                       const int *lens,
+                                                       int num_streams);
+
 /**
  * Get converted/resampled data from the stream
  *
@@ -1180,6 +1343,43 @@ extern DECLSPEC void SDLCALL SDL_MixAudioFormat(Uint8 * dst,
                                                 SDL_AudioFormat format,
                                                 Uint32 len, int volume);
 
+/**
+ * Mix several audio buffers in a specified format into one.
+ *
+ * This mixes each of the `num_srcs` buffers in `srcs` into `dst`, like
+ * calling SDL_MixAudioFormat() once for each of them, but `dst` is only read
+ * and written once, and for AUDIO_S16SYS, AUDIO_S32SYS and AUDIO_F32SYS data
+ * the sum is kept in a wider accumulator and only clipped after every source
+ * has been added. The integer formats also divide the summed, volume-scaled
+ * samples by SDL_MIX_MAXVOLUME once rather than rounding each source, so the
+ * result can differ from repeated calls by a little. This makes it the
+ * better way to mix several streams.
+ *
+ * Other formats are mixed one source at a time, exactly as repeated calls to
+ * SDL_MixAudioFormat() would.
+ *
+ * \param dst the destination for the mixed audio
+ * \param srcs an array of `num_srcs` source buffers, each holding `len`
+ *             bytes of `format` data
+ * \param volumes an array of `num_srcs` volumes, each ranging from 0 - 128,
+ *                or NULL to mix every source at SDL_MIX_MAXVOLUME
+ * \param num_srcs the number of source buffers
+ * \param format the SDL_AudioFormat of `dst` and all of the sources
+ * \param len the length of each audio buffer in bytes
+ * \returns 0 on success or a negative error code on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \since This function is available since SDL 2.26.5.
+ *
+ * \sa SDL_MixAudioFormat
+ */
+extern DECLSPEC int SDLCALL SDL_MixAudioFormatMultiple(Uint8 * dst,
+                                                       const Uint8 ** srcs,
+                                                       const int * volumes,
+                                                       int num_srcs,
+                                                       SDL_AudioFormat format,
+                                                       Uint32 len);
+
 /**
  * Queue more audio on non-callback devices.
  *
@@ -1344,6 +1544,188 @@ extern DECLSPEC Uint32 SDLCALL SDL_GetQueuedAudioSize(SDL_AudioDeviceID dev);
  */
 extern DECLSPEC void SDLCALL SDL_ClearQueuedAudio(SDL_AudioDeviceID dev);
 
+/**
+ * Performance counters for an opened audio device.
+ *
+ * Times are in nanoseconds. Everything counts from when the device was
+ * opened, or from the last call to SDL_ResetAudioDeviceStats().
+ *
+ * \sa SDL_GetAudioDeviceStats
+ * \sa SDL_ResetAudioDeviceStats
+ */
+typedef struct SDL_AudioDeviceStats
+{
+    Uint64 frames;              /**< Sample frames passed to or from the device. With SDL_HINT_AUDIO_SIMULATED_CLOCK this is the device's clock. */
+    Uint64 callbacks;           /**< Number of times the audio callback ran */
+    Uint64 callback_ns;         /**< Total time spent in the audio callback */
+    Uint64 callback_max_ns;     /**< Longest single run of the audio callback */
+    Uint64 conversion_ns;       /**< Total time spent converting between the callback and device formats */
+    Uint64 conversion_max_ns;   /**< Longest single conversion */
+    Uint64 latency_ns;          /**< How long audio queued right now takes to get through SDL and the device buffer */
+    Uint32 underruns;           /**< Number of times the device had to be given silence because audio wasn't ready in time */
+    Uint32 queued_bytes;        /**< Bytes in the SDL_QueueAudio() queue right now, as SDL_GetQueuedAudioSize() returns */
+    Uint32 queued_bytes_max;    /**< Most bytes the audio thread has found in the queue at once */
+} SDL_AudioDeviceStats;
+
+/**
+ * Get the performance counters of an opened audio device.
+ *
+ * The audio thread keeps these up to date whether or not anyone asks for
+ * them, and they are cheap to read, so this can be polled every frame to
+ * watch how close the callback comes to missing its deadline, or how deep
+ * the queue runs, while tuning buffer sizes.
+ *
+ * Underruns are counted when a device buffer had to be padded with silence:
+ * when the SDL_QueueAudio() queue ran dry during playback, when a capture
+ * device failed to deliver a full buffer, or when converted audio wasn't
+ * ready for the device. A queue that stays empty is only counted once.
+ *
+ * \param dev the ID of an opened audio device
+ * \param stats an SDL_AudioDeviceStats structure to be filled in
+ * \returns 0 on success or a negative error code on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \since This function is available since SDL 2.26.5.
+ *
+ * \sa SDL_ResetAudioDeviceStats
+ */
+extern DECLSPEC int SDLCALL SDL_GetAudioDeviceStats(SDL_AudioDeviceID dev,
+                                                    SDL_AudioDeviceStats *stats);
+
+/**
+ * Reset the performance counters of an opened audio device to zero.
+ *
+ * \param dev the ID of an opened audio device
+ *
+ * \since This function is available since SDL 2.26.5.
+ *
+ * \sa SDL_GetAudioDeviceStats
+ */
+extern DECLSPEC void SDLCALL SDL_ResetAudioDeviceStats(SDL_AudioDeviceID dev);
+
+/**
+ *  \name Audio sources
+ *
+ *  An audio source is a queue of audio data, in its own format and sample
+ *  rate, that an output device converts and mixes into its output on its
+ *  own. Any number of sources can be added to a device. The audio thread
+ *  converts them in parallel on a pool of worker threads and mixes them on
+ *  top of whatever the callback or SDL_QueueAudio() supplied.
+ */
+/* @{ */
+/* this is opaque to the outside world. */
+struct SDL_AudioSource;
+typedef struct SDL_AudioSource SDL_AudioSource;
+
+/**
+ * Add a new audio source to an opened output device.
+ *
+ * The source starts out empty and at SDL_MIX_MAXVOLUME. It plays while the
+ * device is unpaused; a source that runs out of data plays silence until more
+ * is added.
+ *
+ * The source belongs to the device: closing the device frees any sources
+ * that are left on it.
+ *
+ * Sources are mixed by SDL's own audio thread, so this fails with audio
+ * drivers that run the callback on a thread of their own, such as CoreAudio,
+ * PipeWire and Emscripten.
+ *
+ * \param dev the ID of an opened output device
+ * \param format the format of the audio data that will be added
+ * \param channels the number of channels of the audio data
+ * \param rate the sample rate of the audio data
+ * \returns a new audio source, or NULL on error; call SDL_GetError() for
+ *          more information.
+ *
+ * \since This function is available since SDL 2.26.5.
+ *
+ * \sa SDL_AudioSourcePut
+ * \sa SDL_FreeAudioSource
+ */
+extern DECLSPEC SDL_AudioSource * SDLCALL SDL_NewAudioSource(SDL_AudioDeviceID dev,
+                                                            SDL_AudioFormat format,
+                                                            Uint8 channels,
+                                                            int rate);
+
+/**
+ * Add audio data to the end of an audio source.
+ *
+ * The data is copied; it's converted by the audio thread when the device
+ * needs it. It is safe to call this function from any thread, without
+ * locking the device.
+ *
+ * \param source the audio source to add data to
+ * \param buf a pointer to the audio data to add
+ * \param len the number of bytes to add, a multiple of the source's sample
+ *            frame size
+ * \returns 0 on success or a negative error code on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \since This function is available since SDL 2.26.5.
+ *
+ * \sa SDL_AudioSourceQueued
+ * \sa SDL_AudioSourceClear
+ */
+extern DECLSPEC int SDLCALL SDL_AudioSourcePut(SDL_AudioSource *source,
+                                               const void *buf, int len);
+
+/**
+ * Get the number of bytes of audio data still queued in an audio source.
+ *
+ * This counts data added with SDL_AudioSourcePut() that the audio thread
+ * hasn't taken yet, in the source's own format. A little more may already be
+ * converted and waiting to be mixed.
+ *
+ * \param source the audio source to query
+ * \returns the number of queued bytes, or a negative error code on failure;
+ *          call SDL_GetError() for more information.
+ *
+ * \since This function is available since SDL 2.26.5.
+ *
+ * \sa SDL_AudioSourcePut
+ */
+extern DECLSPEC int SDLCALL SDL_AudioSourceQueued(SDL_AudioSource *source);
+
+/**
+ * Set the volume an audio source is mixed at.
+ *
+ * \param source the audio source to change
+ * \param volume the volume, ranging from 0 to SDL_MIX_MAXVOLUME
+ * \returns 0 on success or a negative error code on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \since This function is available since SDL 2.26.5.
+ */
+extern DECLSPEC int SDLCALL SDL_AudioSourceSetVolume(SDL_AudioSource *source,
+                                                     int volume);
+
+/**
+ * Drop any audio data waiting in an audio source.
+ *
+ * \param source the audio source to clear
+ *
+ * \since This function is available since SDL 2.26.5.
+ *
+ * \sa SDL_AudioSourcePut
+ */
+extern DECLSPEC void SDLCALL SDL_AudioSourceClear(SDL_AudioSource *source);
+
+/**
+ * Remove an audio source from its device and free it.
+ *
+ * Any audio data still waiting in the source is dropped. It is safe to call
+ * this function with a NULL pointer.
+ *
+ * \param source the audio source to free
+ *
+ * \since This function is available since SDL 2.26.5.
+ *
+ * \sa SDL_NewAudioSource
+ */
+extern DECLSPEC void SDLCALL SDL_FreeAudioSource(SDL_AudioSource *source);
+/* @} *//* Audio sources */
+
 
 /**
  *  \name Audio lock functions
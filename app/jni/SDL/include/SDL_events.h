@@ -1106,6 +1106,38 @@ extern DECLSPEC void SDLCALL SDL_DelEventWatch(SDL_EventFilter filter,
 extern DECLSPEC void SDLCALL SDL_FilterEvents(SDL_EventFilter filter,
                                               void *userdata);
 
+/**
+ * Get the individual samples that were merged into a motion event.
+ *
+ * When motion events are coalesced (see SDL_HINT_EVENT_COALESCING), a mouse,
+ * finger or sensor motion event that hasn't been read yet is updated with
+ * newer samples from the same source instead of queueing new events. This
+ * function returns those samples, oldest first, for applications that want
+ * the full input history, such as drawing programs.
+ *
+ * The samples of an event are available until the next coalesced event from
+ * the same mouse, finger or sensor is returned by SDL_PollEvent(),
+ * SDL_WaitEvent() or SDL_PeepEvents(). At most the latest 64 samples are
+ * kept for each event.
+ *
+ * An event that was not coalesced has a single sample, the event itself.
+ *
+ * \param event a motion event returned by SDL_PollEvent(), SDL_WaitEvent()
+ *              or SDL_PeepEvents()
+ * \param samples an array filled in with the samples, or NULL
+ * \param maxsamples the number of events that fit in `samples`
+ * \returns the number of samples merged into the event, which may be more
+ *          than `maxsamples`, or a negative error code on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \since This function is available since SDL 2.26.5.
+ *
+ * \sa SDL_HINT_EVENT_COALESCING
+ */
+extern DECLSPEC int SDLCALL SDL_GetEventHistory(const SDL_Event *event,
+                                                SDL_Event *samples,
+                                                int maxsamples);
+
 /* @{ */
 #define SDL_QUERY   -1
 #define SDL_IGNORE   0
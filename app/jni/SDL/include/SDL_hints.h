@@ -291,6 +291,22 @@ extern "C" {
  */
 #define SDL_HINT_AUDIO_RESAMPLING_MODE   "SDL_AUDIO_RESAMPLING_MODE"
 
+/**
+ *  \brief  A variable controlling whether the disk and dummy audio drivers run in real time.
+ *
+ *  This variable can be set to the following values:
+ *    "0"       - The drivers wait for each buffer to "play", like real hardware (default)
+ *    "1"       - The drivers never wait, and the audio thread runs as fast as it can
+ *
+ *  When enabled, time on these devices is only simulated: the frames counter
+ *  from SDL_GetAudioDeviceStats() says how much audio has been played or
+ *  captured. This is meant for benchmarking the conversion and mixing
+ *  throughput without any audio hardware.
+ *
+ *  This hint is checked when an audio device is opened.
+ */
+#define SDL_HINT_AUDIO_SIMULATED_CLOCK "SDL_AUDIO_SIMULATED_CLOCK"
+
 /**
  *  \brief  A variable controlling whether SDL updates joystick state when getting input events
  *
@@ -410,6 +426,26 @@ extern "C" {
  */
 #define SDL_HINT_EVENT_LOGGING   "SDL_EVENT_LOGGING"
 
+/**
+ *  \brief  A variable controlling whether high frequency motion events are merged while queued.
+ *
+ *  When enabled, a mouse, finger or sensor motion event is merged into the
+ *  last unread motion event from the same mouse, finger or sensor, as long
+ *  as no other kind of event was queued in between. The merged event holds
+ *  the latest sample, with relative motion accumulated. The individual
+ *  samples can be retrieved with SDL_GetEventHistory().
+ *
+ *  This variable can be set to the following values:
+ *    "0"     - Queue every motion event (default)
+ *    "1"     - Merge mouse, finger and sensor motion events
+ *
+ *  or a comma separated list of "mouse", "touch" and "sensor" to merge
+ *  only those motion events, e.g. "touch,sensor".
+ *
+ *  This hint can be changed at any time.
+ */
+#define SDL_HINT_EVENT_COALESCING   "SDL_EVENT_COALESCING"
+
 /**
  *  \brief  A variable controlling whether raising the window should be done more forcefully
  *
@@ -1064,6 +1100,25 @@ extern "C" {
   */
 #define SDL_HINT_LINUX_JOYSTICK_DEADZONES "SDL_LINUX_JOYSTICK_DEADZONES"
 
+/**
+ *  \brief  A variable controlling whether log messages are written from a background thread.
+ *
+ *  This variable can be set to the following values:
+ *    "0"       - Log messages are written by the thread that logs them (default)
+ *    "1"       - Log messages are queued and written by a background thread
+ *
+ *  When enabled, SDL_LogMessageV() formats the message into a fixed size
+ *  lock-free queue and returns without waiting for the log output function,
+ *  so logging from time critical threads doesn't block them. If the queue
+ *  is full the message is dropped; dropped messages are counted and reported
+ *  in the log. Queued messages are truncated to 255 characters. Critical
+ *  messages are always written synchronously, after the queue has been
+ *  flushed.
+ *
+ *  This hint is checked during SDL_Init and can not be changed after.
+ */
+#define SDL_HINT_LOG_ASYNC "SDL_LOG_ASYNC"
+
 /**
 *  \brief  When set don't force the SDL app to become a foreground process
 *
@@ -1688,6 +1743,21 @@ extern "C" {
  */
 #define SDL_HINT_VIDEO_MINIMIZE_ON_FOCUS_LOSS   "SDL_VIDEO_MINIMIZE_ON_FOCUS_LOSS"
 
+/**
+ *  \brief  A variable controlling whether large software blits and fills are split across threads.
+ *
+ *  This affects SDL_BlitSurface(), SDL_BlitScaled(), SDL_SoftStretch() and
+ *  SDL_FillRect(). The destination rectangle is split into bands of rows
+ *  that are processed in parallel, and the result is identical to running
+ *  on a single thread.
+ *
+ *  This variable can be set to the following values:
+ *    "0"       - Blits and fills run on the calling thread (default)
+ *    "1"       - Blits and fills of at least 512x512 pixels are split across threads
+ *    "N"       - Blits and fills of at least N destination pixels are split across threads
+ */
+#define SDL_HINT_VIDEO_PARALLEL_BLIT    "SDL_VIDEO_PARALLEL_BLIT"
+
 /**
  *  \brief  A variable controlling whether the libdecor Wayland backend is allowed to be used.
  *
@@ -2366,6 +2436,17 @@ extern "C" {
 #define SDL_HINT_KMSDRM_DEVICE_INDEX "SDL_KMSDRM_DEVICE_INDEX"
 
 
+/**
+ *  \brief  A variable naming a file to write a trace of the program to.
+ *
+ *  If this is set when SDL_Init is called, SDL starts recording a trace as
+ *  with SDL_StartTrace(), and SDL_Quit writes it to the named file in Chrome
+ *  JSON format.
+ *
+ *  This only has an effect if SDL was built with SDL_TRACE defined to 1.
+ */
+#define SDL_HINT_TRACE_FILE "SDL_TRACE_FILE"
+
 /**
  *  \brief  A variable that treats trackpads as touch devices.
  *
@@ -2499,6 +2580,83 @@ extern DECLSPEC const char * SDLCALL SDL_GetHint(const char *name);
  */
 extern DECLSPEC SDL_bool SDLCALL SDL_GetHintBoolean(const char *name, SDL_bool default_value);
 
+/**
+ * A cached lookup of a hint.
+ *
+ * Set `name` and zero the rest of the structure, for example:
+ *
+ * ```c
+ * static SDL_HintCache cache = { SDL_HINT_RENDER_SCALE_QUALITY, 0, NULL, SDL_FALSE, 0 };
+ * ```
+ *
+ * SDL_UpdateHintCache() then only looks the hint up again after some hint
+ * has changed, so the cache can be checked on every call of a performance
+ * critical path. A cache may be checked from several threads at once.
+ *
+ * \sa SDL_UpdateHintCache
+ */
+typedef struct SDL_HintCache
+{
+    const char *name;       /**< The name of the hint */
+    Uint32 generation;      /**< The hint generation the values were read at, 0 if never read */
+    const char *value;      /**< The value of the hint, or NULL if it isn't set */
+    SDL_bool boolean;       /**< The value as a boolean, if it's set */
+    int integer;            /**< The value as an integer, if it's set */
+} SDL_HintCache;
+
+/**
+ * Update a cached lookup of a hint.
+ *
+ * If any hint has been set or reset since the cache was last updated, this
+ * looks up the hint again and fills in the value fields of the cache.
+ * Otherwise it returns without doing anything, so callers can use the
+ * result to decide when to parse the hint into their own representation.
+ *
+ * Changes to the environment aren't noticed until a hint is set or reset.
+ *
+ * Like SDL_GetHint(), the returned value is only valid until the hint
+ * changes, which will also cause the next update to return SDL_TRUE.
+ *
+ * \param cache the cache to update
+ * \returns SDL_TRUE if the cache was updated, or SDL_FALSE if it was already
+ *          current.
+ *
+ * \since This function is available since SDL 2.26.5.
+ *
+ * \sa SDL_GetCachedHintBoolean
+ * \sa SDL_GetCachedHintInt
+ */
+extern DECLSPEC SDL_bool SDLCALL SDL_UpdateHintCache(SDL_HintCache *cache);
+
+/**
+ * Get the boolean value of a cached hint.
+ *
+ * \param cache the cache of the hint, updated as with SDL_UpdateHintCache()
+ * \param default_value the value to return if the hint isn't set
+ * \returns the boolean value of the hint or the provided default value if
+ *          the hint isn't set.
+ *
+ * \since This function is available since SDL 2.26.5.
+ *
+ * \sa SDL_UpdateHintCache
+ * \sa SDL_GetHintBoolean
+ */
+extern DECLSPEC SDL_bool SDLCALL SDL_GetCachedHintBoolean(SDL_HintCache *cache, SDL_bool default_value);
+
+/**
+ * Get the integer value of a cached hint.
+ *
+ * \param cache the cache of the hint, updated as with SDL_UpdateHintCache()
+ * \param default_value the value to return if the hint isn't set
+ * \returns the integer value of the hint or the provided default value if
+ *          the hint isn't set.
+ *
+ * \since This function is available since SDL 2.26.5.
+ *
+ * \sa SDL_UpdateHintCache
+ */
+extern DECLSPEC int SDLCALL SDL_GetCachedHintInt(SDL_HintCache *cache, int default_value);
+
 /**
  * Type definition of the hint callback function.
  *
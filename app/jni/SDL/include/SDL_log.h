@@ -392,6 +392,32 @@ extern DECLSPEC void SDLCALL SDL_LogGetOutputFunction(SDL_LogOutputFunction *cal
  */
 extern DECLSPEC void SDLCALL SDL_LogSetOutputFunction(SDL_LogOutputFunction callback, void *userdata);
 
+/**
+ * Wait until all queued log messages have been written.
+ *
+ * This only has an effect when log messages are written from a background
+ * thread, see SDL_HINT_LOG_ASYNC.
+ *
+ * \since This function is available since SDL 2.26.5.
+ *
+ * \sa SDL_LogGetDroppedMessages
+ */
+extern DECLSPEC void SDLCALL SDL_LogFlush(void);
+
+/**
+ * Get the number of log messages dropped because the log queue was full.
+ *
+ * Messages can only be dropped when they are written from a background
+ * thread, see SDL_HINT_LOG_ASYNC.
+ *
+ * \returns the number of messages dropped since SDL_Init() was called.
+ *
+ * \since This function is available since SDL 2.26.5.
+ *
+ * \sa SDL_LogFlush
+ */
+extern DECLSPEC Uint32 SDLCALL SDL_LogGetDroppedMessages(void);
+
 
 /* Ends C function definitions when using C++ */
 #ifdef __cplusplus
@@ -483,10 +483,105 @@ extern DECLSPEC int SDLCALL SDL_SetMemoryFunctions(SDL_malloc_func malloc_func,
  */
 extern DECLSPEC int SDLCALL SDL_GetNumAllocations(void);
 
+/**
+ * Allocation statistics for a size class, see SDL_GetAllocationStats()
+ */
+typedef struct SDL_AllocationStats
+{
+    size_t size;        /**< The largest allocation in this size class, or 0 for allocations that aren't cached */
+    Uint64 allocations; /**< The number of allocations made in this size class */
+    Uint64 frees;       /**< The number of allocations freed in this size class */
+    size_t reserved;    /**< The bytes of memory set aside for this size class */
+} SDL_AllocationStats;
+
+/**
+ * Get allocation statistics by size class
+ *
+ * Small allocations are served from per-thread caches of fixed size blocks,
+ * grouped in size classes. This reports how many allocations were made and
+ * freed in each class, and how much memory each class holds, followed by an
+ * entry for all the allocations that don't fit in a size class or were
+ * made after SDL_SetMemoryFunctions().
+ *
+ * Threads add their counts to the totals in batches, so the counts of
+ * other threads may lag behind by a few dozen allocations.
+ *
+ * \param stats an array filled in with the statistics of each size class,
+ *              may be NULL if `maxstats` is 0
+ * \param maxstats the number of entries that fit in `stats`
+ * \returns the number of size classes, which may be more than `maxstats`,
+ *          or a negative error code on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \since This function is available since SDL 2.26.5.
+ *
+ * \sa SDL_GetNumAllocations
+ */
+extern DECLSPEC int SDLCALL SDL_GetAllocationStats(SDL_AllocationStats *stats, int maxstats);
+
 extern DECLSPEC char *SDLCALL SDL_getenv(const char *name);
 extern DECLSPEC int SDLCALL SDL_setenv(const char *name, const char *value, int overwrite);
 
 extern DECLSPEC void SDLCALL SDL_qsort(void *base, size_t nmemb, size_t size, int (SDLCALL *compare) (const void *, const void *));
+
+/**
+ * Sort an array, using several threads for large arrays
+ *
+ * This sorts the same way as SDL_qsort(), but splits arrays of more than
+ * 64K elements into runs sorted on SDL's worker threads, which are then
+ * merged. It needs a temporary copy of the array, and falls back to
+ * SDL_qsort() if that can't be allocated.
+ *
+ * \param base the array to sort
+ * \param nmemb the number of elements in the array
+ * \param size the size of each element, in bytes
+ * \param compare a function that returns a negative value, 0 or a positive
+ *                value if its first argument is less than, equal to or
+ *                greater than the second. It must be safe to call from
+ *                several threads at once.
+ *
+ * \since This function is available since SDL 2.26.5.
+ *
+ * \sa SDL_qsort
+ */
+extern DECLSPEC void SDLCALL SDL_ParallelSort(void *base, size_t nmemb, size_t size, int (SDLCALL *compare) (const void *, const void *));
+
+/**
+ * Sort an array of records by a 32-bit unsigned key
+ *
+ * This is a stable radix sort, which is faster than SDL_qsort() for large
+ * arrays. It needs a temporary copy of the array.
+ *
+ * \param base the array to sort
+ * \param nmemb the number of records in the array
+ * \param size the size of each record, in bytes
+ * \param offset the offset of the Uint32 key within each record, in bytes,
+ *               which doesn't need to be aligned
+ * \returns 0 on success or a negative error code on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \since This function is available since SDL 2.26.5.
+ *
+ * \sa SDL_RadixSortU64
+ */
+extern DECLSPEC int SDLCALL SDL_RadixSortU32(void *base, size_t nmemb, size_t size, size_t offset);
+
+/**
+ * Sort an array of records by a 64-bit unsigned key
+ *
+ * \param base the array to sort
+ * \param nmemb the number of records in the array
+ * \param size the size of each record, in bytes
+ * \param offset the offset of the Uint64 key within each record, in bytes,
+ *               which doesn't need to be aligned
+ * \returns 0 on success or a negative error code on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \since This function is available since SDL 2.26.5.
+ *
+ * \sa SDL_RadixSortU32
+ */
+extern DECLSPEC int SDLCALL SDL_RadixSortU64(void *base, size_t nmemb, size_t size, size_t offset);
 extern DECLSPEC void * SDLCALL SDL_bsearch(const void *key, const void *base, size_t nmemb, size_t size, int (SDLCALL *compare) (const void *, const void *));
 
 extern DECLSPEC int SDLCALL SDL_abs(int x);
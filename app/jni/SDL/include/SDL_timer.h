@@ -146,6 +146,130 @@ extern DECLSPEC Uint64 SDLCALL SDL_GetPerformanceFrequency(void);
  */
 extern DECLSPEC void SDLCALL SDL_Delay(Uint32 ms);
 
+/**
+ * Wait a specified number of nanoseconds before returning.
+ *
+ * This function waits at least the specified time, but possibly longer due
+ * to OS scheduling. On platforms without a high resolution sleep, the delay
+ * is rounded up to whole milliseconds.
+ *
+ * To wait for a deadline more precisely than the OS scheduler allows, use a
+ * frame pacer.
+ *
+ * \param ns the number of nanoseconds to delay
+ *
+ * \since This function is available since SDL 2.26.5.
+ *
+ * \sa SDL_Delay
+ * \sa SDL_CreateFramePacer
+ */
+extern DECLSPEC void SDLCALL SDL_DelayNS(Uint64 ns);
+
+/**
+ * A frame pacer, used to wait for a regular series of deadlines.
+ *
+ * \sa SDL_CreateFramePacer
+ */
+typedef struct SDL_FramePacer SDL_FramePacer;
+
+/**
+ * Statistics of how closely a frame pacer met its deadlines.
+ *
+ * All times are in nanoseconds.
+ *
+ * \sa SDL_GetFramePacerStats
+ */
+typedef struct SDL_FramePacerStats
+{
+    Uint64 frames;          /**< Number of calls to SDL_FramePacerWait() */
+    Uint64 missed;          /**< Frames that arrived after their deadline */
+    Uint64 last_overshoot;  /**< Time past the deadline when the last wait returned */
+    Uint64 mean_overshoot;  /**< Average time past the deadline of waits */
+    Uint64 max_overshoot;   /**< Largest time past the deadline of waits */
+    Uint64 spin_margin;     /**< Time before a deadline currently spent spinning instead of sleeping */
+} SDL_FramePacerStats;
+
+/**
+ * Create a frame pacer.
+ *
+ * A frame pacer keeps a timeline of deadlines `interval` nanoseconds apart,
+ * and SDL_FramePacerWait() waits for the next one. It sleeps until shortly
+ * before the deadline and spins for the rest, calibrating how early to wake
+ * up from how much the OS oversleeps, so deadlines are usually met within
+ * tens of microseconds.
+ *
+ * If a frame arrives after its deadline, the timeline skips ahead to the
+ * next deadline rather than hurrying to catch up. If it arrives more than a
+ * second late, the timeline restarts.
+ *
+ * \param interval the time between deadlines, in nanoseconds
+ * \returns a new frame pacer or NULL on failure; call SDL_GetError() for
+ *          more information.
+ *
+ * \since This function is available since SDL 2.26.5.
+ *
+ * \sa SDL_FramePacerWait
+ * \sa SDL_DestroyFramePacer
+ */
+extern DECLSPEC SDL_FramePacer *SDLCALL SDL_CreateFramePacer(Uint64 interval);
+
+/**
+ * Change the time between deadlines of a frame pacer.
+ *
+ * The next deadline is `interval` after the last one, starting with the
+ * next call to SDL_FramePacerWait().
+ *
+ * \param pacer the frame pacer to change
+ * \param interval the time between deadlines, in nanoseconds
+ * \returns 0 on success or a negative error code on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \since This function is available since SDL 2.26.5.
+ */
+extern DECLSPEC int SDLCALL SDL_SetFramePacerInterval(SDL_FramePacer *pacer, Uint64 interval);
+
+/**
+ * Wait for the next deadline of a frame pacer.
+ *
+ * The first call returns immediately and starts the timeline.
+ *
+ * \param pacer the frame pacer to wait on
+ * \returns the number of nanoseconds past the deadline when the wait ended,
+ *          or 0 if the frame had already missed its deadline or there was
+ *          an error.
+ *
+ * \since This function is available since SDL 2.26.5.
+ *
+ * \sa SDL_CreateFramePacer
+ * \sa SDL_GetFramePacerStats
+ */
+extern DECLSPEC Uint64 SDLCALL SDL_FramePacerWait(SDL_FramePacer *pacer);
+
+/**
+ * Get statistics of how closely a frame pacer met its deadlines.
+ *
+ * \param pacer the frame pacer to query
+ * \param stats an SDL_FramePacerStats structure filled in with the
+ *              statistics
+ * \param reset SDL_TRUE to start collecting statistics over again
+ * \returns 0 on success or a negative error code on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \since This function is available since SDL 2.26.5.
+ */
+extern DECLSPEC int SDLCALL SDL_GetFramePacerStats(SDL_FramePacer *pacer, SDL_FramePacerStats *stats, SDL_bool reset);
+
+/**
+ * Destroy a frame pacer.
+ *
+ * \param pacer the frame pacer to destroy
+ *
+ * \since This function is available since SDL 2.26.5.
+ *
+ * \sa SDL_CreateFramePacer
+ */
+extern DECLSPEC void SDLCALL SDL_DestroyFramePacer(SDL_FramePacer *pacer);
+
 /**
  * Function prototype for the timer callback function.
  *
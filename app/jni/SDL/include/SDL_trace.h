@@ -0,0 +1,164 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2023 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+
+#ifndef SDL_trace_h_
+#define SDL_trace_h_
+
+/**
+ *  \file SDL_trace.h
+ *
+ *  Header for the SDL trace instrumentation.
+ *
+ *  SDL can record where time goes in a program as a timeline of zones,
+ *  counters and flow events, and write it as a Chrome JSON trace file that
+ *  can be opened in chrome://tracing or https://ui.perfetto.dev.
+ *
+ *  Recording is only built in when SDL is compiled with `SDL_TRACE`
+ *  defined to 1; otherwise SDL_StartTrace() fails and the SDL_TRACE_*
+ *  macros below compile to nothing. Define `SDL_TRACE` the same way when
+ *  compiling your own code to use the macros for your own zones.
+ */
+
+#include "SDL_stdinc.h"
+
+#include "begin_code.h"
+/* Set up for C function definitions, even when using C++ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Start recording a trace.
+ *
+ * Every thread records into its own buffer, so recording doesn't contend
+ * on a lock. If a thread records more than about a million events, later
+ * ones are dropped.
+ *
+ * If the SDL_HINT_TRACE_FILE hint is set when SDL_Init() is called, a trace
+ * is started automatically and written to that file by SDL_Quit().
+ *
+ * \returns 0 on success or a negative error code on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \since This function is available since SDL 2.26.5.
+ *
+ * \sa SDL_StopTrace
+ */
+extern DECLSPEC int SDLCALL SDL_StartTrace(void);
+
+/**
+ * Stop recording a trace and write it to a file.
+ *
+ * \param file the file to write the trace to in Chrome JSON format, or NULL
+ *             to discard it
+ * \returns 0 on success or a negative error code on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \since This function is available since SDL 2.26.5.
+ *
+ * \sa SDL_StartTrace
+ */
+extern DECLSPEC int SDLCALL SDL_StopTrace(const char *file);
+
+/**
+ * Begin a zone of time on the current thread.
+ *
+ * Zones nest, and each must be ended on the thread that began it.
+ *
+ * \param name the name of the zone, which must stay valid until the trace
+ *             is stopped, usually a string literal
+ *
+ * \since This function is available since SDL 2.26.5.
+ *
+ * \sa SDL_TraceEndZone
+ */
+extern DECLSPEC void SDLCALL SDL_TraceBeginZone(const char *name);
+
+/**
+ * End the zone most recently begun on the current thread.
+ *
+ * \since This function is available since SDL 2.26.5.
+ *
+ * \sa SDL_TraceBeginZone
+ */
+extern DECLSPEC void SDLCALL SDL_TraceEndZone(void);
+
+/**
+ * Record the value of a counter.
+ *
+ * \param name the name of the counter, which must stay valid until the
+ *             trace is stopped, usually a string literal
+ * \param value the current value of the counter
+ *
+ * \since This function is available since SDL 2.26.5.
+ */
+extern DECLSPEC void SDLCALL SDL_TraceCounter(const char *name, Sint64 value);
+
+/**
+ * Start a flow event, an arrow that connects the enclosing zone to the zone
+ * enclosing the matching SDL_TraceFlowEnd(), possibly on another thread.
+ *
+ * \param name the name of the flow, which must stay valid until the trace
+ *             is stopped, usually a string literal
+ * \param id an identifier that matches the start of a flow to its end
+ *
+ * \since This function is available since SDL 2.26.5.
+ *
+ * \sa SDL_TraceFlowEnd
+ */
+extern DECLSPEC void SDLCALL SDL_TraceFlowStart(const char *name, Uint64 id);
+
+/**
+ * End a flow event started with SDL_TraceFlowStart().
+ *
+ * \param name the name of the flow
+ * \param id the identifier passed to SDL_TraceFlowStart()
+ *
+ * \since This function is available since SDL 2.26.5.
+ *
+ * \sa SDL_TraceFlowStart
+ */
+extern DECLSPEC void SDLCALL SDL_TraceFlowEnd(const char *name, Uint64 id);
+
+#if defined(SDL_TRACE) && SDL_TRACE
+#define SDL_TRACE_ZONE_BEGIN(name)      SDL_TraceBeginZone(name)
+#define SDL_TRACE_ZONE_END()            SDL_TraceEndZone()
+#define SDL_TRACE_COUNTER(name, value)  SDL_TraceCounter(name, (Sint64)(value))
+#define SDL_TRACE_FLOW_START(name, id)  SDL_TraceFlowStart(name, (Uint64)(id))
+#define SDL_TRACE_FLOW_END(name, id)    SDL_TraceFlowEnd(name, (Uint64)(id))
+#else
+#define SDL_TRACE_ZONE_BEGIN(name)
+#define SDL_TRACE_ZONE_END()
+#define SDL_TRACE_COUNTER(name, value)
+#define SDL_TRACE_FLOW_START(name, id)
+#define SDL_TRACE_FLOW_END(name, id)
+#endif
+
+/* Ends C function definitions when using C++ */
+#ifdef __cplusplus
+}
+#endif
+#include "close_code.h"
+
+#endif /* SDL_trace_h_ */
+
+/* vi: set ts=4 sw=4 expandtab: */
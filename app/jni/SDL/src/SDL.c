@@ -48,10 +48,12 @@
 #include "SDL_revision.h"
 #include "SDL_assert_c.h"
 #include "SDL_log_c.h"
+#include "SDL_trace_c.h"
 #include "events/SDL_events_c.h"
 #include "haptic/SDL_haptic_c.h"
 #include "joystick/SDL_joystick_c.h"
 #include "sensor/SDL_sensor_c.h"
+#include "thread/SDL_parallel_c.h"
 
 /* Initialization/Cleanup routines */
 #if !SDL_TIMERS_DISABLED
@@ -180,6 +182,7 @@ SDL_InitSubSystem(Uint32 flags)
     }
 
     SDL_LogInit();
+    SDL_InitTrace();
 
     /* Clear the error message */
     SDL_ClearError();
@@ -492,6 +495,9 @@ SDL_Quit(void)
 #endif
     SDL_QuitSubSystem(SDL_INIT_EVERYTHING);
 
+    SDL_QuitParallel();
+    SDL_QuitTrace();
+
 #if !SDL_TIMERS_DISABLED
     SDL_TicksQuit();
 #endif
@@ -334,5 +334,370 @@ SDL_ReserveSpaceInDataQueue(SDL_DataQueue *queue, const size_t len)
     return packet->data;
 }
 
+/* Lock-free single producer/single consumer queue. */
+
+#define SDL_RINGQUEUE_MIN_SIZE 1024
+#define SDL_RINGQUEUE_MAX_SIZE (1u << 30)
+
+typedef struct SDL_RingQueueBuffer
+{
+    /* Only the producer writes these... */
+    SDL_atomic_t tail;  /* total bytes ever committed to this ring. */
+    Uint32 cached_head;  /* producer's last look at head. */
+    void *next;  /* ring the producer moved on to once this one filled up. */
+    Uint8 producer_pad[SDL_CACHELINE_SIZE];
+
+    /* ...and only the consumer writes these, so they get their own cache line. */
+    SDL_atomic_t head;  /* total bytes ever consumed from this ring. */
+    Uint32 cached_tail;  /* consumer's last look at tail. */
+    Uint8 consumer_pad[SDL_CACHELINE_SIZE];
+
+    Uint32 size;  /* always a power of two. */
+    Uint8 data[SDL_VARIABLE_LENGTH_ARRAY];  /* ring data */
+} SDL_RingQueueBuffer;
+
+struct SDL_RingQueue
+{
+    SDL_RingQueueBuffer *writer;  /* queue fills to here. */
+    Uint8 producer_pad[SDL_CACHELINE_SIZE];
+    SDL_RingQueueBuffer *reader;  /* queue is drained from here. */
+    Uint8 consumer_pad[SDL_CACHELINE_SIZE];
+    SDL_atomic_t queued_bytes;  /* number of bytes of data in the queue. */
+    Uint32 initial_size;  /* size of the first ring, to shrink back to on clear. */
+};
+
+static SDL_RingQueueBuffer *
+AllocateRingQueueBuffer(const size_t minsize)
+{
+    SDL_RingQueueBuffer *ring;
+    Uint32 size = SDL_RINGQUEUE_MIN_SIZE;
+
+    while ((size < minsize) && (size < SDL_RINGQUEUE_MAX_SIZE)) {
+        size <<= 1;
+    }
+
+    if (size < minsize) {
+        SDL_SetError("Can't queue more than %u bytes at once", (unsigned int) SDL_RINGQUEUE_MAX_SIZE);
+        return NULL;
+    }
+
+    ring = (SDL_RingQueueBuffer *) SDL_malloc(sizeof (SDL_RingQueueBuffer) + size);
+    if (!ring) {
+        SDL_OutOfMemory();
+        return NULL;
+    }
+
+    SDL_zerop(ring);
+    ring->size = size;
+    return ring;
+}
+
+static void
+SDL_FreeRingQueueList(SDL_RingQueueBuffer *ring)
+{
+    while (ring) {
+        SDL_RingQueueBuffer *next = (SDL_RingQueueBuffer *) ring->next;
+        SDL_free(ring);
+        ring = next;
+    }
+}
+
+/* The producer only rereads head when the ring looks too full, so the two
+   threads don't fight over the cache line on every write. */
+static Uint32
+RingQueueFreeSpace(SDL_RingQueueBuffer *ring, const Uint32 tail, const size_t want)
+{
+    Uint32 space = ring->size - (tail - ring->cached_head);
+    if (space < want) {
+        ring->cached_head = (Uint32) SDL_AtomicGet(&ring->head);
+        SDL_MemoryBarrierAcquire();
+        space = ring->size - (tail - ring->cached_head);
+    }
+    return space;
+}
+
+static void
+CopyIntoRingQueueBuffer(SDL_RingQueueBuffer *ring, const Uint32 pos, const Uint8 *data, const Uint32 len)
+{
+    const Uint32 offset = pos & (ring->size - 1);
+    const Uint32 cpy = SDL_min(len, ring->size - offset);
+    SDL_memcpy(ring->data + offset, data, cpy);
+    SDL_memcpy(ring->data, data + cpy, len - cpy);
+}
+
+SDL_RingQueue *
+SDL_NewRingQueue(const size_t initialsize)
+{
+    SDL_RingQueue *queue = (SDL_RingQueue *) SDL_malloc(sizeof (SDL_RingQueue));
+
+    if (!queue) {
+        SDL_OutOfMemory();
+        return NULL;
+    }
+
+    SDL_zerop(queue);
+    queue->writer = AllocateRingQueueBuffer(initialsize);
+    if (!queue->writer) {
+        SDL_free(queue);
+        return NULL;
+    }
+    queue->reader = queue->writer;
+    queue->initial_size = queue->writer->size;
+    return queue;
+}
+
+void
+SDL_FreeRingQueue(SDL_RingQueue *queue)
+{
+    if (queue) {
+        SDL_FreeRingQueueList(queue->reader);
+        SDL_free(queue);
+    }
+}
+
+void
+SDL_ClearRingQueue(SDL_RingQueue *queue)
+{
+    SDL_RingQueueBuffer *ring;
+
+    if (!queue) {
+        return;
+    }
+
+    /* Drop every ring but the newest... */
+    ring = queue->writer;
+    while (queue->reader != ring) {
+        SDL_RingQueueBuffer *next = (SDL_RingQueueBuffer *) queue->reader->next;
+        SDL_free(queue->reader);
+        queue->reader = next;
+    }
+
+    /* ...and if the queue grew, go back to a small ring, so one big burst of
+       data doesn't pin that much memory for good. If that fails, keep this one. */
+    if (ring->size > queue->initial_size) {
+        SDL_RingQueueBuffer *smaller = AllocateRingQueueBuffer(queue->initial_size);
+        if (smaller) {
+            SDL_free(ring);
+            ring = smaller;
+        }
+    }
+
+    SDL_AtomicSet(&ring->tail, 0);
+    SDL_AtomicSet(&ring->head, 0);
+    ring->cached_head = 0;
+    ring->cached_tail = 0;
+    queue->writer = queue->reader = ring;
+    SDL_AtomicSet(&queue->queued_bytes, 0);
+}
+
+int
+SDL_WriteToRingQueue(SDL_RingQueue *queue, const void *_data, const size_t len)
+{
+    const Uint8 *data = (const Uint8 *) _data;
+    SDL_RingQueueBuffer *ring;
+    SDL_RingQueueBuffer *next = NULL;
+    Uint32 tail, space, cpy;
+
+    if (!queue) {
+        return SDL_InvalidParamError("queue");
+    }
+
+    ring = queue->writer;
+    tail = (Uint32) SDL_AtomicGet(&ring->tail);
+    space = RingQueueFreeSpace(ring, tail, len);
+    cpy = (Uint32) SDL_min(len, space);
+
+    if (cpy < len) {
+        /* Fill in the next ring before touching this one, so that running
+           out of memory leaves the queue as it was. Rings stop doubling at
+           the maximum size, but the rest of the data must still fit. */
+        next = AllocateRingQueueBuffer(SDL_max(len - cpy, SDL_min((size_t) ring->size * 2, (size_t) SDL_RINGQUEUE_MAX_SIZE)));
+        if (!next) {
+            return -1;
+        }
+        CopyIntoRingQueueBuffer(next, 0, data + cpy, (Uint32) (len - cpy));
+        SDL_AtomicSet(&next->tail, (int) (len - cpy));
+    }
+
+    /* Count it first, so the consumer never takes the count below zero. */
+    SDL_AtomicAdd(&queue->queued_bytes, (int) len);
+
+    /* SDL_AtomicSet() and SDL_AtomicSetPtr() are only acquire barriers, so
+       make sure the data lands before the consumer can see it. */
+    if (cpy > 0) {
+        CopyIntoRingQueueBuffer(ring, tail, data, cpy);
+        SDL_MemoryBarrierRelease();
+        SDL_AtomicSet(&ring->tail, (int) (tail + cpy));
+    }
+
+    if (next) {
+        SDL_MemoryBarrierRelease();
+        SDL_AtomicSetPtr(&ring->next, next);
+        queue->writer = next;
+    }
+
+    return 0;
+}
+
+void *
+SDL_ReserveSpaceInRingQueue(SDL_RingQueue *queue, size_t *len)
+{
+    SDL_RingQueueBuffer *ring;
+    Uint32 tail, offset, avail;
+
+    if (!queue) {
+        SDL_InvalidParamError("queue");
+        return NULL;
+    } else if (!len || (*len == 0)) {
+        SDL_InvalidParamError("len");
+        return NULL;
+    }
+
+    ring = queue->writer;
+    tail = (Uint32) SDL_AtomicGet(&ring->tail);
+    avail = RingQueueFreeSpace(ring, tail, *len);
+
+    if (avail == 0) {
+        /* Full, move on to a bigger ring. The consumer follows once it has
+           drained this one. */
+        SDL_RingQueueBuffer *next = AllocateRingQueueBuffer(SDL_min(SDL_max(*len, (size_t) ring->size * 2), SDL_RINGQUEUE_MAX_SIZE));
+        if (!next) {
+            return NULL;
+        }
+        SDL_MemoryBarrierRelease();
+        SDL_AtomicSetPtr(&ring->next, next);
+        queue->writer = ring = next;
+        tail = 0;
+        avail = ring->size;
+    }
+
+    offset = tail & (ring->size - 1);
+    avail = SDL_min(avail, ring->size - offset);
+    *len = SDL_min(*len, avail);
+    return ring->data + offset;
+}
+
+void
+SDL_CommitToRingQueue(SDL_RingQueue *queue, const size_t len)
+{
+    if (queue && (len > 0)) {
+        SDL_RingQueueBuffer *ring = queue->writer;
+        const Uint32 tail = (Uint32) SDL_AtomicGet(&ring->tail);
+        SDL_assert(len <= (ring->size - (tail - ring->cached_head)));
+        SDL_AtomicAdd(&queue->queued_bytes, (int) len);
+        SDL_MemoryBarrierRelease();
+        SDL_AtomicSet(&ring->tail, (int) (tail + len));
+    }
+}
+
+/* Returns the ring to read from, freeing any the producer has moved past. */
+static SDL_RingQueueBuffer *
+RingQueueReadable(SDL_RingQueue *queue, Uint32 *head, Uint32 *avail)
+{
+    SDL_RingQueueBuffer *ring = queue->reader;
+
+    for (;;) {
+        SDL_RingQueueBuffer *next;
+
+        *head = (Uint32) SDL_AtomicGet(&ring->head);
+        if (ring->cached_tail == *head) {
+            ring->cached_tail = (Uint32) SDL_AtomicGet(&ring->tail);
+            SDL_MemoryBarrierAcquire();
+        }
+
+        *avail = ring->cached_tail - *head;
+        if (*avail > 0) {
+            return ring;
+        }
+
+        next = (SDL_RingQueueBuffer *) SDL_AtomicGetPtr(&ring->next);
+        if (!next) {
+            return ring;
+        }
+
+        /* The producer stopped writing here before linking the next ring,
+           but it might have committed more since we looked at tail. */
+        ring->cached_tail = (Uint32) SDL_AtomicGet(&ring->tail);
+        SDL_MemoryBarrierAcquire();
+        if (ring->cached_tail == *head) {
+            queue->reader = next;
+            SDL_free(ring);
+            ring = next;
+        }
+    }
+}
+
+const void *
+SDL_PeekRingQueue(SDL_RingQueue *queue, size_t *len)
+{
+    SDL_RingQueueBuffer *ring;
+    Uint32 head, avail, offset;
+
+    if (!len) {
+        SDL_InvalidParamError("len");
+        return NULL;
+    }
+
+    *len = 0;
+    if (!queue) {
+        return NULL;
+    }
+
+    ring = RingQueueReadable(queue, &head, &avail);
+    if (avail == 0) {
+        return NULL;
+    }
+
+    offset = head & (ring->size - 1);
+    *len = SDL_min(avail, ring->size - offset);
+    return ring->data + offset;
+}
+
+void
+SDL_ConsumeFromRingQueue(SDL_RingQueue *queue, const size_t len)
+{
+    if (queue && (len > 0)) {
+        SDL_RingQueueBuffer *ring = queue->reader;
+        const Uint32 head = (Uint32) SDL_AtomicGet(&ring->head);
+        SDL_assert(len <= (ring->cached_tail - head));
+        SDL_MemoryBarrierRelease();  /* finish reading before the producer can reuse the space. */
+        SDL_AtomicSet(&ring->head, (int) (head + len));
+        SDL_AtomicAdd(&queue->queued_bytes, -((int) len));
+    }
+}
+
+size_t
+SDL_ReadFromRingQueue(SDL_RingQueue *queue, void *_buf, const size_t _len)
+{
+    size_t len = _len;
+    Uint8 *buf = (Uint8 *) _buf;
+    Uint8 *ptr = buf;
+
+    while (len > 0) {
+        size_t avail;
+        const Uint8 *data = (const Uint8 *) SDL_PeekRingQueue(queue, &avail);
+        size_t cpy;
+
+        if (!data) {
+            break;
+        }
+
+        cpy = SDL_min(len, avail);
+        SDL_memcpy(ptr, data, cpy);
+        SDL_ConsumeFromRingQueue(queue, cpy);
+        ptr += cpy;
+        len -= cpy;
+    }
+
+    return (size_t) (ptr - buf);
+}
+
+size_t
+SDL_CountRingQueue(SDL_RingQueue *queue)
+{
+    const int queued = queue ? SDL_AtomicGet(&queue->queued_bytes) : 0;
+    return (queued > 0) ? (size_t) queued : 0;
+}
+
 /* vi: set ts=4 sw=4 expandtab: */
 
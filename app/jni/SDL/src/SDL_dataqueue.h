@@ -49,6 +49,43 @@ size_t SDL_CountDataQueue(SDL_DataQueue *queue);
 */
 void *SDL_ReserveSpaceInDataQueue(SDL_DataQueue *queue, const size_t len);
 
+/* A variant of SDL_DataQueue for one producer thread and one consumer thread,
+   which don't need to lock anything to use it at the same time. Data goes
+   into a ring buffer; when that fills up, a bigger ring is chained after it
+   and the consumer moves over once it has drained the old one, so like
+   SDL_DataQueue there's no limit to how much can be queued.
+
+   SDL_WriteToRingQueue(), SDL_ReserveSpaceInRingQueue() and
+   SDL_CommitToRingQueue() may only be called by the producer, and
+   SDL_ReadFromRingQueue(), SDL_PeekRingQueue() and SDL_ConsumeFromRingQueue()
+   only by the consumer. SDL_CountRingQueue() is safe from any thread.
+   SDL_ClearRingQueue() and SDL_FreeRingQueue() need both sides stopped. */
+
+struct SDL_RingQueue;
+typedef struct SDL_RingQueue SDL_RingQueue;
+
+SDL_RingQueue *SDL_NewRingQueue(const size_t initialsize);
+void SDL_FreeRingQueue(SDL_RingQueue *queue);
+void SDL_ClearRingQueue(SDL_RingQueue *queue);
+int SDL_WriteToRingQueue(SDL_RingQueue *queue, const void *data, const size_t len);
+size_t SDL_ReadFromRingQueue(SDL_RingQueue *queue, void *buf, const size_t len);
+size_t SDL_CountRingQueue(SDL_RingQueue *queue);
+
+/* Returns a pointer to contiguous free space in the ring, and sets (*len) to
+   how much of it, between 1 and the (*len) passed in, may be written. Nothing
+   is visible to the consumer until SDL_CommitToRingQueue() is called with the
+   number of bytes actually written. Returns NULL on error. */
+void *SDL_ReserveSpaceInRingQueue(SDL_RingQueue *queue, size_t *len);
+void SDL_CommitToRingQueue(SDL_RingQueue *queue, const size_t len);
+
+/* Returns a pointer to the oldest queued data without copying it, and sets
+   (*len) to how many contiguous bytes are there, which may be less than
+   SDL_CountRingQueue() when the data wraps around. Returns NULL, with (*len)
+   set to zero, if the queue is empty. The data stays valid until
+   SDL_ConsumeFromRingQueue() drops it from the queue. */
+const void *SDL_PeekRingQueue(SDL_RingQueue *queue, size_t *len);
+void SDL_ConsumeFromRingQueue(SDL_RingQueue *queue, const size_t len);
+
 #endif /* SDL_dataqueue_h_ */
 
 /* vi: set ts=4 sw=4 expandtab: */
@@ -21,12 +21,24 @@
 #include "./SDL_internal.h"
 
 #include "SDL_hints.h"
+#include "SDL_atomic.h"
 #include "SDL_error.h"
 #include "SDL_hints_c.h"
 
 
-/* Assuming there aren't many hints set and they aren't being queried in
-   critical performance paths, we'll just use linked lists here.
+/* Hints are kept in a hash table keyed by name, so looking one up doesn't
+   compare strings against every hint that has been set or watched. Each
+   name is stored once, in the same allocation as its hint entry, and entries
+   are only freed by SDL_ClearHints().
+
+   Hints are read without a lock, often from other threads than the one
+   setting them, so the table is open addressed and only ever gains entries.
+   When it fills up, a bigger copy is built on the side and published in its
+   place. The old table stays valid for anyone still probing it, and is only
+   freed by SDL_ClearHints().
+
+   Every change to a hint value bumps a generation counter, which lets an
+   SDL_HintCache skip the lookup entirely until something changes.
  */
 typedef struct SDL_HintWatch {
     SDL_HintCallback callback;
@@ -35,20 +47,170 @@ typedef struct SDL_HintWatch {
 } SDL_HintWatch;
 
 typedef struct SDL_Hint {
-    char *name;
+    const char *name;
+    Uint32 hash;
     char *value;
     SDL_HintPriority priority;
     SDL_HintWatch *callbacks;
-    struct SDL_Hint *next;
 } SDL_Hint;
 
-static SDL_Hint *SDL_hints;
+typedef struct SDL_HintTable {
+    Uint32 size;        /* a power of two, at least twice the hint count */
+    SDL_Hint **hints;   /* probed linearly from the hash */
+    struct SDL_HintTable *retired;  /* the table this one replaced */
+} SDL_HintTable;
+
+#define SDL_HINT_TABLE_MIN_SIZE 64
+
+static void *SDL_hint_table;    /* the current SDL_HintTable */
+static Uint32 SDL_hints_count;
+static SDL_atomic_t SDL_hint_generation = { 1 };
+
+static Uint32
+SDL_HashHintName(const char *name)
+{
+    /* FNV-1a */
+    Uint32 hash = 2166136261u;
+    while (*name) {
+        hash ^= (Uint8)*name++;
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+static SDL_HintTable *
+SDL_GetHintTable(void)
+{
+    SDL_HintTable *table = (SDL_HintTable *)SDL_AtomicGetPtr(&SDL_hint_table);
+
+    SDL_MemoryBarrierAcquire();
+    return table;
+}
+
+static SDL_Hint *
+SDL_FindHint(const char *name, Uint32 hash)
+{
+    SDL_HintTable *table = SDL_GetHintTable();
+    SDL_Hint *hint;
+    Uint32 i;
+
+    if (!table) {
+        return NULL;
+    }
+    for (i = hash & (table->size - 1); ; i = (i + 1) & (table->size - 1)) {
+        hint = (SDL_Hint *)SDL_AtomicGetPtr((void **)&table->hints[i]);
+        if (!hint) {
+            return NULL;
+        }
+        SDL_MemoryBarrierAcquire();
+        if (hint->hash == hash && SDL_strcmp(name, hint->name) == 0) {
+            return hint;
+        }
+    }
+}
+
+/* Add a hint to a table with room for it, which readers may be probing */
+static void
+SDL_InsertHint(SDL_HintTable *table, SDL_Hint *hint)
+{
+    Uint32 i = hint->hash & (table->size - 1);
+
+    while (table->hints[i]) {
+        i = (i + 1) & (table->size - 1);
+    }
+    SDL_MemoryBarrierRelease();
+    SDL_AtomicSetPtr((void **)&table->hints[i], hint);
+}
+
+static SDL_Hint *
+SDL_CreateHint(const char *name, Uint32 hash)
+{
+    size_t namelen = SDL_strlen(name) + 1;
+    SDL_HintTable *table = SDL_GetHintTable();
+    SDL_Hint *hint;
+
+    if (!table || (SDL_hints_count + 1) * 2 > table->size) {
+        const Uint32 size = table ? table->size * 2 : SDL_HINT_TABLE_MIN_SIZE;
+        SDL_HintTable *grown = (SDL_HintTable *)SDL_calloc(1, sizeof(*grown) + size * sizeof(SDL_Hint *));
+        Uint32 i;
+
+        if (!grown) {
+            SDL_OutOfMemory();
+            return NULL;
+        }
+        grown->size = size;
+        grown->hints = (SDL_Hint **)(grown + 1);
+        grown->retired = table;
+        if (table) {
+            for (i = 0; i < table->size; ++i) {
+                if (table->hints[i]) {
+                    SDL_InsertHint(grown, table->hints[i]);
+                }
+            }
+        }
+        SDL_MemoryBarrierRelease();
+        SDL_AtomicSetPtr(&SDL_hint_table, grown);
+        table = grown;
+    }
+
+    hint = (SDL_Hint *)SDL_malloc(sizeof(*hint) + namelen);
+    if (!hint) {
+        SDL_OutOfMemory();
+        return NULL;
+    }
+    SDL_memcpy(hint + 1, name, namelen);
+    hint->name = (const char *)(hint + 1);
+    hint->hash = hash;
+    hint->value = NULL;
+    hint->priority = SDL_HINT_DEFAULT;
+    hint->callbacks = NULL;
+    SDL_InsertHint(table, hint);
+    ++SDL_hints_count;
+    return hint;
+}
+
+static void
+SDL_HintsChanged(void)
+{
+    /* Generation 0 is reserved for caches that haven't been filled yet */
+    if (SDL_AtomicIncRef(&SDL_hint_generation) == -1) {
+        SDL_AtomicIncRef(&SDL_hint_generation);
+    }
+}
+
+static SDL_bool
+SDL_HintValuesDiffer(const char *a, const char *b)
+{
+    return (a != b && (!a || !b || SDL_strcmp(a, b) != 0)) ? SDL_TRUE : SDL_FALSE;
+}
+
+static void
+SDL_ResetHintEntry(SDL_Hint *hint, const char *env)
+{
+    SDL_HintWatch *entry;
+
+    if (SDL_HintValuesDiffer(env, hint->value)) {
+        for (entry = hint->callbacks; entry; ) {
+            /* Save the next entry in case this one is deleted */
+            SDL_HintWatch *next = entry->next;
+            entry->callback(entry->userdata, hint->name, hint->value, env);
+            entry = next;
+        }
+    }
+    if (hint->value || hint->priority != SDL_HINT_DEFAULT) {
+        SDL_free(hint->value);
+        hint->value = NULL;
+        hint->priority = SDL_HINT_DEFAULT;
+        SDL_HintsChanged();
+    }
+}
 
 SDL_bool
 SDL_SetHintWithPriority(const char *name, const char *value,
                         SDL_HintPriority priority)
 {
     const char *env;
+    Uint32 hash;
     SDL_Hint *hint;
     SDL_HintWatch *entry;
 
@@ -61,96 +223,74 @@ SDL_SetHintWithPriority(const char *name, const char *value,
         return SDL_FALSE;
     }
 
-    for (hint = SDL_hints; hint; hint = hint->next) {
-        if (SDL_strcmp(name, hint->name) == 0) {
-            if (priority < hint->priority) {
-                return SDL_FALSE;
-            }
-            if (hint->value != value &&
-                (!value || !hint->value || SDL_strcmp(hint->value, value) != 0)) {
-                for (entry = hint->callbacks; entry; ) {
-                    /* Save the next entry in case this one is deleted */
-                    SDL_HintWatch *next = entry->next;
-                    entry->callback(entry->userdata, name, hint->value, value);
-                    entry = next;
-                }
-                SDL_free(hint->value);
-                hint->value = value ? SDL_strdup(value) : NULL;
+    hash = SDL_HashHintName(name);
+    hint = SDL_FindHint(name, hash);
+    if (hint) {
+        if (priority < hint->priority) {
+            return SDL_FALSE;
+        }
+        if (SDL_HintValuesDiffer(hint->value, value)) {
+            char *old_value = hint->value;
+
+            for (entry = hint->callbacks; entry; ) {
+                /* Save the next entry in case this one is deleted */
+                SDL_HintWatch *next = entry->next;
+                entry->callback(entry->userdata, name, old_value, value);
+                entry = next;
             }
-            hint->priority = priority;
-            return SDL_TRUE;
+            hint->value = value ? SDL_strdup(value) : NULL;
+            SDL_free(old_value);
+            SDL_HintsChanged();
+        } else if (priority != hint->priority) {
+            SDL_HintsChanged();
         }
+        hint->priority = priority;
+        return SDL_TRUE;
     }
 
     /* Couldn't find the hint, add a new one */
-    hint = (SDL_Hint *)SDL_malloc(sizeof(*hint));
+    hint = SDL_CreateHint(name, hash);
     if (!hint) {
         return SDL_FALSE;
     }
-    hint->name = SDL_strdup(name);
     hint->value = value ? SDL_strdup(value) : NULL;
     hint->priority = priority;
-    hint->callbacks = NULL;
-    hint->next = SDL_hints;
-    SDL_hints = hint;
+    SDL_HintsChanged();
     return SDL_TRUE;
 }
 
 SDL_bool
 SDL_ResetHint(const char *name)
 {
-    const char *env;
     SDL_Hint *hint;
-    SDL_HintWatch *entry;
 
     if (!name) {
         return SDL_FALSE;
     }
 
-    env = SDL_getenv(name);
-    for (hint = SDL_hints; hint; hint = hint->next) {
-        if (SDL_strcmp(name, hint->name) == 0) {
-            if ((env == NULL && hint->value != NULL) ||
-                (env != NULL && hint->value == NULL) ||
-                (env != NULL && SDL_strcmp(env, hint->value) != 0)) {
-                for (entry = hint->callbacks; entry; ) {
-                    /* Save the next entry in case this one is deleted */
-                    SDL_HintWatch *next = entry->next;
-                    entry->callback(entry->userdata, name, hint->value, env);
-                    entry = next;
-                }
-            }
-            SDL_free(hint->value);
-            hint->value = NULL;
-            hint->priority = SDL_HINT_DEFAULT;
-            return SDL_TRUE;
-        }
+    hint = SDL_FindHint(name, SDL_HashHintName(name));
+    if (!hint) {
+        return SDL_FALSE;
     }
-    return SDL_FALSE;
+    SDL_ResetHintEntry(hint, SDL_getenv(name));
+    return SDL_TRUE;
 }
 
 void
 SDL_ResetHints(void)
 {
-    const char *env;
-    SDL_Hint *hint;
-    SDL_HintWatch *entry;
+    SDL_HintTable *table = SDL_GetHintTable();
+    Uint32 i;
 
-    for (hint = SDL_hints; hint; hint = hint->next) {
-        env = SDL_getenv(hint->name);
-        if ((env == NULL && hint->value != NULL) ||
-            (env != NULL && hint->value == NULL) ||
-            (env != NULL && SDL_strcmp(env, hint->value) != 0)) {
-            for (entry = hint->callbacks; entry; ) {
-                /* Save the next entry in case this one is deleted */
-                SDL_HintWatch *next = entry->next;
-                entry->callback(entry->userdata, hint->name, hint->value, env);
-                entry = next;
-            }
+    if (!table) {
+        return;
+    }
+    for (i = 0; i < table->size; ++i) {
+        SDL_Hint *hint = table->hints[i];
+
+        if (hint) {
+            SDL_ResetHintEntry(hint, SDL_getenv(hint->name));
         }
-        SDL_free(hint->value);
-        hint->value = NULL;
-        hint->priority = SDL_HINT_DEFAULT;
     }
 }
 
@@ -167,13 +307,9 @@ SDL_GetHint(const char *name)
     SDL_Hint *hint;
 
     env = SDL_getenv(name);
-    for (hint = SDL_hints; hint; hint = hint->next) {
-        if (SDL_strcmp(name, hint->name) == 0) {
-            if (env == NULL || hint->priority == SDL_HINT_OVERRIDE) {
-                return hint->value;
-            }
-            break;
-        }
+    hint = SDL_FindHint(name, SDL_HashHintName(name));
+    if (hint && (env == NULL || hint->priority == SDL_HINT_OVERRIDE)) {
+        return hint->value;
     }
     return env;
 }
@@ -197,9 +333,60 @@ SDL_GetHintBoolean(const char *name, SDL_bool default_value)
     return SDL_GetStringBoolean(hint, default_value);
 }
 
+SDL_bool
+SDL_UpdateHintCache(SDL_HintCache *cache)
+{
+    Uint32 generation;
+
+    if (!cache) {
+        SDL_InvalidParamError("cache");
+        return SDL_FALSE;
+    }
+
+    /* Caches are usually static and checked from any thread, so the values
+       are filled in before the generation that says they are current */
+    generation = (Uint32)SDL_AtomicGet(&SDL_hint_generation);
+    if (cache->generation == generation) {
+        SDL_MemoryBarrierAcquire();
+        return SDL_FALSE;
+    }
+    cache->value = cache->name ? SDL_GetHint(cache->name) : NULL;
+    if (cache->value && *cache->value) {
+        cache->boolean = SDL_GetStringBoolean(cache->value, SDL_FALSE);
+        cache->integer = SDL_atoi(cache->value);
+    } else {
+        cache->boolean = SDL_FALSE;
+        cache->integer = 0;
+    }
+    SDL_MemoryBarrierRelease();
+    cache->generation = generation;
+    return SDL_TRUE;
+}
+
+SDL_bool
+SDL_GetCachedHintBoolean(SDL_HintCache *cache, SDL_bool default_value)
+{
+    SDL_UpdateHintCache(cache);
+    if (!cache || !cache->value || !*cache->value) {
+        return default_value;
+    }
+    return cache->boolean;
+}
+
+int
+SDL_GetCachedHintInt(SDL_HintCache *cache, int default_value)
+{
+    SDL_UpdateHintCache(cache);
+    if (!cache || !cache->value || !*cache->value) {
+        return default_value;
+    }
+    return cache->integer;
+}
+
 void
 SDL_AddHintCallback(const char *name, SDL_HintCallback callback, void *userdata)
 {
+    Uint32 hash;
     SDL_Hint *hint;
     SDL_HintWatch *entry;
     const char *value;
@@ -223,31 +410,15 @@ SDL_AddHintCallback(const char *name, SDL_HintCallback callback, void *userdata)
     entry->callback = callback;
     entry->userdata = userdata;
 
-    for (hint = SDL_hints; hint; hint = hint->next) {
-        if (SDL_strcmp(name, hint->name) == 0) {
-            break;
-        }
-    }
+    hash = SDL_HashHintName(name);
+    hint = SDL_FindHint(name, hash);
     if (!hint) {
         /* Need to add a hint entry for this watcher */
-        hint = (SDL_Hint *)SDL_malloc(sizeof(*hint));
+        hint = SDL_CreateHint(name, hash);
         if (!hint) {
-            SDL_OutOfMemory();
             SDL_free(entry);
             return;
         }
-        hint->name = SDL_strdup(name);
-        if (!hint->name) {
-            SDL_free(entry);
-            SDL_free(hint);
-            SDL_OutOfMemory();
-            return;
-        }
-        hint->value = NULL;
-        hint->priority = SDL_HINT_DEFAULT;
-        hint->callbacks = NULL;
-        hint->next = SDL_hints;
-        SDL_hints = hint;
     }
 
     /* Add it to the callbacks for this hint */
@@ -265,44 +436,60 @@ SDL_DelHintCallback(const char *name, SDL_HintCallback callback, void *userdata)
     SDL_Hint *hint;
     SDL_HintWatch *entry, *prev;
 
-    for (hint = SDL_hints; hint; hint = hint->next) {
-        if (SDL_strcmp(name, hint->name) == 0) {
-            prev = NULL;
-            for (entry = hint->callbacks; entry; entry = entry->next) {
-                if (callback == entry->callback && userdata == entry->userdata) {
-                    if (prev) {
-                        prev->next = entry->next;
-                    } else {
-                        hint->callbacks = entry->next;
-                    }
-                    SDL_free(entry);
-                    break;
-                }
-                prev = entry;
+    if (!name) {
+        return;
+    }
+
+    hint = SDL_FindHint(name, SDL_HashHintName(name));
+    if (!hint) {
+        return;
+    }
+
+    prev = NULL;
+    for (entry = hint->callbacks; entry; entry = entry->next) {
+        if (callback == entry->callback && userdata == entry->userdata) {
+            if (prev) {
+                prev->next = entry->next;
+            } else {
+                hint->callbacks = entry->next;
             }
-            return;
+            SDL_free(entry);
+            break;
         }
+        prev = entry;
     }
 }
 
 void SDL_ClearHints(void)
 {
-    SDL_Hint *hint;
+    SDL_HintTable *table = SDL_GetHintTable();
     SDL_HintWatch *entry;
+    Uint32 i;
 
-    while (SDL_hints) {
-        hint = SDL_hints;
-        SDL_hints = hint->next;
+    SDL_AtomicSetPtr(&SDL_hint_table, NULL);
+    SDL_hints_count = 0;
 
-        SDL_free(hint->name);
-        SDL_free(hint->value);
-        for (entry = hint->callbacks; entry; ) {
-            SDL_HintWatch *freeable = entry;
-            entry = entry->next;
-            SDL_free(freeable);
+    if (table) {
+        for (i = 0; i < table->size; ++i) {
+            SDL_Hint *hint = table->hints[i];
+
+            if (hint) {
+                SDL_free(hint->value);
+                for (entry = hint->callbacks; entry; ) {
+                    SDL_HintWatch *freeable = entry;
+                    entry = entry->next;
+                    SDL_free(freeable);
+                }
+                SDL_free(hint);
+            }
         }
-        SDL_free(hint);
     }
+    while (table) {
+        SDL_HintTable *retired = table->retired;
+        SDL_free(table);
+        table = retired;
+    }
+    SDL_HintsChanged();
 }
 
 /* vi: set ts=4 sw=4 expandtab: */
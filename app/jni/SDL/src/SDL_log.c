@@ -26,10 +26,14 @@
 
 /* Simple log messages in SDL */
 
+#include "SDL_atomic.h"
 #include "SDL_error.h"
+#include "SDL_hints.h"
 #include "SDL_log.h"
 #include "SDL_mutex.h"
+#include "SDL_timer.h"
 #include "SDL_log_c.h"
+#include "thread/SDL_systhread.h"
 
 #if HAVE_STDIO_H
 #include <stdio.h>
@@ -105,6 +109,282 @@ static int SDL_android_priority[SDL_NUM_LOG_PRIORITIES] = {
 };
 #endif /* __ANDROID__ */
 
+static SDL_atomic_t SDL_log_dropped;
+
+#if !SDL_THREADS_DISABLED
+/* With SDL_HINT_LOG_ASYNC, messages are formatted by the thread that logs
+   them into a bounded multi-producer queue, and written by a background
+   thread. Producers never block: each claims a slot with a CAS on the head
+   position and drops the message if the queue is full. Each slot's sequence
+   number says whether it's free for the producer at a given position or
+   holds a message for the consumer, as in Dmitry Vyukov's bounded queue.
+   Messages that don't fit in a slot are truncated, so queueing a message
+   never allocates memory.
+ */
+#define SDL_LOG_QUEUE_SIZE 256  /* must be a power of two */
+
+typedef struct SDL_LogQueueEntry
+{
+    SDL_atomic_t sequence;
+    int category;
+    SDL_LogPriority priority;
+    char message[SDL_MAX_LOG_MESSAGE_STACK];
+} SDL_LogQueueEntry;
+
+static SDL_LogQueueEntry *SDL_log_queue;
+static SDL_atomic_t SDL_log_queue_head;
+static SDL_atomic_t SDL_log_queue_tail;
+static SDL_atomic_t SDL_log_queue_users;
+static SDL_atomic_t SDL_log_queue_active;
+static SDL_atomic_t SDL_log_thread_sleeping;
+static SDL_atomic_t SDL_log_thread_quit;
+static SDL_sem *SDL_log_thread_sem;
+static SDL_atomic_t SDL_log_flush_waiters;
+static SDL_mutex *SDL_log_flush_lock;
+static SDL_cond *SDL_log_flush_cond;
+static SDL_Thread *SDL_log_thread;
+static SDL_threadID SDL_log_thread_id;
+static int SDL_log_dropped_reported;
+
+static void SDL_LogWrite(int category, SDL_LogPriority priority, const char *message);
+
+static SDL_bool
+SDL_LogQueueReady(void)
+{
+    int tail = SDL_AtomicGet(&SDL_log_queue_tail);
+    SDL_LogQueueEntry *entry = &SDL_log_queue[tail & (SDL_LOG_QUEUE_SIZE - 1)];
+
+    return (SDL_AtomicGet(&entry->sequence) == (int)((Uint32)tail + 1)) ? SDL_TRUE : SDL_FALSE;
+}
+
+static SDL_bool
+SDL_LogDequeue(void)
+{
+    int tail = SDL_AtomicGet(&SDL_log_queue_tail);
+    SDL_LogQueueEntry *entry = &SDL_log_queue[tail & (SDL_LOG_QUEUE_SIZE - 1)];
+
+    if (!SDL_LogQueueReady()) {
+        return SDL_FALSE;
+    }
+
+    SDL_LogWrite(entry->category, entry->priority, entry->message);
+
+    /* Hand the slot back to producers for its next trip around the queue.
+       SDL_AtomicSet() is only an acquire exchange with GCC atomics, so the
+       barrier keeps our reads of the slot ahead of it. The tail is advanced
+       with a full barrier so that it's visible before we look for waiters in
+       SDL_LogFlush(). */
+    SDL_MemoryBarrierRelease();
+    SDL_AtomicSet(&entry->sequence, (int)((Uint32)tail + SDL_LOG_QUEUE_SIZE));
+    SDL_AtomicAdd(&SDL_log_queue_tail, 1);
+    return SDL_TRUE;
+}
+
+static void
+SDL_LogReportDropped(void)
+{
+    int dropped = SDL_AtomicGet(&SDL_log_dropped);
+
+    if (dropped != SDL_log_dropped_reported) {
+        char message[64];
+
+        SDL_snprintf(message, sizeof(message), "%u log messages dropped, the log queue was full",
+                     (unsigned int)(dropped - SDL_log_dropped_reported));
+        SDL_log_dropped_reported = dropped;
+        SDL_LogWrite(SDL_LOG_CATEGORY_SYSTEM, SDL_LOG_PRIORITY_WARN, message);
+    }
+}
+
+static int SDLCALL
+SDL_LogThread(void *unused)
+{
+    for (;;) {
+        while (SDL_LogDequeue()) {
+        }
+        SDL_LogReportDropped();
+
+        /* Let SDL_LogFlush() know how far we got. It checks the tail after
+           saying it's waiting, with the lock held until it waits. */
+        if (SDL_AtomicGet(&SDL_log_flush_waiters) > 0) {
+            SDL_LockMutex(SDL_log_flush_lock);
+            SDL_CondBroadcast(SDL_log_flush_cond);
+            SDL_UnlockMutex(SDL_log_flush_lock);
+        }
+
+        if (SDL_AtomicGet(&SDL_log_thread_quit)) {
+            break;
+        }
+
+        /* Producers only signal the semaphore if we say we're sleeping, so
+           check the queue again after saying so in case we missed one. The
+           CAS is a full barrier, so the check can't move ahead of it. */
+        SDL_AtomicCAS(&SDL_log_thread_sleeping, 0, 1);
+        if (SDL_LogQueueReady() || SDL_AtomicGet(&SDL_log_thread_quit)) {
+            SDL_AtomicSet(&SDL_log_thread_sleeping, 0);
+            continue;
+        }
+        SDL_SemWait(SDL_log_thread_sem);
+    }
+    return 0;
+}
+
+static void
+SDL_LogWakeThread(void)
+{
+    if (SDL_AtomicCAS(&SDL_log_thread_sleeping, 1, 0)) {
+        SDL_SemPost(SDL_log_thread_sem);
+    }
+}
+
+static void
+SDL_LogStartQueue(void)
+{
+    int i;
+
+    if (SDL_log_thread) {
+        return;
+    }
+
+    SDL_log_queue = (SDL_LogQueueEntry *)SDL_calloc(SDL_LOG_QUEUE_SIZE, sizeof(*SDL_log_queue));
+    SDL_log_thread_sem = SDL_CreateSemaphore(0);
+    SDL_log_flush_lock = SDL_CreateMutex();
+    SDL_log_flush_cond = SDL_CreateCond();
+    if (!SDL_log_queue || !SDL_log_thread_sem || !SDL_log_flush_lock || !SDL_log_flush_cond) {
+        goto error;
+    }
+    for (i = 0; i < SDL_LOG_QUEUE_SIZE; ++i) {
+        SDL_AtomicSet(&SDL_log_queue[i].sequence, i);
+    }
+    SDL_AtomicSet(&SDL_log_queue_head, 0);
+    SDL_AtomicSet(&SDL_log_queue_tail, 0);
+    SDL_AtomicSet(&SDL_log_thread_sleeping, 0);
+    SDL_AtomicSet(&SDL_log_thread_quit, 0);
+    SDL_AtomicSet(&SDL_log_flush_waiters, 0);
+    SDL_log_dropped_reported = SDL_AtomicGet(&SDL_log_dropped);
+
+    SDL_log_thread = SDL_CreateThreadInternal(SDL_LogThread, "SDLLog", 0, NULL);
+    if (!SDL_log_thread) {
+        goto error;
+    }
+    SDL_log_thread_id = SDL_GetThreadID(SDL_log_thread);
+    SDL_AtomicSet(&SDL_log_queue_active, 1);
+    return;
+
+error:
+    /* We'll just keep writing messages synchronously */
+    if (SDL_log_thread_sem) {
+        SDL_DestroySemaphore(SDL_log_thread_sem);
+        SDL_log_thread_sem = NULL;
+    }
+    if (SDL_log_flush_lock) {
+        SDL_DestroyMutex(SDL_log_flush_lock);
+        SDL_log_flush_lock = NULL;
+    }
+    if (SDL_log_flush_cond) {
+        SDL_DestroyCond(SDL_log_flush_cond);
+        SDL_log_flush_cond = NULL;
+    }
+    SDL_free(SDL_log_queue);
+    SDL_log_queue = NULL;
+}
+
+static void
+SDL_LogStopQueue(void)
+{
+    if (!SDL_log_thread) {
+        return;
+    }
+
+    /* Stop new messages from being queued, and wait for the producers that
+       are already using the queue to finish with it. */
+    SDL_AtomicSet(&SDL_log_queue_active, 0);
+    while (SDL_AtomicGet(&SDL_log_queue_users) > 0) {
+        SDL_Delay(0);
+    }
+
+    SDL_AtomicSet(&SDL_log_thread_quit, 1);
+    SDL_SemPost(SDL_log_thread_sem);
+    SDL_WaitThread(SDL_log_thread, NULL);
+    SDL_log_thread = NULL;
+    SDL_log_thread_id = 0;
+
+    SDL_DestroySemaphore(SDL_log_thread_sem);
+    SDL_log_thread_sem = NULL;
+    SDL_DestroyMutex(SDL_log_flush_lock);
+    SDL_log_flush_lock = NULL;
+    SDL_DestroyCond(SDL_log_flush_cond);
+    SDL_log_flush_cond = NULL;
+    SDL_free(SDL_log_queue);
+    SDL_log_queue = NULL;
+}
+
+/* Returns SDL_FALSE if the message should be written synchronously */
+static SDL_bool
+SDL_LogEnqueueV(int category, SDL_LogPriority priority, const char *fmt, va_list ap)
+{
+    SDL_LogQueueEntry *entry;
+    int head, len;
+    va_list aq;
+
+    if (!SDL_AtomicGet(&SDL_log_queue_active) || SDL_ThreadID() == SDL_log_thread_id) {
+        return SDL_FALSE;
+    }
+    SDL_AtomicIncRef(&SDL_log_queue_users);
+    if (!SDL_AtomicGet(&SDL_log_queue_active)) {
+        (void)SDL_AtomicDecRef(&SDL_log_queue_users);
+        return SDL_FALSE;
+    }
+
+    head = SDL_AtomicGet(&SDL_log_queue_head);
+    for (;;) {
+        int sequence;
+
+        entry = &SDL_log_queue[head & (SDL_LOG_QUEUE_SIZE - 1)];
+        sequence = SDL_AtomicGet(&entry->sequence);
+        if (sequence == head) {
+            if (SDL_AtomicCAS(&SDL_log_queue_head, head, (int)((Uint32)head + 1))) {
+                break;
+            }
+        } else if ((int)((Uint32)sequence - (Uint32)head) < 0) {
+            /* The consumer hasn't freed this slot yet, the queue is full */
+            SDL_AtomicIncRef(&SDL_log_dropped);
+            (void)SDL_AtomicDecRef(&SDL_log_queue_users);
+            SDL_LogWakeThread();
+            return SDL_TRUE;
+        }
+        head = SDL_AtomicGet(&SDL_log_queue_head);
+    }
+
+    entry->category = category;
+    entry->priority = priority;
+
+    va_copy(aq, ap);
+    len = SDL_vsnprintf(entry->message, sizeof(entry->message), fmt, aq);
+    va_end(aq);
+    if (len < 0) {
+        len = 0;
+        entry->message[0] = '\0';
+    } else if (len >= (int)sizeof(entry->message)) {
+        len = (int)sizeof(entry->message) - 1;
+    }
+
+    /* Chop off final endline. */
+    if ((len > 0) && (entry->message[len-1] == '\n')) {
+        entry->message[--len] = '\0';
+        if ((len > 0) && (entry->message[len-1] == '\r')) {  /* catch "\r\n", too. */
+            entry->message[--len] = '\0';
+        }
+    }
+
+    /* Publish the message to the consumer */
+    SDL_MemoryBarrierRelease();
+    SDL_AtomicSet(&entry->sequence, (int)((Uint32)head + 1));
+    (void)SDL_AtomicDecRef(&SDL_log_queue_users);
+    SDL_LogWakeThread();
+    return SDL_TRUE;
+}
+#endif /* !SDL_THREADS_DISABLED */
+
 void
 SDL_LogInit(void)
 {
@@ -112,11 +392,20 @@ SDL_LogInit(void)
         /* if this fails we'll try to continue without it. */
         log_function_mutex = SDL_CreateMutex();
     }
+
+#if !SDL_THREADS_DISABLED
+    if (SDL_GetHintBoolean(SDL_HINT_LOG_ASYNC, SDL_FALSE)) {
+        SDL_LogStartQueue();
+    }
+#endif
 }
 
 void
 SDL_LogQuit(void)
 {
+#if !SDL_THREADS_DISABLED
+    SDL_LogStopQueue();
+#endif
     SDL_LogResetPriorities();
     if (log_function_mutex) {
         SDL_DestroyMutex(log_function_mutex);
@@ -124,6 +413,42 @@ SDL_LogQuit(void)
     }
 }
 
+void
+SDL_LogFlush(void)
+{
+#if !SDL_THREADS_DISABLED
+    int head;
+
+    if (!SDL_AtomicGet(&SDL_log_queue_active) || SDL_ThreadID() == SDL_log_thread_id) {
+        return;
+    }
+    /* Keep SDL_LogStopQueue() from tearing the queue down while we wait */
+    SDL_AtomicIncRef(&SDL_log_queue_users);
+    if (!SDL_AtomicGet(&SDL_log_queue_active)) {
+        (void)SDL_AtomicDecRef(&SDL_log_queue_users);
+        return;
+    }
+
+    /* Wait for the consumer to get past everything queued so far */
+    head = SDL_AtomicGet(&SDL_log_queue_head);
+    SDL_AtomicIncRef(&SDL_log_flush_waiters);
+    SDL_LockMutex(SDL_log_flush_lock);
+    while ((int)((Uint32)SDL_AtomicGet(&SDL_log_queue_tail) - (Uint32)head) < 0) {
+        SDL_LogWakeThread();
+        SDL_CondWait(SDL_log_flush_cond, SDL_log_flush_lock);
+    }
+    SDL_UnlockMutex(SDL_log_flush_lock);
+    (void)SDL_AtomicDecRef(&SDL_log_flush_waiters);
+    (void)SDL_AtomicDecRef(&SDL_log_queue_users);
+#endif
+}
+
+Uint32
+SDL_LogGetDroppedMessages(void)
+{
+    return (Uint32)SDL_AtomicGet(&SDL_log_dropped);
+}
+
 void
 SDL_LogSetAllPriority(SDL_LogPriority priority)
 {
@@ -292,6 +617,22 @@ GetCategoryPrefix(int category)
 }
 #endif /* __ANDROID__ */
 
+static void
+SDL_LogWrite(int category, SDL_LogPriority priority, const char *message)
+{
+    if (log_function_mutex) {
+        SDL_LockMutex(log_function_mutex);
+    }
+
+    if (SDL_log_function) {
+        SDL_log_function(SDL_log_userdata, category, priority, message);
+    }
+
+    if (log_function_mutex) {
+        SDL_UnlockMutex(log_function_mutex);
+    }
+}
+
 void
 SDL_LogMessageV(int category, SDL_LogPriority priority, const char *fmt, va_list ap)
 {
@@ -321,6 +662,17 @@ SDL_LogMessageV(int category, SDL_LogPriority priority, const char *fmt, va_list
         log_function_mutex = SDL_CreateMutex();
     }
 
+#if !SDL_THREADS_DISABLED
+    if (priority < SDL_LOG_PRIORITY_CRITICAL) {
+        if (SDL_LogEnqueueV(category, priority, fmt, ap)) {
+            return;
+        }
+    } else {
+        /* Make sure everything before a critical message has been written */
+        SDL_LogFlush();
+    }
+#endif
+
     /* Render into stack buffer */
     va_copy(aq, ap);
     len = SDL_vsnprintf(stack_buf, sizeof(stack_buf), fmt, aq);
@@ -350,15 +702,7 @@ SDL_LogMessageV(int category, SDL_LogPriority priority, const char *fmt, va_list
         }
     }
 
-    if (log_function_mutex) {
-        SDL_LockMutex(log_function_mutex);
-    }
-
-    SDL_log_function(SDL_log_userdata, category, priority, message);
-
-    if (log_function_mutex) {
-        SDL_UnlockMutex(log_function_mutex);
-    }
+    SDL_LogWrite(category, priority, message);
 
     /* Free only if dynamically allocated */
     if (message != stack_buf) {
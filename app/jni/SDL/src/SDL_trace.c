@@ -0,0 +1,522 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2023 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "./SDL_internal.h"
+
+#include "SDL_error.h"
+#include "SDL_trace.h"
+#include "SDL_trace_c.h"
+
+#if SDL_TRACE
+
+#include "SDL_atomic.h"
+#include "SDL_hints.h"
+#include "SDL_rwops.h"
+#include "SDL_thread.h"
+#include "SDL_timer.h"
+
+/* Each thread records events into its own list of chunks, found through
+   thread local storage, so recording only touches memory owned by the
+   thread. Chunks are kept and reused across traces; a buffer left over
+   from an earlier trace is reset by its thread the first time it records
+   into the new one.
+ */
+#define SDL_TRACE_CHUNK_EVENTS  4096
+#define SDL_TRACE_MAX_CHUNKS    256
+
+typedef enum
+{
+    SDL_TRACE_EVENT_BEGIN,
+    SDL_TRACE_EVENT_END,
+    SDL_TRACE_EVENT_COUNTER,
+    SDL_TRACE_EVENT_FLOW_START,
+    SDL_TRACE_EVENT_FLOW_END
+} SDL_TraceEventType;
+
+typedef struct SDL_TraceEvent
+{
+    Uint64 timestamp;
+    const char *name;
+    Uint64 value;
+    SDL_TraceEventType type;
+} SDL_TraceEvent;
+
+typedef struct SDL_TraceChunk
+{
+    SDL_TraceEvent events[SDL_TRACE_CHUNK_EVENTS];
+    SDL_atomic_t count;
+    struct SDL_TraceChunk *next;
+} SDL_TraceChunk;
+
+typedef struct SDL_TraceBuffer
+{
+    SDL_threadID thread;
+    int index;
+    int session;
+    int num_chunks;
+    SDL_TraceChunk *chunks;
+    SDL_TraceChunk *current;
+    SDL_atomic_t dropped;
+    struct SDL_TraceBuffer *next;
+} SDL_TraceBuffer;
+
+static SDL_bool SDL_trace_active;
+static int SDL_trace_session;
+static Uint64 SDL_trace_start;
+static SDL_TLSID SDL_trace_tls;
+static SDL_SpinLock SDL_trace_lock;
+static SDL_TraceBuffer *SDL_trace_buffers;
+static int SDL_trace_num_buffers;
+static char *SDL_trace_file;
+
+static SDL_TraceBuffer *
+SDL_GetTraceBuffer(void)
+{
+    SDL_TraceBuffer *buffer = (SDL_TraceBuffer *)SDL_TLSGet(SDL_trace_tls);
+
+    if (!buffer) {
+        buffer = (SDL_TraceBuffer *)SDL_calloc(1, sizeof(*buffer));
+        if (!buffer) {
+            return NULL;
+        }
+        buffer->thread = SDL_ThreadID();
+        buffer->session = SDL_trace_session;
+        if (SDL_TLSSet(SDL_trace_tls, buffer, NULL) < 0) {
+            SDL_free(buffer);
+            return NULL;
+        }
+        SDL_AtomicLock(&SDL_trace_lock);
+        buffer->index = ++SDL_trace_num_buffers;
+        buffer->next = SDL_trace_buffers;
+        SDL_trace_buffers = buffer;
+        SDL_AtomicUnlock(&SDL_trace_lock);
+    } else if (buffer->session != SDL_trace_session) {
+        SDL_TraceChunk *chunk;
+
+        for (chunk = buffer->chunks; chunk; chunk = chunk->next) {
+            SDL_AtomicSet(&chunk->count, 0);
+        }
+        buffer->current = buffer->chunks;
+        SDL_AtomicSet(&buffer->dropped, 0);
+        buffer->session = SDL_trace_session;
+    }
+    return buffer;
+}
+
+static void
+SDL_TraceRecord(SDL_TraceEventType type, const char *name, Uint64 value)
+{
+    SDL_TraceBuffer *buffer = SDL_GetTraceBuffer();
+    SDL_TraceChunk *chunk;
+    SDL_TraceEvent *event;
+    int count;
+
+    if (!buffer) {
+        return;
+    }
+
+    chunk = buffer->current;
+    if (!chunk || SDL_AtomicGet(&chunk->count) == SDL_TRACE_CHUNK_EVENTS) {
+        if (chunk && chunk->next) {
+            chunk = chunk->next;
+        } else if (buffer->num_chunks < SDL_TRACE_MAX_CHUNKS &&
+                   (chunk = (SDL_TraceChunk *)SDL_malloc(sizeof(*chunk))) != NULL) {
+            SDL_AtomicSet(&chunk->count, 0);
+            chunk->next = NULL;
+            SDL_MemoryBarrierRelease();
+            if (buffer->current) {
+                buffer->current->next = chunk;
+            } else {
+                buffer->chunks = chunk;
+            }
+            ++buffer->num_chunks;
+        } else {
+            SDL_AtomicIncRef(&buffer->dropped);
+            return;
+        }
+        buffer->current = chunk;
+    }
+
+    count = SDL_AtomicGet(&chunk->count);
+    event = &chunk->events[count];
+    event->timestamp = SDL_GetPerformanceCounter();
+    event->name = name;
+    event->value = value;
+    event->type = type;
+    SDL_AtomicSet(&chunk->count, count + 1);
+}
+
+int
+SDL_StartTrace(void)
+{
+    if (SDL_trace_active) {
+        return SDL_SetError("A trace is already being recorded");
+    }
+
+    if (!SDL_trace_tls) {
+        SDL_trace_tls = SDL_TLSCreate();
+        if (!SDL_trace_tls) {
+            return -1;
+        }
+    }
+    ++SDL_trace_session;
+    SDL_trace_start = SDL_GetPerformanceCounter();
+    SDL_MemoryBarrierRelease();
+    SDL_trace_active = SDL_TRUE;
+    return 0;
+}
+
+typedef struct SDL_TraceWriter
+{
+    SDL_RWops *file;
+    size_t used;
+    SDL_bool failed;
+    char buffer[4096];
+} SDL_TraceWriter;
+
+static void
+SDL_TraceFlushWriter(SDL_TraceWriter *writer)
+{
+    if (writer->used > 0 && !writer->failed) {
+        if (SDL_RWwrite(writer->file, writer->buffer, 1, writer->used) != writer->used) {
+            writer->failed = SDL_TRUE;
+        }
+    }
+    writer->used = 0;
+}
+
+static void
+SDL_TraceWrite(SDL_TraceWriter *writer, const char *text)
+{
+    while (*text) {
+        if (writer->used == sizeof(writer->buffer)) {
+            SDL_TraceFlushWriter(writer);
+        }
+        writer->buffer[writer->used++] = *text++;
+    }
+}
+
+static void
+SDL_TraceWriteString(SDL_TraceWriter *writer, const char *text)
+{
+    char escaped[8];
+
+    SDL_TraceWrite(writer, "\"");
+    for (; *text; ++text) {
+        if (*text == '"' || *text == '\\') {
+            escaped[0] = '\\';
+            escaped[1] = *text;
+            escaped[2] = '\0';
+        } else if ((unsigned char)*text < 0x20) {
+            SDL_snprintf(escaped, sizeof(escaped), "\\u%.4x", (unsigned int)(unsigned char)*text);
+        } else {
+            escaped[0] = *text;
+            escaped[1] = '\0';
+        }
+        SDL_TraceWrite(writer, escaped);
+    }
+    SDL_TraceWrite(writer, "\"");
+}
+
+static void
+SDL_TraceWriteEvent(SDL_TraceWriter *writer, SDL_TraceBuffer *buffer, const char *phase,
+                    const char *name, Uint64 timestamp, const char *extra)
+{
+    char text[192];
+    const Uint64 elapsed = timestamp - SDL_trace_start;
+    const Uint64 frequency = SDL_GetPerformanceFrequency();
+    const Uint64 seconds = elapsed / frequency;
+    const Uint64 nanoseconds = ((elapsed % frequency) * 1000000000) / frequency;
+
+    SDL_TraceWrite(writer, ",\n{\"ph\":\"");
+    SDL_TraceWrite(writer, phase);
+    SDL_TraceWrite(writer, "\"");
+    if (name) {
+        SDL_TraceWrite(writer, ",\"name\":");
+        SDL_TraceWriteString(writer, name);
+    }
+    SDL_snprintf(text, sizeof(text), ",\"cat\":\"SDL\",\"pid\":1,\"tid\":%d,\"ts\":%" SDL_PRIu64 ".%03u%s}",
+                 buffer->index,
+                 seconds * 1000000 + nanoseconds / 1000, (unsigned int)(nanoseconds % 1000),
+                 extra ? extra : "");
+    SDL_TraceWrite(writer, text);
+}
+
+static int
+SDL_WriteTrace(const char *file, Uint64 end)
+{
+    SDL_TraceWriter *writer;
+    SDL_TraceBuffer *buffer;
+    char extra[128];
+    int retval = 0;
+
+    writer = (SDL_TraceWriter *)SDL_malloc(sizeof(*writer));
+    if (!writer) {
+        return SDL_OutOfMemory();
+    }
+    writer->file = SDL_RWFromFile(file, "wb");
+    if (!writer->file) {
+        SDL_free(writer);
+        return -1;
+    }
+    writer->used = 0;
+    writer->failed = SDL_FALSE;
+
+    SDL_TraceWrite(writer, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n"
+                           "{\"ph\":\"M\",\"name\":\"process_name\",\"pid\":1,\"args\":{\"name\":\"SDL\"}}");
+
+    SDL_AtomicLock(&SDL_trace_lock);
+    for (buffer = SDL_trace_buffers; buffer; buffer = buffer->next) {
+        SDL_TraceChunk *chunk;
+        Uint64 last = SDL_trace_start;
+        int depth = 0;
+        int i, count;
+
+        if (buffer->session != SDL_trace_session) {
+            continue;
+        }
+
+        SDL_snprintf(extra, sizeof(extra), ",\n{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":1,\"tid\":%d,", buffer->index);
+        SDL_TraceWrite(writer, extra);
+        SDL_snprintf(extra, sizeof(extra), "\"args\":{\"name\":\"thread %lu\"}}", (unsigned long)buffer->thread);
+        SDL_TraceWrite(writer, extra);
+
+        SDL_MemoryBarrierAcquire();
+        for (chunk = buffer->chunks; chunk; chunk = chunk->next) {
+            count = SDL_AtomicGet(&chunk->count);
+            SDL_MemoryBarrierAcquire();
+            for (i = 0; i < count; ++i) {
+                const SDL_TraceEvent *event = &chunk->events[i];
+
+                last = event->timestamp;
+                switch (event->type) {
+                case SDL_TRACE_EVENT_BEGIN:
+                    ++depth;
+                    SDL_TraceWriteEvent(writer, buffer, "B", event->name, event->timestamp, NULL);
+                    break;
+                case SDL_TRACE_EVENT_END:
+                    /* Skip the ends of zones begun before the trace started */
+                    if (depth > 0) {
+                        --depth;
+                        SDL_TraceWriteEvent(writer, buffer, "E", NULL, event->timestamp, NULL);
+                    }
+                    break;
+                case SDL_TRACE_EVENT_COUNTER:
+                    SDL_snprintf(extra, sizeof(extra), ",\"args\":{\"value\":%" SDL_PRIs64 "}", (Sint64)event->value);
+                    SDL_TraceWriteEvent(writer, buffer, "C", event->name, event->timestamp, extra);
+                    break;
+                case SDL_TRACE_EVENT_FLOW_START:
+                    SDL_snprintf(extra, sizeof(extra), ",\"id\":%" SDL_PRIu64, event->value);
+                    SDL_TraceWriteEvent(writer, buffer, "s", event->name, event->timestamp, extra);
+                    break;
+                case SDL_TRACE_EVENT_FLOW_END:
+                    SDL_snprintf(extra, sizeof(extra), ",\"id\":%" SDL_PRIu64 ",\"bp\":\"e\"", event->value);
+                    SDL_TraceWriteEvent(writer, buffer, "f", event->name, event->timestamp, extra);
+                    break;
+                }
+            }
+            if (count < SDL_TRACE_CHUNK_EVENTS) {
+                break;
+            }
+        }
+
+        /* Close zones that were still open when the trace stopped */
+        if (last < end) {
+            last = end;
+        }
+        while (depth-- > 0) {
+            SDL_TraceWriteEvent(writer, buffer, "E", NULL, last, NULL);
+        }
+
+        if (SDL_AtomicGet(&buffer->dropped) > 0) {
+            SDL_snprintf(extra, sizeof(extra), ",\"s\":\"t\",\"args\":{\"dropped\":%d}", SDL_AtomicGet(&buffer->dropped));
+            SDL_TraceWriteEvent(writer, buffer, "i", "trace buffer full", last, extra);
+        }
+    }
+    SDL_AtomicUnlock(&SDL_trace_lock);
+
+    SDL_TraceWrite(writer, "\n]}\n");
+    SDL_TraceFlushWriter(writer);
+    if (writer->failed) {
+        retval = SDL_SetError("Couldn't write trace to %s", file);
+    }
+    if (SDL_RWclose(writer->file) < 0) {
+        retval = -1;
+    }
+    SDL_free(writer);
+    return retval;
+}
+
+int
+SDL_StopTrace(const char *file)
+{
+    if (!SDL_trace_active) {
+        return SDL_SetError("A trace isn't being recorded");
+    }
+
+    SDL_trace_active = SDL_FALSE;
+    SDL_MemoryBarrierRelease();
+
+    if (file) {
+        return SDL_WriteTrace(file, SDL_GetPerformanceCounter());
+    }
+    return 0;
+}
+
+void
+SDL_TraceBeginZone(const char *name)
+{
+    if (SDL_trace_active) {
+        SDL_TraceRecord(SDL_TRACE_EVENT_BEGIN, name, 0);
+    }
+}
+
+void
+SDL_TraceEndZone(void)
+{
+    if (SDL_trace_active) {
+        SDL_TraceRecord(SDL_TRACE_EVENT_END, NULL, 0);
+    }
+}
+
+void
+SDL_TraceCounter(const char *name, Sint64 value)
+{
+    if (SDL_trace_active) {
+        SDL_TraceRecord(SDL_TRACE_EVENT_COUNTER, name, (Uint64)value);
+    }
+}
+
+void
+SDL_TraceFlowStart(const char *name, Uint64 id)
+{
+    if (SDL_trace_active) {
+        SDL_TraceRecord(SDL_TRACE_EVENT_FLOW_START, name, id);
+    }
+}
+
+void
+SDL_TraceFlowEnd(const char *name, Uint64 id)
+{
+    if (SDL_trace_active) {
+        SDL_TraceRecord(SDL_TRACE_EVENT_FLOW_END, name, id);
+    }
+}
+
+void
+SDL_InitTrace(void)
+{
+    const char *file = SDL_GetHint(SDL_HINT_TRACE_FILE);
+
+    if (file && *file && !SDL_trace_active && !SDL_trace_file) {
+        SDL_trace_file = SDL_strdup(file);
+        if (SDL_trace_file && SDL_StartTrace() < 0) {
+            SDL_free(SDL_trace_file);
+            SDL_trace_file = NULL;
+        }
+    }
+}
+
+void
+SDL_QuitTrace(void)
+{
+    SDL_TraceBuffer *buffer;
+
+    if (SDL_trace_file) {
+        if (SDL_trace_active) {
+            SDL_StopTrace(SDL_trace_file);
+        }
+        SDL_free(SDL_trace_file);
+        SDL_trace_file = NULL;
+    }
+    if (SDL_trace_active) {
+        SDL_StopTrace(NULL);
+    }
+
+    /* Threads still hold their old buffers in thread local storage, so
+       use new storage for the next trace */
+    SDL_AtomicLock(&SDL_trace_lock);
+    while (SDL_trace_buffers) {
+        buffer = SDL_trace_buffers;
+        SDL_trace_buffers = buffer->next;
+        while (buffer->chunks) {
+            SDL_TraceChunk *chunk = buffer->chunks;
+            buffer->chunks = chunk->next;
+            SDL_free(chunk);
+        }
+        SDL_free(buffer);
+    }
+    SDL_trace_num_buffers = 0;
+    SDL_trace_tls = 0;
+    SDL_AtomicUnlock(&SDL_trace_lock);
+}
+
+#else
+
+int
+SDL_StartTrace(void)
+{
+    return SDL_SetError("SDL not built with trace support");
+}
+
+int
+SDL_StopTrace(const char *file)
+{
+    return SDL_SetError("SDL not built with trace support");
+}
+
+void
+SDL_TraceBeginZone(const char *name)
+{
+}
+
+void
+SDL_TraceEndZone(void)
+{
+}
+
+void
+SDL_TraceCounter(const char *name, Sint64 value)
+{
+}
+
+void
+SDL_TraceFlowStart(const char *name, Uint64 id)
+{
+}
+
+void
+SDL_TraceFlowEnd(const char *name, Uint64 id)
+{
+}
+
+void
+SDL_InitTrace(void)
+{
+}
+
+void
+SDL_QuitTrace(void)
+{
+}
+
+#endif /* SDL_TRACE */
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -21,6 +21,18 @@
 #include "../SDL_internal.h"
 
 #include "SDL_atomic.h"
+#include "SDL_error.h"
+#include "SDL_mutex.h"
+
+#if defined(__LINUX__) || defined(__ANDROID__)
+#include <errno.h>
+#include <limits.h>
+#include <time.h>
+#include <unistd.h>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#define HAVE_FUTEX 1
+#endif
 
 #if defined(_MSC_VER) && (_MSC_VER >= 1500)
 #include <intrin.h>
@@ -295,6 +307,181 @@ SDL_AtomicGetPtr(void **a)
 #endif
 }
 
+#if HAVE_FUTEX
+
+static int
+SDL_Futex(SDL_atomic_t *a, int op, int value, const struct timespec *timeout)
+{
+    return (int)syscall(SYS_futex, &a->value, op | FUTEX_PRIVATE_FLAG, value, timeout, NULL, 0);
+}
+
+int
+SDL_AtomicWaitTimeout(SDL_atomic_t *a, int value, Uint32 ms)
+{
+    struct timespec timeout;
+
+    if (!a) {
+        return SDL_InvalidParamError("a");
+    }
+
+    if (ms != SDL_MUTEX_MAXWAIT) {
+        timeout.tv_sec = ms / 1000;
+        timeout.tv_nsec = (long)(ms % 1000) * 1000000;
+    }
+    if (SDL_Futex(a, FUTEX_WAIT, value, (ms != SDL_MUTEX_MAXWAIT) ? &timeout : NULL) < 0) {
+        switch (errno) {
+        case EAGAIN:  /* the value had already changed */
+        case EINTR:
+            break;
+        case ETIMEDOUT:
+            return SDL_MUTEX_TIMEDOUT;
+        default:
+            return SDL_SetError("futex() failed");
+        }
+    }
+    return 0;
+}
+
+void
+SDL_AtomicWake(SDL_atomic_t *a)
+{
+    if (a) {
+        SDL_Futex(a, FUTEX_WAKE, 1, NULL);
+    }
+}
+
+void
+SDL_AtomicWakeAll(SDL_atomic_t *a)
+{
+    if (a) {
+        SDL_Futex(a, FUTEX_WAKE, INT_MAX, NULL);
+    }
+}
+
+#elif !SDL_THREADS_DISABLED
+
+/* Without futexes, waiters sleep on a condition variable picked by the
+   address they wait on. Unrelated addresses can share one, so wakes are
+   always broadcast. The locks are created on first use and live for the
+   rest of the program.
+ */
+#define SDL_ATOMIC_WAIT_BUCKETS 64
+
+typedef struct SDL_AtomicWaitBucket
+{
+    SDL_mutex *lock;
+    SDL_cond *cond;
+} SDL_AtomicWaitBucket;
+
+static SDL_AtomicWaitBucket SDL_atomic_wait_buckets[SDL_ATOMIC_WAIT_BUCKETS];
+static SDL_SpinLock SDL_atomic_wait_lock;
+
+static SDL_AtomicWaitBucket *
+SDL_GetAtomicWaitBucket(SDL_atomic_t *a)
+{
+    SDL_AtomicWaitBucket *bucket = &SDL_atomic_wait_buckets[((uintptr_t)a / sizeof(*a)) % SDL_ATOMIC_WAIT_BUCKETS];
+
+    if (!SDL_AtomicGetPtr((void **)&bucket->cond)) {
+        SDL_AtomicLock(&SDL_atomic_wait_lock);
+        if (!bucket->cond) {
+            if (!bucket->lock) {
+                bucket->lock = SDL_CreateMutex();
+            }
+            if (bucket->lock) {
+                SDL_AtomicSetPtr((void **)&bucket->cond, SDL_CreateCond());
+            }
+        }
+        SDL_AtomicUnlock(&SDL_atomic_wait_lock);
+        if (!bucket->cond) {
+            return NULL;
+        }
+    }
+    return bucket;
+}
+
+int
+SDL_AtomicWaitTimeout(SDL_atomic_t *a, int value, Uint32 ms)
+{
+    SDL_AtomicWaitBucket *bucket;
+    int retval = 0;
+
+    if (!a) {
+        return SDL_InvalidParamError("a");
+    }
+
+    bucket = SDL_GetAtomicWaitBucket(a);
+    if (!bucket) {
+        return -1;
+    }
+
+    SDL_LockMutex(bucket->lock);
+    if (SDL_AtomicGet(a) == value) {
+        retval = SDL_CondWaitTimeout(bucket->cond, bucket->lock, ms);
+    }
+    SDL_UnlockMutex(bucket->lock);
+    return retval;
+}
+
+static void
+SDL_AtomicWakeBucket(SDL_atomic_t *a)
+{
+    SDL_AtomicWaitBucket *bucket;
+
+    if (!a) {
+        return;
+    }
+
+    bucket = &SDL_atomic_wait_buckets[((uintptr_t)a / sizeof(*a)) % SDL_ATOMIC_WAIT_BUCKETS];
+    if (SDL_AtomicGetPtr((void **)&bucket->cond)) {
+        /* Taking the lock orders this after any waiter's check of the value */
+        SDL_LockMutex(bucket->lock);
+        SDL_CondBroadcast(bucket->cond);
+        SDL_UnlockMutex(bucket->lock);
+    }
+}
+
+void
+SDL_AtomicWake(SDL_atomic_t *a)
+{
+    SDL_AtomicWakeBucket(a);
+}
+
+void
+SDL_AtomicWakeAll(SDL_atomic_t *a)
+{
+    SDL_AtomicWakeBucket(a);
+}
+
+#else
+
+int
+SDL_AtomicWaitTimeout(SDL_atomic_t *a, int value, Uint32 ms)
+{
+    if (!a) {
+        return SDL_InvalidParamError("a");
+    }
+    /* There are no other threads to wait for, treat it as a spurious wakeup */
+    return 0;
+}
+
+void
+SDL_AtomicWake(SDL_atomic_t *a)
+{
+}
+
+void
+SDL_AtomicWakeAll(SDL_atomic_t *a)
+{
+}
+
+#endif /* HAVE_FUTEX */
+
+int
+SDL_AtomicWait(SDL_atomic_t *a, int value)
+{
+    return SDL_AtomicWaitTimeout(a, value, SDL_MUTEX_MAXWAIT);
+}
+
 #ifdef SDL_MEMORY_BARRIER_USES_FUNCTION
 #error This file should be built in arm mode so the mcr instruction is available for memory barriers
 #endif
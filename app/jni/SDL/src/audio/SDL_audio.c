@@ -27,6 +27,7 @@
 #include "SDL_audio_c.h"
 #include "SDL_sysaudio.h"
 #include "../thread/SDL_systhread.h"
+#include "../thread/SDL_parallel_c.h"
 #include "../SDL_utils_c.h"
 
 #define _THIS SDL_AudioDevice *_this
@@ -576,27 +577,141 @@ SDL_RemoveAudioDevice(const SDL_bool iscapture, void *handle)
 
 
 
+/* performance counters... */
+
+static Uint64
+SDL_AudioTicksToNS(const Uint64 ticks)
+{
+    const Uint64 freq = SDL_GetPerformanceFrequency();
+    return ((ticks / freq) * 1000000000) + (((ticks % freq) * 1000000000) / freq);
+}
+
+static Uint64
+SDL_AudioFramesToNS(const Uint64 frames, const int freq)
+{
+    return ((frames / freq) * 1000000000) + (((frames % freq) * 1000000000) / freq);
+}
+
+static void
+SDL_RecordAudioCallback(SDL_AudioDevice *device, const Uint64 start)
+{
+    const Uint64 ns = SDL_AudioTicksToNS(SDL_GetPerformanceCounter() - start);
+
+    SDL_AtomicLock(&device->stats_lock);
+    device->stats.callbacks++;
+    device->stats.callback_ns += ns;
+    device->stats.callback_max_ns = SDL_max(device->stats.callback_max_ns, ns);
+    SDL_AtomicUnlock(&device->stats_lock);
+}
+
+static void
+SDL_RecordAudioConversion(SDL_AudioDevice *device, const Uint64 start)
+{
+    const Uint64 ns = SDL_AudioTicksToNS(SDL_GetPerformanceCounter() - start);
+    const int available = SDL_AudioStreamAvailable(device->stream);
+
+    SDL_AtomicLock(&device->stats_lock);
+    device->stats.conversion_ns += ns;
+    device->stats.conversion_max_ns = SDL_max(device->stats.conversion_max_ns, ns);
+    device->stats_stream_bytes = (Uint32) SDL_max(available, 0);
+    SDL_AtomicUnlock(&device->stats_lock);
+}
+
+static void
+SDL_RecordAudioFrames(SDL_AudioDevice *device, const Uint32 frames, const SDL_bool underrun)
+{
+    SDL_AtomicLock(&device->stats_lock);
+    device->stats.frames += frames;
+    if (underrun) {
+        device->stats.underruns++;
+    }
+    SDL_AtomicUnlock(&device->stats_lock);
+}
+
+static void
+SDL_RecordAudioQueue(SDL_AudioDevice *device, const size_t queued, const SDL_bool underrun)
+{
+    SDL_AtomicLock(&device->stats_lock);
+    device->stats.queued_bytes_max = SDL_max(device->stats.queued_bytes_max, (Uint32) queued);
+    if (underrun) {
+        device->stats.underruns++;
+    }
+    SDL_AtomicUnlock(&device->stats_lock);
+}
+
+int
+SDL_GetAudioDeviceStats(SDL_AudioDeviceID devid, SDL_AudioDeviceStats *stats)
+{
+    SDL_AudioDevice *device = get_audio_device(devid);
+    Uint32 stream_bytes;
+    const SDL_AudioSpec *streamspec;
+    int callback_framesize, stream_framesize;
+
+    if (!device) {
+        return -1;  /* get_audio_device() will have set the error state */
+    } else if (!stats) {
+        return SDL_InvalidParamError("stats");
+    }
+
+    SDL_AtomicLock(&device->stats_lock);
+    SDL_memcpy(stats, &device->stats, sizeof (*stats));
+    stream_bytes = device->stats_stream_bytes;
+    SDL_AtomicUnlock(&device->stats_lock);
+
+    stats->queued_bytes = (Uint32) SDL_CountRingQueue(device->buffer_queue);
+
+    /* The queue holds data in the app's format, and the stream holds it
+       converted, ready for whichever side comes next. */
+    streamspec = device->iscapture ? &device->callbackspec : &device->spec;
+    callback_framesize = (SDL_AUDIO_BITSIZE(device->callbackspec.format) / 8) * device->callbackspec.channels;
+    stream_framesize = (SDL_AUDIO_BITSIZE(streamspec->format) / 8) * streamspec->channels;
+    stats->latency_ns = SDL_AudioFramesToNS(stats->queued_bytes / callback_framesize, device->callbackspec.freq) +
+                        SDL_AudioFramesToNS(stream_bytes / stream_framesize, streamspec->freq) +
+                        SDL_AudioFramesToNS(device->spec.samples, device->spec.freq);
+    return 0;
+}
+
+void
+SDL_ResetAudioDeviceStats(SDL_AudioDeviceID devid)
+{
+    SDL_AudioDevice *device = get_audio_device(devid);
+
+    if (device) {
+        SDL_AtomicLock(&device->stats_lock);
+        SDL_zero(device->stats);
+        SDL_AtomicUnlock(&device->stats_lock);
+    }
+}
+
+
 /* buffer queueing support... */
 
 static void SDLCALL
 SDL_BufferQueueDrainCallback(void *userdata, Uint8 *stream, int len)
 {
-    /* this function always holds the mixer lock before being called. */
+    /* this function always holds the mixer lock before being called, but the
+       queue itself is lock-free, so SDL_QueueAudio() can't hold us up. */
     SDL_AudioDevice *device = (SDL_AudioDevice *) userdata;
-    size_t dequeued;
+    size_t queued, dequeued;
+    SDL_bool underrun;
 
     SDL_assert(device != NULL);  /* this shouldn't ever happen, right?! */
     SDL_assert(!device->iscapture);  /* this shouldn't ever happen, right?! */
     SDL_assert(len >= 0);  /* this shouldn't ever happen, right?! */
 
-    dequeued = SDL_ReadFromDataQueue(device->buffer_queue, stream, len);
+    queued = SDL_CountRingQueue(device->buffer_queue);
+    dequeued = SDL_ReadFromRingQueue(device->buffer_queue, stream, len);
     stream += dequeued;
     len -= (int) dequeued;
 
     if (len > 0) {  /* fill any remaining space in the stream with silence. */
-        SDL_assert(SDL_CountDataQueue(device->buffer_queue) == 0);
         SDL_memset(stream, device->callbackspec.silence, len);
     }
+
+    /* running dry counts once, not for every buffer of silence after it. */
+    underrun = (len > 0) && device->queue_was_playing;
+    device->queue_was_playing = (len == 0);
+    SDL_RecordAudioQueue(device, queued, underrun);
 }
 
 static void SDLCALL
@@ -612,7 +727,8 @@ SDL_BufferQueueFillCallback(void *userdata, Uint8 *stream, int len)
     /* note that if this needs to allocate more space and run out of memory,
        we have no choice but to quietly drop the data and hope it works out
        later, but you probably have bigger problems in this case anyhow. */
-    SDL_WriteToDataQueue(device->buffer_queue, stream, len);
+    SDL_WriteToRingQueue(device->buffer_queue, stream, len);
+    SDL_RecordAudioQueue(device, SDL_CountRingQueue(device->buffer_queue), SDL_FALSE);
 }
 
 int
@@ -630,9 +746,9 @@ SDL_QueueAudio(SDL_AudioDeviceID devid, const void *data, Uint32 len)
     }
 
     if (len > 0) {
-        current_audio.impl.LockDevice(device);
-        rc = SDL_WriteToDataQueue(device->buffer_queue, data, len);
-        current_audio.impl.UnlockDevice(device);
+        SDL_LockMutex(device->buffer_queue_lock);
+        rc = SDL_WriteToRingQueue(device->buffer_queue, data, len);
+        SDL_UnlockMutex(device->buffer_queue_lock);
     }
 
     return rc;
@@ -651,9 +767,9 @@ SDL_DequeueAudio(SDL_AudioDeviceID devid, void *data, Uint32 len)
         return 0;  /* just report zero bytes dequeued. */
     }
 
-    current_audio.impl.LockDevice(device);
-    rc = (Uint32) SDL_ReadFromDataQueue(device->buffer_queue, data, len);
-    current_audio.impl.UnlockDevice(device);
+    SDL_LockMutex(device->buffer_queue_lock);
+    rc = (Uint32) SDL_ReadFromRingQueue(device->buffer_queue, data, len);
+    SDL_UnlockMutex(device->buffer_queue_lock);
     return rc;
 }
 
@@ -671,9 +787,7 @@ SDL_GetQueuedAudioSize(SDL_AudioDeviceID devid)
     if (device->callbackspec.callback == SDL_BufferQueueDrainCallback ||
         device->callbackspec.callback == SDL_BufferQueueFillCallback)
     {
-        current_audio.impl.LockDevice(device);
-        retval = (Uint32) SDL_CountDataQueue(device->buffer_queue);
-        current_audio.impl.UnlockDevice(device);
+        retval = (Uint32) SDL_CountRingQueue(device->buffer_queue);
     }
 
     return retval;
@@ -684,19 +798,320 @@ SDL_ClearQueuedAudio(SDL_AudioDeviceID devid)
 {
     SDL_AudioDevice *device = get_audio_device(devid);
 
-    if (!device) {
+    if (!device || !device->buffer_queue) {
         return;  /* nothing to do. */
     }
 
-    /* Blank out the device and release the mutex. Free it afterwards. */
+    /* Clearing touches both ends of the queue, so stop the audio thread and
+       any other application thread. The device lock comes first, since apps
+       may queue audio while holding it. */
     current_audio.impl.LockDevice(device);
+    SDL_LockMutex(device->buffer_queue_lock);
 
-    /* Keep up to two packets in the pool to reduce future memory allocation pressure. */
-    SDL_ClearDataQueue(device->buffer_queue, SDL_AUDIOBUFFERQUEUE_PACKETLEN * 2);
+    SDL_ClearRingQueue(device->buffer_queue);
 
+    SDL_UnlockMutex(device->buffer_queue_lock);
     current_audio.impl.UnlockDevice(device);
 }
 
+/* The biggest sample frame an SDL_AudioStream takes: 8 channels of 32-bit audio. */
+#define SDL_AUDIO_SOURCE_MAX_FRAME_SIZE (8 * 4)
+
+struct SDL_AudioSource
+{
+    SDL_AudioDevice *device;
+    SDL_AudioStream *stream;    /* converts to the callback's format; only the audio thread uses it. */
+    SDL_RingQueue *queue;       /* the audio thread is the consumer side... */
+    SDL_mutex *queue_lock;      /* ...and this serializes application threads on the other. */
+    SDL_atomic_t volume;
+    int frame_size;
+    int rate;
+
+    /* Audio thread state */
+    Uint8 partial[SDL_AUDIO_SOURCE_MAX_FRAME_SIZE];  /* a sample frame split between two pieces of the queue. */
+    int partial_len;
+    SDL_bool flushed;           /* the stream was flushed since the queue last had data. */
+    SDL_bool active;            /* buffer holds audio for this callback. */
+    Uint8 *buffer;              /* callbackspec.size bytes of converted audio. */
+};
+
+/* Hand one piece of queued data to the stream, returning how much was used. */
+static size_t
+SDL_FeedAudioSource(SDL_AudioSource *source, const Uint8 *data, size_t len, size_t wanted)
+{
+    const size_t frame_size = (size_t) source->frame_size;
+    size_t used;
+
+    if (source->partial_len > 0) {
+        /* Finish the split sample frame first. */
+        used = SDL_min(len, frame_size - source->partial_len);
+        SDL_memcpy(source->partial + source->partial_len, data, used);
+        source->partial_len += (int) used;
+        if (source->partial_len == source->frame_size) {
+            source->partial_len = 0;
+            SDL_AudioStreamPut(source->stream, source->partial, source->frame_size);
+        }
+    } else if (len < frame_size) {
+        /* The rest of this frame is in the next piece, or still being written. */
+        SDL_memcpy(source->partial, data, len);
+        source->partial_len = (int) len;
+        used = len;
+    } else {
+        used = SDL_max(wanted, frame_size);
+        used = SDL_min(used, len);
+        used -= used % frame_size;
+        SDL_AudioStreamPut(source->stream, data, (int) used);
+    }
+    return used;
+}
+
+/* SDL_ParallelFunc to fill one source's buffer for this callback. */
+static void
+SDL_ConvertAudioSource(void *data, int index)
+{
+    SDL_AudioDevice *device = (SDL_AudioDevice *) data;
+    SDL_AudioSource *source = device->sources[index];
+    const int len = (int) device->callbackspec.size;
+    const int dst_frame_size = (SDL_AUDIO_BITSIZE(device->callbackspec.format) / 8) * device->callbackspec.channels;
+    int available = SDL_AudioStreamAvailable(source->stream);
+    int got;
+
+    /* Feed the stream until it has converted enough for this callback. */
+    while (available < len) {
+        const Sint64 frames = ((len - available) + dst_frame_size - 1) / dst_frame_size;
+        const size_t wanted = (size_t) (((frames * source->rate) / device->callbackspec.freq) + 1) * source->frame_size;
+        size_t queued;
+        const Uint8 *ptr = (const Uint8 *) SDL_PeekRingQueue(source->queue, &queued);
+
+        if (!ptr) {
+            /* Ran dry: let the resampler give up what it's holding back. */
+            if (!source->flushed) {
+                SDL_AudioStreamFlush(source->stream);
+                source->flushed = SDL_TRUE;
+                available = SDL_AudioStreamAvailable(source->stream);
+            }
+            break;
+        }
+
+        SDL_ConsumeFromRingQueue(source->queue, SDL_FeedAudioSource(source, ptr, queued, wanted));
+        source->flushed = SDL_FALSE;
+        available = SDL_AudioStreamAvailable(source->stream);
+    }
+
+    got = (available > 0) ? SDL_AudioStreamGet(source->stream, source->buffer, len) : 0;
+    source->active = (got > 0) ? SDL_TRUE : SDL_FALSE;
+    if (source->active && (got < len)) {
+        SDL_memset(source->buffer + got, device->callbackspec.silence, len - got);
+    }
+}
+
+/* Called by the audio thread with the device locked, after the callback. */
+static void
+SDL_MixAudioSources(SDL_AudioDevice *device, Uint8 *data, int len)
+{
+    const Uint64 start = SDL_GetPerformanceCounter();
+    int i, count = 0;
+
+    SDL_TRACE_ZONE_BEGIN("SDL_MixAudioSources");
+    SDL_ParallelFor(device->num_sources, SDL_ConvertAudioSource, device);
+
+    for (i = 0; i < device->num_sources; ++i) {
+        SDL_AudioSource *source = device->sources[i];
+        const int volume = SDL_AtomicGet(&source->volume);
+        if (source->active && (volume > 0)) {
+            device->source_mix_bufs[count] = source->buffer;
+            device->source_mix_volumes[count] = volume;
+            ++count;
+        }
+    }
+
+    if (count > 0) {
+        SDL_MixAudioFormatMultiple(data, device->source_mix_bufs, device->source_mix_volumes,
+                                   count, device->callbackspec.format, (Uint32) len);
+    }
+    SDL_TRACE_ZONE_END();
+
+    SDL_RecordAudioConversion(device, start);
+}
+
+static void
+free_audio_source(SDL_AudioSource *source)
+{
+    SDL_FreeAudioStream(source->stream);
+    SDL_FreeRingQueue(source->queue);
+    if (source->queue_lock != NULL) {
+        SDL_DestroyMutex(source->queue_lock);
+    }
+    SDL_free(source->buffer);
+    SDL_free(source);
+}
+
+SDL_AudioSource *
+SDL_NewAudioSource(SDL_AudioDeviceID devid, SDL_AudioFormat format, Uint8 channels, int rate)
+{
+    SDL_AudioDevice *device = get_audio_device(devid);
+    SDL_AudioSource *source;
+
+    if (!device) {
+        return NULL;  /* get_audio_device() will have set the error state */
+    } else if (device->iscapture) {
+        SDL_SetError("This is a capture device, audio sources not allowed");
+        return NULL;
+    } else if (current_audio.impl.ProvidesOwnCallbackThread) {
+        SDL_SetError("Audio sources aren't supported by the %s driver", current_audio.name);
+        return NULL;
+    }
+
+    source = (SDL_AudioSource *) SDL_calloc(1, sizeof (SDL_AudioSource));
+    if (!source) {
+        SDL_OutOfMemory();
+        return NULL;
+    }
+
+    source->device = device;
+    source->frame_size = (SDL_AUDIO_BITSIZE(format) / 8) * channels;
+    source->rate = rate;
+    SDL_AtomicSet(&source->volume, SDL_MIX_MAXVOLUME);
+
+    source->stream = SDL_NewAudioStream(format, channels, rate,
+                                        device->callbackspec.format,
+                                        device->callbackspec.channels,
+                                        device->callbackspec.freq);
+    if (!source->stream) {
+        free_audio_source(source);
+        return NULL;
+    }
+    SDL_assert(source->frame_size <= SDL_AUDIO_SOURCE_MAX_FRAME_SIZE);
+
+    source->queue = SDL_NewRingQueue(device->callbackspec.size * 2);
+    source->queue_lock = SDL_CreateMutex();
+    source->buffer = (Uint8 *) SDL_malloc(device->callbackspec.size);
+    if (!source->queue || !source->queue_lock || !source->buffer) {
+        free_audio_source(source);
+        SDL_OutOfMemory();
+        return NULL;
+    }
+
+    current_audio.impl.LockDevice(device);
+    if (device->num_sources == device->max_sources) {
+        const int max_sources = device->max_sources ? (device->max_sources * 2) : 4;
+        void *ptr;
+
+        ptr = SDL_realloc(device->sources, max_sources * sizeof (*device->sources));
+        if (ptr) {
+            device->sources = (SDL_AudioSource **) ptr;
+            ptr = SDL_realloc((void *) device->source_mix_bufs, max_sources * sizeof (*device->source_mix_bufs));
+        }
+        if (ptr) {
+            device->source_mix_bufs = (const Uint8 **) ptr;
+            ptr = SDL_realloc(device->source_mix_volumes, max_sources * sizeof (*device->source_mix_volumes));
+        }
+        if (!ptr) {
+            current_audio.impl.UnlockDevice(device);
+            free_audio_source(source);
+            SDL_OutOfMemory();
+            return NULL;
+        }
+        device->source_mix_volumes = (int *) ptr;
+        device->max_sources = max_sources;
+    }
+    device->sources[device->num_sources++] = source;
+    current_audio.impl.UnlockDevice(device);
+
+    return source;
+}
+
+int
+SDL_AudioSourcePut(SDL_AudioSource *source, const void *buf, int len)
+{
+    int rc;
+
+    if (!source) {
+        return SDL_InvalidParamError("source");
+    } else if (!buf) {
+        return SDL_InvalidParamError("buf");
+    } else if (len <= 0) {
+        return 0;  /* nothing to do. */
+    } else if ((len % source->frame_size) != 0) {
+        return SDL_SetError("Can't add partial sample frames");
+    }
+
+    SDL_LockMutex(source->queue_lock);
+    rc = SDL_WriteToRingQueue(source->queue, buf, len);
+    SDL_UnlockMutex(source->queue_lock);
+
+    return rc;
+}
+
+int
+SDL_AudioSourceQueued(SDL_AudioSource *source)
+{
+    if (!source) {
+        return SDL_InvalidParamError("source");
+    }
+    return (int) SDL_CountRingQueue(source->queue);
+}
+
+int
+SDL_AudioSourceSetVolume(SDL_AudioSource *source, int volume)
+{
+    if (!source) {
+        return SDL_InvalidParamError("source");
+    } else if ((volume < 0) || (volume > SDL_MIX_MAXVOLUME)) {
+        return SDL_InvalidParamError("volume");
+    }
+    SDL_AtomicSet(&source->volume, volume);
+    return 0;
+}
+
+void
+SDL_AudioSourceClear(SDL_AudioSource *source)
+{
+    SDL_AudioDevice *device;
+
+    if (!source) {
+        SDL_InvalidParamError("source");
+        return;
+    }
+
+    /* Same locking as SDL_ClearQueuedAudio(). */
+    device = source->device;
+    current_audio.impl.LockDevice(device);
+    SDL_LockMutex(source->queue_lock);
+
+    SDL_ClearRingQueue(source->queue);
+    SDL_AudioStreamClear(source->stream);
+    source->partial_len = 0;
+    source->flushed = SDL_FALSE;
+
+    SDL_UnlockMutex(source->queue_lock);
+    current_audio.impl.UnlockDevice(device);
+}
+
+void
+SDL_FreeAudioSource(SDL_AudioSource *source)
+{
+    SDL_AudioDevice *device;
+    int i;
+
+    if (!source) {
+        return;
+    }
+
+    device = source->device;
+    current_audio.impl.LockDevice(device);
+    for (i = 0; i < device->num_sources; ++i) {
+        if (device->sources[i] == source) {
+            SDL_memmove(&device->sources[i], &device->sources[i + 1], (device->num_sources - i - 1) * sizeof (*device->sources));
+            --device->num_sources;
+            break;
+        }
+    }
+    current_audio.impl.UnlockDevice(device);
+
+    free_audio_source(source);
+}
+
 
 /* The general mixing thread function */
 static int SDLCALL
@@ -705,6 +1120,8 @@ SDL_RunAudio(void *devicep)
     SDL_AudioDevice *device = (SDL_AudioDevice *) devicep;
     void *udata = device->callbackspec.userdata;
     SDL_AudioCallback callback = device->callbackspec.callback;
+    const Uint64 period = ((Uint64) device->spec.samples * SDL_GetPerformanceFrequency()) / device->spec.freq;
+    Uint64 waiting_since;
     int data_len = 0;
     Uint8 *data;
 
@@ -724,6 +1141,7 @@ SDL_RunAudio(void *devicep)
     /* Perform any thread setup */
     device->threadid = SDL_ThreadID();
     current_audio.impl.ThreadInit(device);
+    waiting_since = SDL_GetPerformanceCounter();
 
     /* Loop, filling the audio buffers */
     while (!SDL_AtomicGet(&device->shutdown)) {
@@ -747,24 +1165,46 @@ SDL_RunAudio(void *devicep)
             data = device->work_buffer;
         }
 
+        SDL_TRACE_ZONE_BEGIN("SDL_RunAudio");
+
         /* !!! FIXME: this should be LockDevice. */
         SDL_LockMutex(device->mixer_lock);
         if (SDL_AtomicGet(&device->paused)) {
             SDL_memset(data, device->callbackspec.silence, data_len);
         } else {
+            const Uint64 start = SDL_GetPerformanceCounter();
             callback(udata, data, data_len);
+            SDL_RecordAudioCallback(device, start);
+            if (device->num_sources > 0) {
+                SDL_MixAudioSources(device, data, data_len);
+            }
         }
         SDL_UnlockMutex(device->mixer_lock);
 
         if (device->stream) {
             /* Stream available audio to device, converting/resampling. */
             /* if this fails...oh well. We'll play silence here. */
+            const Uint64 start = SDL_GetPerformanceCounter();
             SDL_AudioStreamPut(device->stream, data, data_len);
+            SDL_RecordAudioConversion(device, start);
+        }
+
+        SDL_TRACE_ZONE_END();
 
+        if (device->stream) {
+            /* The device only gets whole buffers, so when callbacks are
+               shorter than a device buffer some of them play nothing. That's
+               fine as long as the next buffer comes within a buffer's time of
+               the device asking for it, otherwise it has run dry. */
             while (SDL_AudioStreamAvailable(device->stream) >= ((int) device->spec.size)) {
                 int got;
+                Uint64 start;
                 data = SDL_AtomicGet(&device->enabled) ? current_audio.impl.GetDeviceBuf(device) : NULL;
+                SDL_TRACE_ZONE_BEGIN("SDL_AudioStreamGet");
+                start = SDL_GetPerformanceCounter();
                 got = SDL_AudioStreamGet(device->stream, data ? data : device->work_buffer, device->spec.size);
+                SDL_RecordAudioConversion(device, start);
+                SDL_TRACE_ZONE_END();
                 SDL_assert((got <= 0) || (got == device->spec.size));
 
                 if (data == NULL) {  /* device is having issues... */
@@ -775,16 +1215,20 @@ SDL_RunAudio(void *devicep)
                         SDL_memset(data, device->spec.silence, device->spec.size);
                     }
                     current_audio.impl.PlayDevice(device);
+                    SDL_RecordAudioFrames(device, device->spec.samples, (got != device->spec.size) || ((start - waiting_since) > period));
                     current_audio.impl.WaitDevice(device);
                 }
+                waiting_since = SDL_GetPerformanceCounter();
             }
         } else if (data == device->work_buffer) {
             /* nothing to do; pause like we queued a buffer to play. */
             const Uint32 delay = ((device->spec.samples * 1000) / device->spec.freq);
+            SDL_RecordAudioFrames(device, device->spec.samples, SDL_FALSE);
             SDL_Delay(delay);
         } else {  /* writing directly to the device. */
             /* queue this buffer and wait for it to finish playing. */
             current_audio.impl.PlayDevice(device);
+            SDL_RecordAudioFrames(device, device->spec.samples, SDL_FALSE);
             current_audio.impl.WaitDevice(device);
         }
     }
@@ -875,12 +1319,19 @@ SDL_CaptureAudio(void *devicep)
             SDL_memset(ptr, silence, still_need);
         }
 
+        SDL_RecordAudioFrames(device, device->spec.samples, still_need > 0);
+
         if (device->stream) {
             /* if this fails...oh well. */
+            Uint64 start = SDL_GetPerformanceCounter();
             SDL_AudioStreamPut(device->stream, data, data_len);
+            SDL_RecordAudioConversion(device, start);
 
             while (SDL_AudioStreamAvailable(device->stream) >= ((int) device->callbackspec.size)) {
-                const int got = SDL_AudioStreamGet(device->stream, device->work_buffer, device->callbackspec.size);
+                int got;
+                start = SDL_GetPerformanceCounter();
+                got = SDL_AudioStreamGet(device->stream, device->work_buffer, device->callbackspec.size);
+                SDL_RecordAudioConversion(device, start);
                 SDL_assert((got < 0) || (got == device->callbackspec.size));
                 if (got != device->callbackspec.size) {
                     SDL_memset(device->work_buffer, device->spec.silence, device->callbackspec.size);
@@ -889,7 +1340,9 @@ SDL_CaptureAudio(void *devicep)
                 /* !!! FIXME: this should be LockDevice. */
                 SDL_LockMutex(device->mixer_lock);
                 if (!SDL_AtomicGet(&device->paused)) {
+                    start = SDL_GetPerformanceCounter();
                     callback(udata, device->work_buffer, device->callbackspec.size);
+                    SDL_RecordAudioCallback(device, start);
                 }
                 SDL_UnlockMutex(device->mixer_lock);
             }
@@ -897,7 +1350,9 @@ SDL_CaptureAudio(void *devicep)
             /* !!! FIXME: this should be LockDevice. */
             SDL_LockMutex(device->mixer_lock);
             if (!SDL_AtomicGet(&device->paused)) {
+                const Uint64 start = SDL_GetPerformanceCounter();
                 callback(udata, data, device->callbackspec.size);
+                SDL_RecordAudioCallback(device, start);
             }
             SDL_UnlockMutex(device->mixer_lock);
         }
@@ -1236,7 +1691,17 @@ close_audio_device(SDL_AudioDevice * device)
         current_audio.impl.CloseDevice(device);
     }
 
-    SDL_FreeDataQueue(device->buffer_queue);
+    SDL_FreeRingQueue(device->buffer_queue);
+    if (device->buffer_queue_lock != NULL) {
+        SDL_DestroyMutex(device->buffer_queue_lock);
+    }
+
+    while (device->num_sources > 0) {
+        free_audio_source(device->sources[--device->num_sources]);
+    }
+    SDL_free(device->sources);
+    SDL_free((void *) device->source_mix_bufs);
+    SDL_free(device->source_mix_volumes);
 
     SDL_free(device);
 }
@@ -1508,9 +1973,10 @@ open_audio_device(const char *devname, int iscapture,
     }
 
     if (device->spec.callback == NULL) {  /* use buffer queueing? */
-        /* pool a few packets to start. Enough for two callbacks. */
-        device->buffer_queue = SDL_NewDataQueue(SDL_AUDIOBUFFERQUEUE_PACKETLEN, obtained->size * 2);
-        if (!device->buffer_queue) {
+        /* start with enough room for two callbacks, it grows as needed. */
+        device->buffer_queue = SDL_NewRingQueue(obtained->size * 2);
+        device->buffer_queue_lock = SDL_CreateMutex();
+        if (!device->buffer_queue || !device->buffer_queue_lock) {
             close_audio_device(device);
             SDL_UnlockMutex(current_audio.detectionLock);
             SDL_SetError("Couldn't create audio buffer queue");
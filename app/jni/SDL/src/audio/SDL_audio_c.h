@@ -71,6 +71,11 @@ extern SDL_AudioFilter SDL_Convert_F32_to_S16;
 extern SDL_AudioFilter SDL_Convert_F32_to_U16;
 extern SDL_AudioFilter SDL_Convert_F32_to_S32;
 
+/* Integer-to-float conversion fused with a channel remap, also set by SDL_ChooseAudioConverters(). */
+extern SDL_AudioFilter SDL_Convert_S16_to_F32_StereoToMono;
+extern SDL_AudioFilter SDL_Convert_S16_to_F32_MonoToStereo;
+extern SDL_AudioFilter SDL_Convert_S16_to_F32_51ToStereo;
+
 #endif /* SDL_audio_c_h_ */
 
 /* vi: set ts=4 sw=4 expandtab: */
@@ -28,6 +28,7 @@
 
 #include "SDL_loadso.h"
 #include "../SDL_dataqueue.h"
+#include "../thread/SDL_parallel_c.h"
 #include "SDL_cpuinfo.h"
 
 #define DEBUG_AUDIOSTREAM 0
@@ -177,6 +178,22 @@ SDL_ConvertMonoToStereo_SSE(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
 #include "SDL_audio_resampler_filter.h"
 
+/* Every output frame is a weighted sum of the input frames from
+   RESAMPLER_ZERO_CROSSINGS before to RESAMPLER_ZERO_CROSSINGS+1 after it.
+   The weights only depend on where the output frame falls between two
+   input frames, and that position repeats every outrate/gcd(inrate, outrate)
+   output frames. For the usual rate pairs there are few of these phases
+   (160 for 44100->48000, 3 for 16000->48000), so we compute the weights for
+   each phase once and the per-frame work is a short dot product.
+
+   The table gives the same weights as computing them per frame, but the
+   products are summed in a different order, so the output can differ from
+   the old scalar resampler by a few float ULPs (well below 1e-6 for
+   samples in [-1, 1]). */
+#define RESAMPLER_TAPS (2 * (RESAMPLER_ZERO_CROSSINGS + 1))
+#define RESAMPLER_MAX_PHASES 1024
+#define RESAMPLER_MAX_CHANNELS 8
+
 static Sint32
 ResamplerPadding(const Sint32 inrate, const Sint32 outrate)
 {
@@ -193,12 +210,202 @@ ResamplerPadding(const Sint32 inrate, const Sint32 outrate)
     return RESAMPLER_SAMPLES_PER_ZERO_CROSSING;
 }
 
-/* lpadding and rpadding are expected to be buffers of (ResamplePadding(inrate, outrate) * chans * sizeof (float)) bytes. */
+/* Returns the number of distinct filter phases, or 0 if there are too many to tabulate. */
 static int
-SDL_ResampleAudio(const int chans, const int inrate, const int outrate,
+ResamplerPhases(const int inrate, const int outrate)
+{
+    int a = inrate, b = outrate;
+
+    while (b != 0) {
+        const int t = a % b;
+        a = b;
+        b = t;
+    }
+    if (a == 0 || (outrate / a) > RESAMPLER_MAX_PHASES) {
+        return 0;
+    }
+    return outrate / a;
+}
+
+/* Fill in the RESAMPLER_TAPS weights for an output frame that's srcfraction/outrate past its input frame. */
+static void
+ResamplerCoefficients(const int srcfraction, const int outrate, float *coefs)
+{
+    /* Calculating the following way avoids subtraction or modulo of large
+     * floats which have low result precision.
+     *   interpolation1
+     * = (i / outrate * inrate) - floor(i / outrate * inrate)
+     * = mod(i / outrate * inrate, 1)
+     * = mod(i * inrate, outrate) / outrate */
+    const float interpolation1 = ((float) srcfraction) / ((float) outrate);
+    const int filterindex1 = ((Sint32) srcfraction) * RESAMPLER_SAMPLES_PER_ZERO_CROSSING / outrate;
+    const float interpolation2 = 1.0f - interpolation1;
+    const int filterindex2 = ((Sint32) (outrate - srcfraction)) * RESAMPLER_SAMPLES_PER_ZERO_CROSSING / outrate;
+    int j;
+
+    SDL_memset(coefs, '\0', RESAMPLER_TAPS * sizeof (float));
+
+    /* The "left wing" runs backwards from the input frame, the right wing forwards from the next one. */
+    for (j = 0; (filterindex1 + (j * RESAMPLER_SAMPLES_PER_ZERO_CROSSING)) < RESAMPLER_FILTER_SIZE; j++) {
+        const int filt_ind = filterindex1 + j * RESAMPLER_SAMPLES_PER_ZERO_CROSSING;
+        coefs[RESAMPLER_ZERO_CROSSINGS - j] = ResamplerFilter[filt_ind] + (interpolation1 * ResamplerFilterDifference[filt_ind]);
+    }
+    for (j = 0; (filterindex2 + (j * RESAMPLER_SAMPLES_PER_ZERO_CROSSING)) < RESAMPLER_FILTER_SIZE; j++) {
+        const int filt_ind = filterindex2 + j * RESAMPLER_SAMPLES_PER_ZERO_CROSSING;
+        coefs[RESAMPLER_ZERO_CROSSINGS + 1 + j] = ResamplerFilter[filt_ind] + (interpolation2 * ResamplerFilterDifference[filt_ind]);
+    }
+}
+
+/* Returns a table of phases * RESAMPLER_TAPS weights, or NULL to compute them as we go. */
+static float *
+SDL_CreateResamplerTable(const int inrate, const int outrate, const int phases)
+{
+    float *coefs;
+    int srcfraction = 0;
+    int phase;
+
+    if (phases <= 0) {
+        return NULL;
+    }
+
+    coefs = (float *) SDL_malloc(phases * RESAMPLER_TAPS * sizeof (float));
+    if (!coefs) {
+        return NULL;
+    }
+
+    for (phase = 0; phase < phases; phase++) {
+        ResamplerCoefficients(srcfraction, outrate, coefs + (phase * RESAMPLER_TAPS));
+        srcfraction += inrate % outrate;
+        if (srcfraction >= outrate) {
+            srcfraction -= outrate;
+        }
+    }
+    return coefs;
+}
+
+/* Each of these computes one output frame from RESAMPLER_TAPS interleaved input frames. */
+typedef void (*SDL_ResampleFrameFunc)(const int chans, const float *coefs, const float *src, float *dst);
+
+SDL_FORCE_INLINE void
+SDL_ResampleFrame_Scalar(const int chans, const float *coefs, const float *src, float *dst)
+{
+    int chan, j;
+
+    for (chan = 0; chan < chans; chan++) {
+        float outsample = 0.0f;
+        for (j = 0; j < RESAMPLER_TAPS; j++) {
+            outsample += src[(j * chans) + chan] * coefs[j];
+        }
+        dst[chan] = outsample;
+    }
+}
+
+#if HAVE_SSE_INTRINSICS
+SDL_FORCE_INLINE void
+SDL_ResampleFrame_SSE(const int chans, const float *coefs, const float *src, float *dst)
+{
+    const __m128 coefs0 = _mm_loadu_ps(coefs);
+    const __m128 coefs1 = _mm_loadu_ps(coefs + 4);
+    const __m128 coefs2 = _mm_loadu_ps(coefs + 8);
+    __m128 sum;
+    int chan, j;
+
+    if (chans == 1) {
+        sum = _mm_mul_ps(_mm_loadu_ps(src), coefs0);
+        sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(src + 4), coefs1));
+        sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(src + 8), coefs2));
+        sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+        sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, _MM_SHUFFLE(1, 1, 1, 1)));
+        _mm_store_ss(dst, sum);
+    } else if (chans == 2) {
+        /* Pair up each weight for the left and right sample of a frame. */
+        sum = _mm_mul_ps(_mm_loadu_ps(src), _mm_unpacklo_ps(coefs0, coefs0));
+        sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(src + 4), _mm_unpackhi_ps(coefs0, coefs0)));
+        sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(src + 8), _mm_unpacklo_ps(coefs1, coefs1)));
+        sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(src + 12), _mm_unpackhi_ps(coefs1, coefs1)));
+        sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(src + 16), _mm_unpacklo_ps(coefs2, coefs2)));
+        sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(src + 20), _mm_unpackhi_ps(coefs2, coefs2)));
+        sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+        _mm_storel_pi((__m64 *) dst, sum);
+    } else {
+        /* Four channels at a time, then whatever is left over. */
+        for (chan = 0; (chan + 4) <= chans; chan += 4) {
+            sum = _mm_setzero_ps();
+            for (j = 0; j < RESAMPLER_TAPS; j++) {
+                sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(src + (j * chans) + chan), _mm_set1_ps(coefs[j])));
+            }
+            _mm_storeu_ps(dst + chan, sum);
+        }
+        for (; chan < chans; chan++) {
+            float outsample = 0.0f;
+            for (j = 0; j < RESAMPLER_TAPS; j++) {
+                outsample += src[(j * chans) + chan] * coefs[j];
+            }
+            dst[chan] = outsample;
+        }
+    }
+}
+#endif
+
+#if HAVE_NEON_INTRINSICS
+SDL_FORCE_INLINE void
+SDL_ResampleFrame_NEON(const int chans, const float *coefs, const float *src, float *dst)
+{
+    const float32x4_t coefs0 = vld1q_f32(coefs);
+    const float32x4_t coefs1 = vld1q_f32(coefs + 4);
+    const float32x4_t coefs2 = vld1q_f32(coefs + 8);
+    float32x4_t sum;
+    float32x2_t halves;
+    int chan, j;
+
+    if (chans == 1) {
+        sum = vmulq_f32(vld1q_f32(src), coefs0);
+        sum = vmlaq_f32(sum, vld1q_f32(src + 4), coefs1);
+        sum = vmlaq_f32(sum, vld1q_f32(src + 8), coefs2);
+        halves = vadd_f32(vget_low_f32(sum), vget_high_f32(sum));
+        halves = vpadd_f32(halves, halves);
+        vst1_lane_f32(dst, halves, 0);
+    } else if (chans == 2) {
+        /* Pair up each weight for the left and right sample of a frame. */
+        const float32x4x2_t pairs0 = vzipq_f32(coefs0, coefs0);
+        const float32x4x2_t pairs1 = vzipq_f32(coefs1, coefs1);
+        const float32x4x2_t pairs2 = vzipq_f32(coefs2, coefs2);
+        sum = vmulq_f32(vld1q_f32(src), pairs0.val[0]);
+        sum = vmlaq_f32(sum, vld1q_f32(src + 4), pairs0.val[1]);
+        sum = vmlaq_f32(sum, vld1q_f32(src + 8), pairs1.val[0]);
+        sum = vmlaq_f32(sum, vld1q_f32(src + 12), pairs1.val[1]);
+        sum = vmlaq_f32(sum, vld1q_f32(src + 16), pairs2.val[0]);
+        sum = vmlaq_f32(sum, vld1q_f32(src + 20), pairs2.val[1]);
+        vst1_f32(dst, vadd_f32(vget_low_f32(sum), vget_high_f32(sum)));
+    } else {
+        /* Four channels at a time, then whatever is left over. */
+        for (chan = 0; (chan + 4) <= chans; chan += 4) {
+            sum = vdupq_n_f32(0.0f);
+            for (j = 0; j < RESAMPLER_TAPS; j++) {
+                sum = vmlaq_n_f32(sum, vld1q_f32(src + (j * chans) + chan), coefs[j]);
+            }
+            vst1q_f32(dst + chan, sum);
+        }
+        for (; chan < chans; chan++) {
+            float outsample = 0.0f;
+            for (j = 0; j < RESAMPLER_TAPS; j++) {
+                outsample += src[(j * chans) + chan] * coefs[j];
+            }
+            dst[chan] = outsample;
+        }
+    }
+}
+#endif
+
+/* lpadding and rpadding are expected to be buffers of (ResamplePadding(inrate, outrate) * chans * sizeof (float)) bytes.
+   coefs is a table from SDL_CreateResamplerTable() with the given number of phases, or NULL. */
+SDL_FORCE_INLINE int
+SDL_ResampleAudioFrames(const int chans, const int inrate, const int outrate,
+                        const float *coefs, const int phases,
                         const float *lpadding, const float *rpadding,
                         const float *inbuf, const int inbuflen,
-                        float *outbuf, const int outbuflen)
+                        float *outbuf, const int outbuflen,
+                        const SDL_ResampleFrameFunc resample_frame)
 {
     /* This function uses integer arithmetics to avoid precision loss caused
      * by large floating point numbers. For some operations, Sint32 or Sint64
@@ -213,51 +420,126 @@ SDL_ResampleAudio(const int chans, const int inrate, const int outrate,
     const int wantedoutframes = ((Sint64) inframes) * outrate / inrate;
     const int maxoutframes = outbuflen / framelen;
     const int outframes = SDL_min(wantedoutframes, maxoutframes);
+    /* Step through the input without dividing for every output frame:
+       srcindex = i * inrate / outrate, srcfraction = i * inrate % outrate */
+    const int srcstep = inrate / outrate;
+    const int fractionstep = inrate % outrate;
+    float framecoefs[RESAMPLER_TAPS];
+    float window[RESAMPLER_TAPS * RESAMPLER_MAX_CHANNELS];
     float *dst = outbuf;
-    int i, j, chan;
+    int srcindex = 0;
+    int srcfraction = 0;
+    int phase = 0;
+    int i, j;
 
-    for (i = 0; i < outframes; i++) {
-        const int srcindex = ((Sint64) i) * inrate / outrate;
-        /* Calculating the following way avoids subtraction or modulo of large
-         * floats which have low result precision.
-         *   interpolation1
-         * = (i / outrate * inrate) - floor(i / outrate * inrate)
-         * = mod(i / outrate * inrate, 1)
-         * = mod(i * inrate, outrate) / outrate */
-        const int srcfraction = ((Sint64) i) * inrate % outrate;
-        const float interpolation1 = ((float) srcfraction) / ((float) outrate);
-        const int filterindex1 = ((Sint32) srcfraction) * RESAMPLER_SAMPLES_PER_ZERO_CROSSING / outrate;
-        const float interpolation2 = 1.0f - interpolation1;
-        const int filterindex2 = ((Sint32) (outrate - srcfraction)) * RESAMPLER_SAMPLES_PER_ZERO_CROSSING / outrate;
-
-        for (chan = 0; chan < chans; chan++) {
-            float outsample = 0.0f;
+    SDL_assert(chans <= RESAMPLER_MAX_CHANNELS);
 
-            /* do this twice to calculate the sample, once for the "left wing" and then same for the right. */
-            for (j = 0; (filterindex1 + (j * RESAMPLER_SAMPLES_PER_ZERO_CROSSING)) < RESAMPLER_FILTER_SIZE; j++) {
-                const int filt_ind = filterindex1 + j * RESAMPLER_SAMPLES_PER_ZERO_CROSSING;
-                const int srcframe = srcindex - j;
-                /* !!! FIXME: we can bubble this conditional out of here by doing a pre loop. */
-                const float insample = (srcframe < 0) ? lpadding[((paddinglen + srcframe) * chans) + chan] : inbuf[(srcframe * chans) + chan];
-                outsample += (float)(insample * (ResamplerFilter[filt_ind] + (interpolation1 * ResamplerFilterDifference[filt_ind])));
+    for (i = 0; i < outframes; i++) {
+        const int firstframe = srcindex - RESAMPLER_ZERO_CROSSINGS;
+        const float *framecoefsptr;
+        const float *src;
+
+        if (coefs) {
+            framecoefsptr = coefs + (phase * RESAMPLER_TAPS);
+            if (++phase == phases) {
+                phase = 0;
             }
+        } else {
+            ResamplerCoefficients(srcfraction, outrate, framecoefs);
+            framecoefsptr = framecoefs;
+        }
 
-            /* Do the right wing! */
-            for (j = 0; (filterindex2 + (j * RESAMPLER_SAMPLES_PER_ZERO_CROSSING)) < RESAMPLER_FILTER_SIZE; j++) {
-                const int filt_ind = filterindex2 + j * RESAMPLER_SAMPLES_PER_ZERO_CROSSING;
-                const int srcframe = srcindex + 1 + j;
-                /* !!! FIXME: we can bubble this conditional out of here by doing a post loop. */
-                const float insample = (srcframe >= inframes) ? rpadding[((srcframe - inframes) * chans) + chan] : inbuf[(srcframe * chans) + chan];
-                outsample += (float)(insample * (ResamplerFilter[filt_ind] + (interpolation2 * ResamplerFilterDifference[filt_ind])));
+        if (firstframe >= 0 && (firstframe + RESAMPLER_TAPS) <= inframes) {
+            src = inbuf + (firstframe * chans);
+        } else {
+            /* Near either end of the buffer, gather the frames into one
+               place so the padding doesn't need checking for every tap. */
+            for (j = 0; j < RESAMPLER_TAPS; j++) {
+                const int srcframe = firstframe + j;
+                const float *frame;
+                if (srcframe < 0) {
+                    frame = lpadding + ((paddinglen + srcframe) * chans);
+                } else if (srcframe >= inframes) {
+                    frame = rpadding + ((srcframe - inframes) * chans);
+                } else {
+                    frame = inbuf + (srcframe * chans);
+                }
+                SDL_memcpy(window + (j * chans), frame, framelen);
             }
+            src = window;
+        }
 
-            *(dst++) = outsample;
+        resample_frame(chans, framecoefsptr, src, dst);
+        dst += chans;
+
+        srcindex += srcstep;
+        srcfraction += fractionstep;
+        if (srcfraction >= outrate) {
+            srcfraction -= outrate;
+            srcindex++;
         }
     }
 
     return outframes * chans * sizeof (float);
 }
 
+static int
+SDL_ResampleAudio_Scalar(const int chans, const int inrate, const int outrate,
+                         const float *coefs, const int phases,
+                         const float *lpadding, const float *rpadding,
+                         const float *inbuf, const int inbuflen,
+                         float *outbuf, const int outbuflen)
+{
+    return SDL_ResampleAudioFrames(chans, inrate, outrate, coefs, phases, lpadding, rpadding,
+                                   inbuf, inbuflen, outbuf, outbuflen, SDL_ResampleFrame_Scalar);
+}
+
+#if HAVE_SSE_INTRINSICS
+static int
+SDL_ResampleAudio_SSE(const int chans, const int inrate, const int outrate,
+                      const float *coefs, const int phases,
+                      const float *lpadding, const float *rpadding,
+                      const float *inbuf, const int inbuflen,
+                      float *outbuf, const int outbuflen)
+{
+    return SDL_ResampleAudioFrames(chans, inrate, outrate, coefs, phases, lpadding, rpadding,
+                                   inbuf, inbuflen, outbuf, outbuflen, SDL_ResampleFrame_SSE);
+}
+#endif
+
+#if HAVE_NEON_INTRINSICS
+static int
+SDL_ResampleAudio_NEON(const int chans, const int inrate, const int outrate,
+                       const float *coefs, const int phases,
+                       const float *lpadding, const float *rpadding,
+                       const float *inbuf, const int inbuflen,
+                       float *outbuf, const int outbuflen)
+{
+    return SDL_ResampleAudioFrames(chans, inrate, outrate, coefs, phases, lpadding, rpadding,
+                                   inbuf, inbuflen, outbuf, outbuflen, SDL_ResampleFrame_NEON);
+}
+#endif
+
+static int
+SDL_ResampleAudio(const int chans, const int inrate, const int outrate,
+                  const float *coefs, const int phases,
+                  const float *lpadding, const float *rpadding,
+                  const float *inbuf, const int inbuflen,
+                  float *outbuf, const int outbuflen)
+{
+#if HAVE_SSE_INTRINSICS
+    if (SDL_HasSSE()) {
+        return SDL_ResampleAudio_SSE(chans, inrate, outrate, coefs, phases, lpadding, rpadding, inbuf, inbuflen, outbuf, outbuflen);
+    }
+#endif
+#if HAVE_NEON_INTRINSICS
+    if (SDL_HasNEON()) {
+        return SDL_ResampleAudio_NEON(chans, inrate, outrate, coefs, phases, lpadding, rpadding, inbuf, inbuflen, outbuf, outbuflen);
+    }
+#endif
+    return SDL_ResampleAudio_Scalar(chans, inrate, outrate, coefs, phases, lpadding, rpadding, inbuf, inbuflen, outbuf, outbuflen);
+}
+
 int
 SDL_ConvertAudio(SDL_AudioCVT * cvt)
 {
@@ -482,8 +764,10 @@ SDL_ResampleCVT(SDL_AudioCVT *cvt, const int chans, const SDL_AudioFormat format
     float *dst = (float *) (cvt->buf + srclen);
     const int dstlen = (cvt->len * cvt->len_mult) - srclen;
     const int requestedpadding = ResamplerPadding(inrate, outrate);
+    const int phases = ResamplerPhases(inrate, outrate);
     int paddingsamples;
     float *padding;
+    float *coefs = NULL;
 
     if (requestedpadding < SDL_MAX_SINT32 / chans) {
         paddingsamples = requestedpadding * chans;
@@ -499,8 +783,14 @@ SDL_ResampleCVT(SDL_AudioCVT *cvt, const int chans, const SDL_AudioFormat format
         return;
     }
 
-    cvt->len_cvt = SDL_ResampleAudio(chans, inrate, outrate, padding, padding, src, srclen, dst, dstlen);
+    /* Only worth building the weights up front if they'll be used more than once. */
+    if (phases > 0 && phases < (srclen / (chans * (int) sizeof (float)))) {
+        coefs = SDL_CreateResamplerTable(inrate, outrate, phases);
+    }
+
+    cvt->len_cvt = SDL_ResampleAudio(chans, inrate, outrate, coefs, phases, padding, padding, src, srclen, dst, dstlen);
 
+    SDL_free(coefs);
     SDL_free(padding);
 
     SDL_memmove(cvt->buf, dst, cvt->len_cvt);  /* !!! FIXME: remove this if we can get the resampler to work in-place again. */
@@ -756,8 +1046,23 @@ SDL_BuildAudioCVT(SDL_AudioCVT * cvt,
         /* All combinations of supported channel counts should have been handled by now, but let's be defensive */
         return SDL_SetError("Invalid channel combination");
     } else if (channel_converter != NULL) {
-        /* swap in some SIMD versions for a few of these. */
-        if (channel_converter == SDL_ConvertStereoToMono) {
+        SDL_AudioFilter fused = NULL;
+
+        /* if we just added an S16->float pass, see if it can do this remap in the same pass. */
+        if ((cvt->filter_index > 0) && (cvt->filters[cvt->filter_index - 1] == SDL_Convert_S16_to_F32)) {
+            if (channel_converter == SDL_ConvertStereoToMono) {
+                fused = SDL_Convert_S16_to_F32_StereoToMono;
+            } else if (channel_converter == SDL_ConvertMonoToStereo) {
+                fused = SDL_Convert_S16_to_F32_MonoToStereo;
+            } else if (channel_converter == SDL_Convert51ToStereo) {
+                fused = SDL_Convert_S16_to_F32_51ToStereo;
+            }
+        }
+
+        /* use the fused pass, or swap in some SIMD versions for a few of these. */
+        if (fused) {
+            cvt->filters[cvt->filter_index - 1] = fused;
+        } else if (channel_converter == SDL_ConvertStereoToMono) {
             SDL_AudioFilter filter = NULL;
             #if HAVE_SSE3_INTRINSICS
             if (!filter && SDL_HasSSE3()) { filter = SDL_ConvertStereoToMono_SSE3; }
@@ -771,7 +1076,7 @@ SDL_BuildAudioCVT(SDL_AudioCVT * cvt,
             if (filter) { channel_converter = filter; }
         }
 
-        if (SDL_AddAudioCVTFilter(cvt, channel_converter) < 0) {
+        if (!fused && SDL_AddAudioCVTFilter(cvt, channel_converter) < 0) {
             return -1;
         }
 
@@ -825,6 +1130,8 @@ struct _SDL_AudioStream
     int packetlen;
     int resampler_padding_samples;
     float *resampler_padding;
+    float *resampler_coefs;
+    int resampler_phases;
     void *resampler_state;
     SDL_ResampleAudioStreamFunc resampler_func;
     SDL_ResetAudioStreamResamplerFunc reset_resampler_func;
@@ -955,7 +1262,8 @@ SDL_ResampleAudioStream(SDL_AudioStream *stream, const void *_inbuf, const int i
 
     SDL_assert(inbuf != ((const float *) outbuf));  /* SDL_AudioStreamPut() shouldn't allow in-place resamples. */
 
-    retval = SDL_ResampleAudio(chans, inrate, outrate, lpadding, rpadding, inbuf, inbuflen, outbuf, outbuflen);
+    retval = SDL_ResampleAudio(chans, inrate, outrate, stream->resampler_coefs, stream->resampler_phases,
+                               lpadding, rpadding, inbuf, inbuflen, outbuf, outbuflen);
 
     /* update our left padding with end of current input, for next run. */
     SDL_memcpy((lpadding + paddingsamples) - (cpy / sizeof (float)), inbufend - cpy, cpy);
@@ -974,6 +1282,7 @@ static void
 SDL_CleanupAudioStreamResampler(SDL_AudioStream *stream)
 {
     SDL_free(stream->resampler_state);
+    SDL_free(stream->resampler_coefs);
 }
 
 SDL_AudioStream *
@@ -1058,6 +1367,10 @@ SDL_NewAudioStream(const SDL_AudioFormat src_format,
                 return NULL;
             }
 
+            /* If this fails, the weights are computed for every frame instead. */
+            retval->resampler_phases = ResamplerPhases(src_rate, dst_rate);
+            retval->resampler_coefs = SDL_CreateResamplerTable(src_rate, dst_rate, retval->resampler_phases);
+
             retval->resampler_func = SDL_ResampleAudioStream;
             retval->reset_resampler_func = SDL_ResetAudioStreamResampler;
             retval->cleanup_resampler_func = SDL_CleanupAudioStreamResampler;
@@ -1276,6 +1589,59 @@ SDL_AudioStreamPut(SDL_AudioStream *stream, const void *buf, int len)
     return 0;
 }
 
+typedef struct SDL_AudioStreamPutJob
+{
+    SDL_AudioStream **streams;
+    const void **bufs;
+    const int *lens;
+    SDL_atomic_t failed;
+    char error[256];    /* the first failure, since the error state is per-thread. */
+} SDL_AudioStreamPutJob;
+
+static void
+SDL_AudioStreamPutJobFunc(void *data, int index)
+{
+    SDL_AudioStreamPutJob *job = (SDL_AudioStreamPutJob *) data;
+
+    if (SDL_AudioStreamPut(job->streams[index], job->bufs[index], job->lens[index]) < 0) {
+        if (SDL_AtomicCAS(&job->failed, 0, 1)) {
+            SDL_strlcpy(job->error, SDL_GetError(), sizeof (job->error));
+        }
+    }
+}
+
+int
+SDL_AudioStreamPutMultiple(SDL_AudioStream **streams, const void **bufs, const int *lens, int num_streams)
+{
+    SDL_AudioStreamPutJob job;
+
+    if (!streams) {
+        return SDL_InvalidParamError("streams");
+    }
+    if (!bufs) {
+        return SDL_InvalidParamError("bufs");
+    }
+    if (!lens) {
+        return SDL_InvalidParamError("lens");
+    }
+    if (num_streams <= 0) {
+        return 0;  /* nothing to do. */
+    }
+
+    /* Streams don't share anything, so each one can convert on its own thread. */
+    job.streams = streams;
+    job.bufs = bufs;
+    job.lens = lens;
+    SDL_AtomicSet(&job.failed, 0);
+    job.error[0] = '\0';
+    SDL_ParallelFor(num_streams, SDL_AudioStreamPutJobFunc, &job);
+
+    if (SDL_AtomicGet(&job.failed)) {
+        return SDL_SetError("%s", job.error);
+    }
+    return 0;
+}
+
 int SDL_AudioStreamFlush(SDL_AudioStream *stream)
 {
     if (!stream) {
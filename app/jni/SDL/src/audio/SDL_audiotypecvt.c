@@ -32,6 +32,32 @@
 #define HAVE_SSE2_INTRINSICS 1
 #endif
 
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#if defined(HAVE_IMMINTRIN_H) && !defined(SDL_DISABLE_IMMINTRIN_H)
+#define HAVE_AVX2_INTRINSICS 1
+#endif
+#if defined __clang__
+# if (!__has_attribute(target))
+#   undef HAVE_AVX2_INTRINSICS
+# endif
+# if (defined(_MSC_VER) || defined(__SCE__)) && !defined(__AVX2__)
+#   undef HAVE_AVX2_INTRINSICS
+# endif
+#elif defined __GNUC__
+# if (__GNUC__ < 4) || (__GNUC__ == 4 && __GNUC_MINOR__ < 9)
+#   undef HAVE_AVX2_INTRINSICS
+# endif
+#endif
+#endif
+
+#if HAVE_AVX2_INTRINSICS
+#if defined(__clang__) || defined(__GNUC__)
+#define SDL_TARGETING_AVX2 __attribute__((target("avx2")))
+#else
+#define SDL_TARGETING_AVX2
+#endif
+#endif
+
 #if defined(__x86_64__) && HAVE_SSE2_INTRINSICS
 #define NEED_SCALAR_CONVERTER_FALLBACKS 0  /* x86_64 guarantees SSE2. */
 #elif __MACOSX__ && HAVE_SSE2_INTRINSICS
@@ -58,10 +84,14 @@ SDL_AudioFilter SDL_Convert_F32_to_U8 = NULL;
 SDL_AudioFilter SDL_Convert_F32_to_S16 = NULL;
 SDL_AudioFilter SDL_Convert_F32_to_U16 = NULL;
 SDL_AudioFilter SDL_Convert_F32_to_S32 = NULL;
+SDL_AudioFilter SDL_Convert_S16_to_F32_StereoToMono = NULL;
+SDL_AudioFilter SDL_Convert_S16_to_F32_MonoToStereo = NULL;
+SDL_AudioFilter SDL_Convert_S16_to_F32_51ToStereo = NULL;
 
 
 #define DIVBY128 0.0078125f
 #define DIVBY32768 0.000030517578125f
+#define DIVBY65536 0.0000152587890625f
 #define DIVBY8388607 0.00000011920930376163766f
 
 
@@ -849,6 +879,384 @@ SDL_Convert_F32_to_S32_SSE2(SDL_AudioCVT *cvt, SDL_AudioFormat format)
 }
 #endif
 
+#if HAVE_AVX2_INTRINSICS
+/* AVX2 hardware doesn't care much about alignment, so these just use
+   unaligned loads/stores and skip the alignment prologue the SSE2 versions
+   need. Results match the SSE2 block math (round-to-nearest float->int). */
+static void SDLCALL SDL_TARGETING_AVX2
+SDL_Convert_S8_to_F32_AVX2(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const Sint8 *src = (const Sint8 *) cvt->buf;
+    float *dst = (float *) cvt->buf;
+    int i = cvt->len_cvt;
+
+    LOG_DEBUG_CONVERT("AUDIO_S8", "AUDIO_F32 (using AVX2)");
+
+    /* The buffer is growing, so work back from the end; a block's output
+       never overlaps source bytes we haven't read yet. */
+    {
+        const __m256 divby128 = _mm256_set1_ps(DIVBY128);
+        while (i >= 16) {   /* 16 * 8-bit */
+            __m128i bytes;
+            i -= 16;
+            bytes = _mm_loadu_si128((const __m128i *) (src + i));
+            _mm256_storeu_ps(dst + i + 8, _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(_mm_srli_si128(bytes, 8))), divby128));
+            _mm256_storeu_ps(dst + i, _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(bytes)), divby128));
+        }
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    while (i) {
+        --i;
+        dst[i] = ((float) src[i]) * DIVBY128;
+    }
+
+    cvt->len_cvt *= 4;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_F32SYS);
+    }
+}
+
+static void SDLCALL SDL_TARGETING_AVX2
+SDL_Convert_U8_to_F32_AVX2(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const Uint8 *src = (const Uint8 *) cvt->buf;
+    float *dst = (float *) cvt->buf;
+    int i = cvt->len_cvt;
+
+    LOG_DEBUG_CONVERT("AUDIO_U8", "AUDIO_F32 (using AVX2)");
+
+    {
+        const __m256 divby128 = _mm256_set1_ps(DIVBY128);
+        const __m256 minus1 = _mm256_set1_ps(-1.0f);
+        while (i >= 16) {   /* 16 * 8-bit */
+            __m128i bytes;
+            i -= 16;
+            bytes = _mm_loadu_si128((const __m128i *) (src + i));
+            _mm256_storeu_ps(dst + i + 8, _mm256_add_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_srli_si128(bytes, 8))), divby128), minus1));
+            _mm256_storeu_ps(dst + i, _mm256_add_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(bytes)), divby128), minus1));
+        }
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    while (i) {
+        --i;
+        dst[i] = (((float) src[i]) * DIVBY128) - 1.0f;
+    }
+
+    cvt->len_cvt *= 4;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_F32SYS);
+    }
+}
+
+static void SDLCALL SDL_TARGETING_AVX2
+SDL_Convert_S16_to_F32_AVX2(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const Sint16 *src = (const Sint16 *) cvt->buf;
+    float *dst = (float *) cvt->buf;
+    int i = cvt->len_cvt / sizeof (Sint16);
+
+    LOG_DEBUG_CONVERT("AUDIO_S16", "AUDIO_F32 (using AVX2)");
+
+    {
+        const __m256 divby32768 = _mm256_set1_ps(DIVBY32768);
+        while (i >= 16) {   /* 16 * 16-bit */
+            __m128i shorts1, shorts2;
+            i -= 16;
+            shorts1 = _mm_loadu_si128((const __m128i *) (src + i));
+            shorts2 = _mm_loadu_si128((const __m128i *) (src + i + 8));
+            _mm256_storeu_ps(dst + i + 8, _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(shorts2)), divby32768));
+            _mm256_storeu_ps(dst + i, _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(shorts1)), divby32768));
+        }
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    while (i) {
+        --i;
+        dst[i] = ((float) src[i]) * DIVBY32768;
+    }
+
+    cvt->len_cvt *= 2;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_F32SYS);
+    }
+}
+
+static void SDLCALL SDL_TARGETING_AVX2
+SDL_Convert_U16_to_F32_AVX2(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const Uint16 *src = (const Uint16 *) cvt->buf;
+    float *dst = (float *) cvt->buf;
+    int i = cvt->len_cvt / sizeof (Uint16);
+
+    LOG_DEBUG_CONVERT("AUDIO_U16", "AUDIO_F32 (using AVX2)");
+
+    {
+        const __m256 divby32768 = _mm256_set1_ps(DIVBY32768);
+        const __m256 minus1 = _mm256_set1_ps(-1.0f);
+        while (i >= 16) {   /* 16 * 16-bit */
+            __m128i shorts1, shorts2;
+            i -= 16;
+            shorts1 = _mm_loadu_si128((const __m128i *) (src + i));
+            shorts2 = _mm_loadu_si128((const __m128i *) (src + i + 8));
+            _mm256_storeu_ps(dst + i + 8, _mm256_add_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(shorts2)), divby32768), minus1));
+            _mm256_storeu_ps(dst + i, _mm256_add_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(shorts1)), divby32768), minus1));
+        }
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    while (i) {
+        --i;
+        dst[i] = (((float) src[i]) * DIVBY32768) - 1.0f;
+    }
+
+    cvt->len_cvt *= 2;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_F32SYS);
+    }
+}
+
+static void SDLCALL SDL_TARGETING_AVX2
+SDL_Convert_S32_to_F32_AVX2(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const Sint32 *src = (const Sint32 *) cvt->buf;
+    float *dst = (float *) cvt->buf;
+    int i = cvt->len_cvt / sizeof (Sint32);
+
+    LOG_DEBUG_CONVERT("AUDIO_S32", "AUDIO_F32 (using AVX2)");
+
+    {
+        /* In AVX2, converting int32 to float is built-in (and is exact), so it's a simple shift and convert. */
+        const __m256 divby8388607 = _mm256_set1_ps(DIVBY8388607);
+        while (i >= 8) {   /* 8 * 32-bit */
+            _mm256_storeu_ps(dst, _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_srai_epi32(_mm256_loadu_si256((const __m256i *) src), 8)), divby8388607));
+            i -= 8; src += 8; dst += 8;
+        }
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    while (i) {
+        *dst = ((float) (*src>>8)) * DIVBY8388607;
+        i--; src++; dst++;
+    }
+
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_F32SYS);
+    }
+}
+
+static void SDLCALL SDL_TARGETING_AVX2
+SDL_Convert_F32_to_S8_AVX2(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const float *src = (const float *) cvt->buf;
+    Sint8 *dst = (Sint8 *) cvt->buf;
+    int i = cvt->len_cvt / sizeof (float);
+
+    LOG_DEBUG_CONVERT("AUDIO_F32", "AUDIO_S8 (using AVX2)");
+
+    /* The buffer is shrinking, so work forward; each block is fully loaded before it's stored. */
+    {
+        const __m256 one = _mm256_set1_ps(1.0f);
+        const __m256 negone = _mm256_set1_ps(-1.0f);
+        const __m256 mulby127 = _mm256_set1_ps(127.0f);
+        /* packs work within each 128-bit lane, so put the 32-bit groups back in order afterwards. */
+        const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+        while (i >= 32) {   /* 32 * float32 */
+            const __m256i ints1 = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_min_ps(_mm256_max_ps(negone, _mm256_loadu_ps(src)), one), mulby127));  /* load 8 floats, clamp, convert to sint32 */
+            const __m256i ints2 = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_min_ps(_mm256_max_ps(negone, _mm256_loadu_ps(src+8)), one), mulby127));
+            const __m256i ints3 = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_min_ps(_mm256_max_ps(negone, _mm256_loadu_ps(src+16)), one), mulby127));
+            const __m256i ints4 = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_min_ps(_mm256_max_ps(negone, _mm256_loadu_ps(src+24)), one), mulby127));
+            const __m256i packed = _mm256_packs_epi16(_mm256_packs_epi32(ints1, ints2), _mm256_packs_epi32(ints3, ints4));
+            _mm256_storeu_si256((__m256i *) dst, _mm256_permutevar8x32_epi32(packed, order));  /* fix lane order, store out. */
+            i -= 32; src += 32; dst += 32;
+        }
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    while (i) {
+        const float sample = *src;
+        if (sample >= 1.0f) {
+            *dst = 127;
+        } else if (sample <= -1.0f) {
+            *dst = -128;
+        } else {
+            *dst = (Sint8)(sample * 127.0f);
+        }
+        i--; src++; dst++;
+    }
+
+    cvt->len_cvt /= 4;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_S8);
+    }
+}
+
+static void SDLCALL SDL_TARGETING_AVX2
+SDL_Convert_F32_to_U8_AVX2(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const float *src = (const float *) cvt->buf;
+    Uint8 *dst = (Uint8 *) cvt->buf;
+    int i = cvt->len_cvt / sizeof (float);
+
+    LOG_DEBUG_CONVERT("AUDIO_F32", "AUDIO_U8 (using AVX2)");
+
+    {
+        const __m256 one = _mm256_set1_ps(1.0f);
+        const __m256 negone = _mm256_set1_ps(-1.0f);
+        const __m256 mulby127 = _mm256_set1_ps(127.0f);
+        const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+        while (i >= 32) {   /* 32 * float32 */
+            const __m256i ints1 = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_add_ps(_mm256_min_ps(_mm256_max_ps(negone, _mm256_loadu_ps(src)), one), one), mulby127));  /* load 8 floats, clamp, convert to sint32 */
+            const __m256i ints2 = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_add_ps(_mm256_min_ps(_mm256_max_ps(negone, _mm256_loadu_ps(src+8)), one), one), mulby127));
+            const __m256i ints3 = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_add_ps(_mm256_min_ps(_mm256_max_ps(negone, _mm256_loadu_ps(src+16)), one), one), mulby127));
+            const __m256i ints4 = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_add_ps(_mm256_min_ps(_mm256_max_ps(negone, _mm256_loadu_ps(src+24)), one), one), mulby127));
+            const __m256i packed = _mm256_packus_epi16(_mm256_packs_epi32(ints1, ints2), _mm256_packs_epi32(ints3, ints4));
+            _mm256_storeu_si256((__m256i *) dst, _mm256_permutevar8x32_epi32(packed, order));  /* fix lane order, store out. */
+            i -= 32; src += 32; dst += 32;
+        }
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    while (i) {
+        const float sample = *src;
+        if (sample >= 1.0f) {
+            *dst = 255;
+        } else if (sample <= -1.0f) {
+            *dst = 0;
+        } else {
+            *dst = (Uint8)((sample + 1.0f) * 127.0f);
+        }
+        i--; src++; dst++;
+    }
+
+    cvt->len_cvt /= 4;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_U8);
+    }
+}
+
+static void SDLCALL SDL_TARGETING_AVX2
+SDL_Convert_F32_to_S16_AVX2(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const float *src = (const float *) cvt->buf;
+    Sint16 *dst = (Sint16 *) cvt->buf;
+    int i = cvt->len_cvt / sizeof (float);
+
+    LOG_DEBUG_CONVERT("AUDIO_F32", "AUDIO_S16 (using AVX2)");
+
+    {
+        const __m256 one = _mm256_set1_ps(1.0f);
+        const __m256 negone = _mm256_set1_ps(-1.0f);
+        const __m256 mulby32767 = _mm256_set1_ps(32767.0f);
+        while (i >= 16) {   /* 16 * float32 */
+            const __m256i ints1 = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_min_ps(_mm256_max_ps(negone, _mm256_loadu_ps(src)), one), mulby32767));  /* load 8 floats, clamp, convert to sint32 */
+            const __m256i ints2 = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_min_ps(_mm256_max_ps(negone, _mm256_loadu_ps(src+8)), one), mulby32767));
+            _mm256_storeu_si256((__m256i *) dst, _mm256_permute4x64_epi64(_mm256_packs_epi32(ints1, ints2), 0xD8));  /* pack to sint16, fix lane order, store out. */
+            i -= 16; src += 16; dst += 16;
+        }
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    while (i) {
+        const float sample = *src;
+        if (sample >= 1.0f) {
+            *dst = 32767;
+        } else if (sample <= -1.0f) {
+            *dst = -32768;
+        } else {
+            *dst = (Sint16)(sample * 32767.0f);
+        }
+        i--; src++; dst++;
+    }
+
+    cvt->len_cvt /= 2;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_S16SYS);
+    }
+}
+
+static void SDLCALL SDL_TARGETING_AVX2
+SDL_Convert_F32_to_U16_AVX2(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const float *src = (const float *) cvt->buf;
+    Uint16 *dst = (Uint16 *) cvt->buf;
+    int i = cvt->len_cvt / sizeof (float);
+
+    LOG_DEBUG_CONVERT("AUDIO_F32", "AUDIO_U16 (using AVX2)");
+
+    {
+        /* Same signed-pack-then-flip-the-top-bit trick as the SSE2 version, so both agree. */
+        const __m256 mulby32767 = _mm256_set1_ps(32767.0f);
+        const __m256i topbit = _mm256_set1_epi16(-32768);
+        const __m256 one = _mm256_set1_ps(1.0f);
+        const __m256 negone = _mm256_set1_ps(-1.0f);
+        while (i >= 16) {   /* 16 * float32 */
+            const __m256i ints1 = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_min_ps(_mm256_max_ps(negone, _mm256_loadu_ps(src)), one), mulby32767));  /* load 8 floats, clamp, convert to sint32 */
+            const __m256i ints2 = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_min_ps(_mm256_max_ps(negone, _mm256_loadu_ps(src+8)), one), mulby32767));
+            _mm256_storeu_si256((__m256i *) dst, _mm256_xor_si256(_mm256_permute4x64_epi64(_mm256_packs_epi32(ints1, ints2), 0xD8), topbit));  /* pack to sint16, fix lane order, xor top bit, store out. */
+            i -= 16; src += 16; dst += 16;
+        }
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    while (i) {
+        const float sample = *src;
+        if (sample >= 1.0f) {
+            *dst = 65535;
+        } else if (sample <= -1.0f) {
+            *dst = 0;
+        } else {
+            *dst = (Uint16)((sample + 1.0f) * 32767.0f);
+        }
+        i--; src++; dst++;
+    }
+
+    cvt->len_cvt /= 2;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_U16SYS);
+    }
+}
+
+static void SDLCALL SDL_TARGETING_AVX2
+SDL_Convert_F32_to_S32_AVX2(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const float *src = (const float *) cvt->buf;
+    Sint32 *dst = (Sint32 *) cvt->buf;
+    int i = cvt->len_cvt / sizeof (float);
+
+    LOG_DEBUG_CONVERT("AUDIO_F32", "AUDIO_S32 (using AVX2)");
+
+    {
+        const __m256 one = _mm256_set1_ps(1.0f);
+        const __m256 negone = _mm256_set1_ps(-1.0f);
+        const __m256 mulby8388607 = _mm256_set1_ps(8388607.0f);
+        while (i >= 8) {   /* 8 * float32 */
+            _mm256_storeu_si256((__m256i *) dst, _mm256_slli_epi32(_mm256_cvtps_epi32(_mm256_mul_ps(_mm256_min_ps(_mm256_max_ps(negone, _mm256_loadu_ps(src)), one), mulby8388607)), 8));  /* load 8 floats, clamp, convert to sint32 */
+            i -= 8; src += 8; dst += 8;
+        }
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    while (i) {
+        const float sample = *src;
+        if (sample >= 1.0f) {
+            *dst = 2147483647;
+        } else if (sample <= -1.0f) {
+            *dst = (Sint32) -2147483648LL;
+        } else {
+            *dst = ((Sint32)(sample * 8388607.0f)) << 8;
+        }
+        i--; src++; dst++;
+    }
+
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_S32SYS);
+    }
+}
+#endif
+
+
 
 #if HAVE_NEON_INTRINSICS
 static void SDLCALL
@@ -1381,6 +1789,339 @@ SDL_Convert_F32_to_S32_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
 #endif
 
 
+/* These do the integer-to-float conversion and one of the common channel
+   remaps in a single pass over the buffer, instead of a type converter pass
+   followed by a channel converter pass. They do the same math, in the same
+   order, as SDL_Convert_S16_to_F32 followed by the generic channel converter.
+   SDL_BuildAudioCVT() swaps them in when it can. */
+
+#if NEED_SCALAR_CONVERTER_FALLBACKS
+static void SDLCALL
+SDL_Convert_S16_to_F32_StereoToMono_Scalar(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const Sint16 *src = (const Sint16 *) cvt->buf;
+    float *dst = (float *) cvt->buf;
+    int i;
+
+    LOG_DEBUG_CONVERT("AUDIO_S16 stereo", "AUDIO_F32 mono");
+
+    /* (L/32768 * 0.5) + (R/32768 * 0.5) is exactly (L + R) / 65536 in float. */
+    for (i = cvt->len_cvt / (sizeof (Sint16) * 2); i; --i, src += 2, ++dst) {
+        *dst = ((float) (src[0] + src[1])) * DIVBY65536;
+    }
+
+    /* twice the bytes per sample, half the samples: len_cvt doesn't change. */
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_F32SYS);
+    }
+}
+
+static void SDLCALL
+SDL_Convert_S16_to_F32_MonoToStereo_Scalar(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const Sint16 *src = ((const Sint16 *) (cvt->buf + cvt->len_cvt)) - 1;
+    float *dst = ((float *) (cvt->buf + cvt->len_cvt * 4)) - 2;
+    int i;
+
+    LOG_DEBUG_CONVERT("AUDIO_S16 mono", "AUDIO_F32 stereo");
+
+    for (i = cvt->len_cvt / sizeof (Sint16); i; --i, --src, dst -= 2) {
+        const float sample = ((float) *src) * DIVBY32768;
+        dst[1] = sample;
+        dst[0] = sample;
+    }
+
+    cvt->len_cvt *= 4;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_F32SYS);
+    }
+}
+
+static void SDLCALL
+SDL_Convert_S16_to_F32_51ToStereo_Scalar(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const Sint16 *src = (const Sint16 *) cvt->buf;
+    float *dst = (float *) cvt->buf;
+    int i;
+
+    LOG_DEBUG_CONVERT("AUDIO_S16 5.1", "AUDIO_F32 stereo");
+
+    for (i = cvt->len_cvt / (sizeof (Sint16) * 6); i; --i, src += 6, dst += 2) {
+        const float srcFL = ((float) src[0]) * DIVBY32768;
+        const float srcFR = ((float) src[1]) * DIVBY32768;
+        const float srcFC = ((float) src[2]) * DIVBY32768;
+        const float srcLFE = ((float) src[3]) * DIVBY32768;
+        const float srcBL = ((float) src[4]) * DIVBY32768;
+        const float srcBR = ((float) src[5]) * DIVBY32768;
+        dst[0] /* FL */ = (srcFL * 0.294545442f) + (srcFC * 0.208181813f) + (srcLFE * 0.090909094f) + (srcBL * 0.251818180f) + (srcBR * 0.154545456f);
+        dst[1] /* FR */ = (srcFR * 0.294545442f) + (srcFC * 0.208181813f) + (srcLFE * 0.090909094f) + (srcBL * 0.154545456f) + (srcBR * 0.251818180f);
+    }
+
+    cvt->len_cvt = ((cvt->len_cvt * 2) / 6) * 2;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_F32SYS);
+    }
+}
+#endif
+
+#if HAVE_SSE2_INTRINSICS
+static void SDLCALL
+SDL_Convert_S16_to_F32_StereoToMono_SSE2(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const Sint16 *src = (const Sint16 *) cvt->buf;
+    float *dst = (float *) cvt->buf;
+    int i = cvt->len_cvt / (sizeof (Sint16) * 2);
+
+    LOG_DEBUG_CONVERT("AUDIO_S16 stereo", "AUDIO_F32 mono (using SSE2)");
+
+    {
+        /* pmaddwd against 1s sums each L/R pair straight into an int32. */
+        const __m128i ones = _mm_set1_epi16(1);
+        const __m128 divby65536 = _mm_set1_ps(DIVBY65536);
+        while (i >= 8) {   /* 8 * stereo Sint16 frames */
+            const __m128i sums1 = _mm_madd_epi16(_mm_loadu_si128((const __m128i *) src), ones);
+            const __m128i sums2 = _mm_madd_epi16(_mm_loadu_si128((const __m128i *) (src + 8)), ones);
+            _mm_storeu_ps(dst, _mm_mul_ps(_mm_cvtepi32_ps(sums1), divby65536));
+            _mm_storeu_ps(dst + 4, _mm_mul_ps(_mm_cvtepi32_ps(sums2), divby65536));
+            i -= 8; src += 16; dst += 8;
+        }
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    while (i) {
+        *dst = ((float) (src[0] + src[1])) * DIVBY65536;
+        i--; src += 2; dst++;
+    }
+
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_F32SYS);
+    }
+}
+
+static void SDLCALL
+SDL_Convert_S16_to_F32_MonoToStereo_SSE2(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const Sint16 *src = (const Sint16 *) cvt->buf;
+    float *dst = (float *) cvt->buf;
+    int i = cvt->len_cvt / sizeof (Sint16);
+
+    LOG_DEBUG_CONVERT("AUDIO_S16 mono", "AUDIO_F32 stereo (using SSE2)");
+
+    /* The buffer is growing, so work back from the end. */
+    {
+        const __m128 divby32768 = _mm_set1_ps(DIVBY32768);
+        while (i >= 8) {   /* 8 * mono Sint16 frames */
+            __m128i shorts;
+            __m128 floats1, floats2;
+            i -= 8;
+            shorts = _mm_loadu_si128((const __m128i *) (src + i));
+            /* unpack against itself and shift right to sign-extend to int32. */
+            floats1 = _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(shorts, shorts), 16)), divby32768);
+            floats2 = _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(shorts, shorts), 16)), divby32768);
+            _mm_storeu_ps(dst + (i * 2) + 12, _mm_unpackhi_ps(floats2, floats2));
+            _mm_storeu_ps(dst + (i * 2) + 8, _mm_unpacklo_ps(floats2, floats2));
+            _mm_storeu_ps(dst + (i * 2) + 4, _mm_unpackhi_ps(floats1, floats1));
+            _mm_storeu_ps(dst + (i * 2), _mm_unpacklo_ps(floats1, floats1));
+        }
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    while (i) {
+        float sample;
+        --i;
+        sample = ((float) src[i]) * DIVBY32768;
+        dst[(i * 2) + 1] = sample;
+        dst[i * 2] = sample;
+    }
+
+    cvt->len_cvt *= 4;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_F32SYS);
+    }
+}
+
+static void SDLCALL
+SDL_Convert_S16_to_F32_51ToStereo_SSE2(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const Sint16 *src = (const Sint16 *) cvt->buf;
+    float *dst = (float *) cvt->buf;
+    int i = cvt->len_cvt / (sizeof (Sint16) * 6);
+
+    LOG_DEBUG_CONVERT("AUDIO_S16 5.1", "AUDIO_F32 stereo (using SSE2)");
+
+    {
+        /* Two frames per block, output as L0 R0 L1 R1. Folding the 1/32768 into
+           the coefficients is exact, and the terms are summed in the same order
+           as the scalar downmix. */
+        const __m128 front = _mm_set1_ps(0.294545442f * DIVBY32768);
+        const __m128 center = _mm_set1_ps(0.208181813f * DIVBY32768);
+        const __m128 lfe = _mm_set1_ps(0.090909094f * DIVBY32768);
+        const __m128 backleft = _mm_setr_ps(0.251818180f * DIVBY32768, 0.154545456f * DIVBY32768, 0.251818180f * DIVBY32768, 0.154545456f * DIVBY32768);
+        const __m128 backright = _mm_setr_ps(0.154545456f * DIVBY32768, 0.251818180f * DIVBY32768, 0.154545456f * DIVBY32768, 0.251818180f * DIVBY32768);
+        while (i >= 2) {   /* 2 * 5.1 Sint16 frames */
+            const __m128i shorts1 = _mm_loadu_si128((const __m128i *) src);  /* FL0 FR0 FC0 LFE0 BL0 BR0 FL1 FR1 */
+            const __m128i shorts2 = _mm_loadl_epi64((const __m128i *) (src + 8));  /* FC1 LFE1 BL1 BR1 */
+            /* unpack against itself and shift right to sign-extend to int32. */
+            const __m128 floats1 = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(shorts1, shorts1), 16));
+            const __m128 floats2 = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(shorts1, shorts1), 16));
+            const __m128 floats3 = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(shorts2, shorts2), 16));
+            __m128 sum = _mm_mul_ps(_mm_shuffle_ps(floats1, floats2, _MM_SHUFFLE(3, 2, 1, 0)), front);  /* FL0 FR0 FL1 FR1 */
+            sum = _mm_add_ps(sum, _mm_mul_ps(_mm_shuffle_ps(floats1, floats3, _MM_SHUFFLE(0, 0, 2, 2)), center));  /* FC0 FC0 FC1 FC1 */
+            sum = _mm_add_ps(sum, _mm_mul_ps(_mm_shuffle_ps(floats1, floats3, _MM_SHUFFLE(1, 1, 3, 3)), lfe));  /* LFE0 LFE0 LFE1 LFE1 */
+            sum = _mm_add_ps(sum, _mm_mul_ps(_mm_shuffle_ps(floats2, floats3, _MM_SHUFFLE(2, 2, 0, 0)), backleft));  /* BL0 BL0 BL1 BL1 */
+            sum = _mm_add_ps(sum, _mm_mul_ps(_mm_shuffle_ps(floats2, floats3, _MM_SHUFFLE(3, 3, 1, 1)), backright));  /* BR0 BR0 BR1 BR1 */
+            _mm_storeu_ps(dst, sum);
+            i -= 2; src += 12; dst += 4;
+        }
+    }
+
+    /* Finish off any leftover frame with scalar operations. */
+    if (i) {
+        const float srcFL = ((float) src[0]) * DIVBY32768;
+        const float srcFR = ((float) src[1]) * DIVBY32768;
+        const float srcFC = ((float) src[2]) * DIVBY32768;
+        const float srcLFE = ((float) src[3]) * DIVBY32768;
+        const float srcBL = ((float) src[4]) * DIVBY32768;
+        const float srcBR = ((float) src[5]) * DIVBY32768;
+        dst[0] /* FL */ = (srcFL * 0.294545442f) + (srcFC * 0.208181813f) + (srcLFE * 0.090909094f) + (srcBL * 0.251818180f) + (srcBR * 0.154545456f);
+        dst[1] /* FR */ = (srcFR * 0.294545442f) + (srcFC * 0.208181813f) + (srcLFE * 0.090909094f) + (srcBL * 0.154545456f) + (srcBR * 0.251818180f);
+    }
+
+    cvt->len_cvt = ((cvt->len_cvt * 2) / 6) * 2;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_F32SYS);
+    }
+}
+#endif
+
+#if HAVE_NEON_INTRINSICS
+static void SDLCALL
+SDL_Convert_S16_to_F32_StereoToMono_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const Sint16 *src = (const Sint16 *) cvt->buf;
+    float *dst = (float *) cvt->buf;
+    int i = cvt->len_cvt / (sizeof (Sint16) * 2);
+
+    LOG_DEBUG_CONVERT("AUDIO_S16 stereo", "AUDIO_F32 mono (using NEON)");
+
+    {
+        /* pairwise add-long sums each L/R pair straight into an int32. */
+        const float32x4_t divby65536 = vdupq_n_f32(DIVBY65536);
+        while (i >= 8) {   /* 8 * stereo Sint16 frames */
+            const int32x4_t sums1 = vpaddlq_s16(vld1q_s16((const int16_t *) src));
+            const int32x4_t sums2 = vpaddlq_s16(vld1q_s16((const int16_t *) (src + 8)));
+            vst1q_f32(dst, vmulq_f32(vcvtq_f32_s32(sums1), divby65536));
+            vst1q_f32(dst + 4, vmulq_f32(vcvtq_f32_s32(sums2), divby65536));
+            i -= 8; src += 16; dst += 8;
+        }
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    while (i) {
+        *dst = ((float) (src[0] + src[1])) * DIVBY65536;
+        i--; src += 2; dst++;
+    }
+
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_F32SYS);
+    }
+}
+
+static void SDLCALL
+SDL_Convert_S16_to_F32_MonoToStereo_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const Sint16 *src = (const Sint16 *) cvt->buf;
+    float *dst = (float *) cvt->buf;
+    int i = cvt->len_cvt / sizeof (Sint16);
+
+    LOG_DEBUG_CONVERT("AUDIO_S16 mono", "AUDIO_F32 stereo (using NEON)");
+
+    /* The buffer is growing, so work back from the end. */
+    {
+        const float32x4_t divby32768 = vdupq_n_f32(DIVBY32768);
+        while (i >= 8) {   /* 8 * mono Sint16 frames */
+            int16x8_t shorts;
+            float32x4x2_t frames1, frames2;
+            i -= 8;
+            shorts = vld1q_s16((const int16_t *) (src + i));
+            frames1.val[0] = frames1.val[1] = vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(shorts))), divby32768);
+            frames2.val[0] = frames2.val[1] = vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(shorts))), divby32768);
+            vst2q_f32(dst + (i * 2) + 8, frames2);  /* interleaving store duplicates each sample to L and R. */
+            vst2q_f32(dst + (i * 2), frames1);
+        }
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    while (i) {
+        float sample;
+        --i;
+        sample = ((float) src[i]) * DIVBY32768;
+        dst[(i * 2) + 1] = sample;
+        dst[i * 2] = sample;
+    }
+
+    cvt->len_cvt *= 4;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_F32SYS);
+    }
+}
+
+static void SDLCALL
+SDL_Convert_S16_to_F32_51ToStereo_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const Sint16 *src = (const Sint16 *) cvt->buf;
+    float *dst = (float *) cvt->buf;
+    int i = cvt->len_cvt / (sizeof (Sint16) * 6);
+
+    LOG_DEBUG_CONVERT("AUDIO_S16 5.1", "AUDIO_F32 stereo (using NEON)");
+
+    {
+        /* Two frames per block, output as L0 R0 L1 R1. Folding the 1/32768 into
+           the coefficients is exact, and the terms are summed in the same order
+           as the scalar downmix. */
+        static const float backleft_coeffs[4] = { 0.251818180f * DIVBY32768, 0.154545456f * DIVBY32768, 0.251818180f * DIVBY32768, 0.154545456f * DIVBY32768 };
+        static const float backright_coeffs[4] = { 0.154545456f * DIVBY32768, 0.251818180f * DIVBY32768, 0.154545456f * DIVBY32768, 0.251818180f * DIVBY32768 };
+        const float32x4_t front = vdupq_n_f32(0.294545442f * DIVBY32768);
+        const float32x4_t center = vdupq_n_f32(0.208181813f * DIVBY32768);
+        const float32x4_t lfe = vdupq_n_f32(0.090909094f * DIVBY32768);
+        const float32x4_t backleft = vld1q_f32(backleft_coeffs);
+        const float32x4_t backright = vld1q_f32(backright_coeffs);
+        while (i >= 2) {   /* 2 * 5.1 Sint16 frames */
+            const int16x8_t shorts1 = vld1q_s16((const int16_t *) src);  /* FL0 FR0 FC0 LFE0 BL0 BR0 FL1 FR1 */
+            const int16x4_t shorts2 = vld1_s16((const int16_t *) (src + 8));  /* FC1 LFE1 BL1 BR1 */
+            const float32x4_t floats1 = vcvtq_f32_s32(vmovl_s16(vget_low_s16(shorts1)));
+            const float32x4_t floats2 = vcvtq_f32_s32(vmovl_s16(vget_high_s16(shorts1)));
+            const float32x4_t floats3 = vcvtq_f32_s32(vmovl_s16(shorts2));
+            float32x4_t sum = vmulq_f32(vcombine_f32(vget_low_f32(floats1), vget_high_f32(floats2)), front);  /* FL0 FR0 FL1 FR1 */
+            sum = vaddq_f32(sum, vmulq_f32(vcombine_f32(vdup_lane_f32(vget_high_f32(floats1), 0), vdup_lane_f32(vget_low_f32(floats3), 0)), center));  /* FC0 FC0 FC1 FC1 */
+            sum = vaddq_f32(sum, vmulq_f32(vcombine_f32(vdup_lane_f32(vget_high_f32(floats1), 1), vdup_lane_f32(vget_low_f32(floats3), 1)), lfe));  /* LFE0 LFE0 LFE1 LFE1 */
+            sum = vaddq_f32(sum, vmulq_f32(vcombine_f32(vdup_lane_f32(vget_low_f32(floats2), 0), vdup_lane_f32(vget_high_f32(floats3), 0)), backleft));  /* BL0 BL0 BL1 BL1 */
+            sum = vaddq_f32(sum, vmulq_f32(vcombine_f32(vdup_lane_f32(vget_low_f32(floats2), 1), vdup_lane_f32(vget_high_f32(floats3), 1)), backright));  /* BR0 BR0 BR1 BR1 */
+            vst1q_f32(dst, sum);
+            i -= 2; src += 12; dst += 4;
+        }
+    }
+
+    /* Finish off any leftover frame with scalar operations. */
+    if (i) {
+        const float srcFL = ((float) src[0]) * DIVBY32768;
+        const float srcFR = ((float) src[1]) * DIVBY32768;
+        const float srcFC = ((float) src[2]) * DIVBY32768;
+        const float srcLFE = ((float) src[3]) * DIVBY32768;
+        const float srcBL = ((float) src[4]) * DIVBY32768;
+        const float srcBR = ((float) src[5]) * DIVBY32768;
+        dst[0] /* FL */ = (srcFL * 0.294545442f) + (srcFC * 0.208181813f) + (srcLFE * 0.090909094f) + (srcBL * 0.251818180f) + (srcBR * 0.154545456f);
+        dst[1] /* FR */ = (srcFR * 0.294545442f) + (srcFC * 0.208181813f) + (srcLFE * 0.090909094f) + (srcBL * 0.154545456f) + (srcBR * 0.251818180f);
+    }
+
+    cvt->len_cvt = ((cvt->len_cvt * 2) / 6) * 2;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_F32SYS);
+    }
+}
+#endif
+
+
 
 void SDL_ChooseAudioConverters(void)
 {
@@ -1403,9 +2144,23 @@ void SDL_ChooseAudioConverters(void)
         SDL_Convert_F32_to_S32 = SDL_Convert_F32_to_S32_##fntype; \
         converters_chosen = SDL_TRUE
 
+#define SET_FUSED_CONVERTER_FUNCS(fntype) \
+        SDL_Convert_S16_to_F32_StereoToMono = SDL_Convert_S16_to_F32_StereoToMono_##fntype; \
+        SDL_Convert_S16_to_F32_MonoToStereo = SDL_Convert_S16_to_F32_MonoToStereo_##fntype; \
+        SDL_Convert_S16_to_F32_51ToStereo = SDL_Convert_S16_to_F32_51ToStereo_##fntype
+
+#if HAVE_AVX2_INTRINSICS && HAVE_SSE2_INTRINSICS
+    if (SDL_HasAVX2()) {
+        SET_CONVERTER_FUNCS(AVX2);
+        SET_FUSED_CONVERTER_FUNCS(SSE2);  /* AVX2 implies SSE2, and these are cheap enough already. */
+        return;
+    }
+#endif
+
 #if HAVE_SSE2_INTRINSICS
     if (SDL_HasSSE2()) {
         SET_CONVERTER_FUNCS(SSE2);
+        SET_FUSED_CONVERTER_FUNCS(SSE2);
         return;
     }
 #endif
@@ -1413,14 +2168,17 @@ void SDL_ChooseAudioConverters(void)
 #if HAVE_NEON_INTRINSICS
     if (SDL_HasNEON()) {
         SET_CONVERTER_FUNCS(NEON);
+        SET_FUSED_CONVERTER_FUNCS(NEON);
         return;
     }
 #endif
 
 #if NEED_SCALAR_CONVERTER_FALLBACKS
     SET_CONVERTER_FUNCS(Scalar);
+    SET_FUSED_CONVERTER_FUNCS(Scalar);
 #endif
 
+#undef SET_FUSED_CONVERTER_FUNCS
 #undef SET_CONVERTER_FUNCS
 
     SDL_assert(converters_chosen == SDL_TRUE);
@@ -27,6 +27,40 @@
 #include "SDL_audio.h"
 #include "SDL_sysaudio.h"
 
+#ifdef __SSE2__
+#define HAVE_SSE2_INTRINSICS 1
+#endif
+
+#ifdef __ARM_NEON
+#define HAVE_NEON_INTRINSICS 1
+#endif
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#if defined(HAVE_IMMINTRIN_H) && !defined(SDL_DISABLE_IMMINTRIN_H)
+#define HAVE_AVX2_INTRINSICS 1
+#endif
+#if defined __clang__
+# if (!__has_attribute(target))
+#   undef HAVE_AVX2_INTRINSICS
+# endif
+# if (defined(_MSC_VER) || defined(__SCE__)) && !defined(__AVX2__)
+#   undef HAVE_AVX2_INTRINSICS
+# endif
+#elif defined __GNUC__
+# if (__GNUC__ < 4) || (__GNUC__ == 4 && __GNUC_MINOR__ < 9)
+#   undef HAVE_AVX2_INTRINSICS
+# endif
+#endif
+#endif
+
+#if HAVE_AVX2_INTRINSICS
+#if defined(__clang__) || defined(__GNUC__)
+#define SDL_TARGETING_AVX2 __attribute__((target("avx2")))
+#else
+#define SDL_TARGETING_AVX2
+#endif
+#endif
+
 /* This table is used to add two sound values together and pin
  * the value to avoid overflow.  (used with permission from ARDI)
  */
@@ -86,14 +120,10 @@ static const Uint8 mix8[] = {
 #define ADJUST_VOLUME_U16(s, v)  (s = (((s-32768)*v)/SDL_MIX_MAXVOLUME)+32768)
 
 
-void
-SDL_MixAudioFormat(Uint8 * dst, const Uint8 * src, SDL_AudioFormat format,
-                   Uint32 len, int volume)
+static void
+SDL_MixAudioFormat_Scalar(Uint8 * dst, const Uint8 * src, SDL_AudioFormat format,
+                          Uint32 len, int volume)
 {
-    if (volume == 0) {
-        return;
-    }
-
     switch (format) {
 
     case AUDIO_U8:
@@ -354,4 +384,553 @@ SDL_MixAudioFormat(Uint8 * dst, const Uint8 * src, SDL_AudioFormat format,
     }
 }
 
+/* The SIMD mixers below handle the native-endian formats that audio devices
+   actually use. They produce exactly the same results as the scalar code:
+   volume is applied with the same rounding toward zero as ADJUST_VOLUME,
+   and saturating adds clamp to the same range. */
+
+#if HAVE_SSE2_INTRINSICS
+static void
+SDL_MixAudio_S16_SSE2(Uint8 * dst, const Uint8 * src, Uint32 len, int volume)
+{
+    const __m128i vol = _mm_set1_epi16((short) volume);
+    const __m128i bias = _mm_set1_epi32(SDL_MIX_MAXVOLUME - 1);
+    const Uint32 blocklen = len & ~15;
+    Uint32 i = 0;
+
+    if (volume == SDL_MIX_MAXVOLUME) {
+        for (i = 0; i < blocklen; i += 16) {
+            const __m128i s = _mm_loadu_si128((const __m128i *) (src + i));
+            const __m128i d = _mm_loadu_si128((const __m128i *) (dst + i));
+            _mm_storeu_si128((__m128i *) (dst + i), _mm_adds_epi16(s, d));
+        }
+    } else {
+        for (i = 0; i < blocklen; i += 16) {
+            const __m128i s = _mm_loadu_si128((const __m128i *) (src + i));
+            const __m128i d = _mm_loadu_si128((const __m128i *) (dst + i));
+            const __m128i lo = _mm_mullo_epi16(s, vol);
+            const __m128i hi = _mm_mulhi_epi16(s, vol);
+            __m128i p0 = _mm_unpacklo_epi16(lo, hi);
+            __m128i p1 = _mm_unpackhi_epi16(lo, hi);
+            /* Divide by SDL_MIX_MAXVOLUME, rounding negative values toward zero */
+            p0 = _mm_srai_epi32(_mm_add_epi32(p0, _mm_and_si128(_mm_srai_epi32(p0, 31), bias)), 7);
+            p1 = _mm_srai_epi32(_mm_add_epi32(p1, _mm_and_si128(_mm_srai_epi32(p1, 31), bias)), 7);
+            _mm_storeu_si128((__m128i *) (dst + i), _mm_adds_epi16(_mm_packs_epi32(p0, p1), d));
+        }
+    }
+
+    if (i < len) {
+        SDL_MixAudioFormat_Scalar(dst + i, src + i, AUDIO_S16SYS, len - i, volume);
+    }
+}
+
+static SDL_INLINE __m128i
+SDL_AddSaturateS32_SSE2(const __m128i a, const __m128i b)
+{
+    const __m128i sum = _mm_add_epi32(a, b);
+    /* The add overflowed if a and b have the same sign and the sum doesn't */
+    const __m128i overflow = _mm_srai_epi32(_mm_andnot_si128(_mm_xor_si128(a, b), _mm_xor_si128(a, sum)), 31);
+    const __m128i saturated = _mm_xor_si128(_mm_srai_epi32(a, 31), _mm_set1_epi32(SDL_MAX_SINT32));
+    return _mm_or_si128(_mm_and_si128(overflow, saturated), _mm_andnot_si128(overflow, sum));
+}
+
+static void
+SDL_MixAudio_S32_SSE2(Uint8 * dst, const Uint8 * src, Uint32 len, int volume)
+{
+    /* sample * volume is exact in a double, and scaling by 1/128 is too */
+    const __m128d scale = _mm_set1_pd(((double) volume) / SDL_MIX_MAXVOLUME);
+    const Uint32 blocklen = len & ~15;
+    Uint32 i;
+
+    for (i = 0; i < blocklen; i += 16) {
+        __m128i s = _mm_loadu_si128((const __m128i *) (src + i));
+        const __m128i d = _mm_loadu_si128((const __m128i *) (dst + i));
+        if (volume != SDL_MIX_MAXVOLUME) {
+            const __m128i lo = _mm_cvttpd_epi32(_mm_mul_pd(_mm_cvtepi32_pd(s), scale));
+            const __m128i hi = _mm_cvttpd_epi32(_mm_mul_pd(_mm_cvtepi32_pd(_mm_shuffle_epi32(s, _MM_SHUFFLE(1, 0, 3, 2))), scale));
+            s = _mm_unpacklo_epi64(lo, hi);
+        }
+        _mm_storeu_si128((__m128i *) (dst + i), SDL_AddSaturateS32_SSE2(s, d));
+    }
+
+    if (i < len) {
+        SDL_MixAudioFormat_Scalar(dst + i, src + i, AUDIO_S32SYS, len - i, volume);
+    }
+}
+
+static void
+SDL_MixAudio_F32_SSE2(Uint8 * dst, const Uint8 * src, Uint32 len, int volume)
+{
+    const __m128 fvolume = _mm_set1_ps((float) volume);
+    const __m128 fmaxvolume = _mm_set1_ps(1.0f / ((float) SDL_MIX_MAXVOLUME));
+    const __m128 max_audioval = _mm_set1_ps(3.402823466e+38F);
+    const __m128 min_audioval = _mm_set1_ps(-3.402823466e+38F);
+    const Uint32 blocklen = len & ~15;
+    Uint32 i;
+
+    for (i = 0; i < blocklen; i += 16) {
+        const __m128 s = _mm_mul_ps(_mm_mul_ps(_mm_loadu_ps((const float *) (src + i)), fvolume), fmaxvolume);
+        __m128 sum = _mm_add_ps(s, _mm_loadu_ps((const float *) (dst + i)));
+        /* The limits go first so that NaN passes through, as in the scalar code */
+        sum = _mm_max_ps(min_audioval, _mm_min_ps(max_audioval, sum));
+        _mm_storeu_ps((float *) (dst + i), sum);
+    }
+
+    if (i < len) {
+        SDL_MixAudioFormat_Scalar(dst + i, src + i, AUDIO_F32SYS, len - i, volume);
+    }
+}
+#endif /* HAVE_SSE2_INTRINSICS */
+
+#if HAVE_AVX2_INTRINSICS
+static void SDL_TARGETING_AVX2
+SDL_MixAudio_S16_AVX2(Uint8 * dst, const Uint8 * src, Uint32 len, int volume)
+{
+    const __m256i vol = _mm256_set1_epi16((short) volume);
+    const __m256i bias = _mm256_set1_epi32(SDL_MIX_MAXVOLUME - 1);
+    const Uint32 blocklen = len & ~31;
+    Uint32 i;
+
+    for (i = 0; i < blocklen; i += 32) {
+        __m256i s = _mm256_loadu_si256((const __m256i *) (src + i));
+        const __m256i d = _mm256_loadu_si256((const __m256i *) (dst + i));
+        if (volume != SDL_MIX_MAXVOLUME) {
+            /* The unpacks and the pack both work within 128-bit lanes, so the order comes back out right */
+            const __m256i lo = _mm256_mullo_epi16(s, vol);
+            const __m256i hi = _mm256_mulhi_epi16(s, vol);
+            __m256i p0 = _mm256_unpacklo_epi16(lo, hi);
+            __m256i p1 = _mm256_unpackhi_epi16(lo, hi);
+            p0 = _mm256_srai_epi32(_mm256_add_epi32(p0, _mm256_and_si256(_mm256_srai_epi32(p0, 31), bias)), 7);
+            p1 = _mm256_srai_epi32(_mm256_add_epi32(p1, _mm256_and_si256(_mm256_srai_epi32(p1, 31), bias)), 7);
+            s = _mm256_packs_epi32(p0, p1);
+        }
+        _mm256_storeu_si256((__m256i *) (dst + i), _mm256_adds_epi16(s, d));
+    }
+
+    if (i < len) {
+        SDL_MixAudioFormat_Scalar(dst + i, src + i, AUDIO_S16SYS, len - i, volume);
+    }
+}
+
+static void SDL_TARGETING_AVX2
+SDL_MixAudio_S32_AVX2(Uint8 * dst, const Uint8 * src, Uint32 len, int volume)
+{
+    const __m256d scale = _mm256_set1_pd(((double) volume) / SDL_MIX_MAXVOLUME);
+    const __m256i maxval = _mm256_set1_epi32(SDL_MAX_SINT32);
+    const Uint32 blocklen = len & ~31;
+    Uint32 i;
+
+    for (i = 0; i < blocklen; i += 32) {
+        __m256i s = _mm256_loadu_si256((const __m256i *) (src + i));
+        const __m256i d = _mm256_loadu_si256((const __m256i *) (dst + i));
+        __m256i sum, overflow, saturated;
+        if (volume != SDL_MIX_MAXVOLUME) {
+            const __m128i lo = _mm256_cvttpd_epi32(_mm256_mul_pd(_mm256_cvtepi32_pd(_mm256_castsi256_si128(s)), scale));
+            const __m128i hi = _mm256_cvttpd_epi32(_mm256_mul_pd(_mm256_cvtepi32_pd(_mm256_extracti128_si256(s, 1)), scale));
+            s = _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+        }
+        sum = _mm256_add_epi32(s, d);
+        overflow = _mm256_srai_epi32(_mm256_andnot_si256(_mm256_xor_si256(s, d), _mm256_xor_si256(s, sum)), 31);
+        saturated = _mm256_xor_si256(_mm256_srai_epi32(s, 31), maxval);
+        _mm256_storeu_si256((__m256i *) (dst + i), _mm256_blendv_epi8(sum, saturated, overflow));
+    }
+
+    if (i < len) {
+        SDL_MixAudioFormat_Scalar(dst + i, src + i, AUDIO_S32SYS, len - i, volume);
+    }
+}
+
+static void SDL_TARGETING_AVX2
+SDL_MixAudio_F32_AVX2(Uint8 * dst, const Uint8 * src, Uint32 len, int volume)
+{
+    const __m256 fvolume = _mm256_set1_ps((float) volume);
+    const __m256 fmaxvolume = _mm256_set1_ps(1.0f / ((float) SDL_MIX_MAXVOLUME));
+    const __m256 max_audioval = _mm256_set1_ps(3.402823466e+38F);
+    const __m256 min_audioval = _mm256_set1_ps(-3.402823466e+38F);
+    const Uint32 blocklen = len & ~31;
+    Uint32 i;
+
+    for (i = 0; i < blocklen; i += 32) {
+        const __m256 s = _mm256_mul_ps(_mm256_mul_ps(_mm256_loadu_ps((const float *) (src + i)), fvolume), fmaxvolume);
+        __m256 sum = _mm256_add_ps(s, _mm256_loadu_ps((const float *) (dst + i)));
+        sum = _mm256_max_ps(min_audioval, _mm256_min_ps(max_audioval, sum));
+        _mm256_storeu_ps((float *) (dst + i), sum);
+    }
+
+    if (i < len) {
+        SDL_MixAudioFormat_Scalar(dst + i, src + i, AUDIO_F32SYS, len - i, volume);
+    }
+}
+#endif /* HAVE_AVX2_INTRINSICS */
+
+#if HAVE_NEON_INTRINSICS
+static void
+SDL_MixAudio_S16_NEON(Uint8 * dst, const Uint8 * src, Uint32 len, int volume)
+{
+    const int16x4_t vol = vdup_n_s16((int16_t) volume);
+    const int32x4_t bias = vdupq_n_s32(SDL_MIX_MAXVOLUME - 1);
+    const Uint32 blocklen = len & ~15;
+    Uint32 i;
+
+    for (i = 0; i < blocklen; i += 16) {
+        int16x8_t s = vld1q_s16((const int16_t *) (src + i));
+        const int16x8_t d = vld1q_s16((const int16_t *) (dst + i));
+        if (volume != SDL_MIX_MAXVOLUME) {
+            int32x4_t p0 = vmull_s16(vget_low_s16(s), vol);
+            int32x4_t p1 = vmull_s16(vget_high_s16(s), vol);
+            /* Divide by SDL_MIX_MAXVOLUME, rounding negative values toward zero */
+            p0 = vaddq_s32(p0, vandq_s32(vshrq_n_s32(p0, 31), bias));
+            p1 = vaddq_s32(p1, vandq_s32(vshrq_n_s32(p1, 31), bias));
+            s = vcombine_s16(vshrn_n_s32(p0, 7), vshrn_n_s32(p1, 7));
+        }
+        vst1q_s16((int16_t *) (dst + i), vqaddq_s16(s, d));
+    }
+
+    if (i < len) {
+        SDL_MixAudioFormat_Scalar(dst + i, src + i, AUDIO_S16SYS, len - i, volume);
+    }
+}
+
+static void
+SDL_MixAudio_S32_NEON(Uint8 * dst, const Uint8 * src, Uint32 len, int volume)
+{
+    const int32x2_t vol = vdup_n_s32(volume);
+    const int64x2_t bias = vdupq_n_s64(SDL_MIX_MAXVOLUME - 1);
+    const Uint32 blocklen = len & ~15;
+    Uint32 i;
+
+    for (i = 0; i < blocklen; i += 16) {
+        int32x4_t s = vld1q_s32((const int32_t *) (src + i));
+        const int32x4_t d = vld1q_s32((const int32_t *) (dst + i));
+        if (volume != SDL_MIX_MAXVOLUME) {
+            int64x2_t p0 = vmull_s32(vget_low_s32(s), vol);
+            int64x2_t p1 = vmull_s32(vget_high_s32(s), vol);
+            p0 = vaddq_s64(p0, vandq_s64(vshrq_n_s64(p0, 63), bias));
+            p1 = vaddq_s64(p1, vandq_s64(vshrq_n_s64(p1, 63), bias));
+            s = vcombine_s32(vshrn_n_s64(p0, 7), vshrn_n_s64(p1, 7));
+        }
+        vst1q_s32((int32_t *) (dst + i), vqaddq_s32(s, d));
+    }
+
+    if (i < len) {
+        SDL_MixAudioFormat_Scalar(dst + i, src + i, AUDIO_S32SYS, len - i, volume);
+    }
+}
+
+static void
+SDL_MixAudio_F32_NEON(Uint8 * dst, const Uint8 * src, Uint32 len, int volume)
+{
+    const float32x4_t fvolume = vdupq_n_f32((float) volume);
+    const float32x4_t fmaxvolume = vdupq_n_f32(1.0f / ((float) SDL_MIX_MAXVOLUME));
+    const float32x4_t max_audioval = vdupq_n_f32(3.402823466e+38F);
+    const float32x4_t min_audioval = vdupq_n_f32(-3.402823466e+38F);
+    const Uint32 blocklen = len & ~15;
+    Uint32 i;
+
+    for (i = 0; i < blocklen; i += 16) {
+        const float32x4_t s = vmulq_f32(vmulq_f32(vld1q_f32((const float *) (src + i)), fvolume), fmaxvolume);
+        float32x4_t sum = vaddq_f32(s, vld1q_f32((const float *) (dst + i)));
+        sum = vmaxq_f32(min_audioval, vminq_f32(max_audioval, sum));
+        vst1q_f32((float *) (dst + i), sum);
+    }
+
+    if (i < len) {
+        SDL_MixAudioFormat_Scalar(dst + i, src + i, AUDIO_F32SYS, len - i, volume);
+    }
+}
+#endif /* HAVE_NEON_INTRINSICS */
+
+typedef void (*SDL_MixAudioFunc)(Uint8 * dst, const Uint8 * src, Uint32 len, int volume);
+
+static SDL_MixAudioFunc SDL_MixAudio_S16 = NULL;
+static SDL_MixAudioFunc SDL_MixAudio_S32 = NULL;
+static SDL_MixAudioFunc SDL_MixAudio_F32 = NULL;
+
+static void
+SDL_ChooseMixers(void)
+{
+    static SDL_bool mixers_chosen = SDL_FALSE;
+
+    if (mixers_chosen) {
+        return;
+    }
+
+#define SET_MIXER_FUNCS(fntype) \
+        SDL_MixAudio_S16 = SDL_MixAudio_S16_##fntype; \
+        SDL_MixAudio_S32 = SDL_MixAudio_S32_##fntype; \
+        SDL_MixAudio_F32 = SDL_MixAudio_F32_##fntype; \
+        mixers_chosen = SDL_TRUE
+
+#if HAVE_AVX2_INTRINSICS
+    if (SDL_HasAVX2()) {
+        SET_MIXER_FUNCS(AVX2);
+        return;
+    }
+#endif
+
+#if HAVE_SSE2_INTRINSICS
+    if (SDL_HasSSE2()) {
+        SET_MIXER_FUNCS(SSE2);
+        return;
+    }
+#endif
+
+#if HAVE_NEON_INTRINSICS
+    if (SDL_HasNEON()) {
+        SET_MIXER_FUNCS(NEON);
+        return;
+    }
+#endif
+
+#undef SET_MIXER_FUNCS
+
+    mixers_chosen = SDL_TRUE;
+}
+
+void
+SDL_MixAudioFormat(Uint8 * dst, const Uint8 * src, SDL_AudioFormat format,
+                   Uint32 len, int volume)
+{
+    if (volume == 0) {
+        return;
+    }
+
+    SDL_ChooseMixers();
+
+    /* Out of range volumes wrap around in the scalar code, leave them to it */
+    if (volume > 0 && volume <= SDL_MIX_MAXVOLUME) {
+        if (format == AUDIO_S16SYS && SDL_MixAudio_S16) {
+            SDL_MixAudio_S16(dst, src, len, volume);
+            return;
+        } else if (format == AUDIO_S32SYS && SDL_MixAudio_S32) {
+            SDL_MixAudio_S32(dst, src, len, volume);
+            return;
+        } else if (format == AUDIO_F32SYS && SDL_MixAudio_F32) {
+            SDL_MixAudio_F32(dst, src, len, volume);
+            return;
+        }
+    }
+
+    SDL_MixAudioFormat_Scalar(dst, src, format, len, volume);
+}
+
+/* Mixing several sources at once keeps the running sum in a wider
+   accumulator, so the destination is only read and written once and the sum
+   is only clipped after every source has been added. The integer formats
+   also add up the exact sample * volume products and divide once at the
+   end, instead of rounding every source. */
+
+/* Keeps the sum of 16-bit sample * volume products within 32 bits */
+#define MIX_MAX_SIMD_SOURCES_S16 255
+
+static SDL_bool
+SDL_MixVolumesInRange(const int *volumes, int num_srcs)
+{
+    int n;
+
+    if (volumes) {
+        for (n = 0; n < num_srcs; n++) {
+            if (volumes[n] < 0 || volumes[n] > SDL_MIX_MAXVOLUME) {
+                return SDL_FALSE;
+            }
+        }
+    }
+    return SDL_TRUE;
+}
+
+static void
+SDL_MixAudioMultiple_S16(Uint8 * dst, const Uint8 ** srcs, const int *volumes, int num_srcs, Uint32 len)
+{
+    Sint16 *dst16 = (Sint16 *) dst;
+    const Uint32 num_samples = len / sizeof (Sint16);
+    Uint32 i = 0;
+    int n;
+
+#if HAVE_SSE2_INTRINSICS
+    if (num_srcs <= MIX_MAX_SIMD_SOURCES_S16 && SDL_MixVolumesInRange(volumes, num_srcs) && SDL_HasSSE2()) {
+        const __m128i bias = _mm_set1_epi32(SDL_MIX_MAXVOLUME - 1);
+        for (; (i + 8) <= num_samples; i += 8) {
+            const __m128i d = _mm_loadu_si128((const __m128i *) (dst16 + i));
+            __m128i acc0 = _mm_setzero_si128();
+            __m128i acc1 = _mm_setzero_si128();
+            for (n = 0; n < num_srcs; n++) {
+                const __m128i vol = _mm_set1_epi16((short) (volumes ? volumes[n] : SDL_MIX_MAXVOLUME));
+                const __m128i s = _mm_loadu_si128((const __m128i *) (((const Sint16 *) srcs[n]) + i));
+                const __m128i lo = _mm_mullo_epi16(s, vol);
+                const __m128i hi = _mm_mulhi_epi16(s, vol);
+                acc0 = _mm_add_epi32(acc0, _mm_unpacklo_epi16(lo, hi));
+                acc1 = _mm_add_epi32(acc1, _mm_unpackhi_epi16(lo, hi));
+            }
+            /* Divide by SDL_MIX_MAXVOLUME, rounding toward zero, and add the destination */
+            acc0 = _mm_srai_epi32(_mm_add_epi32(acc0, _mm_and_si128(_mm_srai_epi32(acc0, 31), bias)), 7);
+            acc1 = _mm_srai_epi32(_mm_add_epi32(acc1, _mm_and_si128(_mm_srai_epi32(acc1, 31), bias)), 7);
+            acc0 = _mm_add_epi32(acc0, _mm_srai_epi32(_mm_unpacklo_epi16(d, d), 16));
+            acc1 = _mm_add_epi32(acc1, _mm_srai_epi32(_mm_unpackhi_epi16(d, d), 16));
+            _mm_storeu_si128((__m128i *) (dst16 + i), _mm_packs_epi32(acc0, acc1));
+        }
+    }
+#elif HAVE_NEON_INTRINSICS
+    if (num_srcs <= MIX_MAX_SIMD_SOURCES_S16 && SDL_MixVolumesInRange(volumes, num_srcs) && SDL_HasNEON()) {
+        const int32x4_t bias = vdupq_n_s32(SDL_MIX_MAXVOLUME - 1);
+        for (; (i + 8) <= num_samples; i += 8) {
+            const int16x8_t d = vld1q_s16((const int16_t *) (dst16 + i));
+            int32x4_t acc0 = vdupq_n_s32(0);
+            int32x4_t acc1 = vdupq_n_s32(0);
+            for (n = 0; n < num_srcs; n++) {
+                const int16x4_t vol = vdup_n_s16((int16_t) (volumes ? volumes[n] : SDL_MIX_MAXVOLUME));
+                const int16x8_t s = vld1q_s16(((const int16_t *) srcs[n]) + i);
+                acc0 = vmlal_s16(acc0, vget_low_s16(s), vol);
+                acc1 = vmlal_s16(acc1, vget_high_s16(s), vol);
+            }
+            acc0 = vshrq_n_s32(vaddq_s32(acc0, vandq_s32(vshrq_n_s32(acc0, 31), bias)), 7);
+            acc1 = vshrq_n_s32(vaddq_s32(acc1, vandq_s32(vshrq_n_s32(acc1, 31), bias)), 7);
+            acc0 = vaddw_s16(acc0, vget_low_s16(d));
+            acc1 = vaddw_s16(acc1, vget_high_s16(d));
+            vst1q_s16((int16_t *) (dst16 + i), vcombine_s16(vqmovn_s32(acc0), vqmovn_s32(acc1)));
+        }
+    }
+#endif
+
+    for (; i < num_samples; i++) {
+        Sint64 products = 0;
+        Sint64 sample;
+        for (n = 0; n < num_srcs; n++) {
+            const int volume = volumes ? volumes[n] : SDL_MIX_MAXVOLUME;
+            products += ((const Sint16 *) srcs[n])[i] * volume;
+        }
+        sample = dst16[i] + (products / SDL_MIX_MAXVOLUME);
+        dst16[i] = (Sint16) SDL_clamp(sample, SDL_MIN_SINT16, SDL_MAX_SINT16);
+    }
+}
+
+static void
+SDL_MixAudioMultiple_S32(Uint8 * dst, const Uint8 ** srcs, const int *volumes, int num_srcs, Uint32 len)
+{
+    Sint32 *dst32 = (Sint32 *) dst;
+    const Uint32 num_samples = len / sizeof (Sint32);
+    Uint32 i;
+    int n;
+
+    for (i = 0; i < num_samples; i++) {
+        Sint64 products = 0;
+        Sint64 sample;
+        for (n = 0; n < num_srcs; n++) {
+            const int volume = volumes ? volumes[n] : SDL_MIX_MAXVOLUME;
+            products += ((Sint64) ((const Sint32 *) srcs[n])[i]) * volume;
+        }
+        sample = dst32[i] + (products / SDL_MIX_MAXVOLUME);
+        dst32[i] = (Sint32) SDL_clamp(sample, SDL_MIN_SINT32, SDL_MAX_SINT32);
+    }
+}
+
+static void
+SDL_MixAudioMultiple_F32(Uint8 * dst, const Uint8 ** srcs, const int *volumes, int num_srcs, Uint32 len)
+{
+    /* Scaling by volume / SDL_MIX_MAXVOLUME in one step is exact, it's a power of two */
+    const float fmaxvolume = 1.0f / ((float) SDL_MIX_MAXVOLUME);
+    const float max_audioval = 3.402823466e+38F;
+    const float min_audioval = -3.402823466e+38F;
+    float *dst32 = (float *) dst;
+    const Uint32 num_samples = len / sizeof (float);
+    Uint32 i = 0;
+    int n;
+
+#if HAVE_SSE2_INTRINSICS
+    if (SDL_HasSSE2()) {
+        const __m128 max4 = _mm_set1_ps(max_audioval);
+        const __m128 min4 = _mm_set1_ps(min_audioval);
+        for (; (i + 4) <= num_samples; i += 4) {
+            __m128 acc = _mm_loadu_ps(dst32 + i);
+            for (n = 0; n < num_srcs; n++) {
+                const __m128 scale = _mm_set1_ps(((float) (volumes ? volumes[n] : SDL_MIX_MAXVOLUME)) * fmaxvolume);
+                acc = _mm_add_ps(acc, _mm_mul_ps(_mm_loadu_ps(((const float *) srcs[n]) + i), scale));
+            }
+            _mm_storeu_ps(dst32 + i, _mm_max_ps(min4, _mm_min_ps(max4, acc)));
+        }
+    }
+#elif HAVE_NEON_INTRINSICS
+    if (SDL_HasNEON()) {
+        const float32x4_t max4 = vdupq_n_f32(max_audioval);
+        const float32x4_t min4 = vdupq_n_f32(min_audioval);
+        for (; (i + 4) <= num_samples; i += 4) {
+            float32x4_t acc = vld1q_f32(dst32 + i);
+            for (n = 0; n < num_srcs; n++) {
+                const float scale = ((float) (volumes ? volumes[n] : SDL_MIX_MAXVOLUME)) * fmaxvolume;
+                acc = vaddq_f32(acc, vmulq_n_f32(vld1q_f32(((const float *) srcs[n]) + i), scale));
+            }
+            vst1q_f32(dst32 + i, vmaxq_f32(min4, vminq_f32(max4, acc)));
+        }
+    }
+#endif
+
+    for (; i < num_samples; i++) {
+        float sample = dst32[i];
+        for (n = 0; n < num_srcs; n++) {
+            const float scale = ((float) (volumes ? volumes[n] : SDL_MIX_MAXVOLUME)) * fmaxvolume;
+            sample += ((const float *) srcs[n])[i] * scale;
+        }
+        if (sample > max_audioval) {
+            sample = max_audioval;
+        } else if (sample < min_audioval) {
+            sample = min_audioval;
+        }
+        dst32[i] = sample;
+    }
+}
+
+int
+SDL_MixAudioFormatMultiple(Uint8 * dst, const Uint8 ** srcs, const int *volumes,
+                           int num_srcs, SDL_AudioFormat format, Uint32 len)
+{
+    int n;
+
+    if (!dst) {
+        return SDL_InvalidParamError("dst");
+    }
+    if (num_srcs < 0) {
+        return SDL_InvalidParamError("num_srcs");
+    }
+    if (num_srcs > 0 && !srcs) {
+        return SDL_InvalidParamError("srcs");
+    }
+    for (n = 0; n < num_srcs; n++) {
+        if (!srcs[n]) {
+            return SDL_InvalidParamError("srcs");
+        }
+    }
+
+    switch (format) {
+    case AUDIO_U8:
+    case AUDIO_S8:
+    case AUDIO_S16LSB:
+    case AUDIO_S16MSB:
+    case AUDIO_U16LSB:
+    case AUDIO_U16MSB:
+    case AUDIO_S32LSB:
+    case AUDIO_S32MSB:
+    case AUDIO_F32LSB:
+    case AUDIO_F32MSB:
+        break;
+    default:
+        return SDL_SetError("SDL_MixAudioFormatMultiple(): unknown audio format");
+    }
+
+    if (num_srcs == 1) {
+        /* Rounding a single source once is the same as SDL_MixAudioFormat() */
+        SDL_MixAudioFormat(dst, srcs[0], format, len, volumes ? volumes[0] : SDL_MIX_MAXVOLUME);
+    } else if (format == AUDIO_S16SYS) {
+        SDL_MixAudioMultiple_S16(dst, srcs, volumes, num_srcs, len);
+    } else if (format == AUDIO_S32SYS) {
+        SDL_MixAudioMultiple_S32(dst, srcs, volumes, num_srcs, len);
+    } else if (format == AUDIO_F32SYS) {
+        SDL_MixAudioMultiple_F32(dst, srcs, volumes, num_srcs, len);
+    } else {
+        /* Devices don't use the other formats, so just add each source in turn */
+        for (n = 0; n < num_srcs; n++) {
+            SDL_MixAudioFormat(dst, srcs[n], format, len, volumes ? volumes[n] : SDL_MIX_MAXVOLUME);
+        }
+    }
+    return 0;
+}
+
 /* vi: set ts=4 sw=4 expandtab: */
@@ -51,17 +51,6 @@ extern void SDL_RemoveAudioDevice(const SDL_bool iscapture, void *handle);
    as appropriate so SDL's list of devices is accurate. */
 extern void SDL_OpenedAudioDeviceDisconnected(SDL_AudioDevice *device);
 
-/* This is the size of a packet when using SDL_QueueAudio(). We allocate
-   these as necessary and pool them, under the assumption that we'll
-   eventually end up with a handful that keep recycling, meeting whatever
-   the app needs. We keep packing data tightly as more arrives to avoid
-   wasting space, and if we get a giant block of data, we'll split them
-   into multiple packets behind the scenes. My expectation is that most
-   apps will have 2-3 of these in the pool. 8k should cover most needs, but
-   if this is crippling for some embedded system, we can #ifdef this.
-   The system preallocates enough packets for 2 callbacks' worth of data. */
-#define SDL_AUDIOBUFFERQUEUE_PACKETLEN (8 * 1024)
-
 typedef struct SDL_AudioDriverImpl
 {
     void (*DetectDevices) (void);
@@ -161,8 +150,26 @@ struct SDL_AudioDevice
     SDL_Thread *thread;
     SDL_threadID threadid;
 
-    /* Queued buffers (if app not using callback). */
-    SDL_DataQueue *buffer_queue;
+    /* Queued buffers (if app not using callback). The audio thread is the
+       one side of this queue and never blocks; buffer_queue_lock serializes
+       the application threads on the other side. */
+    SDL_RingQueue *buffer_queue;
+    SDL_mutex *buffer_queue_lock;
+
+    /* Performance counters for SDL_GetAudioDeviceStats(). The audio thread
+       updates them, holding stats_lock for just as long as that takes. */
+    SDL_SpinLock stats_lock;
+    SDL_AudioDeviceStats stats;
+    Uint32 stats_stream_bytes;  /* converted audio waiting in the stream. */
+    SDL_bool queue_was_playing;  /* so a queue that stays empty is one underrun. */
+
+    /* Audio sources mixed in after the callback. The audio thread converts
+       them in parallel; the array only changes with the device locked. */
+    SDL_AudioSource **sources;
+    const Uint8 **source_mix_bufs;
+    int *source_mix_volumes;
+    int num_sources;
+    int max_sources;
 
     /* * * */
     /* Data private to this driver */
@@ -1165,8 +1165,11 @@ LAW_Init(WaveFile *file, size_t datalength)
     return 0;
 }
 
+/* Expands sample_count companded samples in src to 16-bit samples in dst.
+ * The buffers may be the same memory; dst must have room for all samples.
+ */
 static int
-LAW_Decode(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
+LAW_DecodeSamples(Uint16 encoding, const Uint8 *src, Sint16 *dst, size_t sample_count)
 {
 #ifdef SDL_WAVE_LAW_LUT
     const Sint16 alaw_lut[256] = {
@@ -1207,53 +1210,13 @@ LAW_Decode(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
     };
 #endif
 
-    WaveFormat *format = &file->format;
-    WaveChunk *chunk = &file->chunk;
-    size_t i, sample_count, expanded_len;
-    Uint8 *src;
-    Sint16 *dst;
-
-    if (chunk->length != chunk->size) {
-        file->sampleframes = WaveAdjustToFactValue(file, chunk->size / format->blockalign);
-        if (file->sampleframes < 0) {
-            return -1;
-        }
-    }
-
-    /* Nothing to decode, nothing to return. */
-    if (file->sampleframes == 0) {
-        *audio_buf = NULL;
-        *audio_len = 0;
-        return 0;
-    }
-
-    sample_count = (size_t)file->sampleframes;
-    if (SafeMult(&sample_count, format->channels)) {
-        return SDL_OutOfMemory();
-    }
-
-    expanded_len = sample_count;
-    if (SafeMult(&expanded_len, sizeof(Sint16))) {
-        return SDL_OutOfMemory();
-    } else if (expanded_len > SDL_MAX_UINT32 || file->sampleframes > SIZE_MAX) {
-        return SDL_SetError("WAVE file too big");
-    }
-
-    /* 1 to avoid allocating zero bytes, to keep static analysis happy. */
-    src = (Uint8 *)SDL_realloc(chunk->data, expanded_len ? expanded_len : 1);
-    if (src == NULL) {
-        return SDL_OutOfMemory();
-    }
-    chunk->data = NULL;
-    chunk->size = 0;
-
-    dst = (Sint16 *)src;
+    size_t i;
 
     /* Work backwards, since we're expanding in-place. SDL_AudioSpec.format will
      * inform the caller about the byte order.
      */
     i = sample_count;
-    switch (file->format.encoding) {
+    switch (encoding) {
 #ifdef SDL_WAVE_LAW_LUT
     case ALAW_CODE:
         while (i--) {
@@ -1298,10 +1261,62 @@ LAW_Decode(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
         break;
 #endif
     default:
-        SDL_free(src);
         return SDL_SetError("Unknown companded encoding");
     }
 
+    return 0;
+}
+
+static int
+LAW_Decode(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
+{
+    WaveFormat *format = &file->format;
+    WaveChunk *chunk = &file->chunk;
+    size_t sample_count, expanded_len;
+    Uint8 *src;
+    Sint16 *dst;
+
+    if (chunk->length != chunk->size) {
+        file->sampleframes = WaveAdjustToFactValue(file, chunk->size / format->blockalign);
+        if (file->sampleframes < 0) {
+            return -1;
+        }
+    }
+
+    /* Nothing to decode, nothing to return. */
+    if (file->sampleframes == 0) {
+        *audio_buf = NULL;
+        *audio_len = 0;
+        return 0;
+    }
+
+    sample_count = (size_t)file->sampleframes;
+    if (SafeMult(&sample_count, format->channels)) {
+        return SDL_OutOfMemory();
+    }
+
+    expanded_len = sample_count;
+    if (SafeMult(&expanded_len, sizeof(Sint16))) {
+        return SDL_OutOfMemory();
+    } else if (expanded_len > SDL_MAX_UINT32 || file->sampleframes > SIZE_MAX) {
+        return SDL_SetError("WAVE file too big");
+    }
+
+    /* 1 to avoid allocating zero bytes, to keep static analysis happy. */
+    src = (Uint8 *)SDL_realloc(chunk->data, expanded_len ? expanded_len : 1);
+    if (src == NULL) {
+        return SDL_OutOfMemory();
+    }
+    chunk->data = NULL;
+    chunk->size = 0;
+
+    dst = (Sint16 *)src;
+
+    if (LAW_DecodeSamples(file->format.encoding, src, dst, sample_count) < 0) {
+        SDL_free(src);
+        return -1;
+    }
+
     *audio_buf = src;
     *audio_len = (Uint32)expanded_len;
 
@@ -1352,12 +1367,35 @@ PCM_Init(WaveFile *file, size_t datalength)
     return 0;
 }
 
+/* Shifts sample_count packed 24-bit samples in ptr to 32 bits, in place. */
+static void
+PCM_ExpandSint24ToSint32(Uint8 *ptr, size_t sample_count)
+{
+    size_t i;
+
+    /* work from end to start, since we're expanding in-place. */
+    for (i = sample_count; i > 0; i--) {
+        const size_t o = i - 1;
+        uint8_t b[4];
+
+        b[0] = 0;
+        b[1] = ptr[o * 3];
+        b[2] = ptr[o * 3 + 1];
+        b[3] = ptr[o * 3 + 2];
+
+        ptr[o * 4 + 0] = b[0];
+        ptr[o * 4 + 1] = b[1];
+        ptr[o * 4 + 2] = b[2];
+        ptr[o * 4 + 3] = b[3];
+    }
+}
+
 static int
 PCM_ConvertSint24ToSint32(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
 {
     WaveFormat *format = &file->format;
     WaveChunk *chunk = &file->chunk;
-    size_t i, expanded_len, sample_count;
+    size_t expanded_len, sample_count;
     Uint8 *ptr;
 
     sample_count = (size_t)file->sampleframes;
@@ -1385,21 +1423,7 @@ PCM_ConvertSint24ToSint32(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
     *audio_buf = ptr;
     *audio_len = (Uint32)expanded_len;
 
-    /* work from end to start, since we're expanding in-place. */
-    for (i = sample_count; i > 0; i--) {
-        const size_t o = i - 1;
-        uint8_t b[4];
-
-        b[0] = 0;
-        b[1] = ptr[o * 3];
-        b[2] = ptr[o * 3 + 1];
-        b[3] = ptr[o * 3 + 2];
-
-        ptr[o * 4 + 0] = b[0];
-        ptr[o * 4 + 1] = b[1];
-        ptr[o * 4 + 2] = b[2];
-        ptr[o * 4 + 3] = b[3];
-    }
+    PCM_ExpandSint24ToSint32(ptr, sample_count);
 
     return 0;
 }
@@ -1783,8 +1807,12 @@ WaveCheckFormat(WaveFile *file, size_t datalength)
     return 0;
 }
 
+/* Reads the RIFF header and the fmt and fact chunks, and checks the format.
+ * The data chunk header is stored in datachunk, without its data, and the
+ * position after the last chunk is stored in endposition.
+ */
 static int
-WaveLoad(SDL_RWops *src, WaveFile *file, SDL_AudioSpec *spec, Uint8 **audio_buf, Uint32 *audio_len)
+WaveReadHeaders(SDL_RWops *src, WaveFile *file, WaveChunk *datachunk, Sint64 *endposition)
 {
     int result;
     Uint32 chunkcount = 0;
@@ -1792,15 +1820,13 @@ WaveLoad(SDL_RWops *src, WaveFile *file, SDL_AudioSpec *spec, Uint8 **audio_buf,
     char *envchunkcountlimit;
     Sint64 RIFFstart, RIFFend, lastchunkpos;
     SDL_bool RIFFlengthknown = SDL_FALSE;
-    WaveFormat *format = &file->format;
     WaveChunk *chunk = &file->chunk;
     WaveChunk RIFFchunk;
     WaveChunk fmtchunk;
-    WaveChunk datachunk;
 
     SDL_zero(RIFFchunk);
     SDL_zero(fmtchunk);
-    SDL_zero(datachunk);
+    SDL_zerop(datachunk);
 
     envchunkcountlimit = SDL_getenv("SDL_WAVE_CHUNK_LIMIT");
     if (envchunkcountlimit != NULL) {
@@ -1891,7 +1917,7 @@ WaveLoad(SDL_RWops *src, WaveFile *file, SDL_AudioSpec *spec, Uint8 **audio_buf,
                 /* Multiple fmt chunks. Ignore or error? */
             } else {
                 /* The fmt chunk must occur before the data chunk. */
-                if (datachunk.fourcc == DATA) {
+                if (datachunk->fourcc == DATA) {
                     return SDL_SetError("fmt chunk after data chunk in WAVE file");
                 }
                 fmtchunk = *chunk;
@@ -1900,8 +1926,8 @@ WaveLoad(SDL_RWops *src, WaveFile *file, SDL_AudioSpec *spec, Uint8 **audio_buf,
             /* Only use the first data chunk. Handling the wavl list madness
              * may require a different approach.
              */
-            if (datachunk.fourcc != DATA) {
-                datachunk = *chunk;
+            if (datachunk->fourcc != DATA) {
+                *datachunk = *chunk;
             }
         } else if (chunk->fourcc == FACT) {
             /* The fact chunk data must be at least 4 bytes for the
@@ -1931,7 +1957,7 @@ WaveLoad(SDL_RWops *src, WaveFile *file, SDL_AudioSpec *spec, Uint8 **audio_buf,
             if ((Uint64)RIFFend < (Uint64)chunk->position + chunk->length) {
                 return SDL_SetError("RIFF size truncates chunk");
             }
-        } else if (fmtchunk.fourcc == FMT && datachunk.fourcc == DATA) {
+        } else if (fmtchunk.fourcc == FMT && datachunk->fourcc == DATA) {
             if (file->fact.status == 1 || file->facthint == FactIgnore || file->facthint == FactNoHint) {
                 break;
             }
@@ -1948,7 +1974,7 @@ WaveLoad(SDL_RWops *src, WaveFile *file, SDL_AudioSpec *spec, Uint8 **audio_buf,
         return SDL_SetError("Missing fmt chunk in WAVE file");
     }
     /* A data chunk must be present. */
-    if (datachunk.fourcc != DATA) {
+    if (datachunk->fourcc != DATA) {
         return SDL_SetError("Missing data chunk in WAVE file");
     }
     /* Check if the last chunk has all of its data in verystrict mode. */
@@ -1984,7 +2010,7 @@ WaveLoad(SDL_RWops *src, WaveFile *file, SDL_AudioSpec *spec, Uint8 **audio_buf,
         return SDL_SetError("Could not read data of WAVE fmt chunk");
     } else if (WaveReadFormat(file) < 0) {
         return -1;
-    } else if (WaveCheckFormat(file, (size_t)datachunk.length) < 0) {
+    } else if (WaveCheckFormat(file, (size_t)datachunk->length) < 0) {
         return -1;
     }
 
@@ -1992,11 +2018,82 @@ WaveLoad(SDL_RWops *src, WaveFile *file, SDL_AudioSpec *spec, Uint8 **audio_buf,
     WaveDebugLogFormat(file);
 #endif
 #ifdef SDL_WAVE_DEBUG_DUMP_FORMAT
-    WaveDebugDumpFormat(file, RIFFchunk.length, fmtchunk.length, datachunk.length);
+    WaveDebugDumpFormat(file, RIFFchunk.length, fmtchunk.length, datachunk->length);
 #endif
 
     WaveFreeChunkData(chunk);
 
+    /* Report the end position back to the cleanup code. */
+    if (RIFFlengthknown) {
+        *endposition = RIFFend;
+    } else {
+        *endposition = lastchunkpos;
+    }
+
+    return 0;
+}
+
+/* Sets up the SDL_AudioSpec for the decoded data. All unsupported formats
+ * were filtered out by the checks in WaveReadHeaders.
+ */
+static int
+WaveSetupSpec(WaveFile *file, SDL_AudioSpec *spec)
+{
+    WaveFormat *format = &file->format;
+
+    SDL_zerop(spec);
+    spec->freq = format->frequency;
+    spec->channels = (Uint8)format->channels;
+    spec->samples = 4096;       /* Good default buffer size */
+
+    switch (format->encoding) {
+    case MS_ADPCM_CODE:
+    case IMA_ADPCM_CODE:
+    case ALAW_CODE:
+    case MULAW_CODE:
+        /* These can be easily stored in the byte order of the system. */
+        spec->format = AUDIO_S16SYS;
+        break;
+    case IEEE_FLOAT_CODE:
+        spec->format = AUDIO_F32LSB;
+        break;
+    case PCM_CODE:
+        switch (format->bitspersample) {
+        case 8:
+            spec->format = AUDIO_U8;
+            break;
+        case 16:
+            spec->format = AUDIO_S16LSB;
+            break;
+        case 24: /* Has been shifted to 32 bits. */
+        case 32:
+            spec->format = AUDIO_S32LSB;
+            break;
+        default:
+            /* Just in case something unexpected happened in the checks. */
+            return SDL_SetError("Unexpected %u-bit PCM data format", (unsigned int)format->bitspersample);
+        }
+        break;
+    }
+
+    spec->silence = SDL_SilenceValueForFormat(spec->format);
+
+    return 0;
+}
+
+static int
+WaveLoad(SDL_RWops *src, WaveFile *file, SDL_AudioSpec *spec, Uint8 **audio_buf, Uint32 *audio_len)
+{
+    int result;
+    Sint64 endposition = 0;
+    WaveFormat *format = &file->format;
+    WaveChunk *chunk = &file->chunk;
+    WaveChunk datachunk;
+
+    if (WaveReadHeaders(src, file, &datachunk, &endposition) < 0) {
+        return -1;
+    }
+
     /* Process data chunk. */
     *chunk = datachunk;
 
@@ -2043,52 +2140,12 @@ WaveLoad(SDL_RWops *src, WaveFile *file, SDL_AudioSpec *spec, Uint8 **audio_buf,
         break;
     }
 
-    /* Setting up the SDL_AudioSpec. All unsupported formats were filtered out
-     * by checks earlier in this function.
-     */
-    SDL_zerop(spec);
-    spec->freq = format->frequency;
-    spec->channels = (Uint8)format->channels;
-    spec->samples = 4096;       /* Good default buffer size */
-
-    switch (format->encoding) {
-    case MS_ADPCM_CODE:
-    case IMA_ADPCM_CODE:
-    case ALAW_CODE:
-    case MULAW_CODE:
-        /* These can be easily stored in the byte order of the system. */
-        spec->format = AUDIO_S16SYS;
-        break;
-    case IEEE_FLOAT_CODE:
-        spec->format = AUDIO_F32LSB;
-        break;
-    case PCM_CODE:
-        switch (format->bitspersample) {
-        case 8:
-            spec->format = AUDIO_U8;
-            break;
-        case 16:
-            spec->format = AUDIO_S16LSB;
-            break;
-        case 24: /* Has been shifted to 32 bits. */
-        case 32:
-            spec->format = AUDIO_S32LSB;
-            break;
-        default:
-            /* Just in case something unexpected happened in the checks. */
-            return SDL_SetError("Unexpected %u-bit PCM data format", (unsigned int)format->bitspersample);
-        }
-        break;
+    if (WaveSetupSpec(file, spec) < 0) {
+        return -1;
     }
 
-    spec->silence = SDL_SilenceValueForFormat(spec->format);
-
     /* Report the end position back to the cleanup code. */
-    if (RIFFlengthknown) {
-        chunk->position = RIFFend;
-    } else {
-        chunk->position = lastchunkpos;
-    }
+    chunk->position = endposition;
 
     return 0;
 }
@@ -2152,4 +2209,409 @@ SDL_FreeWAV(Uint8 *audio_buf)
     SDL_free(audio_buf);
 }
 
+/* Streaming decoder. PCM and companded data are read straight into the
+ * caller's buffer and converted in place. ADPCM is decoded one block at a
+ * time, so memory use doesn't depend on the length of the file.
+ */
+struct SDL_WaveStream
+{
+    SDL_RWops *src;
+    int freesrc;
+    WaveFile file;          /* file.chunk is the data chunk. Its data is never loaded. */
+    size_t datalength;      /* Number of bytes in the data chunk that can be read. */
+    size_t datapos;         /* Read position in the data chunk. */
+    SDL_bool needseek;      /* Set if src is not at datapos. */
+    size_t inframesize;     /* Size of a sample frame in the data chunk (PCM and companded data). */
+    size_t outframesize;    /* Size of a sample frame returned to the caller. */
+    Sint64 framestotal;     /* Number of sample frames in the stream. */
+    Sint64 frame;           /* Next sample frame returned to the caller. */
+
+    /* ADPCM only. The current block and the sample frames decoded from it. */
+    ADPCM_DecoderState state;
+    size_t decodedframes;   /* Number of decoded sample frames in state.output. */
+    size_t decodedpos;      /* Next decoded sample frame returned to the caller. */
+    size_t skipframes;      /* Sample frames to drop from the next block after a seek. */
+};
+
+static int
+WaveCalculateSampleFrames(WaveFile *file, size_t datalength)
+{
+    switch (file->format.encoding) {
+    case MS_ADPCM_CODE:
+        return MS_ADPCM_CalculateSampleFrames(file, datalength);
+    case IMA_ADPCM_CODE:
+        return IMA_ADPCM_CalculateSampleFrames(file, datalength);
+    default:
+        file->sampleframes = WaveAdjustToFactValue(file, datalength / file->format.blockalign);
+        return file->sampleframes < 0 ? -1 : 0;
+    }
+}
+
+static int
+WaveStreamInit(SDL_WaveStream *stream, SDL_AudioSpec *spec)
+{
+    WaveFile *file = &stream->file;
+    WaveFormat *format = &file->format;
+    WaveChunk *chunk = &file->chunk;
+    ADPCM_DecoderState *state = &stream->state;
+    WaveChunk datachunk;
+    Sint64 endposition = 0;
+    Sint64 srcsize;
+
+    if (WaveReadHeaders(stream->src, file, &datachunk, &endposition) < 0) {
+        return -1;
+    }
+
+    *chunk = datachunk;
+
+    /* Don't load the data, but find out how much of it is actually there. */
+    stream->datalength = chunk->length;
+    srcsize = SDL_RWsize(stream->src);
+    if (srcsize >= 0 && srcsize - chunk->position < (Sint64)chunk->length) {
+        /* I/O issues or corrupt file. */
+        if (file->trunchint == TruncVeryStrict || file->trunchint == TruncStrict) {
+            return SDL_SetError("Could not read data of WAVE data chunk");
+        }
+        stream->datalength = srcsize > chunk->position ? (size_t)(srcsize - chunk->position) : 0;
+        if (WaveCalculateSampleFrames(file, stream->datalength) < 0) {
+            return -1;
+        }
+    }
+
+    if (WaveSetupSpec(file, spec) < 0) {
+        return -1;
+    }
+    stream->outframesize = (SDL_AUDIO_BITSIZE(spec->format) / 8) * (size_t)format->channels;
+
+    switch (format->encoding) {
+    case MS_ADPCM_CODE:
+    case IMA_ADPCM_CODE:
+        stream->framestotal = file->sampleframes;
+        state->channels = format->channels;
+        state->blocksize = format->blockalign;
+        state->blockheadersize = (size_t)state->channels * (format->encoding == MS_ADPCM_CODE ? 7 : 4);
+        state->samplesperblock = format->samplesperblock;
+        state->framesize = state->channels * sizeof(Sint16);
+        state->framestotal = file->sampleframes;
+        state->ddata = file->decoderdata;
+        state->output.size = state->samplesperblock * state->channels;
+
+        state->block.data = (Uint8 *)SDL_malloc(state->blocksize);
+        state->output.data = (Sint16 *)SDL_malloc(state->output.size * sizeof(Sint16));
+        if (format->encoding == MS_ADPCM_CODE) {
+            state->cstate = SDL_calloc(2, sizeof(MS_ADPCM_ChannelState));
+        } else {
+            state->cstate = SDL_calloc(state->channels, sizeof(Sint8));
+        }
+        if (state->block.data == NULL || state->output.data == NULL || state->cstate == NULL) {
+            return SDL_OutOfMemory();
+        }
+        break;
+    default:
+        /* PCM_Init made sure the frame size is a multiple of the block size. */
+        stream->inframesize = (size_t)format->channels * (format->bitspersample / 8);
+        stream->framestotal = (file->sampleframes * format->blockalign) / stream->inframesize;
+        break;
+    }
+
+    return 0;
+}
+
+/* Reads up to length bytes from the current position in the data chunk. */
+static int
+WaveStreamRead(SDL_WaveStream *stream, void *buf, size_t length, size_t *bytesread)
+{
+    *bytesread = 0;
+
+    if (stream->datapos >= stream->datalength) {
+        return 0;
+    } else if (length > stream->datalength - stream->datapos) {
+        length = stream->datalength - stream->datapos;
+    }
+
+    if (stream->needseek) {
+        const Sint64 position = stream->file.chunk.position + (Sint64)stream->datapos;
+        if (SDL_RWseek(stream->src, position, RW_SEEK_SET) != position) {
+            return SDL_SetError("Could not seek data of WAVE data chunk");
+        }
+        stream->needseek = SDL_FALSE;
+    }
+
+    *bytesread = SDL_RWread(stream->src, buf, 1, length);
+    stream->datapos += *bytesread;
+
+    return 0;
+}
+
+/* Reads and decodes the ADPCM block at the current position. Leaves no
+ * decoded sample frames behind when the end of the data is reached.
+ */
+static int
+WaveStreamDecodeBlock(SDL_WaveStream *stream)
+{
+    WaveFile *file = &stream->file;
+    ADPCM_DecoderState *state = &stream->state;
+    const size_t block = stream->datapos / state->blocksize;
+    const Sint64 blockframe = (Sint64)block * state->samplesperblock;
+    size_t blocksize;
+    int result;
+
+    stream->decodedframes = 0;
+    stream->decodedpos = 0;
+
+    state->framesleft = stream->framestotal - blockframe;
+    if (state->framesleft <= 0) {
+        return 0;
+    }
+
+    if (WaveStreamRead(stream, state->block.data, state->blocksize, &blocksize) < 0) {
+        return -1;
+    } else if (blocksize != state->blocksize) {
+        /* A short block can only be the last one; make sure the next read doesn't reuse it. */
+        stream->datapos = (block + 1) * state->blocksize;
+        stream->needseek = SDL_TRUE;
+    }
+
+    if (blocksize < state->blockheadersize) {
+        /* Unexpected end. */
+        stream->framestotal = blockframe;
+        if (stream->frame > stream->framestotal) {
+            stream->frame = stream->framestotal;
+        }
+        return 0;
+    }
+
+    state->block.size = blocksize;
+    state->block.pos = 0;
+    state->output.pos = 0;
+
+    if (file->format.encoding == MS_ADPCM_CODE) {
+        if (MS_ADPCM_DecodeBlockHeader(state) < 0) {
+            return -1;
+        }
+        result = MS_ADPCM_DecodeBlockData(state);
+    } else {
+        IMA_ADPCM_DecodeBlockHeader(state);
+        result = IMA_ADPCM_DecodeBlockData(state);
+    }
+
+    if (result == -1) {
+        /* Truncated block. Same rules as decoding the whole file at once. */
+        if (file->trunchint == TruncVeryStrict || file->trunchint == TruncStrict) {
+            return SDL_SetError("Truncated data chunk");
+        } else if (file->trunchint != TruncDropFrame) {
+            state->output.pos -= state->output.pos % (state->samplesperblock * state->channels);
+        }
+    }
+
+    /* The MS ADPCM header always provides two sample frames, even if only one is left. */
+    stream->decodedframes = state->output.pos / state->channels;
+    if ((Sint64)stream->decodedframes > stream->framestotal - blockframe) {
+        stream->decodedframes = (size_t)(stream->framestotal - blockframe);
+    } else if (result == -1) {
+        /* The sample frame count of a truncated block is only an estimate until it is decoded. */
+        stream->framestotal = blockframe + stream->decodedframes;
+        if (stream->frame > stream->framestotal) {
+            stream->frame = stream->framestotal;
+        }
+    }
+
+    stream->decodedpos = stream->skipframes < stream->decodedframes ? stream->skipframes : stream->decodedframes;
+    stream->skipframes = 0;
+
+    return 0;
+}
+
+SDL_WaveStream *
+SDL_OpenWaveStream_RW(SDL_RWops *src, int freesrc, SDL_AudioSpec *spec)
+{
+    SDL_WaveStream *stream;
+
+    /* Make sure we are passed a valid data source */
+    if (src == NULL) {
+        /* Error may come from RWops. */
+        return NULL;
+    } else if (spec == NULL) {
+        SDL_InvalidParamError("spec");
+        if (freesrc) {
+            SDL_RWclose(src);
+        }
+        return NULL;
+    }
+
+    stream = (SDL_WaveStream *)SDL_calloc(1, sizeof(*stream));
+    if (stream == NULL) {
+        SDL_OutOfMemory();
+        if (freesrc) {
+            SDL_RWclose(src);
+        }
+        return NULL;
+    }
+
+    stream->src = src;
+    stream->freesrc = freesrc;
+    stream->needseek = SDL_TRUE;
+    stream->file.riffhint = WaveGetRiffSizeHint();
+    stream->file.trunchint = WaveGetTruncationHint();
+    stream->file.facthint = WaveGetFactChunkHint();
+
+    if (WaveStreamInit(stream, spec) < 0) {
+        SDL_CloseWaveStream(stream);
+        return NULL;
+    }
+
+    return stream;
+}
+
+int
+SDL_ReadWaveStream(SDL_WaveStream *stream, void *buf, int len)
+{
+    Uint8 *dst = (Uint8 *)buf;
+    WaveFormat *format;
+    Sint64 frames;
+    int total = 0;
+
+    if (stream == NULL) {
+        return SDL_InvalidParamError("stream");
+    } else if (buf == NULL) {
+        return SDL_InvalidParamError("buf");
+    } else if (len < 0) {
+        return SDL_InvalidParamError("len");
+    } else if (len > 0 && (size_t)len < stream->outframesize) {
+        return SDL_SetError("Can't request partial sample frames");
+    }
+
+    format = &stream->file.format;
+    frames = (Sint64)((size_t)len / stream->outframesize);
+    if (frames > stream->framestotal - stream->frame) {
+        frames = stream->framestotal - stream->frame;
+    }
+
+    if (format->encoding == MS_ADPCM_CODE || format->encoding == IMA_ADPCM_CODE) {
+        ADPCM_DecoderState *state = &stream->state;
+        while (frames > 0) {
+            size_t count;
+            if (stream->decodedpos >= stream->decodedframes) {
+                if (WaveStreamDecodeBlock(stream) < 0) {
+                    return -1;
+                } else if (stream->decodedpos >= stream->decodedframes) {
+                    break; /* Nothing left to decode. */
+                }
+            }
+
+            count = stream->decodedframes - stream->decodedpos;
+            if ((Sint64)count > frames) {
+                count = (size_t)frames;
+            }
+            SDL_memcpy(dst, state->output.data + stream->decodedpos * state->channels, count * stream->outframesize);
+            stream->decodedpos += count;
+            stream->frame += count;
+            dst += count * stream->outframesize;
+            total += (int)(count * stream->outframesize);
+            frames -= count;
+        }
+    } else if (frames > 0) {
+        const size_t samplesperframe = format->channels;
+        size_t bytesread, count;
+
+        /* The data is never bigger than its decoded form, so read it into the
+         * start of the caller's buffer and expand it in place.
+         */
+        if (WaveStreamRead(stream, dst, (size_t)frames * stream->inframesize, &bytesread) < 0) {
+            return -1;
+        }
+
+        count = bytesread / stream->inframesize;
+        if (bytesread % stream->inframesize) {
+            /* Incomplete sample frame. Read it again next time. */
+            stream->datapos -= bytesread % stream->inframesize;
+            stream->needseek = SDL_TRUE;
+        }
+
+        switch (format->encoding) {
+        case ALAW_CODE:
+        case MULAW_CODE:
+            if (LAW_DecodeSamples(format->encoding, dst, (Sint16 *)dst, count * samplesperframe) < 0) {
+                return -1;
+            }
+            break;
+        case PCM_CODE:
+            if (format->bitspersample == 24) {
+                PCM_ExpandSint24ToSint32(dst, count * samplesperframe);
+            }
+            break;
+        }
+
+        stream->frame += count;
+        total = (int)(count * stream->outframesize);
+    }
+
+    return total;
+}
+
+int
+SDL_SeekWaveStream(SDL_WaveStream *stream, Sint64 frame)
+{
+    WaveFormat *format;
+
+    if (stream == NULL) {
+        return SDL_InvalidParamError("stream");
+    } else if (frame < 0 || frame > stream->framestotal) {
+        return SDL_InvalidParamError("frame");
+    }
+
+    format = &stream->file.format;
+    if (format->encoding == MS_ADPCM_CODE || format->encoding == IMA_ADPCM_CODE) {
+        /* Blocks can only be decoded from the start. Decode the one holding
+         * the frame and drop the sample frames before it.
+         */
+        const Sint64 block = frame / stream->state.samplesperblock;
+        stream->datapos = (size_t)block * stream->state.blocksize;
+        stream->skipframes = (size_t)(frame - block * stream->state.samplesperblock);
+        stream->decodedframes = 0;
+        stream->decodedpos = 0;
+    } else {
+        stream->datapos = (size_t)frame * stream->inframesize;
+    }
+
+    stream->frame = frame;
+    stream->needseek = SDL_TRUE;
+
+    return 0;
+}
+
+Sint64
+SDL_TellWaveStream(SDL_WaveStream *stream)
+{
+    if (stream == NULL) {
+        return SDL_InvalidParamError("stream");
+    }
+    return stream->frame;
+}
+
+Sint64
+SDL_GetWaveStreamLength(SDL_WaveStream *stream)
+{
+    if (stream == NULL) {
+        return SDL_InvalidParamError("stream");
+    }
+    return stream->framestotal;
+}
+
+void
+SDL_CloseWaveStream(SDL_WaveStream *stream)
+{
+    if (stream != NULL) {
+        if (stream->freesrc) {
+            SDL_RWclose(stream->src);
+        }
+        WaveFreeChunkData(&stream->file.chunk);
+        SDL_free(stream->file.decoderdata);
+        SDL_free(stream->state.cstate);
+        SDL_free(stream->state.block.data);
+        SDL_free(stream->state.output.data);
+        SDL_free(stream);
+    }
+}
+
 /* vi: set ts=4 sw=4 expandtab: */
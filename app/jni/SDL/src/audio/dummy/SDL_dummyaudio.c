@@ -23,6 +23,7 @@
 /* Output audio to nowhere... */
 
 #include "SDL_timer.h"
+#include "SDL_hints.h"
 #include "SDL_audio.h"
 #include "../SDL_audio_c.h"
 #include "SDL_dummyaudio.h"
@@ -30,27 +31,58 @@
 static int
 DUMMYAUDIO_OpenDevice(_THIS, const char *devname)
 {
-    _this->hidden = (void *) 0x1;  /* just something non-NULL */
-    return 0;                   /* always succeeds. */
+    _this->hidden = (struct SDL_PrivateAudioData *) SDL_calloc(1, sizeof (*_this->hidden));
+    if (_this->hidden == NULL) {
+        return SDL_OutOfMemory();
+    }
+
+    if (!SDL_GetHintBoolean(SDL_HINT_AUDIO_SIMULATED_CLOCK, SDL_FALSE)) {
+        _this->hidden->io_delay = ((_this->spec.samples * 1000) / _this->spec.freq);
+    } else if (!_this->iscapture) {
+        /* "Play" into a buffer of our own, so SDL_RunAudio() doesn't sleep
+           between buffers. SDL_GetAudioDeviceStats() keeps the time. */
+        _this->hidden->mixbuf = (Uint8 *) SDL_malloc(_this->spec.size);
+        if (_this->hidden->mixbuf == NULL) {
+            return SDL_OutOfMemory();
+        }
+    }
+    return 0;
+}
+
+static Uint8 *
+DUMMYAUDIO_GetDeviceBuf(_THIS)
+{
+    return _this->hidden->mixbuf;
 }
 
 static int
 DUMMYAUDIO_CaptureFromDevice(_THIS, void *buffer, int buflen)
 {
     /* Delay to make this sort of simulate real audio input. */
-    SDL_Delay((_this->spec.samples * 1000) / _this->spec.freq);
+    if (_this->hidden->io_delay) {
+        SDL_Delay(_this->hidden->io_delay);
+    }
 
     /* always return a full buffer of silence. */
     SDL_memset(buffer, _this->spec.silence, buflen);
     return buflen;
 }
 
+static void
+DUMMYAUDIO_CloseDevice(_THIS)
+{
+    SDL_free(_this->hidden->mixbuf);
+    SDL_free(_this->hidden);
+}
+
 static SDL_bool
 DUMMYAUDIO_Init(SDL_AudioDriverImpl * impl)
 {
     /* Set the function pointers */
     impl->OpenDevice = DUMMYAUDIO_OpenDevice;
+    impl->GetDeviceBuf = DUMMYAUDIO_GetDeviceBuf;
     impl->CaptureFromDevice = DUMMYAUDIO_CaptureFromDevice;
+    impl->CloseDevice = DUMMYAUDIO_CloseDevice;
 
     impl->OnlyHasDefaultOutputDevice = SDL_TRUE;
     impl->OnlyHasDefaultCaptureDevice = SDL_TRUE;
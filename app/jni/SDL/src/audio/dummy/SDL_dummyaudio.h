@@ -30,11 +30,10 @@
 
 struct SDL_PrivateAudioData
 {
-    /* The file descriptor for the audio device */
+    /* Only used with a simulated clock; otherwise SDL_RunAudio() waits on
+       the work buffer itself. */
     Uint8 *mixbuf;
-    Uint32 mixlen;
-    Uint32 write_delay;
-    Uint32 initial_calls;
+    Uint32 io_delay;
 };
 
 #endif /* SDL_dummyaudio_h_ */
@@ -44,7 +44,7 @@ SDL_WSCONS_mouse_input_data* SDL_WSCONS_Init_Mouse()
 
     if (!mouseInputData) return NULL;
     mouseInputData->fd = open("/dev/wsmouse",O_RDWR | O_NONBLOCK | O_CLOEXEC);
-    if (mouseInputData->fd == -1) {free(mouseInputData); return NULL; }
+    if (mouseInputData->fd == -1) {SDL_free(mouseInputData); return NULL; }
 #ifdef WSMOUSEIO_SETMODE
     ioctl(mouseInputData->fd, WSMOUSEIO_SETMODE, WSMOUSE_COMPAT);
 #endif
@@ -130,5 +130,5 @@ void SDL_WSCONS_Quit_Mouse(SDL_WSCONS_mouse_input_data* inputData)
 {
     if (!inputData) return;
     close(inputData->fd);
-    free(inputData);
+    SDL_free(inputData);
 }
@@ -39,6 +39,7 @@
 /* CPU feature detection for SDL */
 
 #include "SDL_cpuinfo.h"
+#include "SDL_cpuinfo_c.h"
 #include "SDL_assert.h"
 
 #ifdef HAVE_SYSCONF
@@ -91,6 +92,17 @@
 
 #if defined(HAVE_GETAUXVAL) || defined(HAVE_ELF_AUX_INFO)
 #include <sys/auxv.h>
+#elif (defined(__LINUX__) || defined(__ANDROID__)) && defined(__aarch64__)
+#include <sys/auxv.h>  /* getauxval() is always there on 64-bit ARM Linux */
+#endif
+
+#if (defined(__LINUX__) || defined(__ANDROID__)) && defined(__aarch64__)
+#ifndef AT_HWCAP
+#define AT_HWCAP 16
+#endif
+#ifndef HWCAP_CRC32
+#define HWCAP_CRC32 (1 << 7)
+#endif
 #endif
 
 #ifdef __RISCOS__
@@ -118,6 +130,8 @@
 #define CPU_HAS_ARM_SIMD (1 << 13)
 #define CPU_HAS_LSX     (1 << 14)
 #define CPU_HAS_LASX    (1 << 15)
+#define CPU_HAS_PCLMUL  (1 << 16)
+#define CPU_HAS_ARM_CRC32 (1 << 17)
 
 #define CPU_CFG2 0x2
 #define CPU_CFG2_LSX    (1 << 6)
@@ -655,6 +669,32 @@ CPU_haveAVX512F(void)
 }
 #endif
 
+#if defined(__PCLMUL__)
+#define CPU_havePCLMUL() (1)
+#elif defined(__e2k__)
+#define CPU_havePCLMUL() (0)
+#else
+#define CPU_havePCLMUL() (CPU_CPUIDFeatures[2] & 0x00000002)
+#endif
+
+static int
+CPU_haveARMCRC32(void)
+{
+#if defined(SDL_CPUINFO_DISABLED)
+    return 0; /* disabled */
+#elif defined(__ARM_FEATURE_CRC32)
+    return 1; /* the compiler is already allowed to use it everywhere */
+#elif !defined(__aarch64__)
+    return 0; /* only used on 64-bit ARM */
+#elif defined(__APPLE__)
+    return 1; /* all Apple 64-bit ARM chips have the CRC32 instructions. */
+#elif defined(__LINUX__) || defined(__ANDROID__)
+    return ((getauxval(AT_HWCAP) & HWCAP_CRC32) == HWCAP_CRC32);
+#else
+    return 0;
+#endif
+}
+
 static int SDL_CPUCount = 0;
 
 int
@@ -922,6 +962,12 @@ SDL_GetCPUFeatures(void)
             SDL_CPUFeatures |= CPU_HAS_LASX;
             SDL_SIMDAlignment = SDL_max(SDL_SIMDAlignment, 32);
         }
+        if (CPU_havePCLMUL()) {
+            SDL_CPUFeatures |= CPU_HAS_PCLMUL;
+        }
+        if (CPU_haveARMCRC32()) {
+            SDL_CPUFeatures |= CPU_HAS_ARM_CRC32;
+        }
     }
     return SDL_CPUFeatures;
 }
@@ -1023,6 +1069,18 @@ SDL_HasLASX(void)
     return CPU_FEATURE_AVAILABLE(CPU_HAS_LASX);
 }
 
+SDL_bool
+SDL_HasPCLMUL(void)
+{
+    return CPU_FEATURE_AVAILABLE(CPU_HAS_PCLMUL);
+}
+
+SDL_bool
+SDL_HasARMCRC32(void)
+{
+    return CPU_FEATURE_AVAILABLE(CPU_HAS_ARM_CRC32);
+}
+
 static int SDL_SystemRAM = 0;
 
 int
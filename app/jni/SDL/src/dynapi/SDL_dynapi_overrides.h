@@ -893,3 +893,46 @@
 #define SDL_SensorGetDataWithTimestamp SDL_SensorGetDataWithTimestamp_REAL
 #define SDL_ResetHints SDL_ResetHints_REAL
 #define SDL_strcasestr SDL_strcasestr_REAL
+#define SDL_GetEventHistory SDL_GetEventHistory_REAL
+#define SDL_DelayNS SDL_DelayNS_REAL
+#define SDL_CreateFramePacer SDL_CreateFramePacer_REAL
+#define SDL_SetFramePacerInterval SDL_SetFramePacerInterval_REAL
+#define SDL_FramePacerWait SDL_FramePacerWait_REAL
+#define SDL_GetFramePacerStats SDL_GetFramePacerStats_REAL
+#define SDL_DestroyFramePacer SDL_DestroyFramePacer_REAL
+#define SDL_GetAllocationStats SDL_GetAllocationStats_REAL
+#define SDL_ParallelSort SDL_ParallelSort_REAL
+#define SDL_RadixSortU32 SDL_RadixSortU32_REAL
+#define SDL_RadixSortU64 SDL_RadixSortU64_REAL
+#define SDL_UpdateHintCache SDL_UpdateHintCache_REAL
+#define SDL_GetCachedHintBoolean SDL_GetCachedHintBoolean_REAL
+#define SDL_GetCachedHintInt SDL_GetCachedHintInt_REAL
+#define SDL_LogFlush SDL_LogFlush_REAL
+#define SDL_LogGetDroppedMessages SDL_LogGetDroppedMessages_REAL
+#define SDL_StartTrace SDL_StartTrace_REAL
+#define SDL_StopTrace SDL_StopTrace_REAL
+#define SDL_TraceBeginZone SDL_TraceBeginZone_REAL
+#define SDL_TraceEndZone SDL_TraceEndZone_REAL
+#define SDL_TraceCounter SDL_TraceCounter_REAL
+#define SDL_TraceFlowStart SDL_TraceFlowStart_REAL
+#define SDL_TraceFlowEnd SDL_TraceFlowEnd_REAL
+#define SDL_AtomicWaitTimeout SDL_AtomicWaitTimeout_REAL
+#define SDL_AtomicWait SDL_AtomicWait_REAL
+#define SDL_AtomicWake SDL_AtomicWake_REAL
+#define SDL_AtomicWakeAll SDL_AtomicWakeAll_REAL
+#define SDL_MixAudioFormatMultiple SDL_MixAudioFormatMultiple_REAL
+#define SDL_GetAudioDeviceStats SDL_GetAudioDeviceStats_REAL
+#define SDL_ResetAudioDeviceStats SDL_ResetAudioDeviceStats_REAL
+#define SDL_OpenWaveStream_RW SDL_OpenWaveStream_RW_REAL
+#define SDL_ReadWaveStream SDL_ReadWaveStream_REAL
+#define SDL_SeekWaveStream SDL_SeekWaveStream_REAL
+#define SDL_TellWaveStream SDL_TellWaveStream_REAL
+#define SDL_GetWaveStreamLength SDL_GetWaveStreamLength_REAL
+#define SDL_CloseWaveStream SDL_CloseWaveStream_REAL
+#define SDL_AudioStreamPutMultiple SDL_AudioStreamPutMultiple_REAL
+#define SDL_NewAudioSource SDL_NewAudioSource_REAL
+#define SDL_AudioSourcePut SDL_AudioSourcePut_REAL
+#define SDL_AudioSourceQueued SDL_AudioSourceQueued_REAL
+#define SDL_AudioSourceSetVolume SDL_AudioSourceSetVolume_REAL
+#define SDL_AudioSourceClear SDL_AudioSourceClear_REAL
+#define SDL_FreeAudioSource SDL_FreeAudioSource_REAL
@@ -976,3 +976,46 @@ SDL_DYNAPI_PROC(int,SDL_GameControllerGetSensorDataWithTimestamp,(SDL_GameContro
 SDL_DYNAPI_PROC(int,SDL_SensorGetDataWithTimestamp,(SDL_Sensor *a, Uint64 *b, float *c, int d),(a,b,c,d),return)
 SDL_DYNAPI_PROC(void,SDL_ResetHints,(void),(),)
 SDL_DYNAPI_PROC(char*,SDL_strcasestr,(const char *a, const char *b),(a,b),return)
+SDL_DYNAPI_PROC(int,SDL_GetEventHistory,(const SDL_Event *a, SDL_Event *b, int c),(a,b,c),return)
+SDL_DYNAPI_PROC(void,SDL_DelayNS,(Uint64 a),(a),)
+SDL_DYNAPI_PROC(SDL_FramePacer*,SDL_CreateFramePacer,(Uint64 a),(a),return)
+SDL_DYNAPI_PROC(int,SDL_SetFramePacerInterval,(SDL_FramePacer *a, Uint64 b),(a,b),return)
+SDL_DYNAPI_PROC(Uint64,SDL_FramePacerWait,(SDL_FramePacer *a),(a),return)
+SDL_DYNAPI_PROC(int,SDL_GetFramePacerStats,(SDL_FramePacer *a, SDL_FramePacerStats *b, SDL_bool c),(a,b,c),return)
+SDL_DYNAPI_PROC(void,SDL_DestroyFramePacer,(SDL_FramePacer *a),(a),)
+SDL_DYNAPI_PROC(int,SDL_GetAllocationStats,(SDL_AllocationStats *a, int b),(a,b),return)
+SDL_DYNAPI_PROC(void,SDL_ParallelSort,(void *a, size_t b, size_t c, int (SDLCALL *d)(const void *, const void *)),(a,b,c,d),)
+SDL_DYNAPI_PROC(int,SDL_RadixSortU32,(void *a, size_t b, size_t c, size_t d),(a,b,c,d),return)
+SDL_DYNAPI_PROC(int,SDL_RadixSortU64,(void *a, size_t b, size_t c, size_t d),(a,b,c,d),return)
+SDL_DYNAPI_PROC(SDL_bool,SDL_UpdateHintCache,(SDL_HintCache *a),(a),return)
+SDL_DYNAPI_PROC(SDL_bool,SDL_GetCachedHintBoolean,(SDL_HintCache *a, SDL_bool b),(a,b),return)
+SDL_DYNAPI_PROC(int,SDL_GetCachedHintInt,(SDL_HintCache *a, int b),(a,b),return)
+SDL_DYNAPI_PROC(void,SDL_LogFlush,(void),(),)
+SDL_DYNAPI_PROC(Uint32,SDL_LogGetDroppedMessages,(void),(),return)
+SDL_DYNAPI_PROC(int,SDL_StartTrace,(void),(),return)
+SDL_DYNAPI_PROC(int,SDL_StopTrace,(const char *a),(a),return)
+SDL_DYNAPI_PROC(void,SDL_TraceBeginZone,(const char *a),(a),)
+SDL_DYNAPI_PROC(void,SDL_TraceEndZone,(void),(),)
+SDL_DYNAPI_PROC(void,SDL_TraceCounter,(const char *a, Sint64 b),(a,b),)
+SDL_DYNAPI_PROC(void,SDL_TraceFlowStart,(const char *a, Uint64 b),(a,b),)
+SDL_DYNAPI_PROC(void,SDL_TraceFlowEnd,(const char *a, Uint64 b),(a,b),)
+SDL_DYNAPI_PROC(int,SDL_AtomicWaitTimeout,(SDL_atomic_t *a, int b, Uint32 c),(a,b,c),return)
+SDL_DYNAPI_PROC(int,SDL_AtomicWait,(SDL_atomic_t *a, int b),(a,b),return)
+SDL_DYNAPI_PROC(void,SDL_AtomicWake,(SDL_atomic_t *a),(a),)
+SDL_DYNAPI_PROC(void,SDL_AtomicWakeAll,(SDL_atomic_t *a),(a),)
+SDL_DYNAPI_PROC(int,SDL_MixAudioFormatMultiple,(Uint8 *a, const Uint8 **b, const int *c, int d, SDL_AudioFormat e, Uint32 f),(a,b,c,d,e,f),return)
+SDL_DYNAPI_PROC(int,SDL_GetAudioDeviceStats,(SDL_AudioDeviceID a, SDL_AudioDeviceStats *b),(a,b),return)
+SDL_DYNAPI_PROC(void,SDL_ResetAudioDeviceStats,(SDL_AudioDeviceID a),(a),)
+SDL_DYNAPI_PROC(SDL_WaveStream*,SDL_OpenWaveStream_RW,(SDL_RWops *a, int b, SDL_AudioSpec *c),(a,b,c),return)
+SDL_DYNAPI_PROC(int,SDL_ReadWaveStream,(SDL_WaveStream *a, void *b, int c),(a,b,c),return)
+SDL_DYNAPI_PROC(int,SDL_SeekWaveStream,(SDL_WaveStream *a, Sint64 b),(a,b),return)
+SDL_DYNAPI_PROC(Sint64,SDL_TellWaveStream,(SDL_WaveStream *a),(a),return)
+SDL_DYNAPI_PROC(Sint64,SDL_GetWaveStreamLength,(SDL_WaveStream *a),(a),return)
+SDL_DYNAPI_PROC(void,SDL_CloseWaveStream,(SDL_WaveStream *a),(a),)
+SDL_DYNAPI_PROC(int,SDL_AudioStreamPutMultiple,(SDL_AudioStream **a, const void **b, const int *c, int d),(a,b,c,d),return)
+SDL_DYNAPI_PROC(SDL_AudioSource*,SDL_NewAudioSource,(SDL_AudioDeviceID a, SDL_AudioFormat b, Uint8 c, int d),(a,b,c,d),return)
+SDL_DYNAPI_PROC(int,SDL_AudioSourcePut,(SDL_AudioSource *a, const void *b, int c),(a,b,c),return)
+SDL_DYNAPI_PROC(int,SDL_AudioSourceQueued,(SDL_AudioSource *a),(a),return)
+SDL_DYNAPI_PROC(int,SDL_AudioSourceSetVolume,(SDL_AudioSource *a, int b),(a,b),return)
+SDL_DYNAPI_PROC(void,SDL_AudioSourceClear,(SDL_AudioSource *a),(a),)
+SDL_DYNAPI_PROC(void,SDL_FreeAudioSource,(SDL_AudioSource *a),(a),)
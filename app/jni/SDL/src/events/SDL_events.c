@@ -44,6 +44,19 @@
 /* An arbitrary limit so we don't have unbounded growth */
 #define SDL_MAX_QUEUED_EVENTS   65535
 
+/* Number of events other threads can push without taking the queue lock,
+   must be a power of two */
+#define SDL_EVENT_RING_SIZE     1024
+
+/* Number of samples kept for SDL_GetEventHistory() per coalesced event */
+#define SDL_MAX_EVENT_HISTORY   64
+
+/* Number of delivered coalesced events whose samples are remembered */
+#define SDL_MAX_EVENT_HISTORIES 16
+
+/* How far back from the end of the queue to look for an event to merge into */
+#define SDL_MAX_COALESCE_DISTANCE   32
+
 /* Determines how often we wake to call SDL_PumpEvents() in SDL_WaitEventTimeout_Device() */
 #define PERIODIC_POLL_INTERVAL_MS 3000
 
@@ -73,6 +86,8 @@ typedef struct _SDL_EventEntry
 {
     SDL_Event event;
     SDL_SysWMmsg msg;
+    SDL_Event *history;
+    int num_history;
     struct _SDL_EventEntry *prev;
     struct _SDL_EventEntry *next;
 } SDL_EventEntry;
@@ -83,18 +98,48 @@ typedef struct _SDL_SysWMEntry
     struct _SDL_SysWMEntry *next;
 } SDL_SysWMEntry;
 
+/* A slot in the ring of pushed events.  The sequence number says whether
+   the slot is free for the producer at that position, or holds an event
+   for the consumer at that position. */
+typedef struct
+{
+    SDL_atomic_t sequence;
+    SDL_Event event;
+} SDL_EventRingSlot;
+
+/* Events are pushed into a bounded multi-producer ring without locking, and
+   moved to the queue list by whoever holds the queue lock before it looks at
+   the queue.  The list is still needed since events can be removed from the
+   middle of the queue by type.  The count covers events in both places. */
 static struct
 {
     SDL_mutex *lock;
-    SDL_bool active;
+    SDL_atomic_t active;
     SDL_atomic_t count;
-    int max_events_seen;
+    SDL_atomic_t max_events_seen;
     SDL_EventEntry *head;
     SDL_EventEntry *tail;
     SDL_EventEntry *free;
     SDL_SysWMEntry *wmmsg_used;
     SDL_SysWMEntry *wmmsg_free;
-} SDL_EventQ = { NULL, SDL_FALSE, { 0 }, 0, NULL, NULL, NULL, NULL, NULL };
+    SDL_atomic_t producers;
+    SDL_atomic_t ring_tail;
+    int ring_head;
+    SDL_EventRingSlot ring[SDL_EVENT_RING_SIZE];
+} SDL_EventQ;
+
+/* The samples merged into recently delivered events -- guarded by the queue lock */
+typedef struct
+{
+    SDL_Event event;
+    SDL_Event *samples;
+    int num_samples;
+} SDL_EventHistory;
+
+static SDL_EventHistory SDL_event_histories[SDL_MAX_EVENT_HISTORIES];
+static int SDL_next_event_history = 0;
+
+static void SDL_ResetEventRing(void);
 
 
 #if !SDL_JOYSTICK_DISABLED
@@ -165,6 +210,38 @@ SDL_EventLoggingChanged(void *userdata, const char *name, const char *oldValue,
     SDL_EventLoggingVerbosity = (hint && *hint) ? SDL_clamp(SDL_atoi(hint), 0, 3) : 0;
 }
 
+/**
+ * Motion events merged while queued, as defined in SDL_HINT_EVENT_COALESCING
+ */
+#define SDL_COALESCE_MOUSE  0x01
+#define SDL_COALESCE_TOUCH  0x02
+#define SDL_COALESCE_SENSOR 0x04
+
+static int SDL_EventCoalescing = 0;
+
+static void SDLCALL
+SDL_EventCoalescingChanged(void *userdata, const char *name, const char *oldValue, const char *hint)
+{
+    int coalescing = 0;
+
+    if (hint && *hint) {
+        if (SDL_strcmp(hint, "1") == 0) {
+            coalescing = SDL_COALESCE_MOUSE | SDL_COALESCE_TOUCH | SDL_COALESCE_SENSOR;
+        } else {
+            if (SDL_strcasestr(hint, "mouse")) {
+                coalescing |= SDL_COALESCE_MOUSE;
+            }
+            if (SDL_strcasestr(hint, "touch")) {
+                coalescing |= SDL_COALESCE_TOUCH;
+            }
+            if (SDL_strcasestr(hint, "sensor")) {
+                coalescing |= SDL_COALESCE_SENSOR;
+            }
+        }
+    }
+    SDL_EventCoalescing = coalescing;
+}
+
 static void
 SDL_LogEvent(const SDL_Event *event)
 {
@@ -470,28 +547,43 @@ SDL_StopEventLoop(void)
     SDL_EventEntry *entry;
     SDL_SysWMEntry *wmmsg;
 
+    /* Stop accepting events, and let pushes in progress finish.  This pairs
+       with SDL_PeepEventsInternal() raising 'producers' before it checks
+       'active', so the store here must be ordered before the load of
+       'producers' below; SDL_AtomicCAS() is a full barrier, SDL_AtomicSet()
+       isn't. */
+    SDL_AtomicCAS(&SDL_EventQ.active, SDL_TRUE, SDL_FALSE);
+    while (SDL_AtomicGet(&SDL_EventQ.producers) > 0) {
+        SDL_Delay(0);
+    }
+
     if (SDL_EventQ.lock) {
         SDL_LockMutex(SDL_EventQ.lock);
     }
 
-    SDL_EventQ.active = SDL_FALSE;
-
     if (report && SDL_atoi(report)) {
         SDL_Log("SDL EVENT QUEUE: Maximum events in-flight: %d\n",
-                SDL_EventQ.max_events_seen);
+                SDL_AtomicGet(&SDL_EventQ.max_events_seen));
     }
 
     /* Clean out EventQ */
     for (entry = SDL_EventQ.head; entry; ) {
         SDL_EventEntry *next = entry->next;
+        SDL_free(entry->history);
         SDL_free(entry);
         entry = next;
     }
     for (entry = SDL_EventQ.free; entry; ) {
         SDL_EventEntry *next = entry->next;
+        SDL_free(entry->history);
         SDL_free(entry);
         entry = next;
     }
+    for (i = 0; i < SDL_arraysize(SDL_event_histories); ++i) {
+        SDL_free(SDL_event_histories[i].samples);
+    }
+    SDL_zeroa(SDL_event_histories);
+    SDL_next_event_history = 0;
     for (wmmsg = SDL_EventQ.wmmsg_used; wmmsg; ) {
         SDL_SysWMEntry *next = wmmsg->next;
         SDL_free(wmmsg);
@@ -504,7 +596,7 @@ SDL_StopEventLoop(void)
     }
 
     SDL_AtomicSet(&SDL_EventQ.count, 0);
-    SDL_EventQ.max_events_seen = 0;
+    SDL_AtomicSet(&SDL_EventQ.max_events_seen, 0);
     SDL_EventQ.head = NULL;
     SDL_EventQ.tail = NULL;
     SDL_EventQ.free = NULL;
@@ -574,7 +666,11 @@ SDL_StartEventLoop(void)
     (void)SDL_EventState(SDL_DROPTEXT, SDL_DISABLE);
 #endif
 
-    SDL_EventQ.active = SDL_TRUE;
+    if (!SDL_AtomicGet(&SDL_EventQ.active)) {
+        /* Nothing can be in the ring until we're active */
+        SDL_ResetEventRing();
+        SDL_AtomicSet(&SDL_EventQ.active, SDL_TRUE);
+    }
     if (SDL_EventQ.lock) {
         SDL_UnlockMutex(SDL_EventQ.lock);
     }
@@ -582,37 +678,26 @@ SDL_StartEventLoop(void)
 }
 
 
-/* Add an event to the event queue -- called with the queue locked */
+/* Append an event to the queue list -- called with the queue locked */
 static int
-SDL_AddEvent(SDL_Event * event)
+SDL_AppendEvent(const SDL_Event * event)
 {
     SDL_EventEntry *entry;
-    const int initial_count = SDL_AtomicGet(&SDL_EventQ.count);
-    int final_count;
-
-    if (initial_count >= SDL_MAX_QUEUED_EVENTS) {
-        SDL_SetError("Event queue is full (%d events)", initial_count);
-        return 0;
-    }
 
     if (SDL_EventQ.free == NULL) {
         entry = (SDL_EventEntry *)SDL_malloc(sizeof(*entry));
         if (!entry) {
             return 0;
         }
+        entry->history = NULL;
+        entry->num_history = 0;
     } else {
         entry = SDL_EventQ.free;
         SDL_EventQ.free = entry->next;
     }
 
-    if (SDL_EventLoggingVerbosity > 0) {
-        SDL_LogEvent(event);
-    }
-
     entry->event = *event;
-    if (event->type == SDL_POLLSENTINEL) {
-        SDL_AtomicAdd(&SDL_sentinel_pending, 1);
-    } else if (event->type == SDL_SYSWMEVENT) {
+    if (event->type == SDL_SYSWMEVENT) {
         entry->msg = *event->syswm.msg;
         entry->event.syswm.msg = &entry->msg;
     }
@@ -629,12 +714,351 @@ SDL_AddEvent(SDL_Event * event)
         entry->prev = NULL;
         entry->next = NULL;
     }
+    return 1;
+}
+
+static void
+SDL_ResetEventRing(void)
+{
+    int i;
+
+    for (i = 0; i < SDL_EVENT_RING_SIZE; ++i) {
+        SDL_AtomicSet(&SDL_EventQ.ring[i].sequence, i);
+    }
+    SDL_AtomicSet(&SDL_EventQ.ring_tail, 0);
+    SDL_EventQ.ring_head = 0;
+}
 
-    final_count = SDL_AtomicAdd(&SDL_EventQ.count, 1) + 1;
-    if (final_count > SDL_EventQ.max_events_seen) {
-        SDL_EventQ.max_events_seen = final_count;
+/* Push an event into the ring, returns 0 if the ring is full */
+static int
+SDL_PushEventRing(const SDL_Event * event)
+{
+    SDL_EventRingSlot *slot;
+    int pos = SDL_AtomicGet(&SDL_EventQ.ring_tail);
+
+    for (;;) {
+        int diff;
+
+        slot = &SDL_EventQ.ring[pos & (SDL_EVENT_RING_SIZE - 1)];
+        diff = (int)((Uint32)SDL_AtomicGet(&slot->sequence) - (Uint32)pos);
+        if (diff == 0) {
+            /* The slot is free, try to claim it */
+            if (SDL_AtomicCAS(&SDL_EventQ.ring_tail, pos, pos + 1)) {
+                break;
+            }
+        } else if (diff < 0) {
+            /* The consumer hasn't caught up with this slot yet */
+            return 0;
+        }
+        /* Another producer got here first */
+        pos = SDL_AtomicGet(&SDL_EventQ.ring_tail);
     }
 
+    slot->event = *event;
+    SDL_MemoryBarrierRelease();
+    SDL_AtomicSet(&slot->sequence, pos + 1);
+    return 1;
+}
+
+/* Move events pushed by other threads from the ring to the queue list.
+   While nothing older is in the list, events of the wanted types are copied
+   straight into 'events' instead, up to 'numevents' of them.
+   Returns the number of events copied -- called with the queue locked */
+static int
+SDL_DrainEventRing(SDL_Event * events, int numevents, Uint32 minType, Uint32 maxType)
+{
+    int used = 0;
+
+    for (;;) {
+        const int pos = SDL_EventQ.ring_head;
+        SDL_EventRingSlot *slot = &SDL_EventQ.ring[pos & (SDL_EVENT_RING_SIZE - 1)];
+        Uint32 type;
+
+        if (SDL_AtomicGet(&slot->sequence) != pos + 1) {
+            /* Empty, or the event is still being written */
+            break;
+        }
+        SDL_MemoryBarrierAcquire();
+
+        type = slot->event.type;
+        if (used < numevents && !SDL_EventQ.head &&
+            minType <= type && type <= maxType && type != SDL_POLLSENTINEL) {
+            events[used++] = slot->event;
+            SDL_assert(SDL_AtomicGet(&SDL_EventQ.count) > 0);
+            SDL_AtomicAdd(&SDL_EventQ.count, -1);
+        } else if (!SDL_AppendEvent(&slot->event)) {
+            /* Out of memory, leave the rest in the ring */
+            break;
+        }
+
+        /* Done reading the slot, hand it back to the producers */
+        SDL_MemoryBarrierRelease();
+        SDL_AtomicSet(&slot->sequence, pos + SDL_EVENT_RING_SIZE);
+        SDL_EventQ.ring_head = pos + 1;
+    }
+    return used;
+}
+
+/* Move everything pushed so far to the queue list, waiting for slots that
+   other producers have claimed but not filled in yet.  This keeps the events
+   of each thread in order when it has to bypass the ring.
+   Called with the queue locked */
+static void
+SDL_FlushEventRing(void)
+{
+    const int tail = SDL_AtomicGet(&SDL_EventQ.ring_tail);
+
+    for (;;) {
+        SDL_EventRingSlot *slot;
+
+        SDL_DrainEventRing(NULL, 0, 0, 0);
+        if ((int)((Uint32)tail - (Uint32)SDL_EventQ.ring_head) <= 0) {
+            break;
+        }
+        slot = &SDL_EventQ.ring[SDL_EventQ.ring_head & (SDL_EVENT_RING_SIZE - 1)];
+        if (SDL_AtomicGet(&slot->sequence) == SDL_EventQ.ring_head + 1) {
+            /* Ready but couldn't be moved, we're out of memory */
+            break;
+        }
+        SDL_Delay(0);
+    }
+}
+
+/* Whether the event is a motion sample that can be merged with another */
+static SDL_bool
+SDL_IsMotionEvent(const SDL_Event * event)
+{
+    switch (event->type) {
+    case SDL_MOUSEMOTION:
+    case SDL_FINGERMOTION:
+    case SDL_SENSORUPDATE:
+        return SDL_TRUE;
+    default:
+        return SDL_FALSE;
+    }
+}
+
+static SDL_bool
+SDL_ShouldCoalesceEvent(const SDL_Event * event)
+{
+    switch (event->type) {
+    case SDL_MOUSEMOTION:
+        return (SDL_EventCoalescing & SDL_COALESCE_MOUSE) ? SDL_TRUE : SDL_FALSE;
+    case SDL_FINGERMOTION:
+        return (SDL_EventCoalescing & SDL_COALESCE_TOUCH) ? SDL_TRUE : SDL_FALSE;
+    case SDL_SENSORUPDATE:
+        return (SDL_EventCoalescing & SDL_COALESCE_SENSOR) ? SDL_TRUE : SDL_FALSE;
+    default:
+        return SDL_FALSE;
+    }
+}
+
+/* Whether two motion events come from the same mouse, finger or sensor */
+static SDL_bool
+SDL_SameEventSource(const SDL_Event * a, const SDL_Event * b)
+{
+    if (a->type != b->type) {
+        return SDL_FALSE;
+    }
+    switch (a->type) {
+    case SDL_MOUSEMOTION:
+        return (a->motion.which == b->motion.which &&
+                a->motion.windowID == b->motion.windowID);
+    case SDL_FINGERMOTION:
+        return (a->tfinger.touchId == b->tfinger.touchId &&
+                a->tfinger.fingerId == b->tfinger.fingerId &&
+                a->tfinger.windowID == b->tfinger.windowID);
+    case SDL_SENSORUPDATE:
+        return (a->sensor.which == b->sensor.which);
+    default:
+        return SDL_FALSE;
+    }
+}
+
+/* Whether two motion events are copies of the same event */
+static SDL_bool
+SDL_SameMotionEvent(const SDL_Event * a, const SDL_Event * b)
+{
+    if (!SDL_SameEventSource(a, b) || a->common.timestamp != b->common.timestamp) {
+        return SDL_FALSE;
+    }
+    switch (a->type) {
+    case SDL_MOUSEMOTION:
+        return (a->motion.x == b->motion.x && a->motion.y == b->motion.y &&
+                a->motion.xrel == b->motion.xrel && a->motion.yrel == b->motion.yrel);
+    case SDL_FINGERMOTION:
+        return (a->tfinger.x == b->tfinger.x && a->tfinger.y == b->tfinger.y &&
+                a->tfinger.dx == b->tfinger.dx && a->tfinger.dy == b->tfinger.dy);
+    case SDL_SENSORUPDATE:
+        return (a->sensor.timestamp_us == b->sensor.timestamp_us &&
+                SDL_memcmp(a->sensor.data, b->sensor.data, sizeof(a->sensor.data)) == 0);
+    default:
+        return SDL_FALSE;
+    }
+}
+
+/* Record a sample merged into a queued event -- called with the queue locked */
+static void
+SDL_AddEventHistory(SDL_EventEntry *entry, const SDL_Event * event)
+{
+    if (!entry->history) {
+        entry->history = (SDL_Event *)SDL_malloc(SDL_MAX_EVENT_HISTORY * sizeof(*entry->history));
+        if (!entry->history) {
+            return;
+        }
+    }
+    if (entry->num_history == 0) {
+        /* The queued event is the first sample */
+        entry->history[entry->num_history++] = entry->event;
+    }
+    if (entry->num_history == SDL_MAX_EVENT_HISTORY) {
+        /* Drop the oldest sample */
+        SDL_memmove(&entry->history[0], &entry->history[1], (SDL_MAX_EVENT_HISTORY - 1) * sizeof(*entry->history));
+        --entry->num_history;
+    }
+    entry->history[entry->num_history++] = *event;
+}
+
+/* Merge a motion event into the last queued one from the same source, if no
+   other kind of event has been queued since -- called with the queue locked */
+static SDL_bool
+SDL_CoalesceEvent(const SDL_Event * event)
+{
+    SDL_EventEntry *entry;
+    int distance = 0;
+
+    for (entry = SDL_EventQ.tail; entry && distance < SDL_MAX_COALESCE_DISTANCE; entry = entry->prev, ++distance) {
+        SDL_Event *queued = &entry->event;
+
+        if (!SDL_IsMotionEvent(queued)) {
+            break;
+        }
+        if (!SDL_SameEventSource(queued, event)) {
+            continue;
+        }
+
+        SDL_AddEventHistory(entry, event);
+
+        /* The latest sample wins, relative motion adds up */
+        switch (event->type) {
+        case SDL_MOUSEMOTION: {
+            const Sint32 xrel = queued->motion.xrel + event->motion.xrel;
+            const Sint32 yrel = queued->motion.yrel + event->motion.yrel;
+            *queued = *event;
+            queued->motion.xrel = xrel;
+            queued->motion.yrel = yrel;
+            break;
+        }
+        case SDL_FINGERMOTION: {
+            const float dx = queued->tfinger.dx + event->tfinger.dx;
+            const float dy = queued->tfinger.dy + event->tfinger.dy;
+            *queued = *event;
+            queued->tfinger.dx = dx;
+            queued->tfinger.dy = dy;
+            break;
+        }
+        default:
+            *queued = *event;
+            break;
+        }
+        return SDL_TRUE;
+    }
+    return SDL_FALSE;
+}
+
+/* Keep the samples of a coalesced event being returned to the application
+   -- called with the queue locked */
+static void
+SDL_SaveEventHistory(SDL_EventEntry *entry)
+{
+    SDL_EventHistory *history = NULL;
+    SDL_Event *samples;
+    int i;
+
+    for (i = 0; i < SDL_arraysize(SDL_event_histories); ++i) {
+        if (SDL_event_histories[i].samples &&
+            SDL_SameEventSource(&SDL_event_histories[i].event, &entry->event)) {
+            history = &SDL_event_histories[i];
+            break;
+        }
+    }
+    if (!history) {
+        history = &SDL_event_histories[SDL_next_event_history];
+        SDL_next_event_history = (SDL_next_event_history + 1) % SDL_arraysize(SDL_event_histories);
+    }
+
+    /* Trade buffers, the entry gets the old one back for reuse */
+    samples = history->samples;
+    history->event = entry->event;
+    history->samples = entry->history;
+    history->num_samples = entry->num_history;
+    entry->history = samples;
+    entry->num_history = 0;
+}
+
+/* Add an event to the event queue, this doesn't need the queue lock */
+static int
+SDL_AddEvent(SDL_Event * event)
+{
+    const int final_count = SDL_AtomicAdd(&SDL_EventQ.count, 1) + 1;
+    const SDL_bool coalesce = (SDL_EventCoalescing && SDL_ShouldCoalesceEvent(event));
+    SDL_bool merged = SDL_FALSE;
+    int max_events_seen;
+    int added;
+
+    if (final_count > SDL_MAX_QUEUED_EVENTS) {
+        SDL_AtomicAdd(&SDL_EventQ.count, -1);
+        SDL_SetError("Event queue is full (%d events)", final_count - 1);
+        return 0;
+    }
+
+    if (SDL_EventLoggingVerbosity > 0) {
+        SDL_LogEvent(event);
+    }
+
+    /* The sentinel has to be counted before the consumer can see it */
+    if (event->type == SDL_POLLSENTINEL) {
+        SDL_AtomicAdd(&SDL_sentinel_pending, 1);
+    }
+
+    /* Window manager messages are copied along with the event, which only
+       the list has room for, and merging motion needs to see the list.
+       If the ring is full, fall back to appending to the list after the
+       events already in the ring. */
+    added = (!coalesce && event->type != SDL_SYSWMEVENT && SDL_PushEventRing(event));
+    if (!added) {
+        if (!SDL_EventQ.lock || SDL_LockMutex(SDL_EventQ.lock) == 0) {
+            SDL_FlushEventRing();
+            if (coalesce && SDL_CoalesceEvent(event)) {
+                merged = SDL_TRUE;
+                added = 1;
+            } else {
+                added = SDL_AppendEvent(event);
+            }
+            if (SDL_EventQ.lock) {
+                SDL_UnlockMutex(SDL_EventQ.lock);
+            }
+        }
+    }
+    if (!added) {
+        if (event->type == SDL_POLLSENTINEL) {
+            SDL_AtomicAdd(&SDL_sentinel_pending, -1);
+        }
+        SDL_AtomicAdd(&SDL_EventQ.count, -1);
+        return 0;
+    }
+    if (merged) {
+        /* The queue didn't grow */
+        SDL_AtomicAdd(&SDL_EventQ.count, -1);
+        return 1;
+    }
+
+    /* This is only statistics, so a lost update now and then is fine */
+    max_events_seen = SDL_AtomicGet(&SDL_EventQ.max_events_seen);
+    while (final_count > max_events_seen &&
+           !SDL_AtomicCAS(&SDL_EventQ.max_events_seen, max_events_seen, final_count)) {
+        max_events_seen = SDL_AtomicGet(&SDL_EventQ.max_events_seen);
+    }
     return 1;
 }
 
@@ -662,6 +1086,7 @@ SDL_CutEvent(SDL_EventEntry *entry)
         SDL_AtomicAdd(&SDL_sentinel_pending, -1);
     }
 
+    entry->num_history = 0;
     entry->next = SDL_EventQ.free;
     SDL_EventQ.free = entry;
     SDL_assert(SDL_AtomicGet(&SDL_EventQ.count) > 0);
@@ -695,12 +1120,34 @@ SDL_PeepEventsInternal(SDL_Event * events, int numevents, SDL_eventaction action
                Uint32 minType, Uint32 maxType, SDL_bool include_sentinel)
 {
     int i, used, sentinels_expected = 0;
+    SDL_EventEntry *entry, *next;
+    SDL_SysWMEntry *wmmsg, *wmmsg_next;
+    Uint32 type;
 
-    /* Lock the event queue */
     used = 0;
+
+    /* Adding events doesn't need the queue lock */
+    if (action == SDL_ADDEVENT) {
+        SDL_AtomicIncRef(&SDL_EventQ.producers);
+        if (SDL_AtomicGet(&SDL_EventQ.active)) {
+            for (i = 0; i < numevents; ++i) {
+                used += SDL_AddEvent(&events[i]);
+            }
+        } else {
+            used = -1;
+        }
+        SDL_AtomicAdd(&SDL_EventQ.producers, -1);
+
+        if (used > 0) {
+            SDL_SendWakeupEvent();
+        }
+        return (used);
+    }
+
+    /* Lock the event queue */
     if (!SDL_EventQ.lock || SDL_LockMutex(SDL_EventQ.lock) == 0) {
         /* Don't look after we've quit */
-        if (!SDL_EventQ.active) {
+        if (!SDL_AtomicGet(&SDL_EventQ.active)) {
             if (SDL_EventQ.lock) {
                 SDL_UnlockMutex(SDL_EventQ.lock);
             }
@@ -710,70 +1157,71 @@ SDL_PeepEventsInternal(SDL_Event * events, int numevents, SDL_eventaction action
             }
             return (-1);
         }
-        if (action == SDL_ADDEVENT) {
-            for (i = 0; i < numevents; ++i) {
-                used += SDL_AddEvent(&events[i]);
+        if (action == SDL_GETEVENT) {
+            /* Clean out any used wmmsg data
+               FIXME: Do we want to retain the data for some period of time?
+             */
+            for (wmmsg = SDL_EventQ.wmmsg_used; wmmsg; wmmsg = wmmsg_next) {
+                wmmsg_next = wmmsg->next;
+                wmmsg->next = SDL_EventQ.wmmsg_free;
+                SDL_EventQ.wmmsg_free = wmmsg;
             }
-        } else {
-            SDL_EventEntry *entry, *next;
-            SDL_SysWMEntry *wmmsg, *wmmsg_next;
-            Uint32 type;
+            SDL_EventQ.wmmsg_used = NULL;
+        }
 
-            if (action == SDL_GETEVENT) {
-                /* Clean out any used wmmsg data
-                   FIXME: Do we want to retain the data for some period of time?
-                 */
-                for (wmmsg = SDL_EventQ.wmmsg_used; wmmsg; wmmsg = wmmsg_next) {
-                    wmmsg_next = wmmsg->next;
-                    wmmsg->next = SDL_EventQ.wmmsg_free;
-                    SDL_EventQ.wmmsg_free = wmmsg;
-                }
-                SDL_EventQ.wmmsg_used = NULL;
-            }
+        /* Pick up events pushed since we last looked, taking them
+           straight from the ring when we can */
+        if (action == SDL_GETEVENT && events) {
+            used = SDL_DrainEventRing(events, numevents, minType, maxType);
+        } else {
+            SDL_DrainEventRing(NULL, 0, 0, 0);
+        }
 
-            for (entry = SDL_EventQ.head; entry && (!events || used < numevents); entry = next) {
-                next = entry->next;
-                type = entry->event.type;
-                if (minType <= type && type <= maxType) {
-                    if (events) {
-                        events[used] = entry->event;
-                        if (entry->event.type == SDL_SYSWMEVENT) {
-                            /* We need to copy the wmmsg somewhere safe.
-                               For now we'll guarantee it's valid at least until
-                               the next call to SDL_PeepEvents()
-                             */
-                            if (SDL_EventQ.wmmsg_free) {
-                                wmmsg = SDL_EventQ.wmmsg_free;
-                                SDL_EventQ.wmmsg_free = wmmsg->next;
-                            } else {
-                                wmmsg = (SDL_SysWMEntry *)SDL_malloc(sizeof(*wmmsg));
-                            }
-                            wmmsg->msg = *entry->event.syswm.msg;
-                            wmmsg->next = SDL_EventQ.wmmsg_used;
-                            SDL_EventQ.wmmsg_used = wmmsg;
-                            events[used].syswm.msg = &wmmsg->msg;
+        for (entry = SDL_EventQ.head; entry && (!events || used < numevents); entry = next) {
+            next = entry->next;
+            type = entry->event.type;
+            if (minType <= type && type <= maxType) {
+                if (events) {
+                    events[used] = entry->event;
+                    if (entry->event.type == SDL_SYSWMEVENT) {
+                        /* We need to copy the wmmsg somewhere safe.
+                           For now we'll guarantee it's valid at least until
+                           the next call to SDL_PeepEvents()
+                         */
+                        if (SDL_EventQ.wmmsg_free) {
+                            wmmsg = SDL_EventQ.wmmsg_free;
+                            SDL_EventQ.wmmsg_free = wmmsg->next;
+                        } else {
+                            wmmsg = (SDL_SysWMEntry *)SDL_malloc(sizeof(*wmmsg));
                         }
+                        wmmsg->msg = *entry->event.syswm.msg;
+                        wmmsg->next = SDL_EventQ.wmmsg_used;
+                        SDL_EventQ.wmmsg_used = wmmsg;
+                        events[used].syswm.msg = &wmmsg->msg;
+                    }
 
-                        if (action == SDL_GETEVENT) {
-                            SDL_CutEvent(entry);
+                    if (action == SDL_GETEVENT) {
+                        if (entry->num_history > 0) {
+                            SDL_SaveEventHistory(entry);
                         }
+                        SDL_CutEvent(entry);
                     }
-                    if (type == SDL_POLLSENTINEL) {
-                        /* Special handling for the sentinel event */
-                        if (!include_sentinel) {
-                            /* Skip it, we don't want to include it */
-                            continue;
-                        }
-                        if (!events || action != SDL_GETEVENT) {
-                            ++sentinels_expected;
-                        }
-                        if (SDL_AtomicGet(&SDL_sentinel_pending) > sentinels_expected) {
-                            /* Skip it, there's another one pending */
-                            continue;
-                        }
+                }
+                if (type == SDL_POLLSENTINEL) {
+                    /* Special handling for the sentinel event */
+                    if (!include_sentinel) {
+                        /* Skip it, we don't want to include it */
+                        continue;
+                    }
+                    if (!events || action != SDL_GETEVENT) {
+                        ++sentinels_expected;
+                    }
+                    if (SDL_AtomicGet(&SDL_sentinel_pending) > sentinels_expected) {
+                        /* Skip it, there's another one pending */
+                        continue;
                     }
-                    ++used;
                 }
+                ++used;
             }
         }
         if (SDL_EventQ.lock) {
@@ -783,10 +1231,6 @@ SDL_PeepEventsInternal(SDL_Event * events, int numevents, SDL_eventaction action
         return SDL_SetError("Couldn't lock event queue");
     }
 
-    if (used > 0 && action == SDL_ADDEVENT) {
-        SDL_SendWakeupEvent();
-    }
-
     return (used);
 }
 int
@@ -834,12 +1278,13 @@ SDL_FlushEvents(Uint32 minType, Uint32 maxType)
     /* Lock the event queue */
     if (!SDL_EventQ.lock || SDL_LockMutex(SDL_EventQ.lock) == 0) {
         /* Don't look after we've quit */
-        if (!SDL_EventQ.active) {
+        if (!SDL_AtomicGet(&SDL_EventQ.active)) {
             if (SDL_EventQ.lock) {
                 SDL_UnlockMutex(SDL_EventQ.lock);
             }
             return;
         }
+        SDL_DrainEventRing(NULL, 0, 0, 0);
         for (entry = SDL_EventQ.head; entry; entry = next) {
             next = entry->next;
             type = entry->event.type;
@@ -859,6 +1304,8 @@ SDL_PumpEventsInternal(SDL_bool push_sentinel)
 {
     SDL_VideoDevice *_this = SDL_GetVideoDevice();
 
+    SDL_TRACE_ZONE_BEGIN("SDL_PumpEvents");
+
     /* Release any keys held down from last frame */
     SDL_ReleaseAutoReleaseKeys();
 
@@ -890,6 +1337,8 @@ SDL_PumpEventsInternal(SDL_bool push_sentinel)
         sentinel.type = SDL_POLLSENTINEL;
         SDL_PushEvent(&sentinel);
     }
+
+    SDL_TRACE_ZONE_END();
 }
 
 void
@@ -1271,6 +1720,7 @@ SDL_FilterEvents(SDL_EventFilter filter, void *userdata)
 {
     if (!SDL_EventQ.lock || SDL_LockMutex(SDL_EventQ.lock) == 0) {
         SDL_EventEntry *entry, *next;
+        SDL_DrainEventRing(NULL, 0, 0, 0);
         for (entry = SDL_EventQ.head; entry; entry = next) {
             next = entry->next;
             if (!filter(userdata, &entry->event)) {
@@ -1283,6 +1733,45 @@ SDL_FilterEvents(SDL_EventFilter filter, void *userdata)
     }
 }
 
+int
+SDL_GetEventHistory(const SDL_Event * event, SDL_Event * samples, int maxsamples)
+{
+    int i, count = 0;
+
+    if (!event) {
+        return SDL_InvalidParamError("event");
+    }
+    if (maxsamples < 0) {
+        return SDL_InvalidParamError("maxsamples");
+    }
+
+    if (SDL_IsMotionEvent(event) &&
+        (!SDL_EventQ.lock || SDL_LockMutex(SDL_EventQ.lock) == 0)) {
+        for (i = 0; i < SDL_arraysize(SDL_event_histories); ++i) {
+            const SDL_EventHistory *history = &SDL_event_histories[i];
+            if (history->num_samples > 0 && SDL_SameMotionEvent(&history->event, event)) {
+                count = history->num_samples;
+                if (samples) {
+                    SDL_memcpy(samples, history->samples, SDL_min(count, maxsamples) * sizeof(*samples));
+                }
+                break;
+            }
+        }
+        if (SDL_EventQ.lock) {
+            SDL_UnlockMutex(SDL_EventQ.lock);
+        }
+    }
+
+    if (count == 0) {
+        /* Not a coalesced event, it's its own only sample */
+        count = 1;
+        if (samples && maxsamples > 0) {
+            samples[0] = *event;
+        }
+    }
+    return count;
+}
+
 Uint8
 SDL_EventState(Uint32 type, int state)
 {
@@ -1397,8 +1886,10 @@ SDL_EventsInit(void)
     SDL_AddHintCallback(SDL_HINT_AUTO_UPDATE_SENSORS, SDL_AutoUpdateSensorsChanged, NULL);
 #endif
     SDL_AddHintCallback(SDL_HINT_EVENT_LOGGING, SDL_EventLoggingChanged, NULL);
+    SDL_AddHintCallback(SDL_HINT_EVENT_COALESCING, SDL_EventCoalescingChanged, NULL);
     SDL_AddHintCallback(SDL_HINT_POLL_SENTINEL, SDL_PollSentinelChanged, NULL);
     if (SDL_StartEventLoop() < 0) {
+        SDL_DelHintCallback(SDL_HINT_EVENT_COALESCING, SDL_EventCoalescingChanged, NULL);
         SDL_DelHintCallback(SDL_HINT_EVENT_LOGGING, SDL_EventLoggingChanged, NULL);
         return -1;
     }
@@ -1414,6 +1905,7 @@ SDL_EventsQuit(void)
     SDL_QuitQuit();
     SDL_StopEventLoop();
     SDL_DelHintCallback(SDL_HINT_POLL_SENTINEL, SDL_PollSentinelChanged, NULL);
+    SDL_DelHintCallback(SDL_HINT_EVENT_COALESCING, SDL_EventCoalescingChanged, NULL);
     SDL_DelHintCallback(SDL_HINT_EVENT_LOGGING, SDL_EventLoggingChanged, NULL);
 #if !SDL_JOYSTICK_DISABLED
     SDL_DelHintCallback(SDL_HINT_AUTO_UPDATE_JOYSTICKS, SDL_AutoUpdateJoysticksChanged, NULL);
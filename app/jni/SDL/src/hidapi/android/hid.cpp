@@ -326,7 +326,7 @@ static char *CreateStringFromJString( JNIEnv *env, const jstring &sString )
 {
 	size_t nLength = env->GetStringUTFLength( sString );
 	const char *pjChars = env->GetStringUTFChars( sString, NULL );
-	char *psString = (char*)malloc( nLength + 1 );
+	char *psString = (char*)SDL_malloc( nLength + 1 );
 	SDL_memcpy( psString, pjChars, nLength );
 	psString[ nLength ] = '\0';
 	env->ReleaseStringUTFChars( sString, pjChars );
@@ -337,7 +337,7 @@ static wchar_t *CreateWStringFromJString( JNIEnv *env, const jstring &sString )
 {
 	size_t nLength = env->GetStringLength( sString );
 	const jchar *pjChars = env->GetStringChars( sString, NULL );
-	wchar_t *pwString = (wchar_t*)malloc( ( nLength + 1 ) * sizeof( wchar_t ) );
+	wchar_t *pwString = (wchar_t*)SDL_malloc( ( nLength + 1 ) * sizeof( wchar_t ) );
 	wchar_t *pwChars = pwString;
 	for ( size_t iIndex = 0; iIndex < nLength; ++iIndex )
 	{
@@ -351,7 +351,7 @@ static wchar_t *CreateWStringFromJString( JNIEnv *env, const jstring &sString )
 static wchar_t *CreateWStringFromWString( const wchar_t *pwSrc )
 {
 	size_t nLength = SDL_wcslen( pwSrc );
-	wchar_t *pwString = (wchar_t*)malloc( ( nLength + 1 ) * sizeof( wchar_t ) );
+	wchar_t *pwString = (wchar_t*)SDL_malloc( ( nLength + 1 ) * sizeof( wchar_t ) );
 	SDL_memcpy( pwString, pwSrc, nLength * sizeof( wchar_t ) );
 	pwString[ nLength ] = '\0';
 	return pwString;
@@ -370,10 +370,10 @@ static hid_device_info *CopyHIDDeviceInfo( const hid_device_info *pInfo )
 
 static void FreeHIDDeviceInfo( hid_device_info *pInfo )
 {
-	free( pInfo->path );
-	free( pInfo->serial_number );
-	free( pInfo->manufacturer_string );
-	free( pInfo->product_string );
+	SDL_free( pInfo->path );
+	SDL_free( pInfo->serial_number );
+	SDL_free( pInfo->manufacturer_string );
+	SDL_free( pInfo->product_string );
 	delete pInfo;
 }
 
@@ -25,6 +25,7 @@
 #include "SDL_hints.h"
 #include "SDL_render.h"
 #include "SDL_timer.h"
+#include "SDL_trace.h"
 #include "SDL_sysrender.h"
 #include "software/SDL_render_sw_c.h"
 #include "../video/SDL_pixels_c.h"
@@ -248,7 +249,10 @@ FlushRenderCommands(SDL_Renderer *renderer)
 
     DebugLogRenderCommands(renderer->render_commands);
 
+    SDL_TRACE_ZONE_BEGIN("FlushRenderCommands");
+    SDL_TRACE_COUNTER("Render vertex bytes", renderer->vertex_data_used);
     retval = renderer->RunCommandQueue(renderer, renderer->render_commands, renderer->vertex_data, renderer->vertex_data_used);
+    SDL_TRACE_ZONE_END();
 
     /* Move the whole render command queue to the unused pool so we can reuse them next time. */
     if (renderer->render_commands_tail != NULL) {
@@ -917,13 +921,9 @@ void VerifyDrawQueueFunctions(const SDL_Renderer *renderer)
 
 static SDL_RenderLineMethod SDL_GetRenderLineMethod()
 {
-    const char *hint = SDL_GetHint(SDL_HINT_RENDER_LINE_METHOD);
+    static SDL_HintCache hint = { SDL_HINT_RENDER_LINE_METHOD, 0, NULL, SDL_FALSE, 0 };
 
-    int method = 0;
-    if (hint) {
-        method = SDL_atoi(hint);
-    }
-    switch (method) {
+    switch (SDL_GetCachedHintInt(&hint, 0)) {
     case 1:
         return SDL_RENDERLINEMETHOD_POINTS;
     case 2:
@@ -952,7 +952,10 @@ static void SDL_CalculateSimulatedVSyncInterval(SDL_Renderer *renderer, SDL_Wind
         /* Pick a good default refresh rate */
         refresh_rate = 60;
     }
-    renderer->simulate_vsync_interval = (1000 / refresh_rate);
+    renderer->simulate_vsync_interval = (1000000000 / refresh_rate);
+    if (renderer->simulate_vsync_pacer) {
+        SDL_SetFramePacerInterval(renderer->simulate_vsync_pacer, renderer->simulate_vsync_interval);
+    }
 }
 #endif /* !SDL_RENDER_DISABLED */
 
@@ -1255,17 +1258,21 @@ GetClosestSupportedFormat(SDL_Renderer * renderer, Uint32 format)
 
 static SDL_ScaleMode SDL_GetScaleMode(void)
 {
-    const char *hint = SDL_GetHint(SDL_HINT_RENDER_SCALE_QUALITY);
+    static SDL_HintCache hint = { SDL_HINT_RENDER_SCALE_QUALITY, 0, NULL, SDL_FALSE, 0 };
+    static SDL_ScaleMode scale_mode = SDL_ScaleModeNearest;
 
-    if (!hint || SDL_strcasecmp(hint, "nearest") == 0) {
-        return SDL_ScaleModeNearest;
-    } else if (SDL_strcasecmp(hint, "linear") == 0) {
-        return SDL_ScaleModeLinear;
-    } else if (SDL_strcasecmp(hint, "best") == 0) {
-        return SDL_ScaleModeBest;
-    } else {
-        return (SDL_ScaleMode)SDL_atoi(hint);
+    if (SDL_UpdateHintCache(&hint)) {
+        if (!hint.value || SDL_strcasecmp(hint.value, "nearest") == 0) {
+            scale_mode = SDL_ScaleModeNearest;
+        } else if (SDL_strcasecmp(hint.value, "linear") == 0) {
+            scale_mode = SDL_ScaleModeLinear;
+        } else if (SDL_strcasecmp(hint.value, "best") == 0) {
+            scale_mode = SDL_ScaleModeBest;
+        } else {
+            scale_mode = (SDL_ScaleMode)hint.integer;
+        }
     }
+    return scale_mode;
 }
 
 SDL_Texture *
@@ -1789,6 +1796,7 @@ SDL_UpdateTexture(SDL_Texture * texture, const SDL_Rect * rect,
                   const void *pixels, int pitch)
 {
     SDL_Rect real_rect;
+    int retval;
 
     CHECK_TEXTURE_MAGIC(texture, -1);
 
@@ -1811,19 +1819,26 @@ SDL_UpdateTexture(SDL_Texture * texture, const SDL_Rect * rect,
 
     if (real_rect.w == 0 || real_rect.h == 0) {
         return 0;  /* nothing to do. */
+    }
+
+    SDL_TRACE_ZONE_BEGIN("SDL_UpdateTexture");
 #if SDL_HAVE_YUV
-    } else if (texture->yuv) {
-        return SDL_UpdateTextureYUV(texture, &real_rect, pixels, pitch);
+    if (texture->yuv) {
+        retval = SDL_UpdateTextureYUV(texture, &real_rect, pixels, pitch);
+    } else
 #endif
-    } else if (texture->native) {
-        return SDL_UpdateTextureNative(texture, &real_rect, pixels, pitch);
+    if (texture->native) {
+        retval = SDL_UpdateTextureNative(texture, &real_rect, pixels, pitch);
     } else {
         SDL_Renderer *renderer = texture->renderer;
         if (FlushRenderCommandsIfTextureNeeded(texture) < 0) {
-            return -1;
+            retval = -1;
+        } else {
+            retval = renderer->UpdateTexture(renderer, texture, &real_rect, pixels, pitch);
         }
-        return renderer->UpdateTexture(renderer, texture, &real_rect, pixels, pitch);
     }
+    SDL_TRACE_ZONE_END();
+    return retval;
 }
 
 #if SDL_HAVE_YUV
@@ -4306,29 +4321,13 @@ SDL_RenderReadPixels(SDL_Renderer * renderer, const SDL_Rect * rect,
 static void
 SDL_RenderSimulateVSync(SDL_Renderer * renderer)
 {
-    Uint32 now, elapsed;
-    const Uint32 interval = renderer->simulate_vsync_interval;
-
-    if (!interval) {
-        /* We can't do sub-ms delay, so just return here */
-        return;
-    }
-
-    now = SDL_GetTicks();
-    elapsed = (now - renderer->last_present);
-    if (elapsed < interval) {
-        Uint32 duration = (interval - elapsed);
-        SDL_Delay(duration);
-        now = SDL_GetTicks();
-    }
-
-    elapsed = (now - renderer->last_present);
-    if (!renderer->last_present || elapsed > 1000) {
-        /* It's been too long, reset the presentation timeline */
-        renderer->last_present = now;
-    } else {
-        renderer->last_present += (elapsed / interval) * interval;
+    if (!renderer->simulate_vsync_pacer) {
+        renderer->simulate_vsync_pacer = SDL_CreateFramePacer(renderer->simulate_vsync_interval);
+        if (!renderer->simulate_vsync_pacer) {
+            return;
+        }
     }
+    SDL_FramePacerWait(renderer->simulate_vsync_pacer);
 }
 
 void
@@ -4338,6 +4337,8 @@ SDL_RenderPresent(SDL_Renderer * renderer)
 
     CHECK_RENDERER_MAGIC(renderer, );
 
+    SDL_TRACE_ZONE_BEGIN("SDL_RenderPresent");
+
     FlushRenderCommands(renderer);  /* time to send everything to the GPU! */
 
 #if DONT_DRAW_WHILE_HIDDEN
@@ -4354,6 +4355,8 @@ SDL_RenderPresent(SDL_Renderer * renderer)
         (!presented && renderer->wanted_vsync)) {
         SDL_RenderSimulateVSync(renderer);
     }
+
+    SDL_TRACE_ZONE_END();
 }
 
 void
@@ -4445,6 +4448,9 @@ SDL_DestroyRenderer(SDL_Renderer * renderer)
     SDL_DestroyMutex(renderer->target_mutex);
     renderer->target_mutex = NULL;
 
+    SDL_DestroyFramePacer(renderer->simulate_vsync_pacer);
+    renderer->simulate_vsync_pacer = NULL;
+
     /* Free the renderer instance */
     renderer->DestroyRenderer(renderer);
 }
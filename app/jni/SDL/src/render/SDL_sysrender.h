@@ -26,6 +26,7 @@
 #include "SDL_render.h"
 #include "SDL_events.h"
 #include "SDL_mutex.h"
+#include "SDL_timer.h"
 #include "SDL_yuv_sw_c.h"
 
 /* Set up for C function definitions, even when using C++ */
@@ -211,8 +212,8 @@ struct SDL_Renderer
     /* Whether we should simulate vsync */
     SDL_bool wanted_vsync;
     SDL_bool simulate_vsync;
-    Uint32 simulate_vsync_interval;
-    Uint32 last_present;
+    Uint64 simulate_vsync_interval;    /* in nanoseconds */
+    SDL_FramePacer *simulate_vsync_pacer;
 
     /* The logical resolution for rendering */
     int logical_w;
@@ -21,6 +21,48 @@
 #include "../SDL_internal.h"
 
 #include "SDL_stdinc.h"
+#include "SDL_endian.h"
+#include "SDL_cpuinfo.h"
+#include "../cpuinfo/SDL_cpuinfo_c.h"
+#include "SDL_crc32_table.h"
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#if defined(HAVE_IMMINTRIN_H) && !defined(SDL_DISABLE_IMMINTRIN_H)
+#define HAVE_PCLMUL_INTRINSICS 1
+#endif
+#if defined __clang__
+# if (!__has_attribute(target))
+#   undef HAVE_PCLMUL_INTRINSICS
+# endif
+# if (defined(_MSC_VER) || defined(__SCE__)) && !defined(__PCLMUL__)
+#   undef HAVE_PCLMUL_INTRINSICS
+# endif
+#elif defined __GNUC__
+# if (__GNUC__ < 4) || (__GNUC__ == 4 && __GNUC_MINOR__ < 9)
+#   undef HAVE_PCLMUL_INTRINSICS
+# endif
+#endif
+#endif
+
+#if defined(__aarch64__)
+#if defined(__clang__)
+# if defined(__has_builtin) && __has_builtin(__builtin_arm_crc32d) && __has_attribute(target)
+#   define HAVE_ARM_CRC32_INTRINSICS 1
+#   define ARM_CRC32_TARGET __attribute__((target("crc")))
+#   define ARM_CRC32_D(crc, v) __builtin_arm_crc32d(crc, v)
+#   define ARM_CRC32_B(crc, v) __builtin_arm_crc32b(crc, v)
+# endif
+#elif defined(__GNUC__) && (__GNUC__ >= 6)
+# define HAVE_ARM_CRC32_INTRINSICS 1
+# define ARM_CRC32_TARGET __attribute__((target("+crc")))
+# define ARM_CRC32_D(crc, v) __builtin_aarch64_crc32x(crc, v)
+# define ARM_CRC32_B(crc, v) __builtin_aarch64_crc32b(crc, v)
+#endif
+#endif
+
+#if HAVE_PCLMUL_INTRINSICS
+#include <immintrin.h>
+#endif
 
 
 /* Public domain CRC implementation adapted from:
@@ -31,25 +73,221 @@
 */
 /* NOTE: DO NOT CHANGE THIS ALGORITHM
    There is code that relies on this in the joystick code
+
+   The original implementation runs a bitwise loop over every byte, which
+   works out to the standard reflected CRC-32 (as used by zlib) computed on
+   the inverted running value.  All of the implementations below work on
+   that inverted value and must produce exactly the same results.
 */
 
-static Uint32 crc32_for_byte(Uint32 r)
+typedef Uint32 (*SDL_CRC32Func)(Uint32 crc, const Uint8 *data, size_t len);
+
+/* Portable slicing-by-8: eight table lookups per 8 bytes of input */
+static Uint32 SDL_crc32_tables(Uint32 crc, const Uint8 *data, size_t len)
 {
-    int i;
-    for (i = 0; i < 8; ++i) {
-        r = (r & 1? 0: (Uint32)0xEDB88320L) ^ r >> 1;
+    while (len && ((uintptr_t)data & 7)) {
+        crc = crc32_table[0][(crc ^ *data++) & 0xFF] ^ (crc >> 8);
+        --len;
     }
-    return r ^ (Uint32)0xFF000000L;
+
+    while (len >= 8) {
+        /* data is 8 byte aligned here */
+        const Uint32 lo = SDL_SwapLE32(((const Uint32 *)data)[0]) ^ crc;
+        const Uint32 hi = SDL_SwapLE32(((const Uint32 *)data)[1]);
+
+        crc = crc32_table[7][lo & 0xFF] ^
+              crc32_table[6][(lo >> 8) & 0xFF] ^
+              crc32_table[5][(lo >> 16) & 0xFF] ^
+              crc32_table[4][lo >> 24] ^
+              crc32_table[3][hi & 0xFF] ^
+              crc32_table[2][(hi >> 8) & 0xFF] ^
+              crc32_table[1][(hi >> 16) & 0xFF] ^
+              crc32_table[0][hi >> 24];
+        data += 8;
+        len -= 8;
+    }
+
+    while (len--) {
+        crc = crc32_table[0][(crc ^ *data++) & 0xFF] ^ (crc >> 8);
+    }
+    return crc;
 }
 
-Uint32 SDL_crc32(Uint32 crc, const void *data, size_t len)
+#if HAVE_PCLMUL_INTRINSICS
+/* Carry-less multiplication folding, as described in Intel's "Fast CRC
+   Computation for Generic Polynomials Using PCLMULQDQ Instruction".
+   Folds four 128-bit lanes at a time, then reduces to 32 bits with a
+   Barrett reduction.  The constants are for the reflected polynomial
+   0xEDB88320. */
+#if defined(__clang__) || defined(__GNUC__)
+__attribute__((target("sse4.1,pclmul")))
+#endif
+static Uint32 SDL_crc32_fold_PCLMUL(Uint32 crc, const Uint8 *data, size_t len)
 {
-    /* As an optimization we can precalculate a 256 entry table for each byte */
-    size_t i;
-    for(i = 0; i < len; ++i) {
-        crc = crc32_for_byte((Uint8)crc ^ ((const Uint8*)data)[i]) ^ crc >> 8;
+    /* len must be a multiple of 16 and at least 64 */
+    const __m128i k1k2 = _mm_set_epi64x(0x01c6e41596LL, 0x0154442bd4LL);
+    const __m128i k3k4 = _mm_set_epi64x(0x00ccaa009eLL, 0x01751997d0LL);
+    const __m128i k5k0 = _mm_set_epi64x(0x0000000000LL, 0x0163cd6124LL);
+    const __m128i poly = _mm_set_epi64x(0x01f7011641LL, 0x01db710641LL);
+    const __m128i mask32 = _mm_setr_epi32(~0, 0, ~0, 0);
+    __m128i x1, x2, x3, x4, x5, x6, x7, x8;
+
+    x1 = _mm_loadu_si128((const __m128i *)(data + 0x00));
+    x2 = _mm_loadu_si128((const __m128i *)(data + 0x10));
+    x3 = _mm_loadu_si128((const __m128i *)(data + 0x20));
+    x4 = _mm_loadu_si128((const __m128i *)(data + 0x30));
+    x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128((int)crc));
+    data += 64;
+    len -= 64;
+
+    while (len >= 64) {
+        x5 = _mm_clmulepi64_si128(x1, k1k2, 0x00);
+        x6 = _mm_clmulepi64_si128(x2, k1k2, 0x00);
+        x7 = _mm_clmulepi64_si128(x3, k1k2, 0x00);
+        x8 = _mm_clmulepi64_si128(x4, k1k2, 0x00);
+        x1 = _mm_clmulepi64_si128(x1, k1k2, 0x11);
+        x2 = _mm_clmulepi64_si128(x2, k1k2, 0x11);
+        x3 = _mm_clmulepi64_si128(x3, k1k2, 0x11);
+        x4 = _mm_clmulepi64_si128(x4, k1k2, 0x11);
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, x5), _mm_loadu_si128((const __m128i *)(data + 0x00)));
+        x2 = _mm_xor_si128(_mm_xor_si128(x2, x6), _mm_loadu_si128((const __m128i *)(data + 0x10)));
+        x3 = _mm_xor_si128(_mm_xor_si128(x3, x7), _mm_loadu_si128((const __m128i *)(data + 0x20)));
+        x4 = _mm_xor_si128(_mm_xor_si128(x4, x8), _mm_loadu_si128((const __m128i *)(data + 0x30)));
+        data += 64;
+        len -= 64;
+    }
+
+    /* Fold the four lanes into one */
+    x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+    x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x3), x5);
+    x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x4), x5);
+
+    /* Fold in any remaining 16 byte blocks */
+    while (len >= 16) {
+        x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+        x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, _mm_loadu_si128((const __m128i *)data)), x5);
+        data += 16;
+        len -= 16;
+    }
+
+    /* Fold 128 bits down to 64 bits */
+    x2 = _mm_clmulepi64_si128(x1, k3k4, 0x10);
+    x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2);
+    x2 = _mm_srli_si128(x1, 4);
+    x1 = _mm_and_si128(x1, mask32);
+    x1 = _mm_clmulepi64_si128(x1, k5k0, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+
+    /* Barrett reduction down to 32 bits */
+    x2 = _mm_and_si128(x1, mask32);
+    x2 = _mm_clmulepi64_si128(x2, poly, 0x10);
+    x2 = _mm_and_si128(x2, mask32);
+    x2 = _mm_clmulepi64_si128(x2, poly, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+    return (Uint32)_mm_extract_epi32(x1, 1);
+}
+
+static Uint32 SDL_crc32_PCLMUL(Uint32 crc, const Uint8 *data, size_t len)
+{
+    /* Short buffers aren't worth the setup cost */
+    if (len >= 64) {
+        const size_t blocks = len & ~(size_t)15;
+        crc = SDL_crc32_fold_PCLMUL(crc, data, blocks);
+        data += blocks;
+        len -= blocks;
+    }
+    return SDL_crc32_tables(crc, data, len);
+}
+#endif /* HAVE_PCLMUL_INTRINSICS */
+
+#if HAVE_ARM_CRC32_INTRINSICS
+/* The ARMv8 CRC32 instructions implement exactly this polynomial, and
+   process 8 bytes per instruction, which keeps up with a PMULL folding
+   loop on the cores we care about without needing any constants. */
+ARM_CRC32_TARGET
+static Uint32 SDL_crc32_ARM(Uint32 crc, const Uint8 *data, size_t len)
+{
+    while (len && ((uintptr_t)data & 7)) {
+        crc = ARM_CRC32_B(crc, *data++);
+        --len;
+    }
+
+    while (len >= 32) {
+        const Uint64 *blocks = (const Uint64 *)data;
+
+        crc = ARM_CRC32_D(crc, SDL_SwapLE64(blocks[0]));
+        crc = ARM_CRC32_D(crc, SDL_SwapLE64(blocks[1]));
+        crc = ARM_CRC32_D(crc, SDL_SwapLE64(blocks[2]));
+        crc = ARM_CRC32_D(crc, SDL_SwapLE64(blocks[3]));
+        data += 32;
+        len -= 32;
+    }
+
+    while (len >= 8) {
+        crc = ARM_CRC32_D(crc, SDL_SwapLE64(*(const Uint64 *)data));
+        data += 8;
+        len -= 8;
+    }
+
+    while (len--) {
+        crc = ARM_CRC32_B(crc, *data++);
     }
     return crc;
 }
+#endif /* HAVE_ARM_CRC32_INTRINSICS */
+
+static SDL_CRC32Func SDL_crc32_impl = NULL;
+
+static SDL_CRC32Func SDL_ChooseCRC32Func(void)
+{
+    /* Allow an override for testing: "table", "pclmul" or "arm".  An
+       implementation that isn't available falls back to the tables. */
+    const char *override = SDL_getenv("SDL_CRC32_IMPL");
+
+    if (override && *override) {
+#if HAVE_PCLMUL_INTRINSICS
+        if (SDL_strcasecmp(override, "pclmul") == 0 && SDL_HasPCLMUL() && SDL_HasSSE41()) {
+            return SDL_crc32_PCLMUL;
+        }
+#endif
+#if HAVE_ARM_CRC32_INTRINSICS
+        if (SDL_strcasecmp(override, "arm") == 0 && SDL_HasARMCRC32()) {
+            return SDL_crc32_ARM;
+        }
+#endif
+        return SDL_crc32_tables;
+    }
+
+#if HAVE_PCLMUL_INTRINSICS
+    if (SDL_HasPCLMUL() && SDL_HasSSE41()) {
+        return SDL_crc32_PCLMUL;
+    }
+#endif
+#if HAVE_ARM_CRC32_INTRINSICS
+    if (SDL_HasARMCRC32()) {
+        return SDL_crc32_ARM;
+    }
+#endif
+    return SDL_crc32_tables;
+}
+
+Uint32 SDL_crc32(Uint32 crc, const void *data, size_t len)
+{
+    SDL_CRC32Func func = SDL_crc32_impl;
+
+    if (!func) {
+        /* Every thread picks the same function, so racing here is harmless */
+        func = SDL_ChooseCRC32Func();
+        SDL_crc32_impl = func;
+    }
+    return ~func(~crc, (const Uint8 *)data, len);
+}
 
 /* vi: set ts=4 sw=4 expandtab: */
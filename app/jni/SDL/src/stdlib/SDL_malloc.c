@@ -28,7 +28,9 @@
 /* This file contains portable memory management functions for SDL */
 #include "SDL_stdinc.h"
 #include "SDL_atomic.h"
+#include "SDL_cpuinfo.h"
 #include "SDL_error.h"
+#include "SDL_malloc_c.h"
 
 #ifndef HAVE_MALLOC
 #define LACKS_SYS_TYPES_H
@@ -5338,6 +5340,472 @@ static struct
     real_malloc, real_calloc, real_realloc, real_free, { 0 }
 };
 
+/* Small allocations are served from per-thread caches of fixed size blocks,
+   so threads don't serialize on the allocator for them.
+
+   Blocks are carved out of 64K spans, which come from large arenas
+   allocated with the original allocator and are never given back. A radix
+   map of span addresses tells whether a pointer being freed is a cached
+   block, and which size class it belongs to.
+
+   Freed blocks go to the cache of the thread freeing them, wherever they
+   were allocated, and move to a shared list for their size class in
+   batches when that cache gets too full. Threads refill their caches from
+   the shared lists in batches as well.
+
+   SDL threads give their cached blocks back when they exit. Other threads,
+   like the ones Java creates on Android, do it from a pthread key
+   destructor where there is one, so they don't take their blocks with them.
+ */
+#if (defined(__GNUC__) || defined(__clang__)) && \
+    (defined(__LINUX__) || defined(__ANDROID__) || defined(__MACOSX__) || defined(__IPHONEOS__) || \
+     defined(__FREEBSD__) || defined(__NETBSD__) || defined(__OPENBSD__))
+#define SDL_MEMORY_THREAD_LOCAL __thread
+#define SDL_MEMORY_THREAD_EXIT_KEY 1
+#include <pthread.h>
+#elif defined(_MSC_VER) && defined(__WIN32__)
+#define SDL_MEMORY_THREAD_LOCAL __declspec(thread)
+#endif
+
+#ifdef SDL_MEMORY_THREAD_LOCAL
+
+#define SDL_NUM_SIZE_CLASSES    12
+#define SDL_MAX_CACHED_SIZE     1024
+#define SDL_SPAN_SHIFT          16
+#define SDL_SPAN_SIZE           ((size_t)1 << SDL_SPAN_SHIFT)
+#define SDL_SPANS_PER_ARENA     16
+#define SDL_SPAN_MAP_BITS       12
+#define SDL_SPAN_MAP_SIZE       (1 << SDL_SPAN_MAP_BITS)
+#define SDL_SPAN_MAP_MASK       (SDL_SPAN_MAP_SIZE - 1)
+#define SDL_CACHE_BYTES         8192    /* per size class, per thread */
+#define SDL_STATS_BATCH         64
+
+static const size_t class_sizes[SDL_NUM_SIZE_CLASSES] = {
+    16, 32, 48, 64, 96, 128, 192, 256, 384, 512, 768, 1024
+};
+
+/* The size class for each multiple of 16 bytes */
+static const Uint8 class_for_size[(SDL_MAX_CACHED_SIZE / 16) + 1] = {
+    0, 0, 1, 2, 3, 4, 4, 5, 5, 6, 6, 6, 6, 7, 7, 7,
+    7, 8, 8, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 9, 9,
+    9, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11
+};
+
+typedef struct
+{
+    SDL_SpinLock lock;
+    void *blocks;       /* free blocks, linked through their first word */
+    int count;
+    char *next;         /* the uncarved part of the current span */
+    char *end;
+    char cache_pad[SDL_CACHELINE_SIZE];
+} SDL_SizeClass;
+
+typedef struct
+{
+    void *blocks[SDL_NUM_SIZE_CLASSES];
+    int count[SDL_NUM_SIZE_CLASSES];
+
+    /* Allocation counts not yet added to the totals, the last entry is for
+       allocations that aren't cached */
+    Uint32 allocations[SDL_NUM_SIZE_CLASSES + 1];
+    Uint32 frees[SDL_NUM_SIZE_CLASSES + 1];
+    Uint32 pending;
+
+    SDL_bool registered;    /* to be flushed when the thread exits */
+} SDL_ThreadMemoryCache;
+
+static struct
+{
+    SDL_SizeClass classes[SDL_NUM_SIZE_CLASSES];
+
+    /* Arenas and the span map, protected by lock */
+    SDL_SpinLock lock;
+    char *arena;
+    char *arena_end;
+    size_t reserved[SDL_NUM_SIZE_CLASSES];
+
+    /* Four levels indexed by 12 bits of the span address each, the leaves
+       hold the size class plus one, or 0 if it's not a span of ours */
+    void **span_map[SDL_SPAN_MAP_SIZE];
+
+    /* Allocation statistics, protected by stats_lock */
+    SDL_SpinLock stats_lock;
+    Uint64 allocations[SDL_NUM_SIZE_CLASSES + 1];
+    Uint64 frees[SDL_NUM_SIZE_CLASSES + 1];
+} s_cache;
+
+static SDL_MEMORY_THREAD_LOCAL SDL_ThreadMemoryCache thread_cache;
+
+static int
+SDL_GetCacheLimit(int c)
+{
+    return (int)SDL_max(8, SDL_CACHE_BYTES / class_sizes[c]);
+}
+
+/* Returns the size class of a cached block, or -1 for other pointers */
+static int
+SDL_GetSpanClass(const void *ptr)
+{
+    const Uint64 key = (Uint64)(uintptr_t)ptr >> SDL_SPAN_SHIFT;
+    void **level1, **level2;
+    Uint8 *leaf;
+
+    /* These are published with a release barrier, and only ever set once */
+    level1 = s_cache.span_map[(key >> (3 * SDL_SPAN_MAP_BITS)) & SDL_SPAN_MAP_MASK];
+    if (!level1) {
+        return -1;
+    }
+    level2 = (void **)level1[(key >> (2 * SDL_SPAN_MAP_BITS)) & SDL_SPAN_MAP_MASK];
+    if (!level2) {
+        return -1;
+    }
+    leaf = (Uint8 *)level2[(key >> SDL_SPAN_MAP_BITS) & SDL_SPAN_MAP_MASK];
+    if (!leaf) {
+        return -1;
+    }
+    return (int)leaf[key & SDL_SPAN_MAP_MASK] - 1;
+}
+
+/* This must be called with s_cache.lock held */
+static SDL_bool
+SDL_SetSpanClass(const void *span, int c)
+{
+    const Uint64 key = (Uint64)(uintptr_t)span >> SDL_SPAN_SHIFT;
+    void ***level1 = &s_cache.span_map[(key >> (3 * SDL_SPAN_MAP_BITS)) & SDL_SPAN_MAP_MASK];
+    void **level2;
+    Uint8 **leaf;
+
+    if (!*level1) {
+        void **node = (void **)real_calloc(SDL_SPAN_MAP_SIZE, sizeof(void *));
+        if (!node) {
+            return SDL_FALSE;
+        }
+        SDL_MemoryBarrierRelease();
+        *level1 = node;
+    }
+    level2 = &(*level1)[(key >> (2 * SDL_SPAN_MAP_BITS)) & SDL_SPAN_MAP_MASK];
+    if (!*level2) {
+        void **node = (void **)real_calloc(SDL_SPAN_MAP_SIZE, sizeof(void *));
+        if (!node) {
+            return SDL_FALSE;
+        }
+        SDL_MemoryBarrierRelease();
+        *level2 = node;
+    }
+    leaf = (Uint8 **)&((void **)*level2)[(key >> SDL_SPAN_MAP_BITS) & SDL_SPAN_MAP_MASK];
+    if (!*leaf) {
+        Uint8 *node = (Uint8 *)real_calloc(SDL_SPAN_MAP_SIZE, sizeof(Uint8));
+        if (!node) {
+            return SDL_FALSE;
+        }
+        SDL_MemoryBarrierRelease();
+        *leaf = node;
+    }
+    (*leaf)[key & SDL_SPAN_MAP_MASK] = (Uint8)(c + 1);
+    return SDL_TRUE;
+}
+
+/* Give a size class a new span to carve, called with its lock held */
+static SDL_bool
+SDL_AddSpan(SDL_SizeClass *sizeclass, int c)
+{
+    SDL_bool result = SDL_FALSE;
+
+    SDL_AtomicLock(&s_cache.lock);
+    if (s_cache.arena == s_cache.arena_end) {
+        /* Leave room to align the spans */
+        char *arena = (char *)real_malloc((SDL_SPANS_PER_ARENA + 1) * SDL_SPAN_SIZE);
+        if (arena) {
+            s_cache.arena = (char *)(((uintptr_t)arena + SDL_SPAN_SIZE - 1) & ~(uintptr_t)(SDL_SPAN_SIZE - 1));
+            s_cache.arena_end = s_cache.arena + SDL_SPANS_PER_ARENA * SDL_SPAN_SIZE;
+        }
+    }
+    if (s_cache.arena != s_cache.arena_end && SDL_SetSpanClass(s_cache.arena, c)) {
+        sizeclass->next = s_cache.arena;
+        sizeclass->end = s_cache.arena + SDL_SPAN_SIZE;
+        s_cache.arena += SDL_SPAN_SIZE;
+        s_cache.reserved[c] += SDL_SPAN_SIZE;
+        result = SDL_TRUE;
+    }
+    SDL_AtomicUnlock(&s_cache.lock);
+
+    return result;
+}
+
+static void
+SDL_FlushAllocationStats(SDL_ThreadMemoryCache *cache)
+{
+    int i;
+
+    SDL_AtomicLock(&s_cache.stats_lock);
+    for (i = 0; i <= SDL_NUM_SIZE_CLASSES; ++i) {
+        s_cache.allocations[i] += cache->allocations[i];
+        s_cache.frees[i] += cache->frees[i];
+    }
+    SDL_AtomicUnlock(&s_cache.stats_lock);
+
+    SDL_zeroa(cache->allocations);
+    SDL_zeroa(cache->frees);
+    cache->pending = 0;
+}
+
+static SDL_INLINE void
+SDL_CountAllocation(int c)
+{
+    SDL_ThreadMemoryCache *cache = &thread_cache;
+
+    ++cache->allocations[c];
+    if (++cache->pending == SDL_STATS_BATCH) {
+        SDL_FlushAllocationStats(cache);
+    }
+}
+
+static SDL_INLINE void
+SDL_CountFree(int c)
+{
+    SDL_ThreadMemoryCache *cache = &thread_cache;
+
+    ++cache->frees[c];
+    if (++cache->pending == SDL_STATS_BATCH) {
+        SDL_FlushAllocationStats(cache);
+    }
+}
+
+static void SDL_RegisterThreadCache(SDL_ThreadMemoryCache *cache);
+
+/* Move a batch of blocks from the shared list to an empty thread cache */
+static SDL_bool
+SDL_RefillCache(SDL_ThreadMemoryCache *cache, int c)
+{
+    SDL_SizeClass *sizeclass = &s_cache.classes[c];
+    const size_t size = class_sizes[c];
+    int wanted = SDL_GetCacheLimit(c) / 2;
+    void *blocks = NULL;
+    int count = 0;
+
+    if (!cache->registered) {
+        SDL_RegisterThreadCache(cache);
+    }
+
+    SDL_AtomicLock(&sizeclass->lock);
+    if (sizeclass->count <= wanted) {
+        blocks = sizeclass->blocks;
+        count = sizeclass->count;
+        sizeclass->blocks = NULL;
+        sizeclass->count = 0;
+    } else {
+        void *last = sizeclass->blocks;
+
+        blocks = last;
+        for (count = 1; count < wanted; ++count) {
+            last = *(void **)last;
+        }
+        sizeclass->blocks = *(void **)last;
+        sizeclass->count -= count;
+        *(void **)last = NULL;
+    }
+
+    /* Carve new blocks for the rest */
+    while (count < wanted) {
+        if ((size_t)(sizeclass->end - sizeclass->next) < size) {
+            if (count > 0 || !SDL_AddSpan(sizeclass, c)) {
+                break;
+            }
+        }
+        *(void **)sizeclass->next = blocks;
+        blocks = sizeclass->next;
+        sizeclass->next += size;
+        ++count;
+    }
+    SDL_AtomicUnlock(&sizeclass->lock);
+
+    cache->blocks[c] = blocks;
+    cache->count[c] = count;
+    return count > 0 ? SDL_TRUE : SDL_FALSE;
+}
+
+/* Move a number of blocks from a thread cache to the shared list */
+static void
+SDL_ReleaseCache(SDL_ThreadMemoryCache *cache, int c, int count)
+{
+    SDL_SizeClass *sizeclass = &s_cache.classes[c];
+    void *blocks = cache->blocks[c];
+    void *last = blocks;
+    int i;
+
+    if (count <= 0) {
+        return;
+    }
+    for (i = 1; i < count; ++i) {
+        last = *(void **)last;
+    }
+    cache->blocks[c] = *(void **)last;
+    cache->count[c] -= count;
+
+    SDL_AtomicLock(&sizeclass->lock);
+    *(void **)last = sizeclass->blocks;
+    sizeclass->blocks = blocks;
+    sizeclass->count += count;
+    SDL_AtomicUnlock(&sizeclass->lock);
+}
+
+static void *
+SDL_CacheAlloc(size_t size)
+{
+    SDL_ThreadMemoryCache *cache = &thread_cache;
+    const int c = class_for_size[(size + 15) / 16];
+    void *block = cache->blocks[c];
+
+    if (!block) {
+        if (!SDL_RefillCache(cache, c)) {
+            return NULL;
+        }
+        block = cache->blocks[c];
+    }
+    cache->blocks[c] = *(void **)block;
+    --cache->count[c];
+
+    SDL_CountAllocation(c);
+    return block;
+}
+
+static void
+SDL_CacheFree(void *ptr, int c)
+{
+    SDL_ThreadMemoryCache *cache = &thread_cache;
+
+    if (!cache->registered) {
+        SDL_RegisterThreadCache(cache);
+    }
+    *(void **)ptr = cache->blocks[c];
+    cache->blocks[c] = ptr;
+    if (++cache->count[c] > SDL_GetCacheLimit(c)) {
+        SDL_ReleaseCache(cache, c, cache->count[c] / 2);
+    }
+
+    SDL_CountFree(c);
+}
+
+static void
+SDL_FlushCache(SDL_ThreadMemoryCache *cache)
+{
+    int c;
+
+    for (c = 0; c < SDL_NUM_SIZE_CLASSES; ++c) {
+        SDL_ReleaseCache(cache, c, cache->count[c]);
+    }
+    SDL_FlushAllocationStats(cache);
+}
+
+#ifdef SDL_MEMORY_THREAD_EXIT_KEY
+static pthread_key_t thread_cache_key;
+static pthread_once_t thread_cache_once = PTHREAD_ONCE_INIT;
+static SDL_bool thread_cache_key_created;
+
+static void
+SDL_ThreadCacheDestructor(void *data)
+{
+    SDL_ThreadMemoryCache *cache = (SDL_ThreadMemoryCache *)data;
+
+    /* Anything freed by later destructors registers the cache again, and
+       pthreads calls this again for it */
+    cache->registered = SDL_FALSE;
+    SDL_FlushCache(cache);
+}
+
+static void
+SDL_CreateThreadCacheKey(void)
+{
+    thread_cache_key_created = (pthread_key_create(&thread_cache_key, SDL_ThreadCacheDestructor) == 0);
+}
+#endif /* SDL_MEMORY_THREAD_EXIT_KEY */
+
+/* Arrange for the cache to be flushed when the thread exits */
+static void
+SDL_RegisterThreadCache(SDL_ThreadMemoryCache *cache)
+{
+#ifdef SDL_MEMORY_THREAD_EXIT_KEY
+    pthread_once(&thread_cache_once, SDL_CreateThreadCacheKey);
+    if (thread_cache_key_created) {
+        pthread_setspecific(thread_cache_key, cache);
+    }
+#endif
+    /* Without a key only SDL threads flush their caches, don't try again */
+    cache->registered = SDL_TRUE;
+}
+
+void
+SDL_FlushThreadMemoryCache(void)
+{
+    SDL_FlushCache(&thread_cache);
+}
+
+int
+SDL_GetAllocationStats(SDL_AllocationStats *stats, int maxstats)
+{
+    int i;
+
+    if (!stats && maxstats) {
+        return SDL_InvalidParamError("stats");
+    }
+
+    /* Include this thread's counts, other threads add theirs in batches */
+    SDL_FlushAllocationStats(&thread_cache);
+
+    for (i = 0; i < maxstats && i <= SDL_NUM_SIZE_CLASSES; ++i) {
+        SDL_zerop(&stats[i]);
+        SDL_AtomicLock(&s_cache.stats_lock);
+        stats[i].allocations = s_cache.allocations[i];
+        stats[i].frees = s_cache.frees[i];
+        SDL_AtomicUnlock(&s_cache.stats_lock);
+        if (i < SDL_NUM_SIZE_CLASSES) {
+            stats[i].size = class_sizes[i];
+            SDL_AtomicLock(&s_cache.lock);
+            stats[i].reserved = s_cache.reserved[i];
+            SDL_AtomicUnlock(&s_cache.lock);
+        }
+    }
+    return SDL_NUM_SIZE_CLASSES + 1;
+}
+
+/* Allocate without updating the number of allocations */
+static void *
+SDL_AllocBlock(size_t size)
+{
+    void *mem;
+
+    if (size <= SDL_MAX_CACHED_SIZE && s_mem.malloc_func == real_malloc) {
+        mem = SDL_CacheAlloc(size);
+        if (mem) {
+            return mem;
+        }
+    }
+
+    mem = s_mem.malloc_func(size);
+    if (mem) {
+        SDL_CountAllocation(SDL_NUM_SIZE_CLASSES);
+    }
+    return mem;
+}
+
+#else
+
+void
+SDL_FlushThreadMemoryCache(void)
+{
+}
+
+int
+SDL_GetAllocationStats(SDL_AllocationStats *stats, int maxstats)
+{
+    return SDL_Unsupported();
+}
+
+#endif /* SDL_MEMORY_THREAD_LOCAL */
+
 void SDL_GetOriginalMemoryFunctions(SDL_malloc_func *malloc_func,
                                     SDL_calloc_func *calloc_func,
                                     SDL_realloc_func *realloc_func,
@@ -5414,7 +5882,11 @@ void *SDL_malloc(size_t size)
         size = 1;
     }
 
+#ifdef SDL_MEMORY_THREAD_LOCAL
+    mem = SDL_AllocBlock(size);
+#else
     mem = s_mem.malloc_func(size);
+#endif
     if (mem) {
         SDL_AtomicIncRef(&s_mem.num_allocations);
     }
@@ -5430,8 +5902,22 @@ void *SDL_calloc(size_t nmemb, size_t size)
         size = 1;
     }
 
+#ifdef SDL_MEMORY_THREAD_LOCAL
+    if (nmemb <= SDL_MAX_CACHED_SIZE / size && s_mem.calloc_func == real_calloc) {
+        mem = SDL_CacheAlloc(nmemb * size);
+        if (mem) {
+            SDL_memset(mem, 0, nmemb * size);
+            SDL_AtomicIncRef(&s_mem.num_allocations);
+            return mem;
+        }
+    }
+#endif
+
     mem = s_mem.calloc_func(nmemb, size);
     if (mem) {
+#ifdef SDL_MEMORY_THREAD_LOCAL
+        SDL_CountAllocation(SDL_NUM_SIZE_CLASSES);
+#endif
         SDL_AtomicIncRef(&s_mem.num_allocations);
     }
     return mem;
@@ -5445,6 +5931,31 @@ void *SDL_realloc(void *ptr, size_t size)
         size = 1;
     }
 
+#ifdef SDL_MEMORY_THREAD_LOCAL
+    if (!ptr) {
+        mem = SDL_AllocBlock(size);
+        if (mem) {
+            SDL_AtomicIncRef(&s_mem.num_allocations);
+        }
+        return mem;
+    } else {
+        const int c = SDL_GetSpanClass(ptr);
+
+        if (c >= 0) {
+            /* Cached blocks stay where they are as long as they fit */
+            if (size <= class_sizes[c]) {
+                return ptr;
+            }
+            mem = SDL_AllocBlock(size);
+            if (mem) {
+                SDL_memcpy(mem, ptr, class_sizes[c]);
+                SDL_CacheFree(ptr, c);
+            }
+            return mem;
+        }
+    }
+#endif
+
     mem = s_mem.realloc_func(ptr, size);
     if (mem && !ptr) {
         SDL_AtomicIncRef(&s_mem.num_allocations);
@@ -5454,11 +5965,25 @@ void *SDL_realloc(void *ptr, size_t size)
 
 void SDL_free(void *ptr)
 {
+#ifdef SDL_MEMORY_THREAD_LOCAL
+    int c;
+#endif
+
     if (!ptr) {
         return;
     }
 
+#ifdef SDL_MEMORY_THREAD_LOCAL
+    c = SDL_GetSpanClass(ptr);
+    if (c >= 0) {
+        SDL_CacheFree(ptr, c);
+    } else {
+        s_mem.free_func(ptr);
+        SDL_CountFree(SDL_NUM_SIZE_CLASSES);
+    }
+#else
     s_mem.free_func(ptr);
+#endif
     (void)SDL_AtomicDecRef(&s_mem.num_allocations);
 }
 
@@ -0,0 +1,340 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2023 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+/* This is a pattern-defeating quicksort, after Orson Peters' pdqsort, which
+   is included once for each element size that gets its own code.
+
+   Before including it, define:
+    SDL_SORT_NAME(name) to give a name a suffix for this element size
+    SDL_SORT_SIZE as the element size, a constant or the size parameter
+    SDL_SORT_SWAP(a, b) to swap the elements at a and b
+
+   The pivot stays at the start of the range while partitioning, rather
+   than being copied out, so no element ever needs temporary storage.
+ */
+
+#define SDL_SORT_AT(p, i)   ((p) + (ptrdiff_t)(i) * (ptrdiff_t)SDL_SORT_SIZE)
+#define SDL_SORT_LESS(a, b) (compare((a), (b)) < 0)
+#define SDL_SORT_COUNT(a, b) ((size_t)((b) - (a)) / SDL_SORT_SIZE)
+
+static void
+SDL_SORT_NAME(SDL_sort2)(char *a, char *b, size_t size, SDL_SortCompare compare)
+{
+    if (SDL_SORT_LESS(b, a)) {
+        SDL_SORT_SWAP(a, b);
+    }
+}
+
+static void
+SDL_SORT_NAME(SDL_sort3)(char *a, char *b, char *c, size_t size, SDL_SortCompare compare)
+{
+    SDL_SORT_NAME(SDL_sort2)(a, b, size, compare);
+    SDL_SORT_NAME(SDL_sort2)(b, c, size, compare);
+    SDL_SORT_NAME(SDL_sort2)(a, b, size, compare);
+}
+
+static void
+SDL_SORT_NAME(SDL_insertion_sort)(char *begin, char *end, size_t size, SDL_SortCompare compare)
+{
+    char *cur, *sift;
+
+    if (begin == end) {
+        return;
+    }
+    for (cur = SDL_SORT_AT(begin, 1); cur != end; cur = SDL_SORT_AT(cur, 1)) {
+        for (sift = cur; sift != begin && SDL_SORT_LESS(sift, SDL_SORT_AT(sift, -1)); sift = SDL_SORT_AT(sift, -1)) {
+            SDL_SORT_SWAP(sift, SDL_SORT_AT(sift, -1));
+        }
+    }
+}
+
+/* The element before begin must be no greater than any in the range */
+static void
+SDL_SORT_NAME(SDL_unguarded_insertion_sort)(char *begin, char *end, size_t size, SDL_SortCompare compare)
+{
+    char *cur, *sift;
+
+    if (begin == end) {
+        return;
+    }
+    for (cur = SDL_SORT_AT(begin, 1); cur != end; cur = SDL_SORT_AT(cur, 1)) {
+        for (sift = cur; SDL_SORT_LESS(sift, SDL_SORT_AT(sift, -1)); sift = SDL_SORT_AT(sift, -1)) {
+            SDL_SORT_SWAP(sift, SDL_SORT_AT(sift, -1));
+        }
+    }
+}
+
+/* Insertion sort that gives up after moving a few elements, for ranges that
+   look already sorted */
+static SDL_bool
+SDL_SORT_NAME(SDL_partial_insertion_sort)(char *begin, char *end, size_t size, SDL_SortCompare compare)
+{
+    size_t moves = 0;
+    char *cur, *sift;
+
+    if (begin == end) {
+        return SDL_TRUE;
+    }
+    for (cur = SDL_SORT_AT(begin, 1); cur != end; cur = SDL_SORT_AT(cur, 1)) {
+        for (sift = cur; sift != begin && SDL_SORT_LESS(sift, SDL_SORT_AT(sift, -1)); sift = SDL_SORT_AT(sift, -1)) {
+            SDL_SORT_SWAP(sift, SDL_SORT_AT(sift, -1));
+        }
+        moves += SDL_SORT_COUNT(sift, cur);
+        if (moves > SDL_SORT_PARTIAL_INSERTION_LIMIT) {
+            return SDL_FALSE;
+        }
+    }
+    return SDL_TRUE;
+}
+
+static void
+SDL_SORT_NAME(SDL_heapsort)(char *begin, char *end, size_t size, SDL_SortCompare compare)
+{
+    const size_t count = SDL_SORT_COUNT(begin, end);
+    size_t start, last, root, child;
+
+    for (start = count / 2; ; --start) {
+        for (root = start; (child = 2 * root + 1) < count; root = child) {
+            if (child + 1 < count && SDL_SORT_LESS(SDL_SORT_AT(begin, child), SDL_SORT_AT(begin, child + 1))) {
+                ++child;
+            }
+            if (!SDL_SORT_LESS(SDL_SORT_AT(begin, root), SDL_SORT_AT(begin, child))) {
+                break;
+            }
+            SDL_SORT_SWAP(SDL_SORT_AT(begin, root), SDL_SORT_AT(begin, child));
+        }
+        if (start == 0) {
+            break;
+        }
+    }
+
+    for (last = count - 1; last > 0; --last) {
+        SDL_SORT_SWAP(begin, SDL_SORT_AT(begin, last));
+        for (root = 0; (child = 2 * root + 1) < last; root = child) {
+            if (child + 1 < last && SDL_SORT_LESS(SDL_SORT_AT(begin, child), SDL_SORT_AT(begin, child + 1))) {
+                ++child;
+            }
+            if (!SDL_SORT_LESS(SDL_SORT_AT(begin, root), SDL_SORT_AT(begin, child))) {
+                break;
+            }
+            SDL_SORT_SWAP(SDL_SORT_AT(begin, root), SDL_SORT_AT(begin, child));
+        }
+    }
+}
+
+/* Partition around the pivot at begin, putting elements equal to it on the
+   right. Returns the final position of the pivot, and whether the range was
+   already partitioned. */
+static char *
+SDL_SORT_NAME(SDL_partition_right)(char *begin, char *end, size_t size, SDL_SortCompare compare, SDL_bool *already_partitioned)
+{
+    char *first = begin;
+    char *last = end;
+    char *pivot;
+
+    /* The median of 3 guarantees there's an element no less than the pivot */
+    do {
+        first = SDL_SORT_AT(first, 1);
+    } while (SDL_SORT_LESS(first, begin));
+
+    /* If the first element was moved, there's an element less than the
+       pivot to stop at, otherwise we need to check the bounds */
+    if (SDL_SORT_AT(first, -1) == begin) {
+        while (first < last) {
+            last = SDL_SORT_AT(last, -1);
+            if (SDL_SORT_LESS(last, begin)) {
+                break;
+            }
+        }
+    } else {
+        do {
+            last = SDL_SORT_AT(last, -1);
+        } while (!SDL_SORT_LESS(last, begin));
+    }
+
+    *already_partitioned = (first >= last) ? SDL_TRUE : SDL_FALSE;
+
+    while (first < last) {
+        SDL_SORT_SWAP(first, last);
+        do {
+            first = SDL_SORT_AT(first, 1);
+        } while (SDL_SORT_LESS(first, begin));
+        do {
+            last = SDL_SORT_AT(last, -1);
+        } while (!SDL_SORT_LESS(last, begin));
+    }
+
+    pivot = SDL_SORT_AT(first, -1);
+    SDL_SORT_SWAP(begin, pivot);
+    return pivot;
+}
+
+/* Partition around the pivot at begin, putting elements equal to it on the
+   left. Used when the range is known to have many elements equal to the
+   pivot, which all end up in place. */
+static char *
+SDL_SORT_NAME(SDL_partition_left)(char *begin, char *end, size_t size, SDL_SortCompare compare)
+{
+    char *first = begin;
+    char *last = end;
+
+    do {
+        last = SDL_SORT_AT(last, -1);
+    } while (SDL_SORT_LESS(begin, last));
+
+    if (SDL_SORT_AT(last, 1) == end) {
+        while (first < last) {
+            first = SDL_SORT_AT(first, 1);
+            if (SDL_SORT_LESS(begin, first)) {
+                break;
+            }
+        }
+    } else {
+        do {
+            first = SDL_SORT_AT(first, 1);
+        } while (!SDL_SORT_LESS(begin, first));
+    }
+
+    while (first < last) {
+        SDL_SORT_SWAP(first, last);
+        do {
+            last = SDL_SORT_AT(last, -1);
+        } while (SDL_SORT_LESS(begin, last));
+        do {
+            first = SDL_SORT_AT(first, 1);
+        } while (!SDL_SORT_LESS(begin, first));
+    }
+
+    SDL_SORT_SWAP(begin, last);
+    return last;
+}
+
+static void
+SDL_SORT_NAME(SDL_pdqsort_loop)(char *begin, char *end, size_t size, SDL_SortCompare compare, int bad_allowed, SDL_bool leftmost)
+{
+    for ( ; ; ) {
+        const size_t count = SDL_SORT_COUNT(begin, end);
+        const size_t half = count / 2;
+        char *middle = SDL_SORT_AT(begin, half);
+        char *pivot;
+        size_t left_count, right_count;
+        SDL_bool already_partitioned;
+
+        if (count < SDL_SORT_INSERTION_THRESHOLD) {
+            if (leftmost) {
+                SDL_SORT_NAME(SDL_insertion_sort)(begin, end, size, compare);
+            } else {
+                SDL_SORT_NAME(SDL_unguarded_insertion_sort)(begin, end, size, compare);
+            }
+            return;
+        }
+
+        /* Choose the pivot as the median of 3, or the pseudomedian of 9 for
+           larger ranges, and move it to begin */
+        if (count > SDL_SORT_NINTHER_THRESHOLD) {
+            SDL_SORT_NAME(SDL_sort3)(begin, middle, SDL_SORT_AT(end, -1), size, compare);
+            SDL_SORT_NAME(SDL_sort3)(SDL_SORT_AT(begin, 1), SDL_SORT_AT(middle, -1), SDL_SORT_AT(end, -2), size, compare);
+            SDL_SORT_NAME(SDL_sort3)(SDL_SORT_AT(begin, 2), SDL_SORT_AT(middle, 1), SDL_SORT_AT(end, -3), size, compare);
+            SDL_SORT_NAME(SDL_sort3)(SDL_SORT_AT(middle, -1), middle, SDL_SORT_AT(middle, 1), size, compare);
+            SDL_SORT_SWAP(begin, middle);
+        } else {
+            SDL_SORT_NAME(SDL_sort3)(middle, begin, SDL_SORT_AT(end, -1), size, compare);
+        }
+
+        /* If the element before this range is equal to the pivot, this is a
+           run of equal elements, so put them in place and skip past them */
+        if (!leftmost && !SDL_SORT_LESS(SDL_SORT_AT(begin, -1), begin)) {
+            begin = SDL_SORT_AT(SDL_SORT_NAME(SDL_partition_left)(begin, end, size, compare), 1);
+            continue;
+        }
+
+        pivot = SDL_SORT_NAME(SDL_partition_right)(begin, end, size, compare, &already_partitioned);
+        left_count = SDL_SORT_COUNT(begin, pivot);
+        right_count = SDL_SORT_COUNT(SDL_SORT_AT(pivot, 1), end);
+
+        if (left_count < count / 8 || right_count < count / 8) {
+            /* A bad partition, fall back to heapsort after too many of them,
+               otherwise shuffle some elements to break up patterns */
+            if (--bad_allowed == 0) {
+                SDL_SORT_NAME(SDL_heapsort)(begin, end, size, compare);
+                return;
+            }
+
+            if (left_count >= SDL_SORT_INSERTION_THRESHOLD) {
+                SDL_SORT_SWAP(begin, SDL_SORT_AT(begin, left_count / 4));
+                SDL_SORT_SWAP(SDL_SORT_AT(pivot, -1), SDL_SORT_AT(pivot, -(ptrdiff_t)(left_count / 4)));
+                if (left_count > SDL_SORT_NINTHER_THRESHOLD) {
+                    SDL_SORT_SWAP(SDL_SORT_AT(begin, 1), SDL_SORT_AT(begin, left_count / 4 + 1));
+                    SDL_SORT_SWAP(SDL_SORT_AT(begin, 2), SDL_SORT_AT(begin, left_count / 4 + 2));
+                    SDL_SORT_SWAP(SDL_SORT_AT(pivot, -2), SDL_SORT_AT(pivot, -(ptrdiff_t)(left_count / 4 + 1)));
+                    SDL_SORT_SWAP(SDL_SORT_AT(pivot, -3), SDL_SORT_AT(pivot, -(ptrdiff_t)(left_count / 4 + 2)));
+                }
+            }
+            if (right_count >= SDL_SORT_INSERTION_THRESHOLD) {
+                SDL_SORT_SWAP(SDL_SORT_AT(pivot, 1), SDL_SORT_AT(pivot, right_count / 4 + 1));
+                SDL_SORT_SWAP(SDL_SORT_AT(end, -1), SDL_SORT_AT(end, -(ptrdiff_t)(right_count / 4)));
+                if (right_count > SDL_SORT_NINTHER_THRESHOLD) {
+                    SDL_SORT_SWAP(SDL_SORT_AT(pivot, 2), SDL_SORT_AT(pivot, right_count / 4 + 2));
+                    SDL_SORT_SWAP(SDL_SORT_AT(pivot, 3), SDL_SORT_AT(pivot, right_count / 4 + 3));
+                    SDL_SORT_SWAP(SDL_SORT_AT(end, -2), SDL_SORT_AT(end, -(ptrdiff_t)(right_count / 4 + 1)));
+                    SDL_SORT_SWAP(SDL_SORT_AT(end, -3), SDL_SORT_AT(end, -(ptrdiff_t)(right_count / 4 + 2)));
+                }
+            }
+        } else if (already_partitioned &&
+                   SDL_SORT_NAME(SDL_partial_insertion_sort)(begin, pivot, size, compare) &&
+                   SDL_SORT_NAME(SDL_partial_insertion_sort)(SDL_SORT_AT(pivot, 1), end, size, compare)) {
+            /* The partition was balanced and both sides were nearly sorted */
+            return;
+        }
+
+        /* Recurse into the smaller side and loop on the larger one, which
+           keeps the stack depth logarithmic */
+        if (left_count < right_count) {
+            SDL_SORT_NAME(SDL_pdqsort_loop)(begin, pivot, size, compare, bad_allowed, leftmost);
+            begin = SDL_SORT_AT(pivot, 1);
+            leftmost = SDL_FALSE;
+        } else {
+            SDL_SORT_NAME(SDL_pdqsort_loop)(SDL_SORT_AT(pivot, 1), end, size, compare, bad_allowed, SDL_FALSE);
+            end = pivot;
+        }
+    }
+}
+
+static void
+SDL_SORT_NAME(SDL_pdqsort)(char *base, size_t nmemb, size_t size, SDL_SortCompare compare)
+{
+    int bad_allowed = 0;
+    size_t n;
+
+    for (n = nmemb; n > 1; n >>= 1) {
+        ++bad_allowed;
+    }
+    SDL_SORT_NAME(SDL_pdqsort_loop)(base, SDL_SORT_AT(base, nmemb), size, compare, bad_allowed, SDL_TRUE);
+}
+
+#undef SDL_SORT_AT
+#undef SDL_SORT_LESS
+#undef SDL_SORT_COUNT
+#undef SDL_SORT_NAME
+#undef SDL_SORT_SIZE
+#undef SDL_SORT_SWAP
+
+/* vi: set ts=4 sw=4 expandtab: */
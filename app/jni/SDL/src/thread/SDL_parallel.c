@@ -0,0 +1,232 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2023 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "../SDL_internal.h"
+
+#include "SDL_thread.h"
+#include "SDL_cpuinfo.h"
+#include "SDL_parallel_c.h"
+#include "SDL_systhread.h"
+
+#define SDL_MAX_PARALLEL_THREADS    16
+
+#if !SDL_THREADS_DISABLED
+
+static struct
+{
+    SDL_SpinLock init_lock;
+    SDL_atomic_t initialized;
+    SDL_atomic_t busy;      /* a job is running */
+
+    SDL_mutex *lock;
+    SDL_cond *start_cond;
+    SDL_cond *done_cond;
+    SDL_Thread *threads[SDL_MAX_PARALLEL_THREADS];
+    int num_threads;
+    SDL_bool quit;
+
+    /* The current job, protected by lock except for next_index */
+    Uint32 generation;
+    SDL_ParallelFunc func;
+    void *data;
+    int count;
+    SDL_atomic_t next_index;
+    int working;            /* worker threads that haven't finished the job */
+} SDL_parallel;
+
+static void
+SDL_RunParallelJob(SDL_ParallelFunc func, void *data, int count)
+{
+    int index;
+
+    while ((index = SDL_AtomicAdd(&SDL_parallel.next_index, 1)) < count) {
+        func(data, index);
+    }
+}
+
+static int SDLCALL
+SDL_ParallelThread(void *unused)
+{
+    Uint32 generation = 0;
+
+    SDL_LockMutex(SDL_parallel.lock);
+    for ( ; ; ) {
+        SDL_ParallelFunc func;
+        void *data;
+        int count;
+
+        while (!SDL_parallel.quit && SDL_parallel.generation == generation) {
+            SDL_CondWait(SDL_parallel.start_cond, SDL_parallel.lock);
+        }
+        if (SDL_parallel.quit) {
+            break;
+        }
+        generation = SDL_parallel.generation;
+        func = SDL_parallel.func;
+        data = SDL_parallel.data;
+        count = SDL_parallel.count;
+        SDL_UnlockMutex(SDL_parallel.lock);
+
+        SDL_RunParallelJob(func, data, count);
+
+        SDL_LockMutex(SDL_parallel.lock);
+        if (--SDL_parallel.working == 0) {
+            SDL_CondSignal(SDL_parallel.done_cond);
+        }
+    }
+    SDL_UnlockMutex(SDL_parallel.lock);
+
+    return 0;
+}
+
+static SDL_bool
+SDL_InitParallel(void)
+{
+    if (SDL_AtomicGet(&SDL_parallel.initialized)) {
+        return SDL_parallel.num_threads > 0 ? SDL_TRUE : SDL_FALSE;
+    }
+
+    SDL_AtomicLock(&SDL_parallel.init_lock);
+    if (!SDL_AtomicGet(&SDL_parallel.initialized)) {
+        const int num_threads = SDL_min(SDL_GetCPUCount() - 1, SDL_MAX_PARALLEL_THREADS);
+        int i;
+
+        SDL_parallel.quit = SDL_FALSE;
+        SDL_parallel.num_threads = 0;
+        if (num_threads > 0) {
+            SDL_parallel.lock = SDL_CreateMutex();
+            SDL_parallel.start_cond = SDL_CreateCond();
+            SDL_parallel.done_cond = SDL_CreateCond();
+        }
+        if (SDL_parallel.lock && SDL_parallel.start_cond && SDL_parallel.done_cond) {
+            for (i = 0; i < num_threads; ++i) {
+                SDL_Thread *thread = SDL_CreateThreadInternal(SDL_ParallelThread, "SDLParallel", 0, NULL);
+                if (!thread) {
+                    break;
+                }
+                SDL_parallel.threads[SDL_parallel.num_threads++] = thread;
+            }
+        }
+        SDL_AtomicSet(&SDL_parallel.initialized, 1);
+    }
+    SDL_AtomicUnlock(&SDL_parallel.init_lock);
+
+    return SDL_parallel.num_threads > 0 ? SDL_TRUE : SDL_FALSE;
+}
+
+int
+SDL_GetParallelThreadCount(void)
+{
+    SDL_InitParallel();
+    return SDL_parallel.num_threads + 1;
+}
+
+void
+SDL_ParallelFor(int count, SDL_ParallelFunc func, void *data)
+{
+    int i;
+
+    if (count > 1 && SDL_InitParallel() && SDL_AtomicCAS(&SDL_parallel.busy, 0, 1)) {
+        SDL_LockMutex(SDL_parallel.lock);
+        ++SDL_parallel.generation;
+        SDL_parallel.func = func;
+        SDL_parallel.data = data;
+        SDL_parallel.count = count;
+        SDL_AtomicSet(&SDL_parallel.next_index, 0);
+        SDL_parallel.working = SDL_parallel.num_threads;
+        SDL_CondBroadcast(SDL_parallel.start_cond);
+        SDL_UnlockMutex(SDL_parallel.lock);
+
+        SDL_RunParallelJob(func, data, count);
+
+        /* Wait for the workers to let go of the job */
+        SDL_LockMutex(SDL_parallel.lock);
+        while (SDL_parallel.working > 0) {
+            SDL_CondWait(SDL_parallel.done_cond, SDL_parallel.lock);
+        }
+        SDL_UnlockMutex(SDL_parallel.lock);
+
+        SDL_AtomicSet(&SDL_parallel.busy, 0);
+        return;
+    }
+
+    for (i = 0; i < count; ++i) {
+        func(data, i);
+    }
+}
+
+void
+SDL_QuitParallel(void)
+{
+    int i;
+
+    if (!SDL_AtomicGet(&SDL_parallel.initialized)) {
+        return;
+    }
+
+    if (SDL_parallel.num_threads > 0) {
+        SDL_LockMutex(SDL_parallel.lock);
+        SDL_parallel.quit = SDL_TRUE;
+        SDL_CondBroadcast(SDL_parallel.start_cond);
+        SDL_UnlockMutex(SDL_parallel.lock);
+
+        for (i = 0; i < SDL_parallel.num_threads; ++i) {
+            SDL_WaitThread(SDL_parallel.threads[i], NULL);
+            SDL_parallel.threads[i] = NULL;
+        }
+        SDL_parallel.num_threads = 0;
+    }
+
+    SDL_DestroyCond(SDL_parallel.done_cond);
+    SDL_parallel.done_cond = NULL;
+    SDL_DestroyCond(SDL_parallel.start_cond);
+    SDL_parallel.start_cond = NULL;
+    SDL_DestroyMutex(SDL_parallel.lock);
+    SDL_parallel.lock = NULL;
+
+    SDL_AtomicSet(&SDL_parallel.initialized, 0);
+}
+
+#else
+
+int
+SDL_GetParallelThreadCount(void)
+{
+    return 1;
+}
+
+void
+SDL_ParallelFor(int count, SDL_ParallelFunc func, void *data)
+{
+    int i;
+
+    for (i = 0; i < count; ++i) {
+        func(data, i);
+    }
+}
+
+void
+SDL_QuitParallel(void)
+{
+}
+
+#endif /* !SDL_THREADS_DISABLED */
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -0,0 +1,46 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2023 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "../SDL_internal.h"
+
+#ifndef SDL_parallel_c_h_
+#define SDL_parallel_c_h_
+
+/* A pool of worker threads, one per extra CPU core, for splitting up large
+   jobs. The threads are started the first time they're needed. */
+
+typedef void (*SDL_ParallelFunc)(void *data, int index);
+
+/* Get the number of threads that SDL_ParallelFor() runs a job on */
+extern int SDL_GetParallelThreadCount(void);
+
+/* Call func(data, index) for each index from 0 to count - 1, spread over the
+   worker threads and the calling thread, and return when they're all done.
+
+   Only one job runs at a time. If the workers are busy, or this is called
+   from a job, the calls happen on the calling thread. */
+extern void SDL_ParallelFor(int count, SDL_ParallelFunc func, void *data);
+
+/* Stop the worker threads */
+extern void SDL_QuitParallel(void);
+
+#endif /* SDL_parallel_c_h_ */
+
+/* vi: set ts=4 sw=4 expandtab: */
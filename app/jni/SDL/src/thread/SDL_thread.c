@@ -27,6 +27,7 @@
 #include "SDL_systhread.h"
 #include "SDL_hints.h"
 #include "../SDL_error_c.h"
+#include "../stdlib/SDL_malloc_c.h"
 
 
 SDL_TLSID
@@ -317,6 +318,9 @@ SDL_RunThread(SDL_Thread *thread)
             SDL_free(thread);
         }
     }
+
+    /* Give back any memory cached by this thread */
+    SDL_FlushThreadMemoryCache();
 }
 
 #ifdef SDL_CreateThread
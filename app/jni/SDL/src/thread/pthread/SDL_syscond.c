@@ -29,6 +29,127 @@
 #include "SDL_thread.h"
 #include "SDL_sysmutex_c.h"
 
+#if SDL_THREAD_FUTEX
+
+/* Waiters sleep on a sequence number that every signal bumps, so a signal
+   that comes between unlocking the mutex and going to sleep isn't lost.
+   Signals skip the system call entirely while nobody is waiting.
+ */
+struct SDL_cond
+{
+    SDL_atomic_t sequence;
+    SDL_atomic_t waiters;
+};
+
+/* Create a condition variable */
+SDL_cond *
+SDL_CreateCond(void)
+{
+    SDL_cond *cond;
+
+    cond = (SDL_cond *) SDL_calloc(1, sizeof(SDL_cond));
+    if (!cond) {
+        SDL_OutOfMemory();
+    }
+    return (cond);
+}
+
+/* Destroy a condition variable */
+void
+SDL_DestroyCond(SDL_cond * cond)
+{
+    if (cond) {
+        SDL_free(cond);
+    }
+}
+
+/* Restart one of the threads that are waiting on the condition variable */
+int
+SDL_CondSignal(SDL_cond * cond)
+{
+    if (!cond) {
+        return SDL_InvalidParamError("cond");
+    }
+
+    SDL_AtomicAdd(&cond->sequence, 1);
+    if (SDL_AtomicGet(&cond->waiters) > 0) {
+        SDL_AtomicWake(&cond->sequence);
+    }
+    return 0;
+}
+
+/* Restart all threads that are waiting on the condition variable */
+int
+SDL_CondBroadcast(SDL_cond * cond)
+{
+    if (!cond) {
+        return SDL_InvalidParamError("cond");
+    }
+
+    SDL_AtomicAdd(&cond->sequence, 1);
+    if (SDL_AtomicGet(&cond->waiters) > 0) {
+        SDL_AtomicWakeAll(&cond->sequence);
+    }
+    return 0;
+}
+
+int
+SDL_CondWaitTimeout(SDL_cond * cond, SDL_mutex * mutex, Uint32 ms)
+{
+    pthread_t this_thread;
+    int sequence;
+    int recursive;
+    int retval;
+
+    if (!cond) {
+        return SDL_InvalidParamError("cond");
+    }
+    if (!mutex) {
+        return SDL_InvalidParamError("mutex");
+    }
+
+    this_thread = pthread_self();
+    if (SDL_MutexGetOwner(mutex) != this_thread) {
+        return SDL_SetError("mutex not owned by this thread");
+    }
+
+    SDL_AtomicIncRef(&cond->waiters);
+    sequence = SDL_AtomicGet(&cond->sequence);
+
+    /* Release the mutex completely, even if it's locked recursively */
+    recursive = mutex->recursive;
+    mutex->recursive = 0;
+    SDL_MutexSetOwner(mutex, 0);
+    if (SDL_MutexStateSet(mutex, 0) == 2) {
+        SDL_AtomicWake(&mutex->state);
+    }
+
+    retval = SDL_AtomicWaitTimeout(&cond->sequence, sequence, ms);
+    (void)SDL_AtomicDecRef(&cond->waiters);
+
+    /* Other threads may have been woken along with us, so relock the mutex
+       as contended to make sure its unlock wakes whoever is still waiting.
+     */
+    while (SDL_MutexStateSet(mutex, 2) != 0) {
+        SDL_AtomicWait(&mutex->state, 2);
+    }
+    SDL_MutexSetOwner(mutex, this_thread);
+    mutex->recursive = recursive;
+
+    return retval;
+}
+
+/* Wait on the condition variable, unlocking the provided mutex.
+   The mutex must be locked before entering this function!
+ */
+int
+SDL_CondWait(SDL_cond * cond, SDL_mutex * mutex)
+{
+    return SDL_CondWaitTimeout(cond, mutex, SDL_MUTEX_MAXWAIT);
+}
+
+#else
+
 struct SDL_cond
 {
     pthread_cond_t cond;
@@ -155,4 +276,6 @@ SDL_CondWait(SDL_cond * cond, SDL_mutex * mutex)
     return 0;
 }
 
+#endif /* SDL_THREAD_FUTEX */
+
 /* vi: set ts=4 sw=4 expandtab: */
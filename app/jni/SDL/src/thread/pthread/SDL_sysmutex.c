@@ -24,20 +24,135 @@
 #include <pthread.h>
 
 #include "SDL_thread.h"
+#include "SDL_cpuinfo.h"
+#include "SDL_sysmutex_c.h"
 
-#if !SDL_THREAD_PTHREAD_RECURSIVE_MUTEX && \
-    !SDL_THREAD_PTHREAD_RECURSIVE_MUTEX_NP
-#define FAKE_RECURSIVE_MUTEX 1
-#endif
+#if SDL_THREAD_FUTEX
+
+/* How many times a contended lock polls the mutex before going to sleep */
+#define SDL_MUTEX_SPIN_COUNT 100
 
-struct SDL_mutex
+SDL_mutex *
+SDL_CreateMutex(void)
 {
-    pthread_mutex_t id;
-#if FAKE_RECURSIVE_MUTEX
-    int recursive;
-    pthread_t owner;
-#endif
-};
+    SDL_mutex *mutex;
+
+    /* Allocate the structure */
+    mutex = (SDL_mutex *) SDL_calloc(1, sizeof(*mutex));
+    if (!mutex) {
+        SDL_OutOfMemory();
+    }
+    return (mutex);
+}
+
+void
+SDL_DestroyMutex(SDL_mutex * mutex)
+{
+    if (mutex) {
+        SDL_free(mutex);
+    }
+}
+
+static void
+SDL_LockMutexContended(SDL_mutex * mutex)
+{
+    int spins;
+
+    /* The owner is likely running on another core and about to unlock,
+       so spin for a while before paying for a sleep and a wakeup. There's
+       no point in that on a single core or once others are already asleep.
+     */
+    if (SDL_GetCPUCount() > 1) {
+        for (spins = SDL_MUTEX_SPIN_COUNT; spins > 0; --spins) {
+            const int state = SDL_AtomicGet(&mutex->state);
+            if (state == 0) {
+                if (SDL_MutexStateCAS(mutex, 0, 1)) {
+                    return;
+                }
+            } else if (state == 2) {
+                break;
+            }
+            SDL_CPUPauseInstruction();
+        }
+    }
+
+    /* Mark the mutex contended, so the unlock knows to wake us */
+    while (SDL_MutexStateSet(mutex, 2) != 0) {
+        SDL_AtomicWait(&mutex->state, 2);
+    }
+}
+
+/* Lock the mutex */
+int
+SDL_LockMutex(SDL_mutex * mutex)
+{
+    pthread_t this_thread;
+
+    if (mutex == NULL) {
+        return SDL_InvalidParamError("mutex");
+    }
+
+    this_thread = pthread_self();
+    if (SDL_MutexGetOwner(mutex) == this_thread) {
+        ++mutex->recursive;
+        return 0;
+    }
+
+    if (!SDL_MutexStateCAS(mutex, 0, 1)) {
+        SDL_LockMutexContended(mutex);
+    }
+    SDL_MutexSetOwner(mutex, this_thread);
+    mutex->recursive = 0;
+    return 0;
+}
+
+int
+SDL_TryLockMutex(SDL_mutex * mutex)
+{
+    pthread_t this_thread;
+
+    if (mutex == NULL) {
+        return SDL_InvalidParamError("mutex");
+    }
+
+    this_thread = pthread_self();
+    if (SDL_MutexGetOwner(mutex) == this_thread) {
+        ++mutex->recursive;
+        return 0;
+    }
+
+    if (!SDL_MutexStateCAS(mutex, 0, 1)) {
+        return SDL_MUTEX_TIMEDOUT;
+    }
+    SDL_MutexSetOwner(mutex, this_thread);
+    mutex->recursive = 0;
+    return 0;
+}
+
+int
+SDL_UnlockMutex(SDL_mutex * mutex)
+{
+    if (mutex == NULL) {
+        return SDL_InvalidParamError("mutex");
+    }
+
+    /* We can only unlock the mutex if we own it */
+    if (pthread_self() != SDL_MutexGetOwner(mutex)) {
+        return SDL_SetError("mutex not owned by this thread");
+    }
+
+    if (mutex->recursive) {
+        --mutex->recursive;
+    } else {
+        SDL_MutexSetOwner(mutex, 0);
+        if (SDL_MutexStateSet(mutex, 0) == 2) {
+            SDL_AtomicWake(&mutex->state);
+        }
+    }
+    return 0;
+}
+
+#else
 
 SDL_mutex *
 SDL_CreateMutex(void)
@@ -192,4 +307,6 @@ SDL_UnlockMutex(SDL_mutex * mutex)
     return 0;
 }
 
+#endif /* SDL_THREAD_FUTEX */
+
 /* vi: set ts=4 sw=4 expandtab: */
@@ -23,10 +23,73 @@
 #ifndef SDL_mutex_c_h_
 #define SDL_mutex_c_h_
 
+#include <pthread.h>
+
+#include "SDL_atomic.h"
+
+/* On Linux the mutex and condition variable are built directly on futexes,
+   which lets an uncontended lock/unlock stay in user space and a contended
+   lock spin briefly before sleeping. Build with -DSDL_THREAD_FUTEX=0 to use
+   the pthread primitives instead.
+ */
+#ifndef SDL_THREAD_FUTEX
+#if defined(__LINUX__) || defined(__ANDROID__)
+#define SDL_THREAD_FUTEX 1
+#else
+#define SDL_THREAD_FUTEX 0
+#endif
+#endif
+
+#if SDL_THREAD_FUTEX
+
+struct SDL_mutex
+{
+    SDL_atomic_t state;     /* 0: unlocked, 1: locked, 2: locked and contended */
+    pthread_t owner;
+    int recursive;
+};
+
+/* The lock and unlock paths use the compiler intrinsics directly, calling
+   out to SDL_AtomicCAS() and SDL_AtomicSet() costs as much as the lock.
+ */
+#ifdef HAVE_GCC_ATOMICS
+#define SDL_MutexStateCAS(mutex, oldval, newval) __sync_bool_compare_and_swap(&(mutex)->state.value, oldval, newval)
+#define SDL_MutexStateSet(mutex, val) __atomic_exchange_n(&(mutex)->state.value, val, __ATOMIC_SEQ_CST)
+#else
+#define SDL_MutexStateCAS(mutex, oldval, newval) SDL_AtomicCAS(&(mutex)->state, oldval, newval)
+#define SDL_MutexStateSet(mutex, val) SDL_AtomicSet(&(mutex)->state, val)
+#endif
+
+/* Any thread may check the owner, to see whether it already holds the lock,
+   while the holder sets or clears it. A thread can only find its own id
+   there if it holds the lock, so relaxed accesses are enough, they just
+   mustn't tear.
+ */
+#ifdef HAVE_GCC_ATOMICS
+#define SDL_MutexGetOwner(mutex) __atomic_load_n(&(mutex)->owner, __ATOMIC_RELAXED)
+#define SDL_MutexSetOwner(mutex, thread) __atomic_store_n(&(mutex)->owner, thread, __ATOMIC_RELAXED)
+#else
+#define SDL_MutexGetOwner(mutex) ((mutex)->owner)
+#define SDL_MutexSetOwner(mutex, thread) ((mutex)->owner = (thread))
+#endif
+
+#else
+
+#if !SDL_THREAD_PTHREAD_RECURSIVE_MUTEX && \
+    !SDL_THREAD_PTHREAD_RECURSIVE_MUTEX_NP
+#define FAKE_RECURSIVE_MUTEX 1
+#endif
+
 struct SDL_mutex
 {
     pthread_mutex_t id;
+#if FAKE_RECURSIVE_MUTEX
+    int recursive;
+    pthread_t owner;
+#endif
 };
 
+#endif /* SDL_THREAD_FUTEX */
+
 #endif /* SDL_mutex_c_h_ */
 /* vi: set ts=4 sw=4 expandtab: */
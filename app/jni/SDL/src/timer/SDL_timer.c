@@ -30,15 +30,26 @@
 
 #if !defined(__EMSCRIPTEN__) || !SDL_THREADS_DISABLED
 
+#define SDL_NS_PER_MS   1000000
+
 typedef struct _SDL_Timer
 {
     int timerID;
     SDL_TimerCallback callback;
     void *param;
     Uint32 interval;
-    Uint32 scheduled;
+    Uint64 scheduled;   /* nanoseconds, see SDL_TimerNow() */
     SDL_atomic_t canceled;
     struct _SDL_Timer *next;
+
+    /* Link for the list of canceled timers */
+    struct _SDL_Timer *next_removed;
+
+    /* Pairing heap links, prev is the parent for a first child */
+    SDL_bool queued;
+    struct _SDL_Timer *child;
+    struct _SDL_Timer *sibling;
+    struct _SDL_Timer *prev;
 } SDL_Timer;
 
 typedef struct _SDL_TimerMap
@@ -48,12 +59,14 @@ typedef struct _SDL_TimerMap
     struct _SDL_TimerMap *next;
 } SDL_TimerMap;
 
-/* The timers are kept in a sorted list */
+/* The timers are kept in a pairing heap ordered by scheduled time */
 typedef struct {
     /* Data used by the main thread */
     SDL_Thread *thread;
     SDL_atomic_t nextID;
-    SDL_TimerMap *timermap;
+    SDL_TimerMap **timermap;    /* hashed by timer ID */
+    int timermap_size;          /* number of buckets, a power of two */
+    int timermap_count;
     SDL_mutex *timermap_lock;
 
     /* Padding to separate cache lines between threads */
@@ -63,11 +76,15 @@ typedef struct {
     SDL_SpinLock lock;
     SDL_sem *sem;
     SDL_Timer *pending;
+    SDL_Timer *removed;
     SDL_Timer *freelist;
     SDL_atomic_t active;
 
-    /* List of timers - this is only touched by the timer thread */
+    /* Heap of timers - this is only touched by the timer thread */
     SDL_Timer *timers;
+
+    Uint64 counter_start;
+    Uint64 counter_frequency;
 } SDL_TimerData;
 
 static SDL_TimerData SDL_timer_data;
@@ -75,28 +92,183 @@ static SDL_TimerData SDL_timer_data;
 /* The idea here is that any thread might add a timer, but a single
  * thread manages the active timer queue, sorted by scheduling time.
  *
- * Timers are removed by simply setting a canceled flag
+ * Timers are removed by setting a canceled flag, and handing them to the
+ * timer thread to take out of the queue.
+ *
+ * The queue is a pairing heap: insertion is O(1), and removing the first
+ * or any other timer is O(log n) amortized, without any allocations.
  */
 
+/* Nanoseconds since the timer subsystem started */
+static Uint64
+SDL_TimerNow(SDL_TimerData *data)
+{
+    const Uint64 counter = SDL_GetPerformanceCounter() - data->counter_start;
+    const Uint64 frequency = data->counter_frequency;
+
+    return (counter / frequency) * 1000000000 +
+           ((counter % frequency) * 1000000000) / frequency;
+}
+
+static SDL_Timer *
+SDL_MeldTimers(SDL_Timer *a, SDL_Timer *b)
+{
+    SDL_Timer *child;
+
+    if (!a) {
+        return b;
+    }
+    if (!b) {
+        return a;
+    }
+    if (b->scheduled < a->scheduled) {
+        child = a;
+        a = b;
+        b = child;
+    }
+
+    /* b becomes the first child of a */
+    b->sibling = a->child;
+    if (a->child) {
+        a->child->prev = b;
+    }
+    b->prev = a;
+    a->child = b;
+    a->sibling = NULL;
+    a->prev = NULL;
+    return a;
+}
+
+/* Combine a list of siblings into a single heap, the usual two pass way */
+static SDL_Timer *
+SDL_MergeTimerPairs(SDL_Timer *first)
+{
+    SDL_Timer *pairs = NULL;
+    SDL_Timer *heap = NULL;
+
+    /* Meld pairs left to right, collecting them in reverse order */
+    while (first) {
+        SDL_Timer *a = first;
+        SDL_Timer *b = a->sibling;
+        SDL_Timer *pair;
+
+        first = b ? b->sibling : NULL;
+        a->sibling = a->prev = NULL;
+        if (b) {
+            b->sibling = b->prev = NULL;
+        }
+        pair = SDL_MeldTimers(a, b);
+        pair->sibling = pairs;
+        pairs = pair;
+    }
+
+    /* Meld the pairs right to left */
+    while (pairs) {
+        SDL_Timer *next = pairs->sibling;
+        pairs->sibling = NULL;
+        heap = SDL_MeldTimers(heap, pairs);
+        pairs = next;
+    }
+    return heap;
+}
+
 static void
 SDL_AddTimerInternal(SDL_TimerData *data, SDL_Timer *timer)
 {
-    SDL_Timer *prev, *curr;
+    timer->child = NULL;
+    timer->sibling = NULL;
+    timer->prev = NULL;
+    timer->queued = SDL_TRUE;
+    data->timers = SDL_MeldTimers(data->timers, timer);
+}
 
-    prev = NULL;
-    for (curr = data->timers; curr; prev = curr, curr = curr->next) {
-        if ((Sint32)(timer->scheduled-curr->scheduled) < 0) {
-            break;
+static void
+SDL_RemoveTimerInternal(SDL_TimerData *data, SDL_Timer *timer)
+{
+    SDL_Timer *children = SDL_MergeTimerPairs(timer->child);
+
+    if (timer == data->timers) {
+        data->timers = children;
+    } else {
+        /* Unlink it from its parent or left sibling */
+        if (timer->prev->child == timer) {
+            timer->prev->child = timer->sibling;
+        } else {
+            timer->prev->sibling = timer->sibling;
+        }
+        if (timer->sibling) {
+            timer->sibling->prev = timer->prev;
         }
+        data->timers = SDL_MeldTimers(data->timers, children);
     }
+    timer->child = NULL;
+    timer->sibling = NULL;
+    timer->prev = NULL;
+    timer->queued = SDL_FALSE;
+}
 
-    /* Insert the timer here! */
-    if (prev) {
-        prev->next = timer;
-    } else {
-        data->timers = timer;
+/* Timer IDs are sequential, so the low bits spread them out evenly.
+   These must be called with the timermap lock held. */
+static int
+SDL_InsertTimerMap(SDL_TimerData *data, SDL_TimerMap *entry)
+{
+    SDL_TimerMap **bucket;
+
+    if (data->timermap_count >= data->timermap_size) {
+        const int size = data->timermap_size ? data->timermap_size * 2 : 64;
+        SDL_TimerMap **timermap = (SDL_TimerMap **)SDL_calloc(size, sizeof(*timermap));
+
+        /* If this fails we just keep using longer chains */
+        if (timermap) {
+            int i;
+
+            for (i = 0; i < data->timermap_size; ++i) {
+                while (data->timermap[i]) {
+                    SDL_TimerMap *moved = data->timermap[i];
+                    data->timermap[i] = moved->next;
+                    moved->next = timermap[moved->timerID & (size - 1)];
+                    timermap[moved->timerID & (size - 1)] = moved;
+                }
+            }
+            SDL_free(data->timermap);
+            data->timermap = timermap;
+            data->timermap_size = size;
+        } else if (!data->timermap) {
+            return SDL_OutOfMemory();
+        }
+    }
+
+    bucket = &data->timermap[entry->timerID & (data->timermap_size - 1)];
+    entry->next = *bucket;
+    *bucket = entry;
+    ++data->timermap_count;
+    return 0;
+}
+
+static SDL_TimerMap *
+SDL_TakeTimerMap(SDL_TimerData *data, SDL_TimerID id)
+{
+    SDL_TimerMap *prev, *entry;
+    SDL_TimerMap **bucket;
+
+    if (!data->timermap) {
+        return NULL;
     }
-    timer->next = curr;
+
+    bucket = &data->timermap[id & (data->timermap_size - 1)];
+    prev = NULL;
+    for (entry = *bucket; entry; prev = entry, entry = entry->next) {
+        if (entry->timerID == id) {
+            if (prev) {
+                prev->next = entry->next;
+            } else {
+                *bucket = entry->next;
+            }
+            --data->timermap_count;
+            break;
+        }
+    }
+    return entry;
 }
 
 static int SDLCALL
@@ -104,13 +276,15 @@ SDL_TimerThread(void *_data)
 {
     SDL_TimerData *data = (SDL_TimerData *)_data;
     SDL_Timer *pending;
+    SDL_Timer *removed;
     SDL_Timer *current;
     SDL_Timer *freelist_head = NULL;
     SDL_Timer *freelist_tail = NULL;
-    Uint32 tick, now, interval, delay;
+    Uint64 tick, now, delay_ns;
+    Uint32 interval, delay;
 
     /* Threaded timer loop:
-     *  1. Queue timers added by other threads
+     *  1. Queue timers added by other threads, drop canceled ones
      *  2. Handle any timers that should dispatch this cycle
      *  3. Wait until next dispatch time or new timer arrives
      */
@@ -118,9 +292,11 @@ SDL_TimerThread(void *_data)
         /* Pending and freelist maintenance */
         SDL_AtomicLock(&data->lock);
         {
-            /* Get any timers ready to be queued */
+            /* Get any timers ready to be queued or removed */
             pending = data->pending;
             data->pending = NULL;
+            removed = data->removed;
+            data->removed = NULL;
 
             /* Make any unused timer structures available */
             if (freelist_head) {
@@ -130,7 +306,7 @@ SDL_TimerThread(void *_data)
         }
         SDL_AtomicUnlock(&data->lock);
 
-        /* Sort the pending timers into our list */
+        /* Sort the pending timers into our queue */
         while (pending) {
             current = pending;
             pending = pending->next;
@@ -139,28 +315,47 @@ SDL_TimerThread(void *_data)
         freelist_head = NULL;
         freelist_tail = NULL;
 
+        /* Take canceled timers out of the queue right away, rather than
+           when they would have fired */
+        while (removed) {
+            current = removed;
+            removed = removed->next_removed;
+            if (current->queued) {
+                SDL_RemoveTimerInternal(data, current);
+
+                current->next = NULL;
+                if (!freelist_head) {
+                    freelist_head = current;
+                }
+                if (freelist_tail) {
+                    freelist_tail->next = current;
+                }
+                freelist_tail = current;
+            }
+        }
+
         /* Check to see if we're still running, after maintenance */
         if (!SDL_AtomicGet(&data->active)) {
             break;
         }
 
         /* Initial delay if there are no timers */
-        delay = SDL_MUTEX_MAXWAIT;
+        delay_ns = ~(Uint64)0;
 
-        tick = SDL_GetTicks();
+        tick = SDL_TimerNow(data);
 
         /* Process all the pending timers for this tick */
         while (data->timers) {
             current = data->timers;
 
-            if ((Sint32)(tick-current->scheduled) < 0) {
+            if (tick < current->scheduled) {
                 /* Scheduled for the future, wait a bit */
-                delay = (current->scheduled - tick);
+                delay_ns = (current->scheduled - tick);
                 break;
             }
 
             /* We're going to do something with this timer */
-            data->timers = current->next;
+            SDL_RemoveTimerInternal(data, current);
 
             if (SDL_AtomicGet(&current->canceled)) {
                 interval = 0;
@@ -171,9 +366,10 @@ SDL_TimerThread(void *_data)
             if (interval > 0) {
                 /* Reschedule this timer */
                 current->interval = interval;
-                current->scheduled = tick + interval;
+                current->scheduled = tick + (Uint64)interval * SDL_NS_PER_MS;
                 SDL_AddTimerInternal(data, current);
             } else {
+                current->next = NULL;
                 if (!freelist_head) {
                     freelist_head = current;
                 }
@@ -186,13 +382,17 @@ SDL_TimerThread(void *_data)
             }
         }
 
-        /* Adjust the delay based on processing time */
-        now = SDL_GetTicks();
-        interval = (now - tick);
-        if (interval > delay) {
+        /* Adjust the delay based on processing time, and wait whole
+           milliseconds, rounding up so we don't wake up early */
+        now = SDL_TimerNow(data);
+        if (delay_ns == ~(Uint64)0) {
+            delay = SDL_MUTEX_MAXWAIT;
+        } else if (now - tick >= delay_ns) {
             delay = 0;
         } else {
-            delay -= interval;
+            delay_ns -= (now - tick);
+            delay_ns = (delay_ns + SDL_NS_PER_MS - 1) / SDL_NS_PER_MS;
+            delay = (Uint32)SDL_min(delay_ns, (Uint64)(SDL_MUTEX_MAXWAIT - 1));
         }
 
         /* Note that each time a timer is added, this will return
@@ -223,6 +423,9 @@ SDL_TimerInit(void)
             return -1;
         }
 
+        data->counter_start = SDL_GetPerformanceCounter();
+        data->counter_frequency = SDL_GetPerformanceFrequency();
+
         SDL_AtomicSet(&data->active, 1);
 
         /* Timer threads use a callback into the app, so we can't set a limited stack size here. */
@@ -243,6 +446,7 @@ SDL_TimerQuit(void)
     SDL_TimerData *data = &SDL_timer_data;
     SDL_Timer *timer;
     SDL_TimerMap *entry;
+    int i;
 
     if (SDL_AtomicCAS(&data->active, 1, 0)) {  /* active? Move to inactive. */
         /* Shutdown the timer thread */
@@ -258,19 +462,26 @@ SDL_TimerQuit(void)
         /* Clean up the timer entries */
         while (data->timers) {
             timer = data->timers;
-            data->timers = timer->next;
+            SDL_RemoveTimerInternal(data, timer);
             SDL_free(timer);
         }
+        data->removed = NULL;
         while (data->freelist) {
             timer = data->freelist;
             data->freelist = timer->next;
             SDL_free(timer);
         }
-        while (data->timermap) {
-            entry = data->timermap;
-            data->timermap = entry->next;
-            SDL_free(entry);
+        for (i = 0; i < data->timermap_size; ++i) {
+            while (data->timermap[i]) {
+                entry = data->timermap[i];
+                data->timermap[i] = entry->next;
+                SDL_free(entry);
+            }
         }
+        SDL_free(data->timermap);
+        data->timermap = NULL;
+        data->timermap_size = 0;
+        data->timermap_count = 0;
 
         SDL_DestroyMutex(data->timermap_lock);
         data->timermap_lock = NULL;
@@ -311,7 +522,8 @@ SDL_AddTimer(Uint32 interval, SDL_TimerCallback callback, void *param)
     timer->callback = callback;
     timer->param = param;
     timer->interval = interval;
-    timer->scheduled = SDL_GetTicks() + interval;
+    timer->scheduled = SDL_TimerNow(data) + (Uint64)interval * SDL_NS_PER_MS;
+    timer->queued = SDL_FALSE;
     SDL_AtomicSet(&timer->canceled, 0);
 
     entry = (SDL_TimerMap *)SDL_malloc(sizeof(*entry));
@@ -324,8 +536,12 @@ SDL_AddTimer(Uint32 interval, SDL_TimerCallback callback, void *param)
     entry->timerID = timer->timerID;
 
     SDL_LockMutex(data->timermap_lock);
-    entry->next = data->timermap;
-    data->timermap = entry;
+    if (SDL_InsertTimerMap(data, entry) < 0) {
+        SDL_UnlockMutex(data->timermap_lock);
+        SDL_free(entry);
+        SDL_free(timer);
+        return 0;
+    }
     SDL_UnlockMutex(data->timermap_lock);
 
     /* Add the timer to the pending list for the timer thread */
@@ -344,27 +560,23 @@ SDL_bool
 SDL_RemoveTimer(SDL_TimerID id)
 {
     SDL_TimerData *data = &SDL_timer_data;
-    SDL_TimerMap *prev, *entry;
+    SDL_TimerMap *entry;
     SDL_bool canceled = SDL_FALSE;
 
     /* Find the timer */
     SDL_LockMutex(data->timermap_lock);
-    prev = NULL;
-    for (entry = data->timermap; entry; prev = entry, entry = entry->next) {
-        if (entry->timerID == id) {
-            if (prev) {
-                prev->next = entry->next;
-            } else {
-                data->timermap = entry->next;
-            }
-            break;
-        }
-    }
+    entry = SDL_TakeTimerMap(data, id);
     SDL_UnlockMutex(data->timermap_lock);
 
     if (entry) {
-        if (!SDL_AtomicGet(&entry->timer->canceled)) {
-            SDL_AtomicSet(&entry->timer->canceled, 1);
+        SDL_Timer *timer = entry->timer;
+
+        if (SDL_AtomicCAS(&timer->canceled, 0, 1)) {
+            /* Let the timer thread take it out of the queue */
+            SDL_AtomicLock(&data->lock);
+            timer->next_removed = data->removed;
+            data->removed = timer;
+            SDL_AtomicUnlock(&data->lock);
             canceled = SDL_TRUE;
         }
         SDL_free(entry);
@@ -491,4 +703,194 @@ SDL_GetTicks(void)
     return (Uint32) (SDL_GetTicks64() & 0xFFFFFFFF);
 }
 
+#ifndef SDL_TIMER_UNIX
+/* Platforms without a high resolution sleep round up to milliseconds */
+void
+SDL_DelayNS(Uint64 ns)
+{
+    Uint64 ms = (ns + 999999) / 1000000;
+
+    while (ms > SDL_MAX_UINT32) {
+        SDL_Delay(SDL_MAX_UINT32);
+        ms -= SDL_MAX_UINT32;
+    }
+    SDL_Delay((Uint32)ms);
+}
+#endif /* !SDL_TIMER_UNIX */
+
+struct SDL_FramePacer
+{
+    Uint64 frequency;   /* performance counter ticks per second */
+    Uint64 interval;    /* in performance counter ticks */
+    Uint64 last;        /* the last deadline, 0 before the first wait */
+
+    /* How much SDL_DelayNS() oversleeps, in nanoseconds, estimated the way
+       TCP estimates round trip times */
+    Sint64 sleep_error;
+    Sint64 sleep_deviation;
+
+    SDL_FramePacerStats stats;
+    Uint64 waits;
+    Uint64 total_overshoot;
+};
+
+static Uint64
+SDL_CounterToNS(Uint64 counter, Uint64 frequency)
+{
+    return (counter / frequency) * 1000000000 +
+           ((counter % frequency) * 1000000000) / frequency;
+}
+
+static Uint64
+SDL_NSToCounter(Uint64 ns, Uint64 frequency)
+{
+    return (ns / 1000000000) * frequency +
+           ((ns % 1000000000) * frequency) / 1000000000;
+}
+
+/* How long before a deadline to stop sleeping and start spinning */
+static Uint64
+SDL_GetFramePacerMargin(SDL_FramePacer *pacer)
+{
+    const Sint64 margin = pacer->sleep_error + 4 * pacer->sleep_deviation;
+
+    return margin > 0 ? (Uint64)margin : 0;
+}
+
+static void
+SDL_UpdateFramePacerMargin(SDL_FramePacer *pacer, Sint64 oversleep)
+{
+    const Sint64 error = oversleep - pacer->sleep_error;
+    const Sint64 deviation = (error < 0) ? -error : error;
+
+    pacer->sleep_error += error / 8;
+    pacer->sleep_deviation += (deviation - pacer->sleep_deviation) / 4;
+}
+
+SDL_FramePacer *
+SDL_CreateFramePacer(Uint64 interval)
+{
+    SDL_FramePacer *pacer;
+
+    pacer = (SDL_FramePacer *)SDL_calloc(1, sizeof(*pacer));
+    if (!pacer) {
+        SDL_OutOfMemory();
+        return NULL;
+    }
+    pacer->frequency = SDL_GetPerformanceFrequency();
+
+    /* Start out waking up a millisecond early, and learn from there */
+    pacer->sleep_deviation = 250000;
+
+    if (SDL_SetFramePacerInterval(pacer, interval) < 0) {
+        SDL_free(pacer);
+        return NULL;
+    }
+    pacer->stats.spin_margin = SDL_GetFramePacerMargin(pacer);
+    return pacer;
+}
+
+int
+SDL_SetFramePacerInterval(SDL_FramePacer *pacer, Uint64 interval)
+{
+    if (!pacer) {
+        return SDL_InvalidParamError("pacer");
+    }
+
+    pacer->interval = SDL_NSToCounter(interval, pacer->frequency);
+    if (!pacer->interval) {
+        return SDL_InvalidParamError("interval");
+    }
+    return 0;
+}
+
+Uint64
+SDL_FramePacerWait(SDL_FramePacer *pacer)
+{
+    Uint64 now, deadline, elapsed;
+    Uint64 overshoot = 0;
+
+    if (!pacer) {
+        SDL_InvalidParamError("pacer");
+        return 0;
+    }
+
+    now = SDL_GetPerformanceCounter();
+    ++pacer->stats.frames;
+
+    if (!pacer->last) {
+        pacer->last = now;
+        return 0;
+    }
+
+    deadline = pacer->last + pacer->interval;
+    if (now < deadline) {
+        const Uint64 remaining = SDL_CounterToNS(deadline - now, pacer->frequency);
+        const Uint64 margin = SDL_GetFramePacerMargin(pacer);
+
+        /* Sleep for the bulk of the wait */
+        if (remaining > margin) {
+            const Uint64 request = remaining - margin;
+            const Uint64 then = now;
+
+            SDL_DelayNS(request);
+            now = SDL_GetPerformanceCounter();
+            SDL_UpdateFramePacerMargin(pacer, (Sint64)SDL_CounterToNS(now - then, pacer->frequency) - (Sint64)request);
+        }
+
+        /* Spin for the rest, letting a sibling hyperthread run meanwhile */
+        while (now < deadline) {
+            SDL_CPUPauseInstruction();
+            now = SDL_GetPerformanceCounter();
+        }
+
+        overshoot = SDL_CounterToNS(now - deadline, pacer->frequency);
+        ++pacer->waits;
+        pacer->total_overshoot += overshoot;
+        pacer->stats.last_overshoot = overshoot;
+        pacer->stats.mean_overshoot = pacer->total_overshoot / pacer->waits;
+        pacer->stats.max_overshoot = SDL_max(pacer->stats.max_overshoot, overshoot);
+        pacer->stats.spin_margin = SDL_GetFramePacerMargin(pacer);
+    } else {
+        ++pacer->stats.missed;
+    }
+
+    elapsed = (now - pacer->last);
+    if (elapsed > pacer->frequency) {
+        /* It's been too long, restart the timeline */
+        pacer->last = now;
+    } else {
+        /* Skip any deadlines we missed */
+        pacer->last += (elapsed / pacer->interval) * pacer->interval;
+    }
+    return overshoot;
+}
+
+int
+SDL_GetFramePacerStats(SDL_FramePacer *pacer, SDL_FramePacerStats *stats, SDL_bool reset)
+{
+    if (!pacer) {
+        return SDL_InvalidParamError("pacer");
+    }
+    if (!stats) {
+        return SDL_InvalidParamError("stats");
+    }
+
+    SDL_copyp(stats, &pacer->stats);
+
+    if (reset) {
+        SDL_zero(pacer->stats);
+        pacer->stats.spin_margin = SDL_GetFramePacerMargin(pacer);
+        pacer->waits = 0;
+        pacer->total_overshoot = 0;
+    }
+    return 0;
+}
+
+void
+SDL_DestroyFramePacer(SDL_FramePacer *pacer)
+{
+    SDL_free(pacer);
+}
+
 /* vi: set ts=4 sw=4 expandtab: */
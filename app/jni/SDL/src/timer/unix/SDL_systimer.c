@@ -185,6 +185,12 @@ SDL_GetPerformanceFrequency(void)
 
 void
 SDL_Delay(Uint32 ms)
+{
+    SDL_DelayNS((Uint64)ms * 1000000);
+}
+
+void
+SDL_DelayNS(Uint64 ns)
 {
     int was_error;
 
@@ -198,17 +204,17 @@ SDL_Delay(Uint32 ms)
 #ifdef __EMSCRIPTEN__
     if (emscripten_has_asyncify() && SDL_GetHintBoolean(SDL_HINT_EMSCRIPTEN_ASYNCIFY, SDL_TRUE)) {
         /* pseudo-synchronous pause, used directly or through e.g. SDL_WaitEvent */
-        emscripten_sleep(ms);
+        emscripten_sleep((unsigned int)((ns + 999999) / 1000000));
         return;
     }
 #endif
 
     /* Set the timeout interval */
 #if HAVE_NANOSLEEP
-    elapsed.tv_sec = ms / 1000;
-    elapsed.tv_nsec = (ms % 1000) * 1000000;
+    elapsed.tv_sec = (time_t)(ns / 1000000000);
+    elapsed.tv_nsec = (long)(ns % 1000000000);
 #else
-    then = SDL_GetTicks64();
+    then = SDL_GetPerformanceCounter();
 #endif
     do {
         errno = 0;
@@ -219,15 +225,15 @@ SDL_Delay(Uint32 ms)
         was_error = nanosleep(&tv, &elapsed);
 #else
         /* Calculate the time interval left (in case of interrupt) */
-        now = SDL_GetTicks64();
-        elapsed = (now - then);
+        now = SDL_GetPerformanceCounter();
+        elapsed = ((now - then) * 1000000000) / SDL_GetPerformanceFrequency();
         then = now;
-        if (elapsed >= ((Uint64)ms)) {
+        if (elapsed >= ns) {
             break;
         }
-        ms -= (Uint32)elapsed;
-        tv.tv_sec = ms / 1000;
-        tv.tv_usec = (ms % 1000) * 1000;
+        ns -= elapsed;
+        tv.tv_sec = (long)(((ns + 999) / 1000) / 1000000);
+        tv.tv_usec = (long)(((ns + 999) / 1000) % 1000000);
 
         was_error = select(0, NULL, NULL, NULL, &tv);
 #endif /* HAVE_NANOSLEEP */
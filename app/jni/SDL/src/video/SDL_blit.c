@@ -20,6 +20,7 @@
 */
 #include "../SDL_internal.h"
 
+#include "SDL_hints.h"
 #include "SDL_video.h"
 #include "SDL_sysvideo.h"
 #include "SDL_blit.h"
@@ -28,6 +29,74 @@
 #include "SDL_blit_slow.h"
 #include "SDL_RLEaccel_c.h"
 #include "SDL_pixels_c.h"
+#include "../thread/SDL_parallel_c.h"
+
+/* The smallest blit or fill split into bands when the hint is just "1" */
+#define SDL_PARALLEL_BLIT_DEFAULT_PIXELS (512 * 512)
+
+typedef struct
+{
+    SDL_BlitFunc blit;
+    const SDL_BlitInfo *info;
+    int bands;
+} SDL_BlitBandJob;
+
+static SDL_bool
+SDL_SurfacePixelsOverlap(SDL_Surface * src, SDL_Surface * dst)
+{
+    const Uint8 *src_start = (const Uint8 *) src->pixels;
+    const Uint8 *src_end = src_start + (size_t) src->h * src->pitch;
+    const Uint8 *dst_start = (const Uint8 *) dst->pixels;
+    const Uint8 *dst_end = dst_start + (size_t) dst->h * dst->pitch;
+
+    return (src_start < dst_end && dst_start < src_end) ? SDL_TRUE : SDL_FALSE;
+}
+
+int
+SDL_GetBlitBandCount(SDL_Surface * src, SDL_Surface * dst, int w, int h)
+{
+    static SDL_HintCache hint = { SDL_HINT_VIDEO_PARALLEL_BLIT, 0, NULL, SDL_FALSE, 0 };
+    int threshold = SDL_GetCachedHintInt(&hint, 0);
+    int bands;
+
+    if (threshold <= 0) {
+        return 1;
+    }
+    if (threshold == 1) {
+        threshold = SDL_PARALLEL_BLIT_DEFAULT_PIXELS;
+    }
+    if ((Sint64)w * h < threshold) {
+        return 1;
+    }
+    /* Bands reading rows that other bands write would race */
+    if (src && SDL_SurfacePixelsOverlap(src, dst)) {
+        return 1;
+    }
+    bands = SDL_GetParallelThreadCount();
+    return SDL_min(bands, h);
+}
+
+/* Run one band of rows of a blit. Unscaled blits just start further down
+   both surfaces; scaled ones keep the source and the scaling of the whole. */
+static void
+SDL_RunBlitBand(void *data, int band)
+{
+    const SDL_BlitBandJob *job = (const SDL_BlitBandJob *) data;
+    SDL_BlitInfo info = *job->info;
+    const int y = SDL_BLIT_BAND_ROW(info.dst_h, band, job->bands);
+    const int h = SDL_BLIT_BAND_ROW(info.dst_h, band + 1, job->bands) - y;
+
+    info.dst += (size_t) y * info.dst_pitch;
+    info.dst_h = h;
+    if (info.flags & SDL_COPY_NEAREST) {
+        info.scale_y = y;
+    } else {
+        info.src += (size_t) y * info.src_pitch;
+        info.src_h = h;
+        info.scale_h = h;
+    }
+    job->blit(&info);
+}
 
 /* The general purpose software blit routine */
 static int SDLCALL
@@ -37,6 +106,7 @@ SDL_SoftBlit(SDL_Surface * src, SDL_Rect * srcrect,
     int okay;
     int src_locked;
     int dst_locked;
+    int bands;
 
     /* Everything is okay at the beginning...  */
     okay = 1;
@@ -82,10 +152,22 @@ SDL_SoftBlit(SDL_Surface * src, SDL_Rect * srcrect,
         info->dst_pitch = dst->pitch;
         info->dst_skip =
             info->dst_pitch - info->dst_w * info->dst_fmt->BytesPerPixel;
+        info->scale_y = 0;
+        info->scale_h = dstrect->h;
         RunBlit = (SDL_BlitFunc) src->map->data;
 
-        /* Run the actual software blit */
-        RunBlit(info);
+        /* Run the actual software blit, in bands on the worker threads if
+           it's large enough */
+        bands = SDL_GetBlitBandCount(src, dst, dstrect->w, dstrect->h);
+        if (bands > 1) {
+            SDL_BlitBandJob job;
+            job.blit = RunBlit;
+            job.info = info;
+            job.bands = bands;
+            SDL_ParallelFor(bands, SDL_RunBlitBand, &job);
+        } else {
+            RunBlit(info);
+        }
     }
 
     /* We need to unlock the surfaces if they're locked */
@@ -99,8 +181,6 @@ SDL_SoftBlit(SDL_Surface * src, SDL_Rect * srcrect,
     return (okay ? 0 : -1);
 }
 
-#if SDL_HAVE_BLIT_AUTO
-
 #ifdef __MACOSX__
 #include <sys/sysctl.h>
 
@@ -126,11 +206,9 @@ SDL_UseAltivecPrefetch()
 }
 #endif /* __MACOSX__ */
 
-static SDL_BlitFunc
-SDL_ChooseBlitFunc(Uint32 src_format, Uint32 dst_format, int flags,
-                   SDL_BlitFuncEntry * entries)
+int
+SDL_GetBlitCPUFeatures(void)
 {
-    int i, flagcheck = (flags & (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_COLORKEY | SDL_COPY_NEAREST));
     static int features = 0x7fffffff;
 
     /* Get the available CPU features */
@@ -155,6 +233,15 @@ SDL_ChooseBlitFunc(Uint32 src_format, Uint32 dst_format, int flags,
             if (SDL_HasSSE2()) {
                 features |= SDL_CPU_SSE2;
             }
+            if (SDL_HasSSE41()) {
+                features |= SDL_CPU_SSE41;
+            }
+            if (SDL_HasAVX2()) {
+                features |= SDL_CPU_AVX2;
+            }
+            if (SDL_HasNEON()) {
+                features |= SDL_CPU_NEON;
+            }
             if (SDL_HasAltiVec()) {
                 if (SDL_UseAltivecPrefetch()) {
                     features |= SDL_CPU_ALTIVEC_PREFETCH;
@@ -164,6 +251,17 @@ SDL_ChooseBlitFunc(Uint32 src_format, Uint32 dst_format, int flags,
             }
         }
     }
+    return features;
+}
+
+#if SDL_HAVE_BLIT_AUTO
+
+static SDL_BlitFunc
+SDL_ChooseBlitFunc(Uint32 src_format, Uint32 dst_format, int flags,
+                   SDL_BlitFuncEntry * entries)
+{
+    int i, flagcheck = (flags & (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_COLORKEY | SDL_COPY_NEAREST));
+    const int features = SDL_GetBlitCPUFeatures();
 
     for (i = 0; entries[i].func; ++i) {
         /* Check for matching pixel formats */
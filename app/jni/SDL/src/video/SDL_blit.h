@@ -58,6 +58,47 @@ extern Uint8* SDL_expand_byte[9];
 #define SDL_CPU_SSE2                0x00000008
 #define SDL_CPU_ALTIVEC_PREFETCH    0x00000010
 #define SDL_CPU_ALTIVEC_NOPREFETCH  0x00000020
+#define SDL_CPU_SSE41               0x00000040
+#define SDL_CPU_AVX2                0x00000080
+#define SDL_CPU_NEON                0x00000100
+
+/* Intrinsics for the blitters that check for these at runtime */
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#if defined(HAVE_IMMINTRIN_H) && !defined(SDL_DISABLE_IMMINTRIN_H)
+#define HAVE_SSE41_INTRINSICS 1
+#define HAVE_AVX2_INTRINSICS 1
+#endif
+#if defined __clang__
+# if (!__has_attribute(target))
+#   undef HAVE_SSE41_INTRINSICS
+#   undef HAVE_AVX2_INTRINSICS
+# endif
+# if (defined(_MSC_VER) || defined(__SCE__)) && !defined(__SSE4_1__)
+#   undef HAVE_SSE41_INTRINSICS
+# endif
+# if (defined(_MSC_VER) || defined(__SCE__)) && !defined(__AVX2__)
+#   undef HAVE_AVX2_INTRINSICS
+# endif
+#elif defined __GNUC__
+# if (__GNUC__ < 4) || (__GNUC__ == 4 && __GNUC_MINOR__ < 9)
+#   undef HAVE_SSE41_INTRINSICS
+#   undef HAVE_AVX2_INTRINSICS
+# endif
+#endif
+#endif
+
+#if defined(__clang__) || defined(__GNUC__)
+#define SDL_TARGETING_SSE41 __attribute__((target("sse4.1")))
+#define SDL_TARGETING_AVX2 __attribute__((target("avx2")))
+#else
+#define SDL_TARGETING_SSE41
+#define SDL_TARGETING_AVX2
+#endif
+
+/* The NEON blitters assume the x86 byte order of pixels in memory */
+#if defined(__ARM_NEON) && !defined(SDL_DISABLE_ARM_NEON_H) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+#define HAVE_NEON_INTRINSICS 1
+#endif
 
 typedef struct
 {
@@ -75,6 +116,10 @@ typedef struct
     int flags;
     Uint32 colorkey;
     Uint8 r, g, b, a;
+    /* Scaled blits map src_h rows onto scale_h rows, of which this blit
+       writes dst_h rows starting at row scale_y, so a large scaled blit
+       can be split into bands that each keep the scaling of the whole. */
+    int scale_y, scale_h;
 } SDL_BlitInfo;
 
 typedef void (*SDL_BlitFunc) (SDL_BlitInfo *info);
@@ -107,6 +152,17 @@ struct SDL_BlitMap
 
 /* Functions found in SDL_blit.c */
 extern int SDL_CalculateBlit(SDL_Surface * surface);
+/* Get how many bands of rows to split a w x h blit from src (NULL for a
+   fill) to dst into, according to SDL_HINT_VIDEO_PARALLEL_BLIT. A single
+   band means the blit should run on the calling thread. */
+extern int SDL_GetBlitBandCount(SDL_Surface * src, SDL_Surface * dst, int w, int h);
+
+/* The first row of a band, when h rows are split into bands */
+#define SDL_BLIT_BAND_ROW(h, band, bands) ((int)(((Sint64)(h) * (band)) / (bands)))
+
+/* Get the SDL_CPU_* features the blitters may use, which can be overridden
+   with the SDL_BLIT_CPU_FEATURES environment variable for testing */
+extern int SDL_GetBlitCPUFeatures(void);
 
 /* Functions found in SDL_blit_*.c */
 extern SDL_BlitFunc SDL_CalculateBlit0(SDL_Surface * surface);
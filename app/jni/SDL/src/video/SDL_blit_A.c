@@ -1385,6 +1385,636 @@ BlitNtoNPixelAlpha(SDL_BlitInfo * info)
     }
 }
 
+#if HAVE_SSE41_INTRINSICS || HAVE_AVX2_INTRINSICS
+
+/* Walks the rows handing STEP pixels at a time to blend through the pointers
+   s and d. The last few pixels of a row are blended in a zero-padded copy,
+   so the vector loads and stores never leave the surface. */
+#define SIMD_BLEND_LOOP(STEP, srctype, dsttype, blend)          \
+    while (height--) {                                          \
+        int n = width;                                          \
+        while (n >= STEP) {                                     \
+            const srctype *s = srcp;                            \
+            dsttype *d = dstp;                                  \
+            blend;                                              \
+            srcp += STEP;                                       \
+            dstp += STEP;                                       \
+            n -= STEP;                                          \
+        }                                                       \
+        if (n) {                                                \
+            srctype srctail[STEP];                              \
+            dsttype dsttail[STEP];                              \
+            const srctype *s = srctail;                         \
+            dsttype *d = dsttail;                               \
+            SDL_zeroa(srctail);                                 \
+            SDL_zeroa(dsttail);                                 \
+            SDL_memcpy(srctail, srcp, n * sizeof(srctype));     \
+            SDL_memcpy(dsttail, dstp, n * sizeof(dsttype));     \
+            blend;                                              \
+            SDL_memcpy(dstp, dsttail, n * sizeof(dsttype));     \
+            srcp += n;                                          \
+            dstp += n;                                          \
+        }                                                       \
+        srcp += srcskip;                                        \
+        dstp += dstskip;                                        \
+    }
+
+/* Byte shuffles that line a byte-aligned 32bpp source up with a byte-aligned
+   32bpp destination, for the general blenders below. */
+typedef struct
+{
+    Uint8 to_dst[16];       /* source RGB in destination order, alpha byte cleared */
+    Uint8 alpha_lo[16];     /* source alpha of pixels 0-1 in each of their 16-bit lanes */
+    Uint8 alpha_hi[16];     /* source alpha of pixels 2-3 in each of their 16-bit lanes */
+    Uint16 alpha_lane[8];   /* 16-bit lanes that hold the destination alpha */
+    Uint32 dst_mask;        /* the bits the destination uses, the rest are written as 0 */
+} SDL_BlendShuffle;
+
+static SDL_bool
+IsByteAligned32(const SDL_PixelFormat *fmt)
+{
+    return fmt->BytesPerPixel == 4
+        && fmt->Rloss == 0 && fmt->Gloss == 0 && fmt->Bloss == 0
+        && fmt->Rshift % 8 == 0 && fmt->Gshift % 8 == 0 && fmt->Bshift % 8 == 0
+        && (fmt->Amask == 0 || (fmt->Aloss == 0 && fmt->Ashift % 8 == 0));
+}
+
+static void
+SetupBlendShuffle(const SDL_PixelFormat *srcfmt, const SDL_PixelFormat *dstfmt,
+                  SDL_BlendShuffle *shuffle)
+{
+    const int src_r = srcfmt->Rshift / 8;
+    const int src_g = srcfmt->Gshift / 8;
+    const int src_b = srcfmt->Bshift / 8;
+    const int src_a = srcfmt->Ashift / 8;
+    const int dst_r = dstfmt->Rshift / 8;
+    const int dst_g = dstfmt->Gshift / 8;
+    const int dst_b = dstfmt->Bshift / 8;
+    /* the byte that isn't R, G or B carries alpha, if there is any */
+    const int dst_a = 6 - dst_r - dst_g - dst_b;
+    int i;
+
+    /* x86 is little endian, so a shift of 8*n is byte n of the pixel */
+    for (i = 0; i < 4; ++i) {
+        Uint8 *to_dst = &shuffle->to_dst[i * 4];
+        to_dst[dst_r] = (Uint8)(i * 4 + src_r);
+        to_dst[dst_g] = (Uint8)(i * 4 + src_g);
+        to_dst[dst_b] = (Uint8)(i * 4 + src_b);
+        to_dst[dst_a] = 0x80;
+    }
+    for (i = 0; i < 8; ++i) {
+        shuffle->alpha_lo[i * 2] = (Uint8)((i / 4) * 4 + src_a);
+        shuffle->alpha_lo[i * 2 + 1] = 0x80;
+        shuffle->alpha_hi[i * 2] = (Uint8)((i / 4 + 2) * 4 + src_a);
+        shuffle->alpha_hi[i * 2 + 1] = 0x80;
+        shuffle->alpha_lane[i] = (i % 4 == dst_a) ? 0xffff : 0;
+    }
+    shuffle->dst_mask = dstfmt->Rmask | dstfmt->Gmask | dstfmt->Bmask | dstfmt->Amask;
+}
+
+#endif /* HAVE_SSE41_INTRINSICS || HAVE_AVX2_INTRINSICS */
+
+#if HAVE_SSE41_INTRINSICS
+
+/*
+ * These do the same arithmetic as the C blitters they stand in for, 32 bits
+ * per lane, so the results are bit for bit the same whichever one runs.
+ */
+
+/* ARGB8888->(A)RGB8888 or (A)BGR8888 pixel alpha, as BlitRGBtoRGBPixelAlpha */
+SDL_FORCE_INLINE void SDL_TARGETING_SSE41
+BlendRGBPixelAlpha_SSE41(const Uint32 *srcp, Uint32 *dstp, int swap)
+{
+    const __m128i rbmask = _mm_set1_epi32(0x00ff00ff);
+    const __m128i gmask = _mm_set1_epi32(0x0000ff00);
+    const __m128i s = _mm_loadu_si128((const __m128i *)srcp);
+    const __m128i d = _mm_loadu_si128((const __m128i *)dstp);
+    const __m128i alpha = _mm_srli_epi32(s, 24);
+    const __m128i s2 = _mm_and_si128(s, gmask);
+    __m128i s1 = _mm_and_si128(s, rbmask);
+    __m128i d1 = _mm_and_si128(d, rbmask);
+    __m128i d2 = _mm_and_si128(d, gmask);
+    __m128i dalpha = _mm_srli_epi32(d, 24);
+    __m128i opaque, result;
+
+    if (swap) {
+        s1 = _mm_or_si128(_mm_srli_epi32(s1, 16), _mm_slli_epi32(s1, 16));
+        opaque = _mm_or_si128(_mm_or_si128(s1, s2), _mm_set1_epi32(0xff000000));
+    } else {
+        opaque = s;
+    }
+    d1 = _mm_add_epi32(d1, _mm_srli_epi32(_mm_mullo_epi32(_mm_sub_epi32(s1, d1), alpha), 8));
+    d2 = _mm_add_epi32(d2, _mm_srli_epi32(_mm_mullo_epi32(_mm_sub_epi32(s2, d2), alpha), 8));
+    dalpha = _mm_add_epi32(alpha, _mm_srli_epi32(_mm_mullo_epi32(dalpha, _mm_xor_si128(alpha, _mm_set1_epi32(0xff))), 8));
+    result = _mm_or_si128(_mm_or_si128(_mm_and_si128(d1, rbmask), _mm_and_si128(d2, gmask)),
+                          _mm_slli_epi32(dalpha, 24));
+    result = _mm_blendv_epi8(result, opaque, _mm_cmpeq_epi32(alpha, _mm_set1_epi32(0xff)));
+    result = _mm_blendv_epi8(result, d, _mm_cmpeq_epi32(alpha, _mm_setzero_si128()));
+    _mm_storeu_si128((__m128i *)dstp, result);
+}
+
+/* RGB888->(X)RGB888 surface alpha, as BlitRGBtoRGBSurfaceAlpha */
+SDL_FORCE_INLINE void SDL_TARGETING_SSE41
+BlendRGBSurfaceAlpha_SSE41(const Uint32 *srcp, Uint32 *dstp, __m128i alpha)
+{
+    const __m128i rbmask = _mm_set1_epi32(0x00ff00ff);
+    const __m128i gmask = _mm_set1_epi32(0x0000ff00);
+    const __m128i s = _mm_loadu_si128((const __m128i *)srcp);
+    const __m128i d = _mm_loadu_si128((const __m128i *)dstp);
+    const __m128i s1 = _mm_and_si128(s, rbmask);
+    const __m128i s2 = _mm_and_si128(s, gmask);
+    __m128i d1 = _mm_and_si128(d, rbmask);
+    __m128i d2 = _mm_and_si128(d, gmask);
+
+    d1 = _mm_add_epi32(d1, _mm_srli_epi32(_mm_mullo_epi32(_mm_sub_epi32(s1, d1), alpha), 8));
+    d2 = _mm_add_epi32(d2, _mm_srli_epi32(_mm_mullo_epi32(_mm_sub_epi32(s2, d2), alpha), 8));
+    _mm_storeu_si128((__m128i *)dstp,
+                     _mm_or_si128(_mm_or_si128(_mm_and_si128(d1, rbmask), _mm_and_si128(d2, gmask)),
+                                  _mm_set1_epi32(0xff000000)));
+}
+
+/* ARGB8888->RGB565 pixel alpha, as BlitARGBto565PixelAlpha */
+SDL_FORCE_INLINE void SDL_TARGETING_SSE41
+BlendARGBto565PixelAlpha_SSE41(const Uint32 *srcp, Uint16 *dstp)
+{
+    const __m128i mask = _mm_set1_epi32(0x07e0f81f);
+    __m128i s = _mm_loadu_si128((const __m128i *)srcp);
+    const __m128i d0 = _mm_cvtepu16_epi32(_mm_loadl_epi64((const __m128i *)dstp));
+    const __m128i alpha = _mm_srli_epi32(s, 27);
+    const __m128i rb = _mm_or_si128(_mm_and_si128(_mm_srli_epi32(s, 8), _mm_set1_epi32(0xf800)),
+                                    _mm_and_si128(_mm_srli_epi32(s, 3), _mm_set1_epi32(0x1f)));
+    const __m128i opaque = _mm_or_si128(rb, _mm_and_si128(_mm_srli_epi32(s, 5), _mm_set1_epi32(0x7e0)));
+    __m128i d, result;
+
+    s = _mm_or_si128(rb, _mm_slli_epi32(_mm_and_si128(s, _mm_set1_epi32(0xfc00)), 11));
+    d = _mm_and_si128(_mm_or_si128(d0, _mm_slli_epi32(d0, 16)), mask);
+    d = _mm_add_epi32(d, _mm_srli_epi32(_mm_mullo_epi32(_mm_sub_epi32(s, d), alpha), 5));
+    d = _mm_and_si128(d, mask);
+    result = _mm_and_si128(_mm_or_si128(d, _mm_srli_epi32(d, 16)), _mm_set1_epi32(0xffff));
+    result = _mm_blendv_epi8(result, opaque, _mm_cmpeq_epi32(alpha, _mm_set1_epi32(SDL_ALPHA_OPAQUE >> 3)));
+    result = _mm_blendv_epi8(result, d0, _mm_cmpeq_epi32(alpha, _mm_setzero_si128()));
+    _mm_storel_epi64((__m128i *)dstp, _mm_packus_epi32(result, result));
+}
+
+/* RGB565->RGB565 surface alpha, as Blit565to565SurfaceAlpha */
+SDL_FORCE_INLINE void SDL_TARGETING_SSE41
+Blend565SurfaceAlpha_SSE41(const Uint16 *srcp, Uint16 *dstp, __m128i alpha)
+{
+    const __m128i mask = _mm_set1_epi32(0x07e0f81f);
+    __m128i s = _mm_cvtepu16_epi32(_mm_loadl_epi64((const __m128i *)srcp));
+    __m128i d = _mm_cvtepu16_epi32(_mm_loadl_epi64((const __m128i *)dstp));
+
+    s = _mm_and_si128(_mm_or_si128(s, _mm_slli_epi32(s, 16)), mask);
+    d = _mm_and_si128(_mm_or_si128(d, _mm_slli_epi32(d, 16)), mask);
+    d = _mm_add_epi32(d, _mm_srli_epi32(_mm_mullo_epi32(_mm_sub_epi32(s, d), alpha), 5));
+    d = _mm_and_si128(d, mask);
+    d = _mm_and_si128(_mm_or_si128(d, _mm_srli_epi32(d, 16)), _mm_set1_epi32(0xffff));
+    _mm_storel_epi64((__m128i *)dstp, _mm_packus_epi32(d, d));
+}
+
+/* ALPHA_BLEND_RGBA on 16-bit lanes: d + (s - d) * alpha / 255, truncated
+   towards zero. The alpha lane has s = 0 and gets alpha added back, which
+   makes it alpha + d - d * alpha / 255. */
+SDL_FORCE_INLINE __m128i SDL_TARGETING_SSE41
+BlendChannels_SSE41(__m128i s, __m128i d, __m128i alpha, __m128i alpha_lane)
+{
+    const __m128i diff = _mm_sub_epi16(s, d);
+    __m128i q = _mm_mullo_epi16(_mm_abs_epi16(diff), alpha);
+    q = _mm_srli_epi16(_mm_mulhi_epu16(q, _mm_set1_epi16((short)0x8081)), 7);   /* q / 255 */
+    return _mm_add_epi16(_mm_add_epi16(d, _mm_sign_epi16(q, diff)), _mm_and_si128(alpha, alpha_lane));
+}
+
+/* Any byte-aligned 32bpp pair with pixel alpha, as BlitNtoNPixelAlpha */
+SDL_FORCE_INLINE void SDL_TARGETING_SSE41
+BlendNtoNPixelAlpha_SSE41(const Uint32 *srcp, Uint32 *dstp, __m128i to_dst,
+                          __m128i alpha_lo, __m128i alpha_hi, __m128i alpha_lane,
+                          __m128i dst_mask, __m128i src_amask)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i s = _mm_loadu_si128((const __m128i *)srcp);
+    const __m128i d = _mm_loadu_si128((const __m128i *)dstp);
+    const __m128i sd = _mm_shuffle_epi8(s, to_dst);
+    const __m128i lo = BlendChannels_SSE41(_mm_unpacklo_epi8(sd, zero), _mm_unpacklo_epi8(d, zero),
+                                           _mm_shuffle_epi8(s, alpha_lo), alpha_lane);
+    const __m128i hi = BlendChannels_SSE41(_mm_unpackhi_epi8(sd, zero), _mm_unpackhi_epi8(d, zero),
+                                           _mm_shuffle_epi8(s, alpha_hi), alpha_lane);
+    __m128i result = _mm_and_si128(_mm_packus_epi16(lo, hi), dst_mask);
+
+    /* fully transparent source pixels leave the destination alone */
+    result = _mm_blendv_epi8(result, d, _mm_cmpeq_epi32(_mm_and_si128(s, src_amask), zero));
+    _mm_storeu_si128((__m128i *)dstp, result);
+}
+
+/* Any byte-aligned 32bpp pair with surface alpha, as BlitNtoNSurfaceAlpha */
+SDL_FORCE_INLINE void SDL_TARGETING_SSE41
+BlendNtoNSurfaceAlpha_SSE41(const Uint32 *srcp, Uint32 *dstp, __m128i to_dst,
+                            __m128i alpha, __m128i alpha_lane, __m128i dst_mask)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i s = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)srcp), to_dst);
+    const __m128i d = _mm_loadu_si128((const __m128i *)dstp);
+    const __m128i lo = BlendChannels_SSE41(_mm_unpacklo_epi8(s, zero), _mm_unpacklo_epi8(d, zero),
+                                           alpha, alpha_lane);
+    const __m128i hi = BlendChannels_SSE41(_mm_unpackhi_epi8(s, zero), _mm_unpackhi_epi8(d, zero),
+                                           alpha, alpha_lane);
+    _mm_storeu_si128((__m128i *)dstp, _mm_and_si128(_mm_packus_epi16(lo, hi), dst_mask));
+}
+
+static void SDL_TARGETING_SSE41
+BlitRGBtoRGBPixelAlphaSSE41(SDL_BlitInfo * info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    const Uint32 *srcp = (const Uint32 *) info->src;
+    int srcskip = info->src_skip >> 2;
+    Uint32 *dstp = (Uint32 *) info->dst;
+    int dstskip = info->dst_skip >> 2;
+
+    SIMD_BLEND_LOOP(4, Uint32, Uint32, BlendRGBPixelAlpha_SSE41(s, d, 0));
+}
+
+static void SDL_TARGETING_SSE41
+BlitRGBtoBGRPixelAlphaSSE41(SDL_BlitInfo * info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    const Uint32 *srcp = (const Uint32 *) info->src;
+    int srcskip = info->src_skip >> 2;
+    Uint32 *dstp = (Uint32 *) info->dst;
+    int dstskip = info->dst_skip >> 2;
+
+    SIMD_BLEND_LOOP(4, Uint32, Uint32, BlendRGBPixelAlpha_SSE41(s, d, 1));
+}
+
+static void SDL_TARGETING_SSE41
+BlitRGBtoRGBSurfaceAlphaSSE41(SDL_BlitInfo * info)
+{
+    if (info->a == 128) {
+        BlitRGBtoRGBSurfaceAlpha128(info);
+    } else {
+        int width = info->dst_w;
+        int height = info->dst_h;
+        const Uint32 *srcp = (const Uint32 *) info->src;
+        int srcskip = info->src_skip >> 2;
+        Uint32 *dstp = (Uint32 *) info->dst;
+        int dstskip = info->dst_skip >> 2;
+        const __m128i alpha = _mm_set1_epi32(info->a);
+
+        SIMD_BLEND_LOOP(4, Uint32, Uint32, BlendRGBSurfaceAlpha_SSE41(s, d, alpha));
+    }
+}
+
+static void SDL_TARGETING_SSE41
+BlitARGBto565PixelAlphaSSE41(SDL_BlitInfo * info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    const Uint32 *srcp = (const Uint32 *) info->src;
+    int srcskip = info->src_skip >> 2;
+    Uint16 *dstp = (Uint16 *) info->dst;
+    int dstskip = info->dst_skip >> 1;
+
+    SIMD_BLEND_LOOP(4, Uint32, Uint16, BlendARGBto565PixelAlpha_SSE41(s, d));
+}
+
+static void SDL_TARGETING_SSE41
+Blit565to565SurfaceAlphaSSE41(SDL_BlitInfo * info)
+{
+    if (info->a == 128) {
+        Blit16to16SurfaceAlpha128(info, 0xf7de);
+    } else {
+        int width = info->dst_w;
+        int height = info->dst_h;
+        const Uint16 *srcp = (const Uint16 *) info->src;
+        int srcskip = info->src_skip >> 1;
+        Uint16 *dstp = (Uint16 *) info->dst;
+        int dstskip = info->dst_skip >> 1;
+        const __m128i alpha = _mm_set1_epi32(info->a >> 3);     /* downscale alpha to 5 bits */
+
+        SIMD_BLEND_LOOP(4, Uint16, Uint16, Blend565SurfaceAlpha_SSE41(s, d, alpha));
+    }
+}
+
+static void SDL_TARGETING_SSE41
+BlitNtoNPixelAlphaSSE41(SDL_BlitInfo * info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    const Uint32 *srcp = (const Uint32 *) info->src;
+    int srcskip = info->src_skip >> 2;
+    Uint32 *dstp = (Uint32 *) info->dst;
+    int dstskip = info->dst_skip >> 2;
+    SDL_BlendShuffle shuffle;
+    __m128i to_dst, alpha_lo, alpha_hi, alpha_lane, dst_mask, src_amask;
+
+    SetupBlendShuffle(info->src_fmt, info->dst_fmt, &shuffle);
+    to_dst = _mm_loadu_si128((const __m128i *)shuffle.to_dst);
+    alpha_lo = _mm_loadu_si128((const __m128i *)shuffle.alpha_lo);
+    alpha_hi = _mm_loadu_si128((const __m128i *)shuffle.alpha_hi);
+    alpha_lane = _mm_loadu_si128((const __m128i *)shuffle.alpha_lane);
+    dst_mask = _mm_set1_epi32(shuffle.dst_mask);
+    src_amask = _mm_set1_epi32(info->src_fmt->Amask);
+
+    SIMD_BLEND_LOOP(4, Uint32, Uint32,
+                    BlendNtoNPixelAlpha_SSE41(s, d, to_dst, alpha_lo, alpha_hi,
+                                              alpha_lane, dst_mask, src_amask));
+}
+
+static void SDL_TARGETING_SSE41
+BlitNtoNSurfaceAlphaSSE41(SDL_BlitInfo * info)
+{
+    if (info->a) {
+        int width = info->dst_w;
+        int height = info->dst_h;
+        const Uint32 *srcp = (const Uint32 *) info->src;
+        int srcskip = info->src_skip >> 2;
+        Uint32 *dstp = (Uint32 *) info->dst;
+        int dstskip = info->dst_skip >> 2;
+        SDL_BlendShuffle shuffle;
+        __m128i to_dst, alpha, alpha_lane, dst_mask;
+
+        SetupBlendShuffle(info->src_fmt, info->dst_fmt, &shuffle);
+        to_dst = _mm_loadu_si128((const __m128i *)shuffle.to_dst);
+        alpha = _mm_set1_epi16(info->a);
+        alpha_lane = _mm_loadu_si128((const __m128i *)shuffle.alpha_lane);
+        dst_mask = _mm_set1_epi32(shuffle.dst_mask);
+
+        SIMD_BLEND_LOOP(4, Uint32, Uint32,
+                        BlendNtoNSurfaceAlpha_SSE41(s, d, to_dst, alpha, alpha_lane, dst_mask));
+    }
+}
+
+#endif /* HAVE_SSE41_INTRINSICS */
+
+#if HAVE_AVX2_INTRINSICS
+
+/* ARGB8888->(A)RGB8888 or (A)BGR8888 pixel alpha, as BlitRGBtoRGBPixelAlpha */
+SDL_FORCE_INLINE void SDL_TARGETING_AVX2
+BlendRGBPixelAlpha_AVX2(const Uint32 *srcp, Uint32 *dstp, int swap)
+{
+    const __m256i rbmask = _mm256_set1_epi32(0x00ff00ff);
+    const __m256i gmask = _mm256_set1_epi32(0x0000ff00);
+    const __m256i s = _mm256_loadu_si256((const __m256i *)srcp);
+    const __m256i d = _mm256_loadu_si256((const __m256i *)dstp);
+    const __m256i alpha = _mm256_srli_epi32(s, 24);
+    const __m256i s2 = _mm256_and_si256(s, gmask);
+    __m256i s1 = _mm256_and_si256(s, rbmask);
+    __m256i d1 = _mm256_and_si256(d, rbmask);
+    __m256i d2 = _mm256_and_si256(d, gmask);
+    __m256i dalpha = _mm256_srli_epi32(d, 24);
+    __m256i opaque, result;
+
+    if (swap) {
+        s1 = _mm256_or_si256(_mm256_srli_epi32(s1, 16), _mm256_slli_epi32(s1, 16));
+        opaque = _mm256_or_si256(_mm256_or_si256(s1, s2), _mm256_set1_epi32(0xff000000));
+    } else {
+        opaque = s;
+    }
+    d1 = _mm256_add_epi32(d1, _mm256_srli_epi32(_mm256_mullo_epi32(_mm256_sub_epi32(s1, d1), alpha), 8));
+    d2 = _mm256_add_epi32(d2, _mm256_srli_epi32(_mm256_mullo_epi32(_mm256_sub_epi32(s2, d2), alpha), 8));
+    dalpha = _mm256_add_epi32(alpha, _mm256_srli_epi32(_mm256_mullo_epi32(dalpha, _mm256_xor_si256(alpha, _mm256_set1_epi32(0xff))), 8));
+    result = _mm256_or_si256(_mm256_or_si256(_mm256_and_si256(d1, rbmask), _mm256_and_si256(d2, gmask)),
+                             _mm256_slli_epi32(dalpha, 24));
+    result = _mm256_blendv_epi8(result, opaque, _mm256_cmpeq_epi32(alpha, _mm256_set1_epi32(0xff)));
+    result = _mm256_blendv_epi8(result, d, _mm256_cmpeq_epi32(alpha, _mm256_setzero_si256()));
+    _mm256_storeu_si256((__m256i *)dstp, result);
+}
+
+/* RGB888->(X)RGB888 surface alpha, as BlitRGBtoRGBSurfaceAlpha */
+SDL_FORCE_INLINE void SDL_TARGETING_AVX2
+BlendRGBSurfaceAlpha_AVX2(const Uint32 *srcp, Uint32 *dstp, __m256i alpha)
+{
+    const __m256i rbmask = _mm256_set1_epi32(0x00ff00ff);
+    const __m256i gmask = _mm256_set1_epi32(0x0000ff00);
+    const __m256i s = _mm256_loadu_si256((const __m256i *)srcp);
+    const __m256i d = _mm256_loadu_si256((const __m256i *)dstp);
+    const __m256i s1 = _mm256_and_si256(s, rbmask);
+    const __m256i s2 = _mm256_and_si256(s, gmask);
+    __m256i d1 = _mm256_and_si256(d, rbmask);
+    __m256i d2 = _mm256_and_si256(d, gmask);
+
+    d1 = _mm256_add_epi32(d1, _mm256_srli_epi32(_mm256_mullo_epi32(_mm256_sub_epi32(s1, d1), alpha), 8));
+    d2 = _mm256_add_epi32(d2, _mm256_srli_epi32(_mm256_mullo_epi32(_mm256_sub_epi32(s2, d2), alpha), 8));
+    _mm256_storeu_si256((__m256i *)dstp,
+                        _mm256_or_si256(_mm256_or_si256(_mm256_and_si256(d1, rbmask), _mm256_and_si256(d2, gmask)),
+                                        _mm256_set1_epi32(0xff000000)));
+}
+
+/* ARGB8888->RGB565 pixel alpha, as BlitARGBto565PixelAlpha */
+SDL_FORCE_INLINE void SDL_TARGETING_AVX2
+BlendARGBto565PixelAlpha_AVX2(const Uint32 *srcp, Uint16 *dstp)
+{
+    const __m256i mask = _mm256_set1_epi32(0x07e0f81f);
+    __m256i s = _mm256_loadu_si256((const __m256i *)srcp);
+    const __m256i d0 = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)dstp));
+    const __m256i alpha = _mm256_srli_epi32(s, 27);
+    const __m256i rb = _mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(s, 8), _mm256_set1_epi32(0xf800)),
+                                       _mm256_and_si256(_mm256_srli_epi32(s, 3), _mm256_set1_epi32(0x1f)));
+    const __m256i opaque = _mm256_or_si256(rb, _mm256_and_si256(_mm256_srli_epi32(s, 5), _mm256_set1_epi32(0x7e0)));
+    __m256i d, result;
+
+    s = _mm256_or_si256(rb, _mm256_slli_epi32(_mm256_and_si256(s, _mm256_set1_epi32(0xfc00)), 11));
+    d = _mm256_and_si256(_mm256_or_si256(d0, _mm256_slli_epi32(d0, 16)), mask);
+    d = _mm256_add_epi32(d, _mm256_srli_epi32(_mm256_mullo_epi32(_mm256_sub_epi32(s, d), alpha), 5));
+    d = _mm256_and_si256(d, mask);
+    result = _mm256_and_si256(_mm256_or_si256(d, _mm256_srli_epi32(d, 16)), _mm256_set1_epi32(0xffff));
+    result = _mm256_blendv_epi8(result, opaque, _mm256_cmpeq_epi32(alpha, _mm256_set1_epi32(SDL_ALPHA_OPAQUE >> 3)));
+    result = _mm256_blendv_epi8(result, d0, _mm256_cmpeq_epi32(alpha, _mm256_setzero_si256()));
+    _mm_storeu_si128((__m128i *)dstp, _mm_packus_epi32(_mm256_castsi256_si128(result),
+                                                       _mm256_extracti128_si256(result, 1)));
+}
+
+/* RGB565->RGB565 surface alpha, as Blit565to565SurfaceAlpha */
+SDL_FORCE_INLINE void SDL_TARGETING_AVX2
+Blend565SurfaceAlpha_AVX2(const Uint16 *srcp, Uint16 *dstp, __m256i alpha)
+{
+    const __m256i mask = _mm256_set1_epi32(0x07e0f81f);
+    __m256i s = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)srcp));
+    __m256i d = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)dstp));
+
+    s = _mm256_and_si256(_mm256_or_si256(s, _mm256_slli_epi32(s, 16)), mask);
+    d = _mm256_and_si256(_mm256_or_si256(d, _mm256_slli_epi32(d, 16)), mask);
+    d = _mm256_add_epi32(d, _mm256_srli_epi32(_mm256_mullo_epi32(_mm256_sub_epi32(s, d), alpha), 5));
+    d = _mm256_and_si256(d, mask);
+    d = _mm256_and_si256(_mm256_or_si256(d, _mm256_srli_epi32(d, 16)), _mm256_set1_epi32(0xffff));
+    _mm_storeu_si128((__m128i *)dstp, _mm_packus_epi32(_mm256_castsi256_si128(d),
+                                                       _mm256_extracti128_si256(d, 1)));
+}
+
+/* ALPHA_BLEND_RGBA on 16-bit lanes: d + (s - d) * alpha / 255, truncated
+   towards zero. The alpha lane has s = 0 and gets alpha added back, which
+   makes it alpha + d - d * alpha / 255. */
+SDL_FORCE_INLINE __m256i SDL_TARGETING_AVX2
+BlendChannels_AVX2(__m256i s, __m256i d, __m256i alpha, __m256i alpha_lane)
+{
+    const __m256i diff = _mm256_sub_epi16(s, d);
+    __m256i q = _mm256_mullo_epi16(_mm256_abs_epi16(diff), alpha);
+    q = _mm256_srli_epi16(_mm256_mulhi_epu16(q, _mm256_set1_epi16((short)0x8081)), 7);   /* q / 255 */
+    return _mm256_add_epi16(_mm256_add_epi16(d, _mm256_sign_epi16(q, diff)), _mm256_and_si256(alpha, alpha_lane));
+}
+
+/* Any byte-aligned 32bpp pair with pixel alpha, as BlitNtoNPixelAlpha */
+SDL_FORCE_INLINE void SDL_TARGETING_AVX2
+BlendNtoNPixelAlpha_AVX2(const Uint32 *srcp, Uint32 *dstp, __m256i to_dst,
+                         __m256i alpha_lo, __m256i alpha_hi, __m256i alpha_lane,
+                         __m256i dst_mask, __m256i src_amask)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i s = _mm256_loadu_si256((const __m256i *)srcp);
+    const __m256i d = _mm256_loadu_si256((const __m256i *)dstp);
+    const __m256i sd = _mm256_shuffle_epi8(s, to_dst);
+    const __m256i lo = BlendChannels_AVX2(_mm256_unpacklo_epi8(sd, zero), _mm256_unpacklo_epi8(d, zero),
+                                          _mm256_shuffle_epi8(s, alpha_lo), alpha_lane);
+    const __m256i hi = BlendChannels_AVX2(_mm256_unpackhi_epi8(sd, zero), _mm256_unpackhi_epi8(d, zero),
+                                          _mm256_shuffle_epi8(s, alpha_hi), alpha_lane);
+    __m256i result = _mm256_and_si256(_mm256_packus_epi16(lo, hi), dst_mask);
+
+    /* fully transparent source pixels leave the destination alone */
+    result = _mm256_blendv_epi8(result, d, _mm256_cmpeq_epi32(_mm256_and_si256(s, src_amask), zero));
+    _mm256_storeu_si256((__m256i *)dstp, result);
+}
+
+/* Any byte-aligned 32bpp pair with surface alpha, as BlitNtoNSurfaceAlpha */
+SDL_FORCE_INLINE void SDL_TARGETING_AVX2
+BlendNtoNSurfaceAlpha_AVX2(const Uint32 *srcp, Uint32 *dstp, __m256i to_dst,
+                           __m256i alpha, __m256i alpha_lane, __m256i dst_mask)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i s = _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i *)srcp), to_dst);
+    const __m256i d = _mm256_loadu_si256((const __m256i *)dstp);
+    const __m256i lo = BlendChannels_AVX2(_mm256_unpacklo_epi8(s, zero), _mm256_unpacklo_epi8(d, zero),
+                                          alpha, alpha_lane);
+    const __m256i hi = BlendChannels_AVX2(_mm256_unpackhi_epi8(s, zero), _mm256_unpackhi_epi8(d, zero),
+                                          alpha, alpha_lane);
+    _mm256_storeu_si256((__m256i *)dstp, _mm256_and_si256(_mm256_packus_epi16(lo, hi), dst_mask));
+}
+
+static void SDL_TARGETING_AVX2
+BlitRGBtoRGBPixelAlphaAVX2(SDL_BlitInfo * info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    const Uint32 *srcp = (const Uint32 *) info->src;
+    int srcskip = info->src_skip >> 2;
+    Uint32 *dstp = (Uint32 *) info->dst;
+    int dstskip = info->dst_skip >> 2;
+
+    SIMD_BLEND_LOOP(8, Uint32, Uint32, BlendRGBPixelAlpha_AVX2(s, d, 0));
+}
+
+static void SDL_TARGETING_AVX2
+BlitRGBtoBGRPixelAlphaAVX2(SDL_BlitInfo * info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    const Uint32 *srcp = (const Uint32 *) info->src;
+    int srcskip = info->src_skip >> 2;
+    Uint32 *dstp = (Uint32 *) info->dst;
+    int dstskip = info->dst_skip >> 2;
+
+    SIMD_BLEND_LOOP(8, Uint32, Uint32, BlendRGBPixelAlpha_AVX2(s, d, 1));
+}
+
+static void SDL_TARGETING_AVX2
+BlitRGBtoRGBSurfaceAlphaAVX2(SDL_BlitInfo * info)
+{
+    if (info->a == 128) {
+        BlitRGBtoRGBSurfaceAlpha128(info);
+    } else {
+        int width = info->dst_w;
+        int height = info->dst_h;
+        const Uint32 *srcp = (const Uint32 *) info->src;
+        int srcskip = info->src_skip >> 2;
+        Uint32 *dstp = (Uint32 *) info->dst;
+        int dstskip = info->dst_skip >> 2;
+        const __m256i alpha = _mm256_set1_epi32(info->a);
+
+        SIMD_BLEND_LOOP(8, Uint32, Uint32, BlendRGBSurfaceAlpha_AVX2(s, d, alpha));
+    }
+}
+
+static void SDL_TARGETING_AVX2
+BlitARGBto565PixelAlphaAVX2(SDL_BlitInfo * info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    const Uint32 *srcp = (const Uint32 *) info->src;
+    int srcskip = info->src_skip >> 2;
+    Uint16 *dstp = (Uint16 *) info->dst;
+    int dstskip = info->dst_skip >> 1;
+
+    SIMD_BLEND_LOOP(8, Uint32, Uint16, BlendARGBto565PixelAlpha_AVX2(s, d));
+}
+
+static void SDL_TARGETING_AVX2
+Blit565to565SurfaceAlphaAVX2(SDL_BlitInfo * info)
+{
+    if (info->a == 128) {
+        Blit16to16SurfaceAlpha128(info, 0xf7de);
+    } else {
+        int width = info->dst_w;
+        int height = info->dst_h;
+        const Uint16 *srcp = (const Uint16 *) info->src;
+        int srcskip = info->src_skip >> 1;
+        Uint16 *dstp = (Uint16 *) info->dst;
+        int dstskip = info->dst_skip >> 1;
+        const __m256i alpha = _mm256_set1_epi32(info->a >> 3);     /* downscale alpha to 5 bits */
+
+        SIMD_BLEND_LOOP(8, Uint16, Uint16, Blend565SurfaceAlpha_AVX2(s, d, alpha));
+    }
+}
+
+static void SDL_TARGETING_AVX2
+BlitNtoNPixelAlphaAVX2(SDL_BlitInfo * info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    const Uint32 *srcp = (const Uint32 *) info->src;
+    int srcskip = info->src_skip >> 2;
+    Uint32 *dstp = (Uint32 *) info->dst;
+    int dstskip = info->dst_skip >> 2;
+    SDL_BlendShuffle shuffle;
+    __m256i to_dst, alpha_lo, alpha_hi, alpha_lane, dst_mask, src_amask;
+
+    SetupBlendShuffle(info->src_fmt, info->dst_fmt, &shuffle);
+    to_dst = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)shuffle.to_dst));
+    alpha_lo = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)shuffle.alpha_lo));
+    alpha_hi = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)shuffle.alpha_hi));
+    alpha_lane = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)shuffle.alpha_lane));
+    dst_mask = _mm256_set1_epi32(shuffle.dst_mask);
+    src_amask = _mm256_set1_epi32(info->src_fmt->Amask);
+
+    SIMD_BLEND_LOOP(8, Uint32, Uint32,
+                    BlendNtoNPixelAlpha_AVX2(s, d, to_dst, alpha_lo, alpha_hi,
+                                             alpha_lane, dst_mask, src_amask));
+}
+
+static void SDL_TARGETING_AVX2
+BlitNtoNSurfaceAlphaAVX2(SDL_BlitInfo * info)
+{
+    if (info->a) {
+        int width = info->dst_w;
+        int height = info->dst_h;
+        const Uint32 *srcp = (const Uint32 *) info->src;
+        int srcskip = info->src_skip >> 2;
+        Uint32 *dstp = (Uint32 *) info->dst;
+        int dstskip = info->dst_skip >> 2;
+        SDL_BlendShuffle shuffle;
+        __m256i to_dst, alpha, alpha_lane, dst_mask;
+
+        SetupBlendShuffle(info->src_fmt, info->dst_fmt, &shuffle);
+        to_dst = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)shuffle.to_dst));
+        alpha = _mm256_set1_epi16(info->a);
+        alpha_lane = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)shuffle.alpha_lane));
+        dst_mask = _mm256_set1_epi32(shuffle.dst_mask);
+
+        SIMD_BLEND_LOOP(8, Uint32, Uint32,
+                        BlendNtoNSurfaceAlpha_AVX2(s, d, to_dst, alpha, alpha_lane, dst_mask));
+    }
+}
+
+#endif /* HAVE_AVX2_INTRINSICS */
+
 
 SDL_BlitFunc
 SDL_CalculateBlitA(SDL_Surface * surface)
@@ -1405,14 +2035,22 @@ SDL_CalculateBlitA(SDL_Surface * surface)
             }
 
         case 2:
-#if SDL_ARM_NEON_BLITTERS || SDL_ARM_SIMD_BLITTERS
+#if SDL_ARM_NEON_BLITTERS || SDL_ARM_SIMD_BLITTERS || HAVE_SSE41_INTRINSICS || HAVE_AVX2_INTRINSICS
                 if (sf->BytesPerPixel == 4 && sf->Amask == 0xff000000
                     && sf->Gmask == 0xff00 && df->Gmask == 0x7e0
                     && ((sf->Rmask == 0xff && df->Rmask == 0x1f)
                     || (sf->Bmask == 0xff && df->Bmask == 0x1f)))
                 {
+#if HAVE_AVX2_INTRINSICS
+                    if (SDL_GetBlitCPUFeatures() & SDL_CPU_AVX2)
+                        return BlitARGBto565PixelAlphaAVX2;
+#endif
+#if HAVE_SSE41_INTRINSICS
+                    if (SDL_GetBlitCPUFeatures() & SDL_CPU_SSE41)
+                        return BlitARGBto565PixelAlphaSSE41;
+#endif
 #if SDL_ARM_NEON_BLITTERS
-                    if (SDL_HasNEON())
+                    if (SDL_GetBlitCPUFeatures() & SDL_CPU_NEON)
                         return BlitARGBto565PixelAlphaARMNEON;
 #endif
 #if SDL_ARM_SIMD_BLITTERS
@@ -1433,6 +2071,42 @@ SDL_CalculateBlitA(SDL_Surface * surface)
             return BlitNtoNPixelAlpha;
 
         case 4:
+#if HAVE_SSE41_INTRINSICS || HAVE_AVX2_INTRINSICS
+            /* These match the C blitters below exactly, and so come ahead of
+               the MMX ones, which round differently. */
+            if (sf->BytesPerPixel == 4 && sf->Amask == 0xff000000
+                && sf->Gmask == df->Gmask) {
+                if (sf->Rmask == df->Rmask && sf->Bmask == df->Bmask) {
+#if HAVE_AVX2_INTRINSICS
+                    if (SDL_GetBlitCPUFeatures() & SDL_CPU_AVX2)
+                        return BlitRGBtoRGBPixelAlphaAVX2;
+#endif
+#if HAVE_SSE41_INTRINSICS
+                    if (SDL_GetBlitCPUFeatures() & SDL_CPU_SSE41)
+                        return BlitRGBtoRGBPixelAlphaSSE41;
+#endif
+                } else if (sf->Rmask == df->Bmask && sf->Bmask == df->Rmask) {
+#if HAVE_AVX2_INTRINSICS
+                    if (SDL_GetBlitCPUFeatures() & SDL_CPU_AVX2)
+                        return BlitRGBtoBGRPixelAlphaAVX2;
+#endif
+#if HAVE_SSE41_INTRINSICS
+                    if (SDL_GetBlitCPUFeatures() & SDL_CPU_SSE41)
+                        return BlitRGBtoBGRPixelAlphaSSE41;
+#endif
+                }
+            }
+            if (sf->Amask && IsByteAligned32(sf) && IsByteAligned32(df)) {
+#if HAVE_AVX2_INTRINSICS
+                if (SDL_GetBlitCPUFeatures() & SDL_CPU_AVX2)
+                    return BlitNtoNPixelAlphaAVX2;
+#endif
+#if HAVE_SSE41_INTRINSICS
+                if (SDL_GetBlitCPUFeatures() & SDL_CPU_SSE41)
+                    return BlitNtoNPixelAlphaSSE41;
+#endif
+            }
+#endif /* HAVE_SSE41_INTRINSICS || HAVE_AVX2_INTRINSICS */
             if (sf->Rmask == df->Rmask
                 && sf->Gmask == df->Gmask
                 && sf->Bmask == df->Bmask && sf->BytesPerPixel == 4) {
@@ -1442,18 +2116,18 @@ SDL_CalculateBlitA(SDL_Surface * surface)
                     && sf->Bshift % 8 == 0
                     && sf->Ashift % 8 == 0 && sf->Aloss == 0) {
 #ifdef __3dNOW__
-                    if (SDL_Has3DNow())
+                    if (SDL_GetBlitCPUFeatures() & SDL_CPU_3DNOW)
                         return BlitRGBtoRGBPixelAlphaMMX3DNOW;
 #endif
 #ifdef __MMX__
-                    if (SDL_HasMMX())
+                    if (SDL_GetBlitCPUFeatures() & SDL_CPU_MMX)
                         return BlitRGBtoRGBPixelAlphaMMX;
 #endif
                 }
 #endif /* __MMX__ || __3dNOW__ */
                 if (sf->Amask == 0xff000000) {
 #if SDL_ARM_NEON_BLITTERS
-                    if (SDL_HasNEON())
+                    if (SDL_GetBlitCPUFeatures() & SDL_CPU_NEON)
                         return BlitRGBtoRGBPixelAlphaARMNEON;
 #endif
 #if SDL_ARM_SIMD_BLITTERS
@@ -1492,15 +2166,23 @@ SDL_CalculateBlitA(SDL_Surface * surface)
             case 2:
                 if (surface->map->identity) {
                     if (df->Gmask == 0x7e0) {
+#if HAVE_AVX2_INTRINSICS
+                        if (SDL_GetBlitCPUFeatures() & SDL_CPU_AVX2)
+                            return Blit565to565SurfaceAlphaAVX2;
+#endif
+#if HAVE_SSE41_INTRINSICS
+                        if (SDL_GetBlitCPUFeatures() & SDL_CPU_SSE41)
+                            return Blit565to565SurfaceAlphaSSE41;
+#endif
 #ifdef __MMX__
-                        if (SDL_HasMMX())
+                        if (SDL_GetBlitCPUFeatures() & SDL_CPU_MMX)
                             return Blit565to565SurfaceAlphaMMX;
                         else
 #endif
                             return Blit565to565SurfaceAlpha;
                     } else if (df->Gmask == 0x3e0) {
 #ifdef __MMX__
-                        if (SDL_HasMMX())
+                        if (SDL_GetBlitCPUFeatures() & SDL_CPU_MMX)
                             return Blit555to555SurfaceAlphaMMX;
                         else
 #endif
@@ -1510,13 +2192,38 @@ SDL_CalculateBlitA(SDL_Surface * surface)
                 return BlitNtoNSurfaceAlpha;
 
             case 4:
+#if HAVE_SSE41_INTRINSICS || HAVE_AVX2_INTRINSICS
+                if (sf->Rmask == df->Rmask
+                    && sf->Gmask == df->Gmask
+                    && sf->Bmask == df->Bmask && sf->BytesPerPixel == 4
+                    && (sf->Rmask | sf->Gmask | sf->Bmask) == 0xffffff) {
+#if HAVE_AVX2_INTRINSICS
+                    if (SDL_GetBlitCPUFeatures() & SDL_CPU_AVX2)
+                        return BlitRGBtoRGBSurfaceAlphaAVX2;
+#endif
+#if HAVE_SSE41_INTRINSICS
+                    if (SDL_GetBlitCPUFeatures() & SDL_CPU_SSE41)
+                        return BlitRGBtoRGBSurfaceAlphaSSE41;
+#endif
+                }
+                if (IsByteAligned32(sf) && IsByteAligned32(df)) {
+#if HAVE_AVX2_INTRINSICS
+                    if (SDL_GetBlitCPUFeatures() & SDL_CPU_AVX2)
+                        return BlitNtoNSurfaceAlphaAVX2;
+#endif
+#if HAVE_SSE41_INTRINSICS
+                    if (SDL_GetBlitCPUFeatures() & SDL_CPU_SSE41)
+                        return BlitNtoNSurfaceAlphaSSE41;
+#endif
+                }
+#endif /* HAVE_SSE41_INTRINSICS || HAVE_AVX2_INTRINSICS */
                 if (sf->Rmask == df->Rmask
                     && sf->Gmask == df->Gmask
                     && sf->Bmask == df->Bmask && sf->BytesPerPixel == 4) {
 #ifdef __MMX__
                     if (sf->Rshift % 8 == 0
                         && sf->Gshift % 8 == 0
-                        && sf->Bshift % 8 == 0 && SDL_HasMMX())
+                        && sf->Bshift % 8 == 0 && (SDL_GetBlitCPUFeatures() & SDL_CPU_MMX))
                         return BlitRGBtoRGBSurfaceAlphaMMX;
 #endif
                     if ((sf->Rmask | sf->Gmask | sf->Bmask) == 0xffffff) {
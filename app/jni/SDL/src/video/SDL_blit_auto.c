@@ -35,9 +35,9 @@ static void SDL_Blit_RGB888_RGB888_Scale(SDL_BlitInfo *info)
     Uint32 posy, posx;
     int incy, incx;
 
-    incy = (info->src_h << 16) / info->dst_h;
+    incy = (info->src_h << 16) / info->scale_h;
     incx = (info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + (Uint32)info->scale_y * incy;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -118,9 +118,9 @@ static void SDL_Blit_RGB888_RGB888_Blend_Scale(SDL_BlitInfo *info)
     Uint32 posy, posx;
     int incy, incx;
 
-    incy = (info->src_h << 16) / info->dst_h;
+    incy = (info->src_h << 16) / info->scale_h;
     incx = (info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + (Uint32)info->scale_y * incy;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -211,9 +211,9 @@ static void SDL_Blit_RGB888_RGB888_Modulate_Scale(SDL_BlitInfo *info)
     Uint32 posy, posx;
     int incy, incx;
 
-    incy = (info->src_h << 16) / info->dst_h;
+    incy = (info->src_h << 16) / info->scale_h;
     incx = (info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + (Uint32)info->scale_y * incy;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -325,9 +325,9 @@ static void SDL_Blit_RGB888_RGB888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     Uint32 posy, posx;
     int incy, incx;
 
-    incy = (info->src_h << 16) / info->dst_h;
+    incy = (info->src_h << 16) / info->scale_h;
     incx = (info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + (Uint32)info->scale_y * incy;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -396,9 +396,9 @@ static void SDL_Blit_RGB888_BGR888_Scale(SDL_BlitInfo *info)
     Uint32 posy, posx;
     int incy, incx;
 
-    incy = (info->src_h << 16) / info->dst_h;
+    incy = (info->src_h << 16) / info->scale_h;
     incx = (info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + (Uint32)info->scale_y * incy;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -482,9 +482,9 @@ static void SDL_Blit_RGB888_BGR888_Blend_Scale(SDL_BlitInfo *info)
     Uint32 posy, posx;
     int incy, incx;
 
-    incy = (info->src_h << 16) / info->dst_h;
+    incy = (info->src_h << 16) / info->scale_h;
     incx = (info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + (Uint32)info->scale_y * incy;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -575,9 +575,9 @@ static void SDL_Blit_RGB888_BGR888_Modulate_Scale(SDL_BlitInfo *info)
     Uint32 posy, posx;
     int incy, incx;
 
-    incy = (info->src_h << 16) / info->dst_h;
+    incy = (info->src_h << 16) / info->scale_h;
     incx = (info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + (Uint32)info->scale_y * incy;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -689,9 +689,9 @@ static void SDL_Blit_RGB888_BGR888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     Uint32 posy, posx;
     int incy, incx;
 
-    incy = (info->src_h << 16) / info->dst_h;
+    incy = (info->src_h << 16) / info->scale_h;
     incx = (info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + (Uint32)info->scale_y * incy;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -760,9 +760,9 @@ static void SDL_Blit_RGB888_ARGB8888_Scale(SDL_BlitInfo *info)
     Uint32 posy, posx;
     int incy, incx;
 
-    incy = (info->src_h << 16) / info->dst_h;
+    incy = (info->src_h << 16) / info->scale_h;
     incx = (info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + (Uint32)info->scale_y * incy;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -847,9 +847,9 @@ static void SDL_Blit_RGB888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
     Uint32 posy, posx;
     int incy, incx;
 
-    incy = (info->src_h << 16) / info->dst_h;
+    incy = (info->src_h << 16) / info->scale_h;
     incx = (info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + (Uint32)info->scale_y * incy;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -946,9 +946,9 @@ static void SDL_Blit_RGB888_ARGB8888_Modulate_Scale(SDL_BlitInfo *info)
     Uint32 posy, posx;
     int incy, incx;
 
-    incy = (info->src_h << 16) / info->dst_h;
+    incy = (info->src_h << 16) / info->scale_h;
     incx = (info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + (Uint32)info->scale_y * incy;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -1062,9 +1062,9 @@ static void SDL_Blit_RGB888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     Uint32 posy, posx;
     int incy, incx;
 
-    incy = (info->src_h << 16) / info->dst_h;
+    incy = (info->src_h << 16) / info->scale_h;
     incx = (info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + (Uint32)info->scale_y * incy;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -1135,9 +1135,9 @@ static void SDL_Blit_BGR888_RGB888_Scale(SDL_BlitInfo *info)
     Uint32 posy, posx;
     int incy, incx;
 
-    incy = (info->src_h << 16) / info->dst_h;
+    incy = (info->src_h << 16) / info->scale_h;
     incx = (info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + (Uint32)info->scale_y * incy;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -1221,9 +1221,9 @@ static void SDL_Blit_BGR888_RGB888_Blend_Scale(SDL_BlitInfo *info)
     Uint32 posy, posx;
     int incy, incx;
 
-    incy = (info->src_h << 16) / info->dst_h;
+    incy = (info->src_h << 16) / info->scale_h;
     incx = (info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + (Uint32)info->scale_y * incy;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -1314,9 +1314,9 @@ static void SDL_Blit_BGR888_RGB888_Modulate_Scale(SDL_BlitInfo *info)
     Uint32 posy, posx;
     int incy, incx;
 
-    incy = (info->src_h << 16) / info->dst_h;
+    incy = (info->src_h << 16) / info->scale_h;
     incx = (info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + (Uint32)info->scale_y * incy;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -1428,9 +1428,9 @@ static void SDL_Blit_BGR888_RGB888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     Uint32 posy, posx;
     int incy, incx;
 
-    incy = (info->src_h << 16) / info->dst_h;
+    incy = (info->src_h << 16) / info->scale_h;
     incx = (info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + (Uint32)info->scale_y * incy;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -1497,9 +1497,9 @@ static void SDL_Blit_BGR888_BGR888_Scale(SDL_BlitInfo *info)
     Uint32 posy, posx;
     int incy, incx;
 
-    incy = (info->src_h << 16) / info->dst_h;
+    incy = (info->src_h << 16) / info->scale_h;
     incx = (info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + (Uint32)info->scale_y * incy;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -1580,9 +1580,9 @@ static void SDL_Blit_BGR888_BGR888_Blend_Scale(SDL_BlitInfo *info)
     Uint32 posy, posx;
     int incy, incx;
 
-    incy = (info->src_h << 16) / info->dst_h;
+    incy = (info->src_h << 16) / info->scale_h;
     incx = (info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + (Uint32)info->scale_y * incy;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -1673,9 +1673,9 @@ static void SDL_Blit_BGR888_BGR888_Modulate_Scale(SDL_BlitInfo *info)
     Uint32 posy, posx;
     int incy, incx;
 
-    incy = (info->src_h << 16) / info->dst_h;
+    incy = (info->src_h << 16) / info->scale_h;
     incx = (info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + (Uint32)info->scale_y * incy;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -1787,9 +1787,9 @@ static void SDL_Blit_BGR888_BGR888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     Uint32 posy, posx;
     int incy, incx;
 
-    incy = (info->src_h << 16) / info->dst_h;
+    incy = (info->src_h << 16) / info->scale_h;
     incx = (info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + (Uint32)info->scale_y * incy;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -1859,9 +1859,9 @@ static void SDL_Blit_BGR888_ARGB8888_Scale(SDL_BlitInfo *info)
     Uint32 posy, posx;
     int incy, incx;
 
-    incy = (info->src_h << 16) / info->dst_h;
+    incy = (info->src_h << 16) / info->scale_h;
     incx = (info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + (Uint32)info->scale_y * incy;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -1947,9 +1947,9 @@ static void SDL_Blit_BGR888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
     Uint32 posy, posx;
     int incy, incx;
 
-    incy = (info->src_h << 16) / info->dst_h;
+    incy = (info->src_h << 16) / info->scale_h;
     incx = (info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + (Uint32)info->scale_y * incy;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -2046,9 +2046,9 @@ static void SDL_Blit_BGR888_ARGB8888_Modulate_Scale(SDL_BlitInfo *info)
     Uint32 posy, posx;
     int incy, incx;
 
-    incy = (info->src_h << 16) / info->dst_h;
+    incy = (info->src_h << 16) / info->scale_h;
     incx = (info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + (Uint32)info->scale_y * incy;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -2162,9 +2162,9 @@ static void SDL_Blit_BGR888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     Uint32 posy, posx;
     int incy, incx;
 
-    incy = (info->src_h << 16) / info->dst_h;
+    incy = (info->src_h << 16) / info->scale_h;
     incx = (info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + (Uint32)info->scale_y * incy;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -2234,9 +2234,9 @@ static void SDL_Blit_ARGB8888_RGB888_Scale(SDL_BlitInfo *info)
     Uint32 posy, posx;
     int incy, incx;
 
-    incy = (info->src_h << 16) / info->dst_h;
+    incy = (info->src_h << 16) / info->scale_h;
     incx = (info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + (Uint32)info->scale_y * incy;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -2327,9 +2327,9 @@ static void SDL_Blit_ARGB8888_RGB888_Blend_Scale(SDL_BlitInfo *info)
     Uint32 posy, posx;
     int incy, incx;
 
-    incy = (info->src_h << 16) / info->dst_h;
+    incy = (info->src_h << 16) / info->scale_h;
     incx = (info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + (Uint32)info->scale_y * incy;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -2428,9 +2428,9 @@ static void SDL_Blit_ARGB8888_RGB888_Modulate_Scale(SDL_BlitInfo *info)
     Uint32 posy, posx;
     int incy, incx;
 
-    incy = (info->src_h << 16) / info->dst_h;
+    incy = (info->src_h << 16) / info->scale_h;
     incx = (info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + (Uint32)info->scale_y * incy;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -2543,9 +2543,9 @@ static void SDL_Blit_ARGB8888_RGB888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     Uint32 posy, posx;
     int incy, incx;
 
-    incy = (info->src_h << 16) / info->dst_h;
+    incy = (info->src_h << 16) / info->scale_h;
     incx = (info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + (Uint32)info->scale_y * incy;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -2617,9 +2617,9 @@ static void SDL_Blit_ARGB8888_BGR888_Scale(SDL_BlitInfo *info)
     Uint32 posy, posx;
     int incy, incx;
 
-    incy = (info->src_h << 16) / info->dst_h;
+    incy = (info->src_h << 16) / info->scale_h;
     incx = (info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + (Uint32)info->scale_y * incy;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -2711,9 +2711,9 @@ static void SDL_Blit_ARGB8888_BGR888_Blend_Scale(SDL_BlitInfo *info)
     Uint32 posy, posx;
     int incy, incx;
 
-    incy = (info->src_h << 16) / info->dst_h;
+    incy = (info->src_h << 16) / info->scale_h;
     incx = (info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + (Uint32)info->scale_y * incy;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -2812,9 +2812,9 @@ static void SDL_Blit_ARGB8888_BGR888_Modulate_Scale(SDL_BlitInfo *info)
     Uint32 posy, posx;
     int incy, incx;
 
-    incy = (info->src_h << 16) / info->dst_h;
+    incy = (info->src_h << 16) / info->scale_h;
     incx = (info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + (Uint32)info->scale_y * incy;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -2927,9 +2927,9 @@ static void SDL_Blit_ARGB8888_BGR888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     Uint32 posy, posx;
     int incy, incx;
 
-    incy = (info->src_h << 16) / info->dst_h;
+    incy = (info->src_h << 16) / info->scale_h;
     incx = (info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + (Uint32)info->scale_y * incy;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -2999,9 +2999,9 @@ static void SDL_Blit_ARGB8888_ARGB8888_Scale(SDL_BlitInfo *info)
     Uint32 posy, posx;
     int incy, incx;
 
-    incy = (info->src_h << 16) / info->dst_h;
+    incy = (info->src_h << 16) / info->scale_h;
     incx = (info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + (Uint32)info->scale_y * incy;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -3092,9 +3092,9 @@ static void SDL_Blit_ARGB8888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
     Uint32 posy, posx;
     int incy, incx;
 
-    incy = (info->src_h << 16) / info->dst_h;
+    incy = (info->src_h << 16) / info->scale_h;
     incx = (info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + (Uint32)info->scale_y * incy;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -3200,9 +3200,9 @@ static void SDL_Blit_ARGB8888_ARGB8888_Modulate_Scale(SDL_BlitInfo *info)
     Uint32 posy, posx;
     int incy, incx;
 
-    incy = (info->src_h << 16) / info->dst_h;
+    incy = (info->src_h << 16) / info->scale_h;
     incx = (info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + (Uint32)info->scale_y * incy;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -3320,9 +3320,9 @@ static void SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     Uint32 posy, posx;
     int incy, incx;
 
-    incy = (info->src_h << 16) / info->dst_h;
+    incy = (info->src_h << 16) / info->scale_h;
     incx = (info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + (Uint32)info->scale_y * incy;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -3395,9 +3395,9 @@ static void SDL_Blit_RGBA8888_RGB888_Scale(SDL_BlitInfo *info)
     Uint32 posy, posx;
     int incy, incx;
 
-    incy = (info->src_h << 16) / info->dst_h;
+    incy = (info->src_h << 16) / info->scale_h;
     incx = (info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + (Uint32)info->scale_y * incy;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -3488,9 +3488,9 @@ static void SDL_Blit_RGBA8888_RGB888_Blend_Scale(SDL_BlitInfo *info)
     Uint32 posy, posx;
     int incy, incx;
 
-    incy = (info->src_h << 16) / info->dst_h;
+    incy = (info->src_h << 16) / info->scale_h;
     incx = (info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + (Uint32)info->scale_y * incy;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -3589,9 +3589,9 @@ static void SDL_Blit_RGBA8888_RGB888_Modulate_Scale(SDL_BlitInfo *info)
     Uint32 posy, posx;
     int incy, incx;
 
-    incy = (info->src_h << 16) / info->dst_h;
+    incy = (info->src_h << 16) / info->scale_h;
     incx = (info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + (Uint32)info->scale_y * incy;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -3704,9 +3704,9 @@ static void SDL_Blit_RGBA8888_RGB888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     Uint32 posy, posx;
     int incy, incx;
 
-    incy = (info->src_h << 16) / info->dst_h;
+    incy = (info->src_h << 16) / info->scale_h;
     incx = (info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + (Uint32)info->scale_y * incy;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -3778,9 +3778,9 @@ static void SDL_Blit_RGBA8888_BGR888_Scale(SDL_BlitInfo *info)
     Uint32 posy, posx;
     int incy, incx;
 
-    incy = (info->src_h << 16) / info->dst_h;
+    incy = (info->src_h << 16) / info->scale_h;
     incx = (info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + (Uint32)info->scale_y * incy;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -3872,9 +3872,9 @@ static void SDL_Blit_RGBA8888_BGR888_Blend_Scale(SDL_BlitInfo *info)
     Uint32 posy, posx;
     int incy, incx;
 
-    incy = (info->src_h << 16) / info->dst_h;
+    incy = (info->src_h << 16) / info->scale_h;
     incx = (info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + (Uint32)info->scale_y * incy;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -3973,9 +3973,9 @@ static void SDL_Blit_RGBA8888_BGR888_Modulate_Scale(SDL_BlitInfo *info)
     Uint32 posy, posx;
     int incy, incx;
 
-    incy = (info->src_h << 16) / info->dst_h;
+    incy = (info->src_h << 16) / info->scale_h;
     incx = (info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + (Uint32)info->scale_y * incy;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -4088,9 +4088,9 @@ static void SDL_Blit_RGBA8888_BGR888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     Uint32 posy, posx;
     int incy, incx;
 
-    incy = (info->src_h << 16) / info->dst_h;
+    incy = (info->src_h << 16) / info->scale_h;
     incx = (info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + (Uint32)info->scale_y * incy;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -4161,9 +4161,9 @@ static void SDL_Blit_RGBA8888_ARGB8888_Scale(SDL_BlitInfo *info)
     Uint32 posy, posx;
     int incy, incx;
 
-    incy = (info->src_h << 16) / info->dst_h;
+    incy = (info->src_h << 16) / info->scale_h;
     incx = (info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + (Uint32)info->scale_y * incy;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -4256,9 +4256,9 @@ static void SDL_Blit_RGBA8888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
     Uint32 posy, posx;
     int incy, incx;
 
-    incy = (info->src_h << 16) / info->dst_h;
+    incy = (info->src_h << 16) / info->scale_h;
     incx = (info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + (Uint32)info->scale_y * incy;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -4364,9 +4364,9 @@ static void SDL_Blit_RGBA8888_ARGB8888_Modulate_Scale(SDL_BlitInfo *info)
     Uint32 posy, posx;
     int incy, incx;
 
-    incy = (info->src_h << 16) / info->dst_h;
+    incy = (info->src_h << 16) / info->scale_h;
     incx = (info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + (Uint32)info->scale_y * incy;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -4484,9 +4484,9 @@ static void SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     Uint32 posy, posx;
     int incy, incx;
 
-    incy = (info->src_h << 16) / info->dst_h;
+    incy = (info->src_h << 16) / info->scale_h;
     incx = (info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + (Uint32)info->scale_y * incy;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -4560,9 +4560,9 @@ static void SDL_Blit_ABGR8888_RGB888_Scale(SDL_BlitInfo *info)
     Uint32 posy, posx;
     int incy, incx;
 
-    incy = (info->src_h << 16) / info->dst_h;
+    incy = (info->src_h << 16) / info->scale_h;
     incx = (info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + (Uint32)info->scale_y * incy;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -4654,9 +4654,9 @@ static void SDL_Blit_ABGR8888_RGB888_Blend_Scale(SDL_BlitInfo *info)
     Uint32 posy, posx;
     int incy, incx;
 
-    incy = (info->src_h << 16) / info->dst_h;
+    incy = (info->src_h << 16) / info->scale_h;
     incx = (info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + (Uint32)info->scale_y * incy;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -4755,9 +4755,9 @@ static void SDL_Blit_ABGR8888_RGB888_Modulate_Scale(SDL_BlitInfo *info)
     Uint32 posy, posx;
     int incy, incx;
 
-    incy = (info->src_h << 16) / info->dst_h;
+    incy = (info->src_h << 16) / info->scale_h;
     incx = (info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + (Uint32)info->scale_y * incy;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -4870,9 +4870,9 @@ static void SDL_Blit_ABGR8888_RGB888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     Uint32 posy, posx;
     int incy, incx;
 
-    incy = (info->src_h << 16) / info->dst_h;
+    incy = (info->src_h << 16) / info->scale_h;
     incx = (info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + (Uint32)info->scale_y * incy;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -4943,9 +4943,9 @@ static void SDL_Blit_ABGR8888_BGR888_Scale(SDL_BlitInfo *info)
     Uint32 posy, posx;
     int incy, incx;
 
-    incy = (info->src_h << 16) / info->dst_h;
+    incy = (info->src_h << 16) / info->scale_h;
     incx = (info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + (Uint32)info->scale_y * incy;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -5036,9 +5036,9 @@ static void SDL_Blit_ABGR8888_BGR888_Blend_Scale(SDL_BlitInfo *info)
     Uint32 posy, posx;
     int incy, incx;
 
-    incy = (info->src_h << 16) / info->dst_h;
+    incy = (info->src_h << 16) / info->scale_h;
     incx = (info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + (Uint32)info->scale_y * incy;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -5137,9 +5137,9 @@ static void SDL_Blit_ABGR8888_BGR888_Modulate_Scale(SDL_BlitInfo *info)
     Uint32 posy, posx;
     int incy, incx;
 
-    incy = (info->src_h << 16) / info->dst_h;
+    incy = (info->src_h << 16) / info->scale_h;
     incx = (info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + (Uint32)info->scale_y * incy;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -5252,9 +5252,9 @@ static void SDL_Blit_ABGR8888_BGR888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     Uint32 posy, posx;
     int incy, incx;
 
-    incy = (info->src_h << 16) / info->dst_h;
+    incy = (info->src_h << 16) / info->scale_h;
     incx = (info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + (Uint32)info->scale_y * incy;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -5326,9 +5326,9 @@ static void SDL_Blit_ABGR8888_ARGB8888_Scale(SDL_BlitInfo *info)
     Uint32 posy, posx;
     int incy, incx;
 
-    incy = (info->src_h << 16) / info->dst_h;
+    incy = (info->src_h << 16) / info->scale_h;
     incx = (info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + (Uint32)info->scale_y * incy;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -5422,9 +5422,9 @@ static void SDL_Blit_ABGR8888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
     Uint32 posy, posx;
     int incy, incx;
 
-    incy = (info->src_h << 16) / info->dst_h;
+    incy = (info->src_h << 16) / info->scale_h;
     incx = (info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + (Uint32)info->scale_y * incy;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -5530,9 +5530,9 @@ static void SDL_Blit_ABGR8888_ARGB8888_Modulate_Scale(SDL_BlitInfo *info)
     Uint32 posy, posx;
     int incy, incx;
 
-    incy = (info->src_h << 16) / info->dst_h;
+    incy = (info->src_h << 16) / info->scale_h;
     incx = (info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + (Uint32)info->scale_y * incy;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -5650,9 +5650,9 @@ static void SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     Uint32 posy, posx;
     int incy, incx;
 
-    incy = (info->src_h << 16) / info->dst_h;
+    incy = (info->src_h << 16) / info->scale_h;
     incx = (info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + (Uint32)info->scale_y * incy;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -5726,9 +5726,9 @@ static void SDL_Blit_BGRA8888_RGB888_Scale(SDL_BlitInfo *info)
     Uint32 posy, posx;
     int incy, incx;
 
-    incy = (info->src_h << 16) / info->dst_h;
+    incy = (info->src_h << 16) / info->scale_h;
     incx = (info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + (Uint32)info->scale_y * incy;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -5820,9 +5820,9 @@ static void SDL_Blit_BGRA8888_RGB888_Blend_Scale(SDL_BlitInfo *info)
     Uint32 posy, posx;
     int incy, incx;
 
-    incy = (info->src_h << 16) / info->dst_h;
+    incy = (info->src_h << 16) / info->scale_h;
     incx = (info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + (Uint32)info->scale_y * incy;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -5921,9 +5921,9 @@ static void SDL_Blit_BGRA8888_RGB888_Modulate_Scale(SDL_BlitInfo *info)
     Uint32 posy, posx;
     int incy, incx;
 
-    incy = (info->src_h << 16) / info->dst_h;
+    incy = (info->src_h << 16) / info->scale_h;
     incx = (info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + (Uint32)info->scale_y * incy;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -6036,9 +6036,9 @@ static void SDL_Blit_BGRA8888_RGB888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     Uint32 posy, posx;
     int incy, incx;
 
-    incy = (info->src_h << 16) / info->dst_h;
+    incy = (info->src_h << 16) / info->scale_h;
     incx = (info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + (Uint32)info->scale_y * incy;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -6109,9 +6109,9 @@ static void SDL_Blit_BGRA8888_BGR888_Scale(SDL_BlitInfo *info)
     Uint32 posy, posx;
     int incy, incx;
 
-    incy = (info->src_h << 16) / info->dst_h;
+    incy = (info->src_h << 16) / info->scale_h;
     incx = (info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + (Uint32)info->scale_y * incy;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -6202,9 +6202,9 @@ static void SDL_Blit_BGRA8888_BGR888_Blend_Scale(SDL_BlitInfo *info)
     Uint32 posy, posx;
     int incy, incx;
 
-    incy = (info->src_h << 16) / info->dst_h;
+    incy = (info->src_h << 16) / info->scale_h;
     incx = (info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + (Uint32)info->scale_y * incy;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -6303,9 +6303,9 @@ static void SDL_Blit_BGRA8888_BGR888_Modulate_Scale(SDL_BlitInfo *info)
     Uint32 posy, posx;
     int incy, incx;
 
-    incy = (info->src_h << 16) / info->dst_h;
+    incy = (info->src_h << 16) / info->scale_h;
     incx = (info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + (Uint32)info->scale_y * incy;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -6418,9 +6418,9 @@ static void SDL_Blit_BGRA8888_BGR888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     Uint32 posy, posx;
     int incy, incx;
 
-    incy = (info->src_h << 16) / info->dst_h;
+    incy = (info->src_h << 16) / info->scale_h;
     incx = (info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + (Uint32)info->scale_y * incy;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -6492,9 +6492,9 @@ static void SDL_Blit_BGRA8888_ARGB8888_Scale(SDL_BlitInfo *info)
     Uint32 posy, posx;
     int incy, incx;
 
-    incy = (info->src_h << 16) / info->dst_h;
+    incy = (info->src_h << 16) / info->scale_h;
     incx = (info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + (Uint32)info->scale_y * incy;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -6588,9 +6588,9 @@ static void SDL_Blit_BGRA8888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
     Uint32 posy, posx;
     int incy, incx;
 
-    incy = (info->src_h << 16) / info->dst_h;
+    incy = (info->src_h << 16) / info->scale_h;
     incx = (info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + (Uint32)info->scale_y * incy;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -6696,9 +6696,9 @@ static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Scale(SDL_BlitInfo *info)
     Uint32 posy, posx;
     int incy, incx;
 
-    incy = (info->src_h << 16) / info->dst_h;
+    incy = (info->src_h << 16) / info->scale_h;
     incx = (info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + (Uint32)info->scale_y * incy;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -6816,9 +6816,9 @@ static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     Uint32 posy, posx;
     int incy, incx;
 
-    incy = (info->src_h << 16) / info->dst_h;
+    incy = (info->src_h << 16) / info->scale_h;
     incx = (info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + (Uint32)info->scale_y * incy;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -6884,132 +6884,3720 @@ static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     }
 }
 
+#if HAVE_SSE41_INTRINSICS || HAVE_AVX2_INTRINSICS || HAVE_NEON_INTRINSICS
+
+/*
+ * The vector blitters do the same integer math as the C ones above, exactly:
+ * x / 255 is worked out with a multiply and shifts that agree with the
+ * division for every value the blend can produce. Each generated wrapper
+ * passes in where the channels sit in its two formats and which of the C
+ * variant's quirks it has to reproduce.
+ */
+
+/* Byte offsets of R, G, B and A in a pixel as it is laid out in memory */
+#define SDL_BLIT_AUTO_ORDER(r, g, b, a) ((r) | ((g) << 4) | ((b) << 8) | ((a) << 12))
+#define SDL_BLIT_AUTO_NOALPHA       0xF
+
+#define SDL_BLIT_AUTO_MODULATE      0x01
+#define SDL_BLIT_AUTO_BLEND         0x02
+#define SDL_BLIT_AUTO_SCALE         0x04
+#define SDL_BLIT_AUTO_COPY          0x08    /* same format, every byte is copied */
+#define SDL_BLIT_AUTO_MUL_ALPHA_FF  0x10    /* SDL_COPY_MUL leaves the destination opaque */
+
+enum
+{
+    SDL_BLIT_AUTO_MODE_SRC,     /* the (modulated) source replaces the destination */
+    SDL_BLIT_AUTO_MODE_DST,     /* the destination is repacked as it is */
+    SDL_BLIT_AUTO_MODE_BLEND,
+    SDL_BLIT_AUTO_MODE_ADD,
+    SDL_BLIT_AUTO_MODE_MOD,
+    SDL_BLIT_AUTO_MODE_MUL
+};
+
+typedef struct
+{
+    Uint8 shuffle[16];      /* source bytes of 4 pixels in destination order, 0x80 for none */
+    Uint8 alpha[16];        /* spreads the alpha lane of 2 widened pixels over their other lanes */
+    Uint16 alpha_lane[8];   /* 0xFFFF in the alpha lane of 2 widened pixels */
+    Uint16 mul_alpha[8];    /* ORed into SDL_COPY_MUL results */
+    Uint16 modulate[8];     /* channel modulation of 2 widened pixels, 255 for none */
+    Uint32 fill;            /* ORed into the shuffled source: opaque alpha if it has none */
+    Uint32 mask;            /* the destination bits that get written */
+    SDL_bool modulated;
+    int mode;
+} SDL_BlitAutoSetup;
+
+static void
+SDL_SetupBlitAuto(const SDL_BlitInfo *info, int srcorder, int dstorder, int variant,
+                  SDL_BlitAutoSetup *setup)
+{
+    const int flags = info->flags;
+    const int src_a = (srcorder >> 12) & 0xF;
+    const int dst_r = dstorder & 0xF;
+    const int dst_g = (dstorder >> 4) & 0xF;
+    const int dst_b = (dstorder >> 8) & 0xF;
+    /* alpha, or the unused byte of formats without it */
+    const int dst_a = 6 - dst_r - dst_g - dst_b;
+    const SDL_bool dst_has_alpha = (((dstorder >> 12) & 0xF) != SDL_BLIT_AUTO_NOALPHA);
+    Uint16 modulate[4];
+    int i;
+
+    for (i = 0; i < 16; i += 4) {
+        Uint8 *shuffle = &setup->shuffle[i];
+        if (variant & SDL_BLIT_AUTO_COPY) {
+            shuffle[0] = (Uint8)i;
+            shuffle[1] = (Uint8)(i + 1);
+            shuffle[2] = (Uint8)(i + 2);
+            shuffle[3] = (Uint8)(i + 3);
+        } else {
+            shuffle[dst_r] = (Uint8)(i + (srcorder & 0xF));
+            shuffle[dst_g] = (Uint8)(i + ((srcorder >> 4) & 0xF));
+            shuffle[dst_b] = (Uint8)(i + ((srcorder >> 8) & 0xF));
+            shuffle[dst_a] = (src_a == SDL_BLIT_AUTO_NOALPHA) ? 0x80 : (Uint8)(i + src_a);
+        }
+    }
+    if (src_a == SDL_BLIT_AUTO_NOALPHA && !(variant & SDL_BLIT_AUTO_COPY)) {
+        setup->fill = 0xFFu << (dst_a * 8);
+    } else {
+        setup->fill = 0;
+    }
+    if (dst_has_alpha || (variant & SDL_BLIT_AUTO_COPY)) {
+        setup->mask = 0xFFFFFFFF;
+    } else {
+        setup->mask = ~(0xFFu << (dst_a * 8));
+    }
+
+    modulate[0] = modulate[1] = modulate[2] = modulate[3] = 255;
+    setup->modulated = SDL_FALSE;
+    if (variant & SDL_BLIT_AUTO_MODULATE) {
+        if (flags & SDL_COPY_MODULATE_COLOR) {
+            modulate[dst_r] = info->r;
+            modulate[dst_g] = info->g;
+            modulate[dst_b] = info->b;
+            setup->modulated = SDL_TRUE;
+        }
+        if (flags & SDL_COPY_MODULATE_ALPHA) {
+            modulate[dst_a] = info->a;
+            setup->modulated = SDL_TRUE;
+        }
+    }
+    for (i = 0; i < 8; ++i) {
+        const int pixel = i / 4;
+        const int lane = i % 4;
+        setup->alpha[i * 2] = (Uint8)(pixel * 8 + dst_a * 2);
+        setup->alpha[i * 2 + 1] = (Uint8)(pixel * 8 + dst_a * 2 + 1);
+        setup->alpha_lane[i] = (lane == dst_a) ? 0xFFFF : 0;
+        setup->mul_alpha[i] = (lane == dst_a && (variant & SDL_BLIT_AUTO_MUL_ALPHA_FF)) ? 0xFF : 0;
+        setup->modulate[i] = modulate[lane];
+    }
+
+    if (!(variant & SDL_BLIT_AUTO_BLEND)) {
+        setup->mode = SDL_BLIT_AUTO_MODE_SRC;
+    } else {
+        switch (flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL)) {
+        case SDL_COPY_BLEND:
+            setup->mode = SDL_BLIT_AUTO_MODE_BLEND;
+            break;
+        case SDL_COPY_ADD:
+            setup->mode = SDL_BLIT_AUTO_MODE_ADD;
+            break;
+        case SDL_COPY_MOD:
+            setup->mode = SDL_BLIT_AUTO_MODE_MOD;
+            break;
+        case SDL_COPY_MUL:
+            setup->mode = SDL_BLIT_AUTO_MODE_MUL;
+            break;
+        default:
+            setup->mode = SDL_BLIT_AUTO_MODE_DST;
+            break;
+        }
+    }
+}
+
+/* Runs PIXELS over the blit STEP pixels at a time. The source pixels are
+   read straight from the row, or picked out by GATHER when scaling, and the
+   last few pixels of a row go through zero-padded copies so the vector loads
+   and stores never leave the surfaces. */
+#define SDL_BLIT_AUTO_LOOP(STEP, LOAD, GATHER, STORE, PIXELS, MODE)                     \
+    {                                                                                   \
+        Uint32 srctail[STEP], dsttail[STEP];                                            \
+        Uint32 posy, posx;                                                              \
+        int incy, incx;                                                                 \
+        int width = info->dst_w;                                                        \
+        int height = info->dst_h;                                                       \
+        const Uint8 *srcrow = info->src;                                                \
+        Uint8 *dstrow = info->dst;                                                      \
+                                                                                        \
+        if (variant & SDL_BLIT_AUTO_SCALE) {                                            \
+            incy = (info->src_h << 16) / info->scale_h;                                 \
+            incx = (info->src_w << 16) / info->dst_w;                                   \
+        } else {                                                                        \
+            incy = incx = 1 << 16;                                                      \
+        }                                                                               \
+        posy = incy / 2 + (Uint32)info->scale_y * incy;                                 \
+        while (height--) {                                                              \
+            const Uint32 *src = (const Uint32 *)srcrow;                                 \
+            Uint32 *dst = (Uint32 *)dstrow;                                             \
+            int n = width;                                                              \
+            if (variant & SDL_BLIT_AUTO_SCALE) {                                        \
+                src = (const Uint32 *)(info->src + (posy >> 16) * info->src_pitch);     \
+            }                                                                           \
+            posx = incx / 2;                                                            \
+            while (n >= STEP) {                                                         \
+                if (variant & SDL_BLIT_AUTO_SCALE) {                                    \
+                    STORE(dst, PIXELS(&v, GATHER(src, posx, incx), LOAD(dst), MODE));   \
+                    posx += STEP * incx;                                                \
+                } else {                                                                \
+                    STORE(dst, PIXELS(&v, LOAD(src), LOAD(dst), MODE));                 \
+                    src += STEP;                                                        \
+                }                                                                       \
+                dst += STEP;                                                            \
+                n -= STEP;                                                              \
+            }                                                                           \
+            if (n) {                                                                    \
+                int i;                                                                  \
+                SDL_zeroa(srctail);                                                     \
+                SDL_zeroa(dsttail);                                                     \
+                for (i = 0; i < n; ++i) {                                               \
+                    if (variant & SDL_BLIT_AUTO_SCALE) {                                \
+                        srctail[i] = src[posx >> 16];                                   \
+                        posx += incx;                                                   \
+                    } else {                                                            \
+                        srctail[i] = src[i];                                            \
+                    }                                                                   \
+                    dsttail[i] = dst[i];                                                \
+                }                                                                       \
+                STORE(dsttail, PIXELS(&v, LOAD(srctail), LOAD(dsttail), MODE));         \
+                SDL_memcpy(dst, dsttail, n * sizeof(Uint32));                           \
+            }                                                                           \
+            if (variant & SDL_BLIT_AUTO_SCALE) {                                        \
+                posy += incy;                                                           \
+            } else {                                                                    \
+                srcrow += info->src_pitch;                                              \
+            }                                                                           \
+            dstrow += info->dst_pitch;                                                  \
+        }                                                                               \
+    }
+
+/* The SDL_BLIT_AUTO_MODE_* cases of the drivers below */
+#define SDL_BLIT_AUTO_MODES(STEP, LOAD, GATHER, STORE, PIXELS)                                  \
+    switch (setup.mode) {                                                                       \
+    case SDL_BLIT_AUTO_MODE_SRC:                                                                \
+        SDL_BLIT_AUTO_LOOP(STEP, LOAD, GATHER, STORE, PIXELS, SDL_BLIT_AUTO_MODE_SRC);          \
+        break;                                                                                  \
+    case SDL_BLIT_AUTO_MODE_DST:                                                                \
+        SDL_BLIT_AUTO_LOOP(STEP, LOAD, GATHER, STORE, PIXELS, SDL_BLIT_AUTO_MODE_DST);          \
+        break;                                                                                  \
+    case SDL_BLIT_AUTO_MODE_BLEND:                                                              \
+        SDL_BLIT_AUTO_LOOP(STEP, LOAD, GATHER, STORE, PIXELS, SDL_BLIT_AUTO_MODE_BLEND);        \
+        break;                                                                                  \
+    case SDL_BLIT_AUTO_MODE_ADD:                                                                \
+        SDL_BLIT_AUTO_LOOP(STEP, LOAD, GATHER, STORE, PIXELS, SDL_BLIT_AUTO_MODE_ADD);          \
+        break;                                                                                  \
+    case SDL_BLIT_AUTO_MODE_MOD:                                                                \
+        SDL_BLIT_AUTO_LOOP(STEP, LOAD, GATHER, STORE, PIXELS, SDL_BLIT_AUTO_MODE_MOD);          \
+        break;                                                                                  \
+    default:                                                                                    \
+        SDL_BLIT_AUTO_LOOP(STEP, LOAD, GATHER, STORE, PIXELS, SDL_BLIT_AUTO_MODE_MUL);          \
+        break;                                                                                  \
+    }
+
+#endif /* HAVE_SSE41_INTRINSICS || HAVE_AVX2_INTRINSICS || HAVE_NEON_INTRINSICS */
+
+#if HAVE_SSE41_INTRINSICS
+
+typedef struct
+{
+    __m128i shuffle, alpha, alpha_lane, mul_alpha, modulate, fill, mask;
+    SDL_bool modulated;
+} SDL_BlitAutoVectors_SSE41;
+
+SDL_FORCE_INLINE __m128i SDL_TARGETING_SSE41
+SDL_BlitAutoLoad_SSE41(const Uint32 *p)
+{
+    return _mm_loadu_si128((const __m128i *)p);
+}
+
+/* The pixels at posx, posx + incx, ... in 16.16 fixed point */
+SDL_FORCE_INLINE __m128i SDL_TARGETING_SSE41
+SDL_BlitAutoGather_SSE41(const Uint32 *src, Uint32 posx, int incx)
+{
+    return _mm_setr_epi32((int)src[posx >> 16], (int)src[(posx + incx) >> 16],
+                          (int)src[(posx + 2 * incx) >> 16], (int)src[(posx + 3 * incx) >> 16]);
+}
+
+SDL_FORCE_INLINE void SDL_TARGETING_SSE41
+SDL_BlitAutoStore_SSE41(Uint32 *p, __m128i x)
+{
+    _mm_storeu_si128((__m128i *)p, x);
+}
+
+/* x / 255, exact for any 16-bit x */
+SDL_FORCE_INLINE __m128i SDL_TARGETING_SSE41
+SDL_BlitAutoDiv255_SSE41(__m128i x)
+{
+    return _mm_srli_epi16(_mm_mulhi_epu16(x, _mm_set1_epi16((short)0x8081)), 7);
+}
+
+/* Two pixels, one channel per 16-bit lane */
+SDL_FORCE_INLINE __m128i SDL_TARGETING_SSE41
+SDL_BlitAutoBlend_SSE41(const SDL_BlitAutoVectors_SSE41 *v, __m128i s, __m128i d, int mode)
+{
+    __m128i a, inv, premul;
+
+    if (v->modulated) {
+        s = SDL_BlitAutoDiv255_SSE41(_mm_mullo_epi16(s, v->modulate));
+    }
+    if (mode == SDL_BLIT_AUTO_MODE_SRC) {
+        return s;
+    } else if (mode == SDL_BLIT_AUTO_MODE_DST) {
+        return d;
+    }
+    a = _mm_shuffle_epi8(s, v->alpha);
+    inv = _mm_xor_si128(a, _mm_set1_epi16(0xFF));
+    switch (mode) {
+    case SDL_BLIT_AUTO_MODE_BLEND:
+        premul = _mm_blendv_epi8(SDL_BlitAutoDiv255_SSE41(_mm_mullo_epi16(s, a)), s, v->alpha_lane);
+        return _mm_add_epi16(premul, SDL_BlitAutoDiv255_SSE41(_mm_mullo_epi16(inv, d)));
+    case SDL_BLIT_AUTO_MODE_ADD:
+        premul = _mm_blendv_epi8(SDL_BlitAutoDiv255_SSE41(_mm_mullo_epi16(s, a)), s, v->alpha_lane);
+        return _mm_blendv_epi8(_mm_min_epu16(_mm_add_epi16(premul, d), _mm_set1_epi16(255)), d, v->alpha_lane);
+    case SDL_BLIT_AUTO_MODE_MOD:
+        return _mm_blendv_epi8(SDL_BlitAutoDiv255_SSE41(_mm_mullo_epi16(s, d)), d, v->alpha_lane);
+    default:
+        /* the sum can overflow 16 bits, but anything past 255 * 255 + 254 ends up as 255 */
+        s = _mm_adds_epu16(_mm_mullo_epi16(s, d), _mm_mullo_epi16(d, inv));
+        s = _mm_min_epu16(s, _mm_set1_epi16((short)(255 * 255 + 254)));
+        return _mm_or_si128(SDL_BlitAutoDiv255_SSE41(s), v->mul_alpha);
+    }
+}
+
+SDL_FORCE_INLINE __m128i SDL_TARGETING_SSE41
+SDL_BlitAutoPixels_SSE41(const SDL_BlitAutoVectors_SSE41 *v, __m128i s, __m128i d, int mode)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i lo, hi;
+
+    s = _mm_or_si128(_mm_shuffle_epi8(s, v->shuffle), v->fill);
+    if (mode == SDL_BLIT_AUTO_MODE_SRC && !v->modulated) {
+        return _mm_and_si128(s, v->mask);
+    }
+    lo = SDL_BlitAutoBlend_SSE41(v, _mm_unpacklo_epi8(s, zero), _mm_unpacklo_epi8(d, zero), mode);
+    hi = SDL_BlitAutoBlend_SSE41(v, _mm_unpackhi_epi8(s, zero), _mm_unpackhi_epi8(d, zero), mode);
+    return _mm_and_si128(_mm_packus_epi16(lo, hi), v->mask);
+}
+
+static void SDL_TARGETING_SSE41
+SDL_Blit_Auto_SSE41(SDL_BlitInfo *info, int srcorder, int dstorder, int variant)
+{
+    SDL_BlitAutoSetup setup;
+    SDL_BlitAutoVectors_SSE41 v;
+
+    SDL_SetupBlitAuto(info, srcorder, dstorder, variant, &setup);
+    v.shuffle = _mm_loadu_si128((const __m128i *)setup.shuffle);
+    v.alpha = _mm_loadu_si128((const __m128i *)setup.alpha);
+    v.alpha_lane = _mm_loadu_si128((const __m128i *)setup.alpha_lane);
+    v.mul_alpha = _mm_loadu_si128((const __m128i *)setup.mul_alpha);
+    v.modulate = _mm_loadu_si128((const __m128i *)setup.modulate);
+    v.fill = _mm_set1_epi32((int)setup.fill);
+    v.mask = _mm_set1_epi32((int)setup.mask);
+    v.modulated = setup.modulated;
+
+    SDL_BLIT_AUTO_MODES(4, SDL_BlitAutoLoad_SSE41, SDL_BlitAutoGather_SSE41, SDL_BlitAutoStore_SSE41, SDL_BlitAutoPixels_SSE41);
+}
+
+#endif /* HAVE_SSE41_INTRINSICS */
+
+#if HAVE_AVX2_INTRINSICS
+
+typedef struct
+{
+    __m256i shuffle, alpha, alpha_lane, mul_alpha, modulate, fill, mask;
+    SDL_bool modulated;
+} SDL_BlitAutoVectors_AVX2;
+
+SDL_FORCE_INLINE __m256i SDL_TARGETING_AVX2
+SDL_BlitAutoLoad_AVX2(const Uint32 *p)
+{
+    return _mm256_loadu_si256((const __m256i *)p);
+}
+
+/* The pixels at posx, posx + incx, ... in 16.16 fixed point */
+SDL_FORCE_INLINE __m256i SDL_TARGETING_AVX2
+SDL_BlitAutoGather_AVX2(const Uint32 *src, Uint32 posx, int incx)
+{
+    return _mm256_setr_epi32((int)src[posx >> 16], (int)src[(posx + incx) >> 16],
+                             (int)src[(posx + 2 * incx) >> 16], (int)src[(posx + 3 * incx) >> 16],
+                             (int)src[(posx + 4 * incx) >> 16], (int)src[(posx + 5 * incx) >> 16],
+                             (int)src[(posx + 6 * incx) >> 16], (int)src[(posx + 7 * incx) >> 16]);
+}
+
+SDL_FORCE_INLINE void SDL_TARGETING_AVX2
+SDL_BlitAutoStore_AVX2(Uint32 *p, __m256i x)
+{
+    _mm256_storeu_si256((__m256i *)p, x);
+}
+
+/* x / 255, exact for any 16-bit x */
+SDL_FORCE_INLINE __m256i SDL_TARGETING_AVX2
+SDL_BlitAutoDiv255_AVX2(__m256i x)
+{
+    return _mm256_srli_epi16(_mm256_mulhi_epu16(x, _mm256_set1_epi16((short)0x8081)), 7);
+}
+
+/* Two pixels per 128-bit lane, one channel per 16-bit lane */
+SDL_FORCE_INLINE __m256i SDL_TARGETING_AVX2
+SDL_BlitAutoBlend_AVX2(const SDL_BlitAutoVectors_AVX2 *v, __m256i s, __m256i d, int mode)
+{
+    __m256i a, inv, premul;
+
+    if (v->modulated) {
+        s = SDL_BlitAutoDiv255_AVX2(_mm256_mullo_epi16(s, v->modulate));
+    }
+    if (mode == SDL_BLIT_AUTO_MODE_SRC) {
+        return s;
+    } else if (mode == SDL_BLIT_AUTO_MODE_DST) {
+        return d;
+    }
+    a = _mm256_shuffle_epi8(s, v->alpha);
+    inv = _mm256_xor_si256(a, _mm256_set1_epi16(0xFF));
+    switch (mode) {
+    case SDL_BLIT_AUTO_MODE_BLEND:
+        premul = _mm256_blendv_epi8(SDL_BlitAutoDiv255_AVX2(_mm256_mullo_epi16(s, a)), s, v->alpha_lane);
+        return _mm256_add_epi16(premul, SDL_BlitAutoDiv255_AVX2(_mm256_mullo_epi16(inv, d)));
+    case SDL_BLIT_AUTO_MODE_ADD:
+        premul = _mm256_blendv_epi8(SDL_BlitAutoDiv255_AVX2(_mm256_mullo_epi16(s, a)), s, v->alpha_lane);
+        return _mm256_blendv_epi8(_mm256_min_epu16(_mm256_add_epi16(premul, d), _mm256_set1_epi16(255)), d, v->alpha_lane);
+    case SDL_BLIT_AUTO_MODE_MOD:
+        return _mm256_blendv_epi8(SDL_BlitAutoDiv255_AVX2(_mm256_mullo_epi16(s, d)), d, v->alpha_lane);
+    default:
+        /* the sum can overflow 16 bits, but anything past 255 * 255 + 254 ends up as 255 */
+        s = _mm256_adds_epu16(_mm256_mullo_epi16(s, d), _mm256_mullo_epi16(d, inv));
+        s = _mm256_min_epu16(s, _mm256_set1_epi16((short)(255 * 255 + 254)));
+        return _mm256_or_si256(SDL_BlitAutoDiv255_AVX2(s), v->mul_alpha);
+    }
+}
+
+SDL_FORCE_INLINE __m256i SDL_TARGETING_AVX2
+SDL_BlitAutoPixels_AVX2(const SDL_BlitAutoVectors_AVX2 *v, __m256i s, __m256i d, int mode)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    __m256i lo, hi;
+
+    s = _mm256_or_si256(_mm256_shuffle_epi8(s, v->shuffle), v->fill);
+    if (mode == SDL_BLIT_AUTO_MODE_SRC && !v->modulated) {
+        return _mm256_and_si256(s, v->mask);
+    }
+    lo = SDL_BlitAutoBlend_AVX2(v, _mm256_unpacklo_epi8(s, zero), _mm256_unpacklo_epi8(d, zero), mode);
+    hi = SDL_BlitAutoBlend_AVX2(v, _mm256_unpackhi_epi8(s, zero), _mm256_unpackhi_epi8(d, zero), mode);
+    return _mm256_and_si256(_mm256_packus_epi16(lo, hi), v->mask);
+}
+
+static void SDL_TARGETING_AVX2
+SDL_Blit_Auto_AVX2(SDL_BlitInfo *info, int srcorder, int dstorder, int variant)
+{
+    SDL_BlitAutoSetup setup;
+    SDL_BlitAutoVectors_AVX2 v;
+
+    SDL_SetupBlitAuto(info, srcorder, dstorder, variant, &setup);
+    /* the shuffles stay within 128-bit lanes, so each lane gets the same controls */
+    v.shuffle = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)setup.shuffle));
+    v.alpha = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)setup.alpha));
+    v.alpha_lane = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)setup.alpha_lane));
+    v.mul_alpha = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)setup.mul_alpha));
+    v.modulate = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)setup.modulate));
+    v.fill = _mm256_set1_epi32((int)setup.fill);
+    v.mask = _mm256_set1_epi32((int)setup.mask);
+    v.modulated = setup.modulated;
+
+    SDL_BLIT_AUTO_MODES(8, SDL_BlitAutoLoad_AVX2, SDL_BlitAutoGather_AVX2, SDL_BlitAutoStore_AVX2, SDL_BlitAutoPixels_AVX2);
+}
+
+#endif /* HAVE_AVX2_INTRINSICS */
+
+#if HAVE_NEON_INTRINSICS
+
+typedef struct
+{
+    uint8x8_t shuffle_lo, shuffle_hi, alpha_lo, alpha_hi;
+    uint16x8_t alpha_lane, mul_alpha, modulate;
+    uint8x16_t fill, mask;
+    SDL_bool modulated;
+} SDL_BlitAutoVectors_NEON;
+
+SDL_FORCE_INLINE uint8x16_t
+SDL_BlitAutoLoad_NEON(const Uint32 *p)
+{
+    return vld1q_u8((const Uint8 *)p);
+}
+
+/* The pixels at posx, posx + incx, ... in 16.16 fixed point */
+SDL_FORCE_INLINE uint8x16_t
+SDL_BlitAutoGather_NEON(const Uint32 *src, Uint32 posx, int incx)
+{
+    uint32x4_t x = vdupq_n_u32(src[posx >> 16]);
+    x = vld1q_lane_u32(&src[(posx + incx) >> 16], x, 1);
+    x = vld1q_lane_u32(&src[(posx + 2 * incx) >> 16], x, 2);
+    x = vld1q_lane_u32(&src[(posx + 3 * incx) >> 16], x, 3);
+    return vreinterpretq_u8_u32(x);
+}
+
+SDL_FORCE_INLINE void
+SDL_BlitAutoStore_NEON(Uint32 *p, uint8x16_t x)
+{
+    vst1q_u8((Uint8 *)p, x);
+}
+
+/* x / 255, exact for x up to 255 * 255 + 254 */
+SDL_FORCE_INLINE uint16x8_t
+SDL_BlitAutoDiv255_NEON(uint16x8_t x)
+{
+    return vshrq_n_u16(vaddq_u16(vaddq_u16(x, vshrq_n_u16(x, 8)), vdupq_n_u16(1)), 8);
+}
+
+/* Picks bytes out of x, or zero for indices past the end */
+SDL_FORCE_INLINE uint8x16_t
+SDL_BlitAutoShuffle_NEON(uint8x16_t x, uint8x8_t lo, uint8x8_t hi)
+{
+    uint8x8x2_t table;
+
+    table.val[0] = vget_low_u8(x);
+    table.val[1] = vget_high_u8(x);
+    return vcombine_u8(vtbl2_u8(table, lo), vtbl2_u8(table, hi));
+}
+
+/* Two pixels, one channel per 16-bit lane */
+SDL_FORCE_INLINE uint16x8_t
+SDL_BlitAutoBlend_NEON(const SDL_BlitAutoVectors_NEON *v, uint16x8_t s, uint16x8_t d, int mode)
+{
+    uint16x8_t a, inv, premul;
+
+    if (v->modulated) {
+        s = SDL_BlitAutoDiv255_NEON(vmulq_u16(s, v->modulate));
+    }
+    if (mode == SDL_BLIT_AUTO_MODE_SRC) {
+        return s;
+    } else if (mode == SDL_BLIT_AUTO_MODE_DST) {
+        return d;
+    }
+    a = vreinterpretq_u16_u8(SDL_BlitAutoShuffle_NEON(vreinterpretq_u8_u16(s), v->alpha_lo, v->alpha_hi));
+    inv = veorq_u16(a, vdupq_n_u16(0xFF));
+    switch (mode) {
+    case SDL_BLIT_AUTO_MODE_BLEND:
+        premul = vbslq_u16(v->alpha_lane, s, SDL_BlitAutoDiv255_NEON(vmulq_u16(s, a)));
+        return vaddq_u16(premul, SDL_BlitAutoDiv255_NEON(vmulq_u16(inv, d)));
+    case SDL_BLIT_AUTO_MODE_ADD:
+        premul = vbslq_u16(v->alpha_lane, s, SDL_BlitAutoDiv255_NEON(vmulq_u16(s, a)));
+        return vbslq_u16(v->alpha_lane, d, vminq_u16(vaddq_u16(premul, d), vdupq_n_u16(255)));
+    case SDL_BLIT_AUTO_MODE_MOD:
+        return vbslq_u16(v->alpha_lane, d, SDL_BlitAutoDiv255_NEON(vmulq_u16(s, d)));
+    default:
+        /* the sum can overflow 16 bits, but anything past 255 * 255 + 254 ends up as 255 */
+        s = vqaddq_u16(vmulq_u16(s, d), vmulq_u16(d, inv));
+        s = vminq_u16(s, vdupq_n_u16(255 * 255 + 254));
+        return vorrq_u16(SDL_BlitAutoDiv255_NEON(s), v->mul_alpha);
+    }
+}
+
+SDL_FORCE_INLINE uint8x16_t
+SDL_BlitAutoPixels_NEON(const SDL_BlitAutoVectors_NEON *v, uint8x16_t s, uint8x16_t d, int mode)
+{
+    uint16x8_t lo, hi;
+
+    s = vorrq_u8(SDL_BlitAutoShuffle_NEON(s, v->shuffle_lo, v->shuffle_hi), v->fill);
+    if (mode == SDL_BLIT_AUTO_MODE_SRC && !v->modulated) {
+        return vandq_u8(s, v->mask);
+    }
+    lo = SDL_BlitAutoBlend_NEON(v, vmovl_u8(vget_low_u8(s)), vmovl_u8(vget_low_u8(d)), mode);
+    hi = SDL_BlitAutoBlend_NEON(v, vmovl_u8(vget_high_u8(s)), vmovl_u8(vget_high_u8(d)), mode);
+    return vandq_u8(vcombine_u8(vmovn_u16(lo), vmovn_u16(hi)), v->mask);
+}
+
+static void
+SDL_Blit_Auto_NEON(SDL_BlitInfo *info, int srcorder, int dstorder, int variant)
+{
+    SDL_BlitAutoSetup setup;
+    SDL_BlitAutoVectors_NEON v;
+
+    SDL_SetupBlitAuto(info, srcorder, dstorder, variant, &setup);
+    v.shuffle_lo = vld1_u8(&setup.shuffle[0]);
+    v.shuffle_hi = vld1_u8(&setup.shuffle[8]);
+    v.alpha_lo = vld1_u8(&setup.alpha[0]);
+    v.alpha_hi = vld1_u8(&setup.alpha[8]);
+    v.alpha_lane = vld1q_u16(setup.alpha_lane);
+    v.mul_alpha = vld1q_u16(setup.mul_alpha);
+    v.modulate = vld1q_u16(setup.modulate);
+    v.fill = vreinterpretq_u8_u32(vdupq_n_u32(setup.fill));
+    v.mask = vreinterpretq_u8_u32(vdupq_n_u32(setup.mask));
+    v.modulated = setup.modulated;
+
+    SDL_BLIT_AUTO_MODES(4, SDL_BlitAutoLoad_NEON, SDL_BlitAutoGather_NEON, SDL_BlitAutoStore_NEON, SDL_BlitAutoPixels_NEON);
+}
+
+#endif /* HAVE_NEON_INTRINSICS */
+
+#if HAVE_AVX2_INTRINSICS
+
+static void SDL_Blit_RGB888_RGB888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_SCALE | SDL_BLIT_AUTO_COPY);
+}
+
+static void SDL_Blit_RGB888_RGB888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_MUL_ALPHA_FF);
+}
+
+static void SDL_Blit_RGB888_RGB888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE | SDL_BLIT_AUTO_MUL_ALPHA_FF);
+}
+
+static void SDL_Blit_RGB888_RGB888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE);
+}
+
+static void SDL_Blit_RGB888_RGB888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_RGB888_RGB888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_RGB888_RGB888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_RGB888_BGR888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_RGB888_BGR888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_MUL_ALPHA_FF);
+}
+
+static void SDL_Blit_RGB888_BGR888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE | SDL_BLIT_AUTO_MUL_ALPHA_FF);
+}
+
+static void SDL_Blit_RGB888_BGR888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE);
+}
+
+static void SDL_Blit_RGB888_BGR888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_RGB888_BGR888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_RGB888_BGR888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_RGB888_ARGB8888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_RGB888_ARGB8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_MUL_ALPHA_FF);
+}
+
+static void SDL_Blit_RGB888_ARGB8888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE | SDL_BLIT_AUTO_MUL_ALPHA_FF);
+}
+
+static void SDL_Blit_RGB888_ARGB8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_MODULATE);
+}
+
+static void SDL_Blit_RGB888_ARGB8888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_RGB888_ARGB8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_RGB888_ARGB8888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_BGR888_RGB888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_BGR888_RGB888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_MUL_ALPHA_FF);
+}
+
+static void SDL_Blit_BGR888_RGB888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE | SDL_BLIT_AUTO_MUL_ALPHA_FF);
+}
+
+static void SDL_Blit_BGR888_RGB888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE);
+}
+
+static void SDL_Blit_BGR888_RGB888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_BGR888_RGB888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_BGR888_RGB888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_BGR888_BGR888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_SCALE | SDL_BLIT_AUTO_COPY);
+}
+
+static void SDL_Blit_BGR888_BGR888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_MUL_ALPHA_FF);
+}
+
+static void SDL_Blit_BGR888_BGR888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE | SDL_BLIT_AUTO_MUL_ALPHA_FF);
+}
+
+static void SDL_Blit_BGR888_BGR888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE);
+}
+
+static void SDL_Blit_BGR888_BGR888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_BGR888_BGR888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_BGR888_BGR888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_BGR888_ARGB8888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_BGR888_ARGB8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_MUL_ALPHA_FF);
+}
+
+static void SDL_Blit_BGR888_ARGB8888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE | SDL_BLIT_AUTO_MUL_ALPHA_FF);
+}
+
+static void SDL_Blit_BGR888_ARGB8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_MODULATE);
+}
+
+static void SDL_Blit_BGR888_ARGB8888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_BGR888_ARGB8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_BGR888_ARGB8888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_ARGB8888_RGB888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_ARGB8888_RGB888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_ARGB8888_RGB888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_ARGB8888_RGB888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE);
+}
+
+static void SDL_Blit_ARGB8888_RGB888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_ARGB8888_RGB888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_ARGB8888_RGB888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_ARGB8888_BGR888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_ARGB8888_BGR888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_ARGB8888_BGR888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_ARGB8888_BGR888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE);
+}
+
+static void SDL_Blit_ARGB8888_BGR888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_ARGB8888_BGR888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_ARGB8888_BGR888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_ARGB8888_ARGB8888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_SCALE | SDL_BLIT_AUTO_COPY);
+}
+
+static void SDL_Blit_ARGB8888_ARGB8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_ARGB8888_ARGB8888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_ARGB8888_ARGB8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_MODULATE);
+}
+
+static void SDL_Blit_ARGB8888_ARGB8888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_RGBA8888_RGB888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(3, 2, 1, 0), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_RGBA8888_RGB888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(3, 2, 1, 0), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_RGBA8888_RGB888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(3, 2, 1, 0), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_RGBA8888_RGB888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(3, 2, 1, 0), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE);
+}
+
+static void SDL_Blit_RGBA8888_RGB888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(3, 2, 1, 0), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_RGBA8888_RGB888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(3, 2, 1, 0), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_RGBA8888_RGB888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(3, 2, 1, 0), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(3, 2, 1, 0), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(3, 2, 1, 0), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(3, 2, 1, 0), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(3, 2, 1, 0), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE);
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(3, 2, 1, 0), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(3, 2, 1, 0), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(3, 2, 1, 0), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(3, 2, 1, 0), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(3, 2, 1, 0), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(3, 2, 1, 0), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(3, 2, 1, 0), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_MODULATE);
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(3, 2, 1, 0), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(3, 2, 1, 0), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(3, 2, 1, 0), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, 3), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, 3), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, 3), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, 3), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE);
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, 3), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, 3), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, 3), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, 3), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, 3), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, 3), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, 3), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE);
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, 3), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, 3), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, 3), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, 3), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, 3), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, 3), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, 3), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_MODULATE);
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, 3), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, 3), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, 3), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(1, 2, 3, 0), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(1, 2, 3, 0), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(1, 2, 3, 0), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(1, 2, 3, 0), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE);
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(1, 2, 3, 0), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(1, 2, 3, 0), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(1, 2, 3, 0), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(1, 2, 3, 0), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(1, 2, 3, 0), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(1, 2, 3, 0), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(1, 2, 3, 0), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE);
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(1, 2, 3, 0), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(1, 2, 3, 0), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(1, 2, 3, 0), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_BGRA8888_ARGB8888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(1, 2, 3, 0), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_BGRA8888_ARGB8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(1, 2, 3, 0), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_BGRA8888_ARGB8888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(1, 2, 3, 0), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_BGRA8888_ARGB8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(1, 2, 3, 0), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_MODULATE);
+}
+
+static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(1, 2, 3, 0), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(1, 2, 3, 0), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_AVX2(info, SDL_BLIT_AUTO_ORDER(1, 2, 3, 0), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+#endif /* HAVE_AVX2_INTRINSICS */
+
+#if HAVE_SSE41_INTRINSICS
+
+static void SDL_Blit_RGB888_RGB888_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_SCALE | SDL_BLIT_AUTO_COPY);
+}
+
+static void SDL_Blit_RGB888_RGB888_Blend_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_MUL_ALPHA_FF);
+}
+
+static void SDL_Blit_RGB888_RGB888_Blend_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE | SDL_BLIT_AUTO_MUL_ALPHA_FF);
+}
+
+static void SDL_Blit_RGB888_RGB888_Modulate_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE);
+}
+
+static void SDL_Blit_RGB888_RGB888_Modulate_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_RGB888_RGB888_Modulate_Blend_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_RGB888_RGB888_Modulate_Blend_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_RGB888_BGR888_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_RGB888_BGR888_Blend_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_MUL_ALPHA_FF);
+}
+
+static void SDL_Blit_RGB888_BGR888_Blend_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE | SDL_BLIT_AUTO_MUL_ALPHA_FF);
+}
+
+static void SDL_Blit_RGB888_BGR888_Modulate_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE);
+}
+
+static void SDL_Blit_RGB888_BGR888_Modulate_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_RGB888_BGR888_Modulate_Blend_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_RGB888_BGR888_Modulate_Blend_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_RGB888_ARGB8888_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_RGB888_ARGB8888_Blend_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_MUL_ALPHA_FF);
+}
+
+static void SDL_Blit_RGB888_ARGB8888_Blend_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE | SDL_BLIT_AUTO_MUL_ALPHA_FF);
+}
+
+static void SDL_Blit_RGB888_ARGB8888_Modulate_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_MODULATE);
+}
+
+static void SDL_Blit_RGB888_ARGB8888_Modulate_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_RGB888_ARGB8888_Modulate_Blend_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_RGB888_ARGB8888_Modulate_Blend_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_BGR888_RGB888_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_BGR888_RGB888_Blend_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_MUL_ALPHA_FF);
+}
+
+static void SDL_Blit_BGR888_RGB888_Blend_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE | SDL_BLIT_AUTO_MUL_ALPHA_FF);
+}
+
+static void SDL_Blit_BGR888_RGB888_Modulate_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE);
+}
+
+static void SDL_Blit_BGR888_RGB888_Modulate_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_BGR888_RGB888_Modulate_Blend_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_BGR888_RGB888_Modulate_Blend_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_BGR888_BGR888_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_SCALE | SDL_BLIT_AUTO_COPY);
+}
+
+static void SDL_Blit_BGR888_BGR888_Blend_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_MUL_ALPHA_FF);
+}
+
+static void SDL_Blit_BGR888_BGR888_Blend_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE | SDL_BLIT_AUTO_MUL_ALPHA_FF);
+}
+
+static void SDL_Blit_BGR888_BGR888_Modulate_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE);
+}
+
+static void SDL_Blit_BGR888_BGR888_Modulate_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_BGR888_BGR888_Modulate_Blend_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_BGR888_BGR888_Modulate_Blend_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_BGR888_ARGB8888_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_BGR888_ARGB8888_Blend_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_MUL_ALPHA_FF);
+}
+
+static void SDL_Blit_BGR888_ARGB8888_Blend_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE | SDL_BLIT_AUTO_MUL_ALPHA_FF);
+}
+
+static void SDL_Blit_BGR888_ARGB8888_Modulate_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_MODULATE);
+}
+
+static void SDL_Blit_BGR888_ARGB8888_Modulate_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_BGR888_ARGB8888_Modulate_Blend_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_BGR888_ARGB8888_Modulate_Blend_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_ARGB8888_RGB888_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_ARGB8888_RGB888_Blend_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_ARGB8888_RGB888_Blend_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_ARGB8888_RGB888_Modulate_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE);
+}
+
+static void SDL_Blit_ARGB8888_RGB888_Modulate_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_ARGB8888_RGB888_Modulate_Blend_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_ARGB8888_RGB888_Modulate_Blend_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_ARGB8888_BGR888_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_ARGB8888_BGR888_Blend_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_ARGB8888_BGR888_Blend_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_ARGB8888_BGR888_Modulate_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE);
+}
+
+static void SDL_Blit_ARGB8888_BGR888_Modulate_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_ARGB8888_BGR888_Modulate_Blend_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_ARGB8888_BGR888_Modulate_Blend_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_ARGB8888_ARGB8888_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_SCALE | SDL_BLIT_AUTO_COPY);
+}
+
+static void SDL_Blit_ARGB8888_ARGB8888_Blend_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_ARGB8888_ARGB8888_Blend_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_ARGB8888_ARGB8888_Modulate_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_MODULATE);
+}
+
+static void SDL_Blit_ARGB8888_ARGB8888_Modulate_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_RGBA8888_RGB888_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(3, 2, 1, 0), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_RGBA8888_RGB888_Blend_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(3, 2, 1, 0), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_RGBA8888_RGB888_Blend_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(3, 2, 1, 0), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_RGBA8888_RGB888_Modulate_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(3, 2, 1, 0), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE);
+}
+
+static void SDL_Blit_RGBA8888_RGB888_Modulate_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(3, 2, 1, 0), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_RGBA8888_RGB888_Modulate_Blend_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(3, 2, 1, 0), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_RGBA8888_RGB888_Modulate_Blend_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(3, 2, 1, 0), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(3, 2, 1, 0), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Blend_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(3, 2, 1, 0), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Blend_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(3, 2, 1, 0), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Modulate_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(3, 2, 1, 0), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE);
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Modulate_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(3, 2, 1, 0), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Modulate_Blend_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(3, 2, 1, 0), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Modulate_Blend_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(3, 2, 1, 0), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(3, 2, 1, 0), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Blend_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(3, 2, 1, 0), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Blend_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(3, 2, 1, 0), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Modulate_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(3, 2, 1, 0), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_MODULATE);
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Modulate_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(3, 2, 1, 0), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(3, 2, 1, 0), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(3, 2, 1, 0), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, 3), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Blend_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, 3), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Blend_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, 3), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Modulate_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, 3), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE);
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Modulate_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, 3), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Modulate_Blend_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, 3), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Modulate_Blend_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, 3), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, 3), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Blend_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, 3), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Blend_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, 3), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Modulate_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, 3), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE);
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Modulate_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, 3), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Modulate_Blend_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, 3), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Modulate_Blend_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, 3), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, 3), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Blend_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, 3), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Blend_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, 3), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Modulate_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, 3), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_MODULATE);
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Modulate_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, 3), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, 3), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, 3), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(1, 2, 3, 0), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Blend_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(1, 2, 3, 0), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Blend_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(1, 2, 3, 0), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Modulate_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(1, 2, 3, 0), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE);
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Modulate_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(1, 2, 3, 0), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Modulate_Blend_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(1, 2, 3, 0), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Modulate_Blend_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(1, 2, 3, 0), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(1, 2, 3, 0), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Blend_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(1, 2, 3, 0), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Blend_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(1, 2, 3, 0), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Modulate_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(1, 2, 3, 0), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE);
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Modulate_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(1, 2, 3, 0), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Modulate_Blend_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(1, 2, 3, 0), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Modulate_Blend_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(1, 2, 3, 0), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_BGRA8888_ARGB8888_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(1, 2, 3, 0), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_BGRA8888_ARGB8888_Blend_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(1, 2, 3, 0), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_BGRA8888_ARGB8888_Blend_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(1, 2, 3, 0), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_BGRA8888_ARGB8888_Modulate_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(1, 2, 3, 0), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_MODULATE);
+}
+
+static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(1, 2, 3, 0), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(1, 2, 3, 0), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SSE41(info, SDL_BLIT_AUTO_ORDER(1, 2, 3, 0), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+#endif /* HAVE_SSE41_INTRINSICS */
+
+#if HAVE_NEON_INTRINSICS
+
+static void SDL_Blit_RGB888_RGB888_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_SCALE | SDL_BLIT_AUTO_COPY);
+}
+
+static void SDL_Blit_RGB888_RGB888_Blend_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_MUL_ALPHA_FF);
+}
+
+static void SDL_Blit_RGB888_RGB888_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE | SDL_BLIT_AUTO_MUL_ALPHA_FF);
+}
+
+static void SDL_Blit_RGB888_RGB888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE);
+}
+
+static void SDL_Blit_RGB888_RGB888_Modulate_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_RGB888_RGB888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_RGB888_RGB888_Modulate_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_RGB888_BGR888_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_RGB888_BGR888_Blend_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_MUL_ALPHA_FF);
+}
+
+static void SDL_Blit_RGB888_BGR888_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE | SDL_BLIT_AUTO_MUL_ALPHA_FF);
+}
+
+static void SDL_Blit_RGB888_BGR888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE);
+}
+
+static void SDL_Blit_RGB888_BGR888_Modulate_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_RGB888_BGR888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_RGB888_BGR888_Modulate_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_RGB888_ARGB8888_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_RGB888_ARGB8888_Blend_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_MUL_ALPHA_FF);
+}
+
+static void SDL_Blit_RGB888_ARGB8888_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE | SDL_BLIT_AUTO_MUL_ALPHA_FF);
+}
+
+static void SDL_Blit_RGB888_ARGB8888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_MODULATE);
+}
+
+static void SDL_Blit_RGB888_ARGB8888_Modulate_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_RGB888_ARGB8888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_RGB888_ARGB8888_Modulate_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_BGR888_RGB888_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_BGR888_RGB888_Blend_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_MUL_ALPHA_FF);
+}
+
+static void SDL_Blit_BGR888_RGB888_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE | SDL_BLIT_AUTO_MUL_ALPHA_FF);
+}
+
+static void SDL_Blit_BGR888_RGB888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE);
+}
+
+static void SDL_Blit_BGR888_RGB888_Modulate_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_BGR888_RGB888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_BGR888_RGB888_Modulate_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_BGR888_BGR888_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_SCALE | SDL_BLIT_AUTO_COPY);
+}
+
+static void SDL_Blit_BGR888_BGR888_Blend_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_MUL_ALPHA_FF);
+}
+
+static void SDL_Blit_BGR888_BGR888_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE | SDL_BLIT_AUTO_MUL_ALPHA_FF);
+}
+
+static void SDL_Blit_BGR888_BGR888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE);
+}
+
+static void SDL_Blit_BGR888_BGR888_Modulate_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_BGR888_BGR888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_BGR888_BGR888_Modulate_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_BGR888_ARGB8888_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_BGR888_ARGB8888_Blend_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_MUL_ALPHA_FF);
+}
+
+static void SDL_Blit_BGR888_ARGB8888_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE | SDL_BLIT_AUTO_MUL_ALPHA_FF);
+}
+
+static void SDL_Blit_BGR888_ARGB8888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_MODULATE);
+}
+
+static void SDL_Blit_BGR888_ARGB8888_Modulate_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_BGR888_ARGB8888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_BGR888_ARGB8888_Modulate_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_ARGB8888_RGB888_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_ARGB8888_RGB888_Blend_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_ARGB8888_RGB888_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_ARGB8888_RGB888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE);
+}
+
+static void SDL_Blit_ARGB8888_RGB888_Modulate_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_ARGB8888_RGB888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_ARGB8888_RGB888_Modulate_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_ARGB8888_BGR888_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_ARGB8888_BGR888_Blend_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_ARGB8888_BGR888_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_ARGB8888_BGR888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE);
+}
+
+static void SDL_Blit_ARGB8888_BGR888_Modulate_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_ARGB8888_BGR888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_ARGB8888_BGR888_Modulate_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_ARGB8888_ARGB8888_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_SCALE | SDL_BLIT_AUTO_COPY);
+}
+
+static void SDL_Blit_ARGB8888_ARGB8888_Blend_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_ARGB8888_ARGB8888_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_ARGB8888_ARGB8888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_MODULATE);
+}
+
+static void SDL_Blit_ARGB8888_ARGB8888_Modulate_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_RGBA8888_RGB888_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(3, 2, 1, 0), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_RGBA8888_RGB888_Blend_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(3, 2, 1, 0), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_RGBA8888_RGB888_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(3, 2, 1, 0), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_RGBA8888_RGB888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(3, 2, 1, 0), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE);
+}
+
+static void SDL_Blit_RGBA8888_RGB888_Modulate_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(3, 2, 1, 0), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_RGBA8888_RGB888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(3, 2, 1, 0), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_RGBA8888_RGB888_Modulate_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(3, 2, 1, 0), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(3, 2, 1, 0), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Blend_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(3, 2, 1, 0), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(3, 2, 1, 0), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(3, 2, 1, 0), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE);
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Modulate_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(3, 2, 1, 0), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(3, 2, 1, 0), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Modulate_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(3, 2, 1, 0), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(3, 2, 1, 0), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Blend_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(3, 2, 1, 0), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(3, 2, 1, 0), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(3, 2, 1, 0), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_MODULATE);
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Modulate_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(3, 2, 1, 0), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(3, 2, 1, 0), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(3, 2, 1, 0), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, 3), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Blend_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, 3), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, 3), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, 3), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE);
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Modulate_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, 3), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, 3), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Modulate_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, 3), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, 3), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Blend_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, 3), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, 3), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, 3), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE);
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Modulate_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, 3), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, 3), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Modulate_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, 3), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, 3), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Blend_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, 3), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, 3), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, 3), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_MODULATE);
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Modulate_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, 3), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, 3), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(0, 1, 2, 3), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(1, 2, 3, 0), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Blend_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(1, 2, 3, 0), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(1, 2, 3, 0), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(1, 2, 3, 0), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE);
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Modulate_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(1, 2, 3, 0), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(1, 2, 3, 0), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Modulate_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(1, 2, 3, 0), SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(1, 2, 3, 0), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Blend_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(1, 2, 3, 0), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(1, 2, 3, 0), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(1, 2, 3, 0), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE);
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Modulate_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(1, 2, 3, 0), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(1, 2, 3, 0), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Modulate_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(1, 2, 3, 0), SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_BGRA8888_ARGB8888_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(1, 2, 3, 0), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_BGRA8888_ARGB8888_Blend_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(1, 2, 3, 0), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_BGRA8888_ARGB8888_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(1, 2, 3, 0), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_BGRA8888_ARGB8888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(1, 2, 3, 0), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_MODULATE);
+}
+
+static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(1, 2, 3, 0), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_SCALE);
+}
+
+static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(1, 2, 3, 0), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND);
+}
+
+static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_NEON(info, SDL_BLIT_AUTO_ORDER(1, 2, 3, 0), SDL_BLIT_AUTO_ORDER(2, 1, 0, 3), SDL_BLIT_AUTO_MODULATE | SDL_BLIT_AUTO_BLEND | SDL_BLIT_AUTO_SCALE);
+}
+
+#endif /* HAVE_NEON_INTRINSICS */
+
 SDL_BlitFuncEntry SDL_GeneratedBlitFuncTable[] = {
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGB888_RGB888_Scale_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_RGB888_RGB888_Scale_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGB888_RGB888_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_RGB888_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_RGB888_RGB888_Blend_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE41, SDL_Blit_RGB888_RGB888_Blend_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_RGB888_RGB888_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_RGB888_RGB888_Blend },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGB888_RGB888_Blend_Scale_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_RGB888_RGB888_Blend_Scale_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGB888_RGB888_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_RGB888_Blend_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_RGB888_RGB888_Modulate_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE41, SDL_Blit_RGB888_RGB888_Modulate_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_RGB888_RGB888_Modulate_NEON },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_RGB888_RGB888_Modulate },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGB888_RGB888_Modulate_Scale_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_RGB888_RGB888_Modulate_Scale_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGB888_RGB888_Modulate_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_RGB888_Modulate_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_RGB888_RGB888_Modulate_Blend_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE41, SDL_Blit_RGB888_RGB888_Modulate_Blend_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_RGB888_RGB888_Modulate_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_RGB888_RGB888_Modulate_Blend },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGB888_RGB888_Modulate_Blend_Scale_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_RGB888_RGB888_Modulate_Blend_Scale_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGB888_RGB888_Modulate_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_RGB888_Modulate_Blend_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGB888_BGR888_Scale_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_RGB888_BGR888_Scale_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGB888_BGR888_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_BGR888_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_RGB888_BGR888_Blend_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE41, SDL_Blit_RGB888_BGR888_Blend_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_RGB888_BGR888_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_RGB888_BGR888_Blend },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGB888_BGR888_Blend_Scale_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_RGB888_BGR888_Blend_Scale_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGB888_BGR888_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_BGR888_Blend_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_RGB888_BGR888_Modulate_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE41, SDL_Blit_RGB888_BGR888_Modulate_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_RGB888_BGR888_Modulate_NEON },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_RGB888_BGR888_Modulate },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGB888_BGR888_Modulate_Scale_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_RGB888_BGR888_Modulate_Scale_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGB888_BGR888_Modulate_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_BGR888_Modulate_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_RGB888_BGR888_Modulate_Blend_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE41, SDL_Blit_RGB888_BGR888_Modulate_Blend_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_RGB888_BGR888_Modulate_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_RGB888_BGR888_Modulate_Blend },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGB888_BGR888_Modulate_Blend_Scale_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_RGB888_BGR888_Modulate_Blend_Scale_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGB888_BGR888_Modulate_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_BGR888_Modulate_Blend_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGB888_ARGB8888_Scale_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_RGB888_ARGB8888_Scale_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGB888_ARGB8888_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_ARGB8888_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_RGB888_ARGB8888_Blend_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE41, SDL_Blit_RGB888_ARGB8888_Blend_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_RGB888_ARGB8888_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_RGB888_ARGB8888_Blend },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGB888_ARGB8888_Blend_Scale_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_RGB888_ARGB8888_Blend_Scale_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGB888_ARGB8888_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_ARGB8888_Blend_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_RGB888_ARGB8888_Modulate_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE41, SDL_Blit_RGB888_ARGB8888_Modulate_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_RGB888_ARGB8888_Modulate_NEON },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_RGB888_ARGB8888_Modulate },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGB888_ARGB8888_Modulate_Scale_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_RGB888_ARGB8888_Modulate_Scale_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGB888_ARGB8888_Modulate_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_ARGB8888_Modulate_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_RGB888_ARGB8888_Modulate_Blend_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE41, SDL_Blit_RGB888_ARGB8888_Modulate_Blend_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_RGB888_ARGB8888_Modulate_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_RGB888_ARGB8888_Modulate_Blend },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGB888_ARGB8888_Modulate_Blend_Scale_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_RGB888_ARGB8888_Modulate_Blend_Scale_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGB888_ARGB8888_Modulate_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_ARGB8888_Modulate_Blend_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGR888_RGB888_Scale_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_BGR888_RGB888_Scale_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGR888_RGB888_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_RGB888_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_BGR888_RGB888_Blend_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE41, SDL_Blit_BGR888_RGB888_Blend_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_BGR888_RGB888_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_BGR888_RGB888_Blend },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGR888_RGB888_Blend_Scale_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_BGR888_RGB888_Blend_Scale_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGR888_RGB888_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_RGB888_Blend_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_BGR888_RGB888_Modulate_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE41, SDL_Blit_BGR888_RGB888_Modulate_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_BGR888_RGB888_Modulate_NEON },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_BGR888_RGB888_Modulate },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGR888_RGB888_Modulate_Scale_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_BGR888_RGB888_Modulate_Scale_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGR888_RGB888_Modulate_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_RGB888_Modulate_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_BGR888_RGB888_Modulate_Blend_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE41, SDL_Blit_BGR888_RGB888_Modulate_Blend_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_BGR888_RGB888_Modulate_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_BGR888_RGB888_Modulate_Blend },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGR888_RGB888_Modulate_Blend_Scale_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_BGR888_RGB888_Modulate_Blend_Scale_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGR888_RGB888_Modulate_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_RGB888_Modulate_Blend_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGR888_BGR888_Scale_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_BGR888_BGR888_Scale_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGR888_BGR888_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_BGR888_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_BGR888_BGR888_Blend_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE41, SDL_Blit_BGR888_BGR888_Blend_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_BGR888_BGR888_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_BGR888_BGR888_Blend },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGR888_BGR888_Blend_Scale_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_BGR888_BGR888_Blend_Scale_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGR888_BGR888_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_BGR888_Blend_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_BGR888_BGR888_Modulate_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE41, SDL_Blit_BGR888_BGR888_Modulate_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_BGR888_BGR888_Modulate_NEON },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_BGR888_BGR888_Modulate },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGR888_BGR888_Modulate_Scale_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_BGR888_BGR888_Modulate_Scale_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGR888_BGR888_Modulate_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_BGR888_Modulate_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_BGR888_BGR888_Modulate_Blend_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE41, SDL_Blit_BGR888_BGR888_Modulate_Blend_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_BGR888_BGR888_Modulate_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_BGR888_BGR888_Modulate_Blend },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGR888_BGR888_Modulate_Blend_Scale_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_BGR888_BGR888_Modulate_Blend_Scale_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGR888_BGR888_Modulate_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_BGR888_Modulate_Blend_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGR888_ARGB8888_Scale_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_BGR888_ARGB8888_Scale_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGR888_ARGB8888_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_ARGB8888_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_BGR888_ARGB8888_Blend_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE41, SDL_Blit_BGR888_ARGB8888_Blend_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_BGR888_ARGB8888_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_BGR888_ARGB8888_Blend },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGR888_ARGB8888_Blend_Scale_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_BGR888_ARGB8888_Blend_Scale_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGR888_ARGB8888_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_ARGB8888_Blend_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_BGR888_ARGB8888_Modulate_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE41, SDL_Blit_BGR888_ARGB8888_Modulate_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_BGR888_ARGB8888_Modulate_NEON },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_BGR888_ARGB8888_Modulate },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGR888_ARGB8888_Modulate_Scale_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_BGR888_ARGB8888_Modulate_Scale_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGR888_ARGB8888_Modulate_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_ARGB8888_Modulate_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_BGR888_ARGB8888_Modulate_Blend_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE41, SDL_Blit_BGR888_ARGB8888_Modulate_Blend_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_BGR888_ARGB8888_Modulate_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_BGR888_ARGB8888_Modulate_Blend },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGR888_ARGB8888_Modulate_Blend_Scale_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_BGR888_ARGB8888_Modulate_Blend_Scale_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGR888_ARGB8888_Modulate_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_ARGB8888_Modulate_Blend_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_RGB888_Scale_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_ARGB8888_RGB888_Scale_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ARGB8888_RGB888_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_RGB888_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_ARGB8888_RGB888_Blend_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE41, SDL_Blit_ARGB8888_RGB888_Blend_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_ARGB8888_RGB888_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_ARGB8888_RGB888_Blend },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_RGB888_Blend_Scale_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_ARGB8888_RGB888_Blend_Scale_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ARGB8888_RGB888_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_RGB888_Blend_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_ARGB8888_RGB888_Modulate_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE41, SDL_Blit_ARGB8888_RGB888_Modulate_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_ARGB8888_RGB888_Modulate_NEON },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_ARGB8888_RGB888_Modulate },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_RGB888_Modulate_Scale_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_ARGB8888_RGB888_Modulate_Scale_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ARGB8888_RGB888_Modulate_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_RGB888_Modulate_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_ARGB8888_RGB888_Modulate_Blend_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE41, SDL_Blit_ARGB8888_RGB888_Modulate_Blend_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_ARGB8888_RGB888_Modulate_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_ARGB8888_RGB888_Modulate_Blend },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_RGB888_Modulate_Blend_Scale_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_ARGB8888_RGB888_Modulate_Blend_Scale_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ARGB8888_RGB888_Modulate_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_RGB888_Modulate_Blend_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_BGR888_Scale_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_ARGB8888_BGR888_Scale_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ARGB8888_BGR888_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_BGR888_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_ARGB8888_BGR888_Blend_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE41, SDL_Blit_ARGB8888_BGR888_Blend_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_ARGB8888_BGR888_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_ARGB8888_BGR888_Blend },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_BGR888_Blend_Scale_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_ARGB8888_BGR888_Blend_Scale_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ARGB8888_BGR888_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_BGR888_Blend_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_ARGB8888_BGR888_Modulate_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE41, SDL_Blit_ARGB8888_BGR888_Modulate_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_ARGB8888_BGR888_Modulate_NEON },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_ARGB8888_BGR888_Modulate },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_BGR888_Modulate_Scale_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_ARGB8888_BGR888_Modulate_Scale_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ARGB8888_BGR888_Modulate_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_BGR888_Modulate_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_ARGB8888_BGR888_Modulate_Blend_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE41, SDL_Blit_ARGB8888_BGR888_Modulate_Blend_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_ARGB8888_BGR888_Modulate_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_ARGB8888_BGR888_Modulate_Blend },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_BGR888_Modulate_Blend_Scale_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_ARGB8888_BGR888_Modulate_Blend_Scale_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ARGB8888_BGR888_Modulate_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_BGR888_Modulate_Blend_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_ARGB8888_Scale_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_ARGB8888_ARGB8888_Scale_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ARGB8888_ARGB8888_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_ARGB8888_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_ARGB8888_ARGB8888_Blend_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE41, SDL_Blit_ARGB8888_ARGB8888_Blend_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_ARGB8888_ARGB8888_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_ARGB8888_ARGB8888_Blend },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_ARGB8888_Blend_Scale_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_ARGB8888_ARGB8888_Blend_Scale_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ARGB8888_ARGB8888_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_ARGB8888_Blend_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_ARGB8888_ARGB8888_Modulate_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE41, SDL_Blit_ARGB8888_ARGB8888_Modulate_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_ARGB8888_ARGB8888_Modulate_NEON },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_ARGB8888_ARGB8888_Modulate },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_ARGB8888_Modulate_Scale_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_ARGB8888_ARGB8888_Modulate_Scale_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ARGB8888_ARGB8888_Modulate_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_ARGB8888_Modulate_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE41, SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_Scale_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_Scale_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_RGB888_Scale_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_RGBA8888_RGB888_Scale_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGBA8888_RGB888_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_RGB888_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_RGBA8888_RGB888_Blend_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE41, SDL_Blit_RGBA8888_RGB888_Blend_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_RGBA8888_RGB888_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_RGBA8888_RGB888_Blend },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_RGB888_Blend_Scale_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_RGBA8888_RGB888_Blend_Scale_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGBA8888_RGB888_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_RGB888_Blend_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_RGBA8888_RGB888_Modulate_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE41, SDL_Blit_RGBA8888_RGB888_Modulate_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_RGBA8888_RGB888_Modulate_NEON },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_RGBA8888_RGB888_Modulate },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_RGB888_Modulate_Scale_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_RGBA8888_RGB888_Modulate_Scale_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGBA8888_RGB888_Modulate_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_RGB888_Modulate_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_RGBA8888_RGB888_Modulate_Blend_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE41, SDL_Blit_RGBA8888_RGB888_Modulate_Blend_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_RGBA8888_RGB888_Modulate_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_RGBA8888_RGB888_Modulate_Blend },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_RGB888_Modulate_Blend_Scale_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_RGBA8888_RGB888_Modulate_Blend_Scale_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGBA8888_RGB888_Modulate_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_RGB888_Modulate_Blend_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_BGR888_Scale_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_RGBA8888_BGR888_Scale_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGBA8888_BGR888_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_BGR888_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_RGBA8888_BGR888_Blend_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE41, SDL_Blit_RGBA8888_BGR888_Blend_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_RGBA8888_BGR888_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_RGBA8888_BGR888_Blend },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_BGR888_Blend_Scale_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_RGBA8888_BGR888_Blend_Scale_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGBA8888_BGR888_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_BGR888_Blend_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_RGBA8888_BGR888_Modulate_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE41, SDL_Blit_RGBA8888_BGR888_Modulate_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_RGBA8888_BGR888_Modulate_NEON },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_RGBA8888_BGR888_Modulate },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_BGR888_Modulate_Scale_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_RGBA8888_BGR888_Modulate_Scale_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGBA8888_BGR888_Modulate_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_BGR888_Modulate_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_RGBA8888_BGR888_Modulate_Blend_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE41, SDL_Blit_RGBA8888_BGR888_Modulate_Blend_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_RGBA8888_BGR888_Modulate_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_RGBA8888_BGR888_Modulate_Blend },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_BGR888_Modulate_Blend_Scale_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_RGBA8888_BGR888_Modulate_Blend_Scale_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGBA8888_BGR888_Modulate_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_BGR888_Modulate_Blend_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_ARGB8888_Scale_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_RGBA8888_ARGB8888_Scale_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGBA8888_ARGB8888_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_ARGB8888_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_RGBA8888_ARGB8888_Blend_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE41, SDL_Blit_RGBA8888_ARGB8888_Blend_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_RGBA8888_ARGB8888_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_RGBA8888_ARGB8888_Blend },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_ARGB8888_Blend_Scale_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_RGBA8888_ARGB8888_Blend_Scale_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGBA8888_ARGB8888_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_ARGB8888_Blend_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_RGBA8888_ARGB8888_Modulate_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE41, SDL_Blit_RGBA8888_ARGB8888_Modulate_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_RGBA8888_ARGB8888_Modulate_NEON },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_RGBA8888_ARGB8888_Modulate },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_ARGB8888_Modulate_Scale_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_RGBA8888_ARGB8888_Modulate_Scale_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGBA8888_ARGB8888_Modulate_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_ARGB8888_Modulate_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE41, SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_Scale_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_Scale_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_RGB888_Scale_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_ABGR8888_RGB888_Scale_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ABGR8888_RGB888_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_RGB888_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_ABGR8888_RGB888_Blend_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE41, SDL_Blit_ABGR8888_RGB888_Blend_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_ABGR8888_RGB888_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_ABGR8888_RGB888_Blend },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_RGB888_Blend_Scale_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_ABGR8888_RGB888_Blend_Scale_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ABGR8888_RGB888_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_RGB888_Blend_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_ABGR8888_RGB888_Modulate_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE41, SDL_Blit_ABGR8888_RGB888_Modulate_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_ABGR8888_RGB888_Modulate_NEON },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_ABGR8888_RGB888_Modulate },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_RGB888_Modulate_Scale_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_ABGR8888_RGB888_Modulate_Scale_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ABGR8888_RGB888_Modulate_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_RGB888_Modulate_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_ABGR8888_RGB888_Modulate_Blend_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE41, SDL_Blit_ABGR8888_RGB888_Modulate_Blend_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_ABGR8888_RGB888_Modulate_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_ABGR8888_RGB888_Modulate_Blend },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_RGB888_Modulate_Blend_Scale_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_ABGR8888_RGB888_Modulate_Blend_Scale_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ABGR8888_RGB888_Modulate_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_RGB888_Modulate_Blend_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_BGR888_Scale_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_ABGR8888_BGR888_Scale_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ABGR8888_BGR888_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_BGR888_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_ABGR8888_BGR888_Blend_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE41, SDL_Blit_ABGR8888_BGR888_Blend_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_ABGR8888_BGR888_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_ABGR8888_BGR888_Blend },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_BGR888_Blend_Scale_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_ABGR8888_BGR888_Blend_Scale_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ABGR8888_BGR888_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_BGR888_Blend_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_ABGR8888_BGR888_Modulate_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE41, SDL_Blit_ABGR8888_BGR888_Modulate_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_ABGR8888_BGR888_Modulate_NEON },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_ABGR8888_BGR888_Modulate },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_BGR888_Modulate_Scale_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_ABGR8888_BGR888_Modulate_Scale_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ABGR8888_BGR888_Modulate_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_BGR888_Modulate_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_ABGR8888_BGR888_Modulate_Blend_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE41, SDL_Blit_ABGR8888_BGR888_Modulate_Blend_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_ABGR8888_BGR888_Modulate_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_ABGR8888_BGR888_Modulate_Blend },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_BGR888_Modulate_Blend_Scale_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_ABGR8888_BGR888_Modulate_Blend_Scale_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ABGR8888_BGR888_Modulate_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_BGR888_Modulate_Blend_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_ARGB8888_Scale_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_ABGR8888_ARGB8888_Scale_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ABGR8888_ARGB8888_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_ARGB8888_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_ABGR8888_ARGB8888_Blend_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE41, SDL_Blit_ABGR8888_ARGB8888_Blend_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_ABGR8888_ARGB8888_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_ABGR8888_ARGB8888_Blend },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_ARGB8888_Blend_Scale_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_ABGR8888_ARGB8888_Blend_Scale_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ABGR8888_ARGB8888_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_ARGB8888_Blend_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_ABGR8888_ARGB8888_Modulate_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE41, SDL_Blit_ABGR8888_ARGB8888_Modulate_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_ABGR8888_ARGB8888_Modulate_NEON },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_ABGR8888_ARGB8888_Modulate },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_ARGB8888_Modulate_Scale_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_ABGR8888_ARGB8888_Modulate_Scale_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ABGR8888_ARGB8888_Modulate_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_ARGB8888_Modulate_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE41, SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_Scale_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_Scale_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_RGB888_Scale_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_BGRA8888_RGB888_Scale_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGRA8888_RGB888_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_RGB888_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_BGRA8888_RGB888_Blend_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE41, SDL_Blit_BGRA8888_RGB888_Blend_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_BGRA8888_RGB888_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_BGRA8888_RGB888_Blend },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_RGB888_Blend_Scale_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_BGRA8888_RGB888_Blend_Scale_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGRA8888_RGB888_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_RGB888_Blend_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_BGRA8888_RGB888_Modulate_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE41, SDL_Blit_BGRA8888_RGB888_Modulate_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_BGRA8888_RGB888_Modulate_NEON },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_BGRA8888_RGB888_Modulate },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_RGB888_Modulate_Scale_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_BGRA8888_RGB888_Modulate_Scale_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGRA8888_RGB888_Modulate_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_RGB888_Modulate_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_BGRA8888_RGB888_Modulate_Blend_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE41, SDL_Blit_BGRA8888_RGB888_Modulate_Blend_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_BGRA8888_RGB888_Modulate_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_BGRA8888_RGB888_Modulate_Blend },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_RGB888_Modulate_Blend_Scale_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_BGRA8888_RGB888_Modulate_Blend_Scale_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGRA8888_RGB888_Modulate_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_RGB888_Modulate_Blend_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_BGR888_Scale_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_BGRA8888_BGR888_Scale_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGRA8888_BGR888_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_BGR888_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_BGRA8888_BGR888_Blend_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE41, SDL_Blit_BGRA8888_BGR888_Blend_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_BGRA8888_BGR888_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_BGRA8888_BGR888_Blend },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_BGR888_Blend_Scale_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_BGRA8888_BGR888_Blend_Scale_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGRA8888_BGR888_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_BGR888_Blend_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_BGRA8888_BGR888_Modulate_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE41, SDL_Blit_BGRA8888_BGR888_Modulate_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_BGRA8888_BGR888_Modulate_NEON },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_BGRA8888_BGR888_Modulate },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_BGR888_Modulate_Scale_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_BGRA8888_BGR888_Modulate_Scale_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGRA8888_BGR888_Modulate_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_BGR888_Modulate_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_BGRA8888_BGR888_Modulate_Blend_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE41, SDL_Blit_BGRA8888_BGR888_Modulate_Blend_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_BGRA8888_BGR888_Modulate_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_BGRA8888_BGR888_Modulate_Blend },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_BGR888_Modulate_Blend_Scale_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_BGRA8888_BGR888_Modulate_Blend_Scale_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGRA8888_BGR888_Modulate_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_BGR888_Modulate_Blend_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_ARGB8888_Scale_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_BGRA8888_ARGB8888_Scale_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGRA8888_ARGB8888_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_ARGB8888_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_BGRA8888_ARGB8888_Blend_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE41, SDL_Blit_BGRA8888_ARGB8888_Blend_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_BGRA8888_ARGB8888_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_BGRA8888_ARGB8888_Blend },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_ARGB8888_Blend_Scale_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_BGRA8888_ARGB8888_Blend_Scale_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGRA8888_ARGB8888_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_ARGB8888_Blend_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_BGRA8888_ARGB8888_Modulate_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE41, SDL_Blit_BGRA8888_ARGB8888_Modulate_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_BGRA8888_ARGB8888_Modulate_NEON },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_BGRA8888_ARGB8888_Modulate },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_ARGB8888_Modulate_Scale_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_BGRA8888_ARGB8888_Modulate_Scale_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGRA8888_ARGB8888_Modulate_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_ARGB8888_Modulate_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE41, SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_Scale_AVX2 },
+#endif
+#if HAVE_SSE41_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_Scale_SSE41 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_Scale },
     { 0, 0, 0, 0, NULL }
 };
@@ -69,9 +69,9 @@ SDL_Blit_Slow(SDL_BlitInfo * info)
     srcfmt_val = detect_format(src_fmt);
     dstfmt_val = detect_format(dst_fmt);
 
-    incy = (info->src_h << 16) / info->dst_h;
+    incy = (info->src_h << 16) / info->scale_h;
     incx = (info->src_w << 16) / info->dst_w;
-    posy = incy / 2; /* start at the middle of pixel */
+    posy = incy / 2 + (Uint32)info->scale_y * incy; /* start at the middle of pixel */
 
     while (info->dst_h--) {
         Uint8 *src = 0;
@@ -23,6 +23,7 @@
 #include "SDL_video.h"
 #include "SDL_blit.h"
 #include "SDL_cpuinfo.h"
+#include "../thread/SDL_parallel_c.h"
 
 
 #ifdef __SSE__
@@ -55,7 +56,9 @@
         p += 64; \
     }
 
-#define SSE_END
+/* Make the streaming stores visible to other threads before we return */
+#define SSE_END \
+    _mm_sfence()
 
 #define DEFINE_SSE_FILLRECT(bpp, type) \
 static void \
@@ -295,6 +298,27 @@ static void fill_32_simd(Uint8 * pixels, int pitch, Uint32 color, int w, int h)
 }
 #endif
 
+typedef struct
+{
+    void (*fill_function)(Uint8 * pixels, int pitch, Uint32 color, int w, int h);
+    Uint8 *pixels;
+    int pitch;
+    Uint32 color;
+    int w;
+    int h;
+    int bands;
+} SDL_FillBandJob;
+
+static void
+SDL_RunFillBand(void *data, int band)
+{
+    const SDL_FillBandJob *job = (const SDL_FillBandJob *) data;
+    const int y = SDL_BLIT_BAND_ROW(job->h, band, job->bands);
+    const int h = SDL_BLIT_BAND_ROW(job->h, band + 1, job->bands) - y;
+
+    job->fill_function(job->pixels + y * job->pitch, job->pitch, job->color, job->w, h);
+}
+
 int
 SDL_FillRects(SDL_Surface * dst, const SDL_Rect * rects, int count,
               Uint32 color)
@@ -303,7 +327,7 @@ SDL_FillRects(SDL_Surface * dst, const SDL_Rect * rects, int count,
     Uint8 *pixels;
     const SDL_Rect* rect;
     void (*fill_function)(Uint8 * pixels, int pitch, Uint32 color, int w, int h) = NULL;
-    int i;
+    int i, bands;
 
     if (!dst) {
         return SDL_InvalidParamError("SDL_FillRects(): dst");
@@ -435,7 +459,21 @@ SDL_FillRects(SDL_Surface * dst, const SDL_Rect * rects, int count,
         pixels = (Uint8 *) dst->pixels + rect->y * dst->pitch +
                                          rect->x * dst->format->BytesPerPixel;
 
-        fill_function(pixels, dst->pitch, color, rect->w, rect->h);
+        /* Fill large rectangles in bands on the worker threads */
+        bands = SDL_GetBlitBandCount(NULL, dst, rect->w, rect->h);
+        if (bands > 1) {
+            SDL_FillBandJob job;
+            job.fill_function = fill_function;
+            job.pixels = pixels;
+            job.pitch = dst->pitch;
+            job.color = color;
+            job.w = rect->w;
+            job.h = rect->h;
+            job.bands = bands;
+            SDL_ParallelFor(bands, SDL_RunFillBand, &job);
+        } else {
+            fill_function(pixels, dst->pitch, color, rect->w, rect->h);
+        }
     }
 
     /* We're done! */
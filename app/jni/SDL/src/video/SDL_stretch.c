@@ -23,11 +23,39 @@
 #include "SDL_video.h"
 #include "SDL_blit.h"
 #include "SDL_render.h"
+#include "../thread/SDL_parallel_c.h"
 
-static int SDL_LowerSoftStretchNearest(SDL_Surface *src, const SDL_Rect *srcrect, SDL_Surface *dst, const SDL_Rect *dstrect);
-static int SDL_LowerSoftStretchLinear(SDL_Surface *src, const SDL_Rect *srcrect, SDL_Surface *dst, const SDL_Rect *dstrect);
+static int SDL_LowerSoftStretchNearest(SDL_Surface *src, const SDL_Rect *srcrect, SDL_Surface *dst, const SDL_Rect *dstrect, int band_y, int band_h);
+static int SDL_LowerSoftStretchLinear(SDL_Surface *src, const SDL_Rect *srcrect, SDL_Surface *dst, const SDL_Rect *dstrect, int band_y, int band_h);
 static int SDL_UpperSoftStretch(SDL_Surface * src, const SDL_Rect * srcrect, SDL_Surface * dst, const SDL_Rect * dstrect, SDL_ScaleMode scaleMode);
 
+typedef struct
+{
+    SDL_Surface *src;
+    const SDL_Rect *srcrect;
+    SDL_Surface *dst;
+    const SDL_Rect *dstrect;
+    SDL_ScaleMode scaleMode;
+    int bands;
+} SDL_StretchBandJob;
+
+/* Stretch one band of destination rows, the scalers step to the band's
+   first row so the output matches a stretch done in one piece. */
+static void
+SDL_RunStretchBand(void *data, int band)
+{
+    const SDL_StretchBandJob *job = (const SDL_StretchBandJob *) data;
+    const int h = job->dstrect->h;
+    const int y = SDL_BLIT_BAND_ROW(h, band, job->bands);
+    const int band_h = SDL_BLIT_BAND_ROW(h, band + 1, job->bands) - y;
+
+    if (job->scaleMode == SDL_ScaleModeNearest) {
+        SDL_LowerSoftStretchNearest(job->src, job->srcrect, job->dst, job->dstrect, y, band_h);
+    } else {
+        SDL_LowerSoftStretchLinear(job->src, job->srcrect, job->dst, job->dstrect, y, band_h);
+    }
+}
+
 int
 SDL_SoftStretch(SDL_Surface *src, const SDL_Rect *srcrect,
                 SDL_Surface *dst, const SDL_Rect *dstrect)
@@ -49,6 +77,7 @@ SDL_UpperSoftStretch(SDL_Surface * src, const SDL_Rect * srcrect,
     int ret;
     int src_locked;
     int dst_locked;
+    int bands;
     SDL_Rect full_src;
     SDL_Rect full_dst;
 
@@ -119,10 +148,21 @@ SDL_UpperSoftStretch(SDL_Surface * src, const SDL_Rect * srcrect,
         src_locked = 1;
     }
 
-    if (scaleMode == SDL_ScaleModeNearest) {
-        ret = SDL_LowerSoftStretchNearest(src, srcrect, dst, dstrect);
+    bands = SDL_GetBlitBandCount(src, dst, dstrect->w, dstrect->h);
+    if (bands > 1) {
+        SDL_StretchBandJob job;
+        job.src = src;
+        job.srcrect = srcrect;
+        job.dst = dst;
+        job.dstrect = dstrect;
+        job.scaleMode = scaleMode;
+        job.bands = bands;
+        SDL_ParallelFor(bands, SDL_RunStretchBand, &job);
+        ret = 0;
+    } else if (scaleMode == SDL_ScaleModeNearest) {
+        ret = SDL_LowerSoftStretchNearest(src, srcrect, dst, dstrect, 0, dstrect->h);
     } else {
-        ret = SDL_LowerSoftStretchLinear(src, srcrect, dst, dstrect);
+        ret = SDL_LowerSoftStretchLinear(src, srcrect, dst, dstrect, 0, dstrect->h);
     }
 
     /* We need to unlock the surfaces if they're locked */
@@ -162,6 +202,7 @@ SDL_UpperSoftStretch(SDL_Surface * src, const SDL_Rect * srcrect,
     right_pad_w_init = right_pad_w;                                                             \
     dst_gap          = dst_pitch - 4 * dst_w;                                                   \
     middle_init      = dst_w - left_pad_w - right_pad_w;                                        \
+    fp_sum_h        += band_y * fp_step_h;                                                      \
 
 #define BILINEAR___HEIGHT                                                                       \
     int index_h, frac_h0, frac_h1, middle;                                                      \
@@ -294,11 +335,11 @@ INTERPOL_BILINEAR(const Uint32 *s0, const Uint32 *s1, int frac_w0, int frac_h0,
 
 static int
 scale_mat(const Uint32 *src, int src_w, int src_h, int src_pitch,
-        Uint32 *dst, int dst_w, int dst_h, int dst_pitch)
+        Uint32 *dst, int dst_w, int dst_h, int dst_pitch, int band_y, int band_h)
 {
     BILINEAR___START
 
-    for (i = 0; i < dst_h; i++) {
+    for (i = band_y; i < band_y + band_h; i++) {
 
         BILINEAR___HEIGHT
 
@@ -424,11 +465,11 @@ INTERPOL_BILINEAR_SSE(const Uint32 *s0, const Uint32 *s1, int frac_w, __m128i v_
 }
 
 static int
-scale_mat_SSE(const Uint32 *src, int src_w, int src_h, int src_pitch, Uint32 *dst, int dst_w, int dst_h, int dst_pitch)
+scale_mat_SSE(const Uint32 *src, int src_w, int src_h, int src_pitch, Uint32 *dst, int dst_w, int dst_h, int dst_pitch, int band_y, int band_h)
 {
     BILINEAR___START
 
-    for (i = 0; i < dst_h; i++) {
+    for (i = band_y; i < band_y + band_h; i++) {
         int nb_block2;
         __m128i v_frac_h0;
         __m128i v_frac_h1;
@@ -592,11 +633,11 @@ INTERPOL_BILINEAR_NEON(const Uint32 *s0, const Uint32 *s1, int frac_w, uint8x8_t
 }
 
     static int
-scale_mat_NEON(const Uint32 *src, int src_w, int src_h, int src_pitch, Uint32 *dst, int dst_w, int dst_h, int dst_pitch)
+scale_mat_NEON(const Uint32 *src, int src_w, int src_h, int src_pitch, Uint32 *dst, int dst_w, int dst_h, int dst_pitch, int band_y, int band_h)
 {
     BILINEAR___START
 
-    for (i = 0; i < dst_h; i++) {
+    for (i = band_y; i < band_y + band_h; i++) {
         int nb_block4;
         uint8x8_t v_frac_h0, v_frac_h1;
 
@@ -815,7 +856,7 @@ scale_mat_NEON(const Uint32 *src, int src_w, int src_h, int src_pitch, Uint32 *d
 
 int
 SDL_LowerSoftStretchLinear(SDL_Surface *s, const SDL_Rect *srcrect,
-                SDL_Surface *d, const SDL_Rect *dstrect)
+                SDL_Surface *d, const SDL_Rect *dstrect, int band_y, int band_h)
 {
     int ret = -1;
     int src_w = srcrect->w;
@@ -825,22 +866,22 @@ SDL_LowerSoftStretchLinear(SDL_Surface *s, const SDL_Rect *srcrect,
     int src_pitch = s->pitch;
     int dst_pitch = d->pitch;
     Uint32 *src = (Uint32 *) ((Uint8 *)s->pixels + srcrect->x * 4 + srcrect->y * src_pitch);
-    Uint32 *dst = (Uint32 *) ((Uint8 *)d->pixels + dstrect->x * 4 + dstrect->y * dst_pitch);
+    Uint32 *dst = (Uint32 *) ((Uint8 *)d->pixels + dstrect->x * 4 + (dstrect->y + band_y) * dst_pitch);
 
 #if defined(HAVE_NEON_INTRINSICS)
     if (ret == -1 && hasNEON()) {
-        ret = scale_mat_NEON(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch);
+        ret = scale_mat_NEON(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch, band_y, band_h);
     }
 #endif
 
 #if defined(HAVE_SSE2_INTRINSICS)
     if (ret == -1 && hasSSE2()) {
-        ret = scale_mat_SSE(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch);
+        ret = scale_mat_SSE(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch, band_y, band_h);
     }
 #endif
 
     if (ret == -1) {
-        ret = scale_mat(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch);
+        ret = scale_mat(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch, band_y, band_h);
     }
 
     return ret;
@@ -857,7 +898,7 @@ SDL_LowerSoftStretchLinear(SDL_Surface *s, const SDL_Rect *srcrect,
     incy = (src_h << 16) / dst_h;                                                       \
     incx = (src_w << 16) / dst_w;                                                       \
     dst_gap   = dst_pitch - bpp * dst_w;                                                \
-    posy = incy / 2;                                                                    \
+    posy = incy / 2 + (Uint32)band_y * incy;                                            \
 
 #define SDL_SCALE_NEAREST__HEIGHT                                                       \
     srcy = (posy >> 16);                                                                \
@@ -869,11 +910,11 @@ SDL_LowerSoftStretchLinear(SDL_Surface *s, const SDL_Rect *srcrect,
 
 static int
 scale_mat_nearest_1(const Uint32 *src_ptr, int src_w, int src_h, int src_pitch,
-        Uint32 *dst, int dst_w, int dst_h, int dst_pitch)
+        Uint32 *dst, int dst_w, int dst_h, int dst_pitch, int band_y, int band_h)
 {
     Uint32 bpp = 1;
     SDL_SCALE_NEAREST__START
-    for (i = 0; i < dst_h; i++) {
+    for (i = 0; i < band_h; i++) {
         SDL_SCALE_NEAREST__HEIGHT
         while (n--) {
             const Uint8 *src;
@@ -890,11 +931,11 @@ scale_mat_nearest_1(const Uint32 *src_ptr, int src_w, int src_h, int src_pitch,
 
 static int
 scale_mat_nearest_2(const Uint32 *src_ptr, int src_w, int src_h, int src_pitch,
-        Uint32 *dst, int dst_w, int dst_h, int dst_pitch)
+        Uint32 *dst, int dst_w, int dst_h, int dst_pitch, int band_y, int band_h)
 {
     Uint32 bpp = 2;
     SDL_SCALE_NEAREST__START
-    for (i = 0; i < dst_h; i++) {
+    for (i = 0; i < band_h; i++) {
         SDL_SCALE_NEAREST__HEIGHT
         while (n--) {
             const Uint16 *src;
@@ -911,11 +952,11 @@ scale_mat_nearest_2(const Uint32 *src_ptr, int src_w, int src_h, int src_pitch,
 
 static int
 scale_mat_nearest_3(const Uint32 *src_ptr, int src_w, int src_h, int src_pitch,
-        Uint32 *dst, int dst_w, int dst_h, int dst_pitch)
+        Uint32 *dst, int dst_w, int dst_h, int dst_pitch, int band_y, int band_h)
 {
     Uint32 bpp = 3;
     SDL_SCALE_NEAREST__START
-    for (i = 0; i < dst_h; i++) {
+    for (i = 0; i < band_h; i++) {
         SDL_SCALE_NEAREST__HEIGHT
         while (n--) {
             const Uint8 *src;
@@ -934,11 +975,11 @@ scale_mat_nearest_3(const Uint32 *src_ptr, int src_w, int src_h, int src_pitch,
 
 static int
 scale_mat_nearest_4(const Uint32 *src_ptr, int src_w, int src_h, int src_pitch,
-        Uint32 *dst, int dst_w, int dst_h, int dst_pitch)
+        Uint32 *dst, int dst_w, int dst_h, int dst_pitch, int band_y, int band_h)
 {
     Uint32 bpp = 4;
     SDL_SCALE_NEAREST__START
-    for (i = 0; i < dst_h; i++) {
+    for (i = 0; i < band_h; i++) {
         SDL_SCALE_NEAREST__HEIGHT
         while (n--) {
             const Uint32 *src;
@@ -955,7 +996,7 @@ scale_mat_nearest_4(const Uint32 *src_ptr, int src_w, int src_h, int src_pitch,
 
 int
 SDL_LowerSoftStretchNearest(SDL_Surface *s, const SDL_Rect *srcrect,
-                SDL_Surface *d, const SDL_Rect *dstrect)
+                SDL_Surface *d, const SDL_Rect *dstrect, int band_y, int band_h)
 {
     int src_w = srcrect->w;
     int src_h = srcrect->h;
@@ -967,16 +1008,16 @@ SDL_LowerSoftStretchNearest(SDL_Surface *s, const SDL_Rect *srcrect,
     const int bpp = d->format->BytesPerPixel;
 
     Uint32 *src = (Uint32 *) ((Uint8 *)s->pixels + srcrect->x * bpp + srcrect->y * src_pitch);
-    Uint32 *dst = (Uint32 *) ((Uint8 *)d->pixels + dstrect->x * bpp + dstrect->y * dst_pitch);
+    Uint32 *dst = (Uint32 *) ((Uint8 *)d->pixels + dstrect->x * bpp + (dstrect->y + band_y) * dst_pitch);
 
     if (bpp == 4) {
-        return scale_mat_nearest_4(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch);
+        return scale_mat_nearest_4(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch, band_y, band_h);
     } else if (bpp == 3) {
-        return scale_mat_nearest_3(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch);
+        return scale_mat_nearest_3(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch, band_y, band_h);
     } else if (bpp == 2) {
-        return scale_mat_nearest_2(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch);
+        return scale_mat_nearest_2(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch, band_y, band_h);
     } else {
-        return scale_mat_nearest_1(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch);
+        return scale_mat_nearest_1(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch, band_y, band_h);
     }
 }
 
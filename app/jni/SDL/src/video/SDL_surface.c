@@ -20,6 +20,7 @@
 */
 #include "../SDL_internal.h"
 
+#include "SDL_trace.h"
 #include "SDL_video.h"
 #include "SDL_sysvideo.h"
 #include "SDL_blit.h"
@@ -800,11 +801,15 @@ SDL_UpperBlit(SDL_Surface * src, const SDL_Rect * srcrect,
 
     if (w > 0 && h > 0) {
         SDL_Rect sr;
+        int retval;
         sr.x = srcx;
         sr.y = srcy;
         sr.w = dstrect->w = w;
         sr.h = dstrect->h = h;
-        return SDL_LowerBlit(src, &sr, dst, dstrect);
+        SDL_TRACE_ZONE_BEGIN("SDL_BlitSurface");
+        retval = SDL_LowerBlit(src, &sr, dst, dstrect);
+        SDL_TRACE_ZONE_END();
+        return retval;
     }
     dstrect->w = dstrect->h = 0;
     return 0;
@@ -1444,7 +1449,7 @@ SDL_CreateSurfaceOnStack(int width, int height, Uint32 pixel_format,
 /*
  * Copy a block of pixels of one format to another format
  */
-int SDL_ConvertPixels(int width, int height,
+static int SDL_ConvertPixelsInternal(int width, int height,
                       Uint32 src_format, const void * src, int src_pitch,
                       Uint32 dst_format, void * dst, int dst_pitch)
 {
@@ -1518,6 +1523,18 @@ int SDL_ConvertPixels(int width, int height,
     return ret;
 }
 
+int SDL_ConvertPixels(int width, int height,
+                      Uint32 src_format, const void * src, int src_pitch,
+                      Uint32 dst_format, void * dst, int dst_pitch)
+{
+    int retval;
+
+    SDL_TRACE_ZONE_BEGIN("SDL_ConvertPixels");
+    retval = SDL_ConvertPixelsInternal(width, height, src_format, src, src_pitch, dst_format, dst, dst_pitch);
+    SDL_TRACE_ZONE_END();
+    return retval;
+}
+
 /*
  * Premultiply the alpha on a block of pixels
  *
@@ -76,6 +76,23 @@ my %get_rgba_string = (
     "BGRA8888" => $get_rgba_string_ignore_alpha{"BGRA8888"} . " _A = (Uint8)_pixel;",
 );
 
+# Where R, G, B and A sit in memory, as byte offsets in a little endian pixel
+my %format_order = (
+    "RGB888" => "SDL_BLIT_AUTO_ORDER(2, 1, 0, SDL_BLIT_AUTO_NOALPHA)",
+    "BGR888" => "SDL_BLIT_AUTO_ORDER(0, 1, 2, SDL_BLIT_AUTO_NOALPHA)",
+    "ARGB8888" => "SDL_BLIT_AUTO_ORDER(2, 1, 0, 3)",
+    "RGBA8888" => "SDL_BLIT_AUTO_ORDER(3, 2, 1, 0)",
+    "ABGR8888" => "SDL_BLIT_AUTO_ORDER(0, 1, 2, 3)",
+    "BGRA8888" => "SDL_BLIT_AUTO_ORDER(1, 2, 3, 0)",
+);
+
+# The vector versions of each blitter, in order of preference
+my @simd_targets = (
+    [ "AVX2", "HAVE_AVX2_INTRINSICS", "SDL_CPU_AVX2" ],
+    [ "SSE41", "HAVE_SSE41_INTRINSICS", "SDL_CPU_SSE41" ],
+    [ "NEON", "HAVE_NEON_INTRINSICS", "SDL_CPU_NEON" ],
+);
+
 my %set_rgba_string = (
     "RGB888" => "_pixel = (_R << 16) | (_G << 8) | _B;",
     "BGR888" => "_pixel = (_B << 16) | (_G << 8) | _R;",
@@ -153,6 +170,7 @@ sub output_copyfuncname
     my $scale = shift;
     my $args = shift;
     my $suffix = shift;
+    my $target = shift;
 
     print FILE "$prefix SDL_Blit_${src}_${dst}";
     if ( $modulate ) {
@@ -164,6 +182,9 @@ sub output_copyfuncname
     if ( $scale ) {
         print FILE "_Scale";
     }
+    if ( $target ) {
+        print FILE "_$target";
+    }
     if ( $args ) {
         print FILE "(SDL_BlitInfo *info)";
     }
@@ -536,9 +557,9 @@ __EOF__
 
     print FILE <<__EOF__;
 
-    incy = (info->src_h << 16) / info->dst_h;
+    incy = (info->src_h << 16) / info->scale_h;
     incx = (info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + (Uint32)info->scale_y * incy;
 
     while (info->dst_h--) {
         $format_type{$src} *src = 0;
@@ -587,6 +608,625 @@ __EOF__
 __EOF__
 }
 
+sub output_simdcore
+{
+    print FILE <<'__EOF__';
+#if HAVE_SSE41_INTRINSICS || HAVE_AVX2_INTRINSICS || HAVE_NEON_INTRINSICS
+
+/*
+ * The vector blitters do the same integer math as the C ones above, exactly:
+ * x / 255 is worked out with a multiply and shifts that agree with the
+ * division for every value the blend can produce. Each generated wrapper
+ * passes in where the channels sit in its two formats and which of the C
+ * variant's quirks it has to reproduce.
+ */
+
+/* Byte offsets of R, G, B and A in a pixel as it is laid out in memory */
+#define SDL_BLIT_AUTO_ORDER(r, g, b, a) ((r) | ((g) << 4) | ((b) << 8) | ((a) << 12))
+#define SDL_BLIT_AUTO_NOALPHA       0xF
+
+#define SDL_BLIT_AUTO_MODULATE      0x01
+#define SDL_BLIT_AUTO_BLEND         0x02
+#define SDL_BLIT_AUTO_SCALE         0x04
+#define SDL_BLIT_AUTO_COPY          0x08    /* same format, every byte is copied */
+#define SDL_BLIT_AUTO_MUL_ALPHA_FF  0x10    /* SDL_COPY_MUL leaves the destination opaque */
+
+enum
+{
+    SDL_BLIT_AUTO_MODE_SRC,     /* the (modulated) source replaces the destination */
+    SDL_BLIT_AUTO_MODE_DST,     /* the destination is repacked as it is */
+    SDL_BLIT_AUTO_MODE_BLEND,
+    SDL_BLIT_AUTO_MODE_ADD,
+    SDL_BLIT_AUTO_MODE_MOD,
+    SDL_BLIT_AUTO_MODE_MUL
+};
+
+typedef struct
+{
+    Uint8 shuffle[16];      /* source bytes of 4 pixels in destination order, 0x80 for none */
+    Uint8 alpha[16];        /* spreads the alpha lane of 2 widened pixels over their other lanes */
+    Uint16 alpha_lane[8];   /* 0xFFFF in the alpha lane of 2 widened pixels */
+    Uint16 mul_alpha[8];    /* ORed into SDL_COPY_MUL results */
+    Uint16 modulate[8];     /* channel modulation of 2 widened pixels, 255 for none */
+    Uint32 fill;            /* ORed into the shuffled source: opaque alpha if it has none */
+    Uint32 mask;            /* the destination bits that get written */
+    SDL_bool modulated;
+    int mode;
+} SDL_BlitAutoSetup;
+
+static void
+SDL_SetupBlitAuto(const SDL_BlitInfo *info, int srcorder, int dstorder, int variant,
+                  SDL_BlitAutoSetup *setup)
+{
+    const int flags = info->flags;
+    const int src_a = (srcorder >> 12) & 0xF;
+    const int dst_r = dstorder & 0xF;
+    const int dst_g = (dstorder >> 4) & 0xF;
+    const int dst_b = (dstorder >> 8) & 0xF;
+    /* alpha, or the unused byte of formats without it */
+    const int dst_a = 6 - dst_r - dst_g - dst_b;
+    const SDL_bool dst_has_alpha = (((dstorder >> 12) & 0xF) != SDL_BLIT_AUTO_NOALPHA);
+    Uint16 modulate[4];
+    int i;
+
+    for (i = 0; i < 16; i += 4) {
+        Uint8 *shuffle = &setup->shuffle[i];
+        if (variant & SDL_BLIT_AUTO_COPY) {
+            shuffle[0] = (Uint8)i;
+            shuffle[1] = (Uint8)(i + 1);
+            shuffle[2] = (Uint8)(i + 2);
+            shuffle[3] = (Uint8)(i + 3);
+        } else {
+            shuffle[dst_r] = (Uint8)(i + (srcorder & 0xF));
+            shuffle[dst_g] = (Uint8)(i + ((srcorder >> 4) & 0xF));
+            shuffle[dst_b] = (Uint8)(i + ((srcorder >> 8) & 0xF));
+            shuffle[dst_a] = (src_a == SDL_BLIT_AUTO_NOALPHA) ? 0x80 : (Uint8)(i + src_a);
+        }
+    }
+    if (src_a == SDL_BLIT_AUTO_NOALPHA && !(variant & SDL_BLIT_AUTO_COPY)) {
+        setup->fill = 0xFFu << (dst_a * 8);
+    } else {
+        setup->fill = 0;
+    }
+    if (dst_has_alpha || (variant & SDL_BLIT_AUTO_COPY)) {
+        setup->mask = 0xFFFFFFFF;
+    } else {
+        setup->mask = ~(0xFFu << (dst_a * 8));
+    }
+
+    modulate[0] = modulate[1] = modulate[2] = modulate[3] = 255;
+    setup->modulated = SDL_FALSE;
+    if (variant & SDL_BLIT_AUTO_MODULATE) {
+        if (flags & SDL_COPY_MODULATE_COLOR) {
+            modulate[dst_r] = info->r;
+            modulate[dst_g] = info->g;
+            modulate[dst_b] = info->b;
+            setup->modulated = SDL_TRUE;
+        }
+        if (flags & SDL_COPY_MODULATE_ALPHA) {
+            modulate[dst_a] = info->a;
+            setup->modulated = SDL_TRUE;
+        }
+    }
+    for (i = 0; i < 8; ++i) {
+        const int pixel = i / 4;
+        const int lane = i % 4;
+        setup->alpha[i * 2] = (Uint8)(pixel * 8 + dst_a * 2);
+        setup->alpha[i * 2 + 1] = (Uint8)(pixel * 8 + dst_a * 2 + 1);
+        setup->alpha_lane[i] = (lane == dst_a) ? 0xFFFF : 0;
+        setup->mul_alpha[i] = (lane == dst_a && (variant & SDL_BLIT_AUTO_MUL_ALPHA_FF)) ? 0xFF : 0;
+        setup->modulate[i] = modulate[lane];
+    }
+
+    if (!(variant & SDL_BLIT_AUTO_BLEND)) {
+        setup->mode = SDL_BLIT_AUTO_MODE_SRC;
+    } else {
+        switch (flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL)) {
+        case SDL_COPY_BLEND:
+            setup->mode = SDL_BLIT_AUTO_MODE_BLEND;
+            break;
+        case SDL_COPY_ADD:
+            setup->mode = SDL_BLIT_AUTO_MODE_ADD;
+            break;
+        case SDL_COPY_MOD:
+            setup->mode = SDL_BLIT_AUTO_MODE_MOD;
+            break;
+        case SDL_COPY_MUL:
+            setup->mode = SDL_BLIT_AUTO_MODE_MUL;
+            break;
+        default:
+            setup->mode = SDL_BLIT_AUTO_MODE_DST;
+            break;
+        }
+    }
+}
+
+/* Runs PIXELS over the blit STEP pixels at a time. The source pixels are
+   read straight from the row, or picked out by GATHER when scaling, and the
+   last few pixels of a row go through zero-padded copies so the vector loads
+   and stores never leave the surfaces. */
+#define SDL_BLIT_AUTO_LOOP(STEP, LOAD, GATHER, STORE, PIXELS, MODE)                     \
+    {                                                                                   \
+        Uint32 srctail[STEP], dsttail[STEP];                                            \
+        Uint32 posy, posx;                                                              \
+        int incy, incx;                                                                 \
+        int width = info->dst_w;                                                        \
+        int height = info->dst_h;                                                       \
+        const Uint8 *srcrow = info->src;                                                \
+        Uint8 *dstrow = info->dst;                                                      \
+                                                                                        \
+        if (variant & SDL_BLIT_AUTO_SCALE) {                                            \
+            incy = (info->src_h << 16) / info->scale_h;                                 \
+            incx = (info->src_w << 16) / info->dst_w;                                   \
+        } else {                                                                        \
+            incy = incx = 1 << 16;                                                      \
+        }                                                                               \
+        posy = incy / 2 + (Uint32)info->scale_y * incy;                                 \
+        while (height--) {                                                              \
+            const Uint32 *src = (const Uint32 *)srcrow;                                 \
+            Uint32 *dst = (Uint32 *)dstrow;                                             \
+            int n = width;                                                              \
+            if (variant & SDL_BLIT_AUTO_SCALE) {                                        \
+                src = (const Uint32 *)(info->src + (posy >> 16) * info->src_pitch);     \
+            }                                                                           \
+            posx = incx / 2;                                                            \
+            while (n >= STEP) {                                                         \
+                if (variant & SDL_BLIT_AUTO_SCALE) {                                    \
+                    STORE(dst, PIXELS(&v, GATHER(src, posx, incx), LOAD(dst), MODE));   \
+                    posx += STEP * incx;                                                \
+                } else {                                                                \
+                    STORE(dst, PIXELS(&v, LOAD(src), LOAD(dst), MODE));                 \
+                    src += STEP;                                                        \
+                }                                                                       \
+                dst += STEP;                                                            \
+                n -= STEP;                                                              \
+            }                                                                           \
+            if (n) {                                                                    \
+                int i;                                                                  \
+                SDL_zeroa(srctail);                                                     \
+                SDL_zeroa(dsttail);                                                     \
+                for (i = 0; i < n; ++i) {                                               \
+                    if (variant & SDL_BLIT_AUTO_SCALE) {                                \
+                        srctail[i] = src[posx >> 16];                                   \
+                        posx += incx;                                                   \
+                    } else {                                                            \
+                        srctail[i] = src[i];                                            \
+                    }                                                                   \
+                    dsttail[i] = dst[i];                                                \
+                }                                                                       \
+                STORE(dsttail, PIXELS(&v, LOAD(srctail), LOAD(dsttail), MODE));         \
+                SDL_memcpy(dst, dsttail, n * sizeof(Uint32));                           \
+            }                                                                           \
+            if (variant & SDL_BLIT_AUTO_SCALE) {                                        \
+                posy += incy;                                                           \
+            } else {                                                                    \
+                srcrow += info->src_pitch;                                              \
+            }                                                                           \
+            dstrow += info->dst_pitch;                                                  \
+        }                                                                               \
+    }
+
+/* The SDL_BLIT_AUTO_MODE_* cases of the drivers below */
+#define SDL_BLIT_AUTO_MODES(STEP, LOAD, GATHER, STORE, PIXELS)                                  \
+    switch (setup.mode) {                                                                       \
+    case SDL_BLIT_AUTO_MODE_SRC:                                                                \
+        SDL_BLIT_AUTO_LOOP(STEP, LOAD, GATHER, STORE, PIXELS, SDL_BLIT_AUTO_MODE_SRC);          \
+        break;                                                                                  \
+    case SDL_BLIT_AUTO_MODE_DST:                                                                \
+        SDL_BLIT_AUTO_LOOP(STEP, LOAD, GATHER, STORE, PIXELS, SDL_BLIT_AUTO_MODE_DST);          \
+        break;                                                                                  \
+    case SDL_BLIT_AUTO_MODE_BLEND:                                                              \
+        SDL_BLIT_AUTO_LOOP(STEP, LOAD, GATHER, STORE, PIXELS, SDL_BLIT_AUTO_MODE_BLEND);        \
+        break;                                                                                  \
+    case SDL_BLIT_AUTO_MODE_ADD:                                                                \
+        SDL_BLIT_AUTO_LOOP(STEP, LOAD, GATHER, STORE, PIXELS, SDL_BLIT_AUTO_MODE_ADD);          \
+        break;                                                                                  \
+    case SDL_BLIT_AUTO_MODE_MOD:                                                                \
+        SDL_BLIT_AUTO_LOOP(STEP, LOAD, GATHER, STORE, PIXELS, SDL_BLIT_AUTO_MODE_MOD);          \
+        break;                                                                                  \
+    default:                                                                                    \
+        SDL_BLIT_AUTO_LOOP(STEP, LOAD, GATHER, STORE, PIXELS, SDL_BLIT_AUTO_MODE_MUL);          \
+        break;                                                                                  \
+    }
+
+#endif /* HAVE_SSE41_INTRINSICS || HAVE_AVX2_INTRINSICS || HAVE_NEON_INTRINSICS */
+
+#if HAVE_SSE41_INTRINSICS
+
+typedef struct
+{
+    __m128i shuffle, alpha, alpha_lane, mul_alpha, modulate, fill, mask;
+    SDL_bool modulated;
+} SDL_BlitAutoVectors_SSE41;
+
+SDL_FORCE_INLINE __m128i SDL_TARGETING_SSE41
+SDL_BlitAutoLoad_SSE41(const Uint32 *p)
+{
+    return _mm_loadu_si128((const __m128i *)p);
+}
+
+/* The pixels at posx, posx + incx, ... in 16.16 fixed point */
+SDL_FORCE_INLINE __m128i SDL_TARGETING_SSE41
+SDL_BlitAutoGather_SSE41(const Uint32 *src, Uint32 posx, int incx)
+{
+    return _mm_setr_epi32((int)src[posx >> 16], (int)src[(posx + incx) >> 16],
+                          (int)src[(posx + 2 * incx) >> 16], (int)src[(posx + 3 * incx) >> 16]);
+}
+
+SDL_FORCE_INLINE void SDL_TARGETING_SSE41
+SDL_BlitAutoStore_SSE41(Uint32 *p, __m128i x)
+{
+    _mm_storeu_si128((__m128i *)p, x);
+}
+
+/* x / 255, exact for any 16-bit x */
+SDL_FORCE_INLINE __m128i SDL_TARGETING_SSE41
+SDL_BlitAutoDiv255_SSE41(__m128i x)
+{
+    return _mm_srli_epi16(_mm_mulhi_epu16(x, _mm_set1_epi16((short)0x8081)), 7);
+}
+
+/* Two pixels, one channel per 16-bit lane */
+SDL_FORCE_INLINE __m128i SDL_TARGETING_SSE41
+SDL_BlitAutoBlend_SSE41(const SDL_BlitAutoVectors_SSE41 *v, __m128i s, __m128i d, int mode)
+{
+    __m128i a, inv, premul;
+
+    if (v->modulated) {
+        s = SDL_BlitAutoDiv255_SSE41(_mm_mullo_epi16(s, v->modulate));
+    }
+    if (mode == SDL_BLIT_AUTO_MODE_SRC) {
+        return s;
+    } else if (mode == SDL_BLIT_AUTO_MODE_DST) {
+        return d;
+    }
+    a = _mm_shuffle_epi8(s, v->alpha);
+    inv = _mm_xor_si128(a, _mm_set1_epi16(0xFF));
+    switch (mode) {
+    case SDL_BLIT_AUTO_MODE_BLEND:
+        premul = _mm_blendv_epi8(SDL_BlitAutoDiv255_SSE41(_mm_mullo_epi16(s, a)), s, v->alpha_lane);
+        return _mm_add_epi16(premul, SDL_BlitAutoDiv255_SSE41(_mm_mullo_epi16(inv, d)));
+    case SDL_BLIT_AUTO_MODE_ADD:
+        premul = _mm_blendv_epi8(SDL_BlitAutoDiv255_SSE41(_mm_mullo_epi16(s, a)), s, v->alpha_lane);
+        return _mm_blendv_epi8(_mm_min_epu16(_mm_add_epi16(premul, d), _mm_set1_epi16(255)), d, v->alpha_lane);
+    case SDL_BLIT_AUTO_MODE_MOD:
+        return _mm_blendv_epi8(SDL_BlitAutoDiv255_SSE41(_mm_mullo_epi16(s, d)), d, v->alpha_lane);
+    default:
+        /* the sum can overflow 16 bits, but anything past 255 * 255 + 254 ends up as 255 */
+        s = _mm_adds_epu16(_mm_mullo_epi16(s, d), _mm_mullo_epi16(d, inv));
+        s = _mm_min_epu16(s, _mm_set1_epi16((short)(255 * 255 + 254)));
+        return _mm_or_si128(SDL_BlitAutoDiv255_SSE41(s), v->mul_alpha);
+    }
+}
+
+SDL_FORCE_INLINE __m128i SDL_TARGETING_SSE41
+SDL_BlitAutoPixels_SSE41(const SDL_BlitAutoVectors_SSE41 *v, __m128i s, __m128i d, int mode)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i lo, hi;
+
+    s = _mm_or_si128(_mm_shuffle_epi8(s, v->shuffle), v->fill);
+    if (mode == SDL_BLIT_AUTO_MODE_SRC && !v->modulated) {
+        return _mm_and_si128(s, v->mask);
+    }
+    lo = SDL_BlitAutoBlend_SSE41(v, _mm_unpacklo_epi8(s, zero), _mm_unpacklo_epi8(d, zero), mode);
+    hi = SDL_BlitAutoBlend_SSE41(v, _mm_unpackhi_epi8(s, zero), _mm_unpackhi_epi8(d, zero), mode);
+    return _mm_and_si128(_mm_packus_epi16(lo, hi), v->mask);
+}
+
+static void SDL_TARGETING_SSE41
+SDL_Blit_Auto_SSE41(SDL_BlitInfo *info, int srcorder, int dstorder, int variant)
+{
+    SDL_BlitAutoSetup setup;
+    SDL_BlitAutoVectors_SSE41 v;
+
+    SDL_SetupBlitAuto(info, srcorder, dstorder, variant, &setup);
+    v.shuffle = _mm_loadu_si128((const __m128i *)setup.shuffle);
+    v.alpha = _mm_loadu_si128((const __m128i *)setup.alpha);
+    v.alpha_lane = _mm_loadu_si128((const __m128i *)setup.alpha_lane);
+    v.mul_alpha = _mm_loadu_si128((const __m128i *)setup.mul_alpha);
+    v.modulate = _mm_loadu_si128((const __m128i *)setup.modulate);
+    v.fill = _mm_set1_epi32((int)setup.fill);
+    v.mask = _mm_set1_epi32((int)setup.mask);
+    v.modulated = setup.modulated;
+
+    SDL_BLIT_AUTO_MODES(4, SDL_BlitAutoLoad_SSE41, SDL_BlitAutoGather_SSE41, SDL_BlitAutoStore_SSE41, SDL_BlitAutoPixels_SSE41);
+}
+
+#endif /* HAVE_SSE41_INTRINSICS */
+
+#if HAVE_AVX2_INTRINSICS
+
+typedef struct
+{
+    __m256i shuffle, alpha, alpha_lane, mul_alpha, modulate, fill, mask;
+    SDL_bool modulated;
+} SDL_BlitAutoVectors_AVX2;
+
+SDL_FORCE_INLINE __m256i SDL_TARGETING_AVX2
+SDL_BlitAutoLoad_AVX2(const Uint32 *p)
+{
+    return _mm256_loadu_si256((const __m256i *)p);
+}
+
+/* The pixels at posx, posx + incx, ... in 16.16 fixed point */
+SDL_FORCE_INLINE __m256i SDL_TARGETING_AVX2
+SDL_BlitAutoGather_AVX2(const Uint32 *src, Uint32 posx, int incx)
+{
+    return _mm256_setr_epi32((int)src[posx >> 16], (int)src[(posx + incx) >> 16],
+                             (int)src[(posx + 2 * incx) >> 16], (int)src[(posx + 3 * incx) >> 16],
+                             (int)src[(posx + 4 * incx) >> 16], (int)src[(posx + 5 * incx) >> 16],
+                             (int)src[(posx + 6 * incx) >> 16], (int)src[(posx + 7 * incx) >> 16]);
+}
+
+SDL_FORCE_INLINE void SDL_TARGETING_AVX2
+SDL_BlitAutoStore_AVX2(Uint32 *p, __m256i x)
+{
+    _mm256_storeu_si256((__m256i *)p, x);
+}
+
+/* x / 255, exact for any 16-bit x */
+SDL_FORCE_INLINE __m256i SDL_TARGETING_AVX2
+SDL_BlitAutoDiv255_AVX2(__m256i x)
+{
+    return _mm256_srli_epi16(_mm256_mulhi_epu16(x, _mm256_set1_epi16((short)0x8081)), 7);
+}
+
+/* Two pixels per 128-bit lane, one channel per 16-bit lane */
+SDL_FORCE_INLINE __m256i SDL_TARGETING_AVX2
+SDL_BlitAutoBlend_AVX2(const SDL_BlitAutoVectors_AVX2 *v, __m256i s, __m256i d, int mode)
+{
+    __m256i a, inv, premul;
+
+    if (v->modulated) {
+        s = SDL_BlitAutoDiv255_AVX2(_mm256_mullo_epi16(s, v->modulate));
+    }
+    if (mode == SDL_BLIT_AUTO_MODE_SRC) {
+        return s;
+    } else if (mode == SDL_BLIT_AUTO_MODE_DST) {
+        return d;
+    }
+    a = _mm256_shuffle_epi8(s, v->alpha);
+    inv = _mm256_xor_si256(a, _mm256_set1_epi16(0xFF));
+    switch (mode) {
+    case SDL_BLIT_AUTO_MODE_BLEND:
+        premul = _mm256_blendv_epi8(SDL_BlitAutoDiv255_AVX2(_mm256_mullo_epi16(s, a)), s, v->alpha_lane);
+        return _mm256_add_epi16(premul, SDL_BlitAutoDiv255_AVX2(_mm256_mullo_epi16(inv, d)));
+    case SDL_BLIT_AUTO_MODE_ADD:
+        premul = _mm256_blendv_epi8(SDL_BlitAutoDiv255_AVX2(_mm256_mullo_epi16(s, a)), s, v->alpha_lane);
+        return _mm256_blendv_epi8(_mm256_min_epu16(_mm256_add_epi16(premul, d), _mm256_set1_epi16(255)), d, v->alpha_lane);
+    case SDL_BLIT_AUTO_MODE_MOD:
+        return _mm256_blendv_epi8(SDL_BlitAutoDiv255_AVX2(_mm256_mullo_epi16(s, d)), d, v->alpha_lane);
+    default:
+        /* the sum can overflow 16 bits, but anything past 255 * 255 + 254 ends up as 255 */
+        s = _mm256_adds_epu16(_mm256_mullo_epi16(s, d), _mm256_mullo_epi16(d, inv));
+        s = _mm256_min_epu16(s, _mm256_set1_epi16((short)(255 * 255 + 254)));
+        return _mm256_or_si256(SDL_BlitAutoDiv255_AVX2(s), v->mul_alpha);
+    }
+}
+
+SDL_FORCE_INLINE __m256i SDL_TARGETING_AVX2
+SDL_BlitAutoPixels_AVX2(const SDL_BlitAutoVectors_AVX2 *v, __m256i s, __m256i d, int mode)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    __m256i lo, hi;
+
+    s = _mm256_or_si256(_mm256_shuffle_epi8(s, v->shuffle), v->fill);
+    if (mode == SDL_BLIT_AUTO_MODE_SRC && !v->modulated) {
+        return _mm256_and_si256(s, v->mask);
+    }
+    lo = SDL_BlitAutoBlend_AVX2(v, _mm256_unpacklo_epi8(s, zero), _mm256_unpacklo_epi8(d, zero), mode);
+    hi = SDL_BlitAutoBlend_AVX2(v, _mm256_unpackhi_epi8(s, zero), _mm256_unpackhi_epi8(d, zero), mode);
+    return _mm256_and_si256(_mm256_packus_epi16(lo, hi), v->mask);
+}
+
+static void SDL_TARGETING_AVX2
+SDL_Blit_Auto_AVX2(SDL_BlitInfo *info, int srcorder, int dstorder, int variant)
+{
+    SDL_BlitAutoSetup setup;
+    SDL_BlitAutoVectors_AVX2 v;
+
+    SDL_SetupBlitAuto(info, srcorder, dstorder, variant, &setup);
+    /* the shuffles stay within 128-bit lanes, so each lane gets the same controls */
+    v.shuffle = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)setup.shuffle));
+    v.alpha = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)setup.alpha));
+    v.alpha_lane = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)setup.alpha_lane));
+    v.mul_alpha = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)setup.mul_alpha));
+    v.modulate = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)setup.modulate));
+    v.fill = _mm256_set1_epi32((int)setup.fill);
+    v.mask = _mm256_set1_epi32((int)setup.mask);
+    v.modulated = setup.modulated;
+
+    SDL_BLIT_AUTO_MODES(8, SDL_BlitAutoLoad_AVX2, SDL_BlitAutoGather_AVX2, SDL_BlitAutoStore_AVX2, SDL_BlitAutoPixels_AVX2);
+}
+
+#endif /* HAVE_AVX2_INTRINSICS */
+
+#if HAVE_NEON_INTRINSICS
+
+typedef struct
+{
+    uint8x8_t shuffle_lo, shuffle_hi, alpha_lo, alpha_hi;
+    uint16x8_t alpha_lane, mul_alpha, modulate;
+    uint8x16_t fill, mask;
+    SDL_bool modulated;
+} SDL_BlitAutoVectors_NEON;
+
+SDL_FORCE_INLINE uint8x16_t
+SDL_BlitAutoLoad_NEON(const Uint32 *p)
+{
+    return vld1q_u8((const Uint8 *)p);
+}
+
+/* The pixels at posx, posx + incx, ... in 16.16 fixed point */
+SDL_FORCE_INLINE uint8x16_t
+SDL_BlitAutoGather_NEON(const Uint32 *src, Uint32 posx, int incx)
+{
+    uint32x4_t x = vdupq_n_u32(src[posx >> 16]);
+    x = vld1q_lane_u32(&src[(posx + incx) >> 16], x, 1);
+    x = vld1q_lane_u32(&src[(posx + 2 * incx) >> 16], x, 2);
+    x = vld1q_lane_u32(&src[(posx + 3 * incx) >> 16], x, 3);
+    return vreinterpretq_u8_u32(x);
+}
+
+SDL_FORCE_INLINE void
+SDL_BlitAutoStore_NEON(Uint32 *p, uint8x16_t x)
+{
+    vst1q_u8((Uint8 *)p, x);
+}
+
+/* x / 255, exact for x up to 255 * 255 + 254 */
+SDL_FORCE_INLINE uint16x8_t
+SDL_BlitAutoDiv255_NEON(uint16x8_t x)
+{
+    return vshrq_n_u16(vaddq_u16(vaddq_u16(x, vshrq_n_u16(x, 8)), vdupq_n_u16(1)), 8);
+}
+
+/* Picks bytes out of x, or zero for indices past the end */
+SDL_FORCE_INLINE uint8x16_t
+SDL_BlitAutoShuffle_NEON(uint8x16_t x, uint8x8_t lo, uint8x8_t hi)
+{
+    uint8x8x2_t table;
+
+    table.val[0] = vget_low_u8(x);
+    table.val[1] = vget_high_u8(x);
+    return vcombine_u8(vtbl2_u8(table, lo), vtbl2_u8(table, hi));
+}
+
+/* Two pixels, one channel per 16-bit lane */
+SDL_FORCE_INLINE uint16x8_t
+SDL_BlitAutoBlend_NEON(const SDL_BlitAutoVectors_NEON *v, uint16x8_t s, uint16x8_t d, int mode)
+{
+    uint16x8_t a, inv, premul;
+
+    if (v->modulated) {
+        s = SDL_BlitAutoDiv255_NEON(vmulq_u16(s, v->modulate));
+    }
+    if (mode == SDL_BLIT_AUTO_MODE_SRC) {
+        return s;
+    } else if (mode == SDL_BLIT_AUTO_MODE_DST) {
+        return d;
+    }
+    a = vreinterpretq_u16_u8(SDL_BlitAutoShuffle_NEON(vreinterpretq_u8_u16(s), v->alpha_lo, v->alpha_hi));
+    inv = veorq_u16(a, vdupq_n_u16(0xFF));
+    switch (mode) {
+    case SDL_BLIT_AUTO_MODE_BLEND:
+        premul = vbslq_u16(v->alpha_lane, s, SDL_BlitAutoDiv255_NEON(vmulq_u16(s, a)));
+        return vaddq_u16(premul, SDL_BlitAutoDiv255_NEON(vmulq_u16(inv, d)));
+    case SDL_BLIT_AUTO_MODE_ADD:
+        premul = vbslq_u16(v->alpha_lane, s, SDL_BlitAutoDiv255_NEON(vmulq_u16(s, a)));
+        return vbslq_u16(v->alpha_lane, d, vminq_u16(vaddq_u16(premul, d), vdupq_n_u16(255)));
+    case SDL_BLIT_AUTO_MODE_MOD:
+        return vbslq_u16(v->alpha_lane, d, SDL_BlitAutoDiv255_NEON(vmulq_u16(s, d)));
+    default:
+        /* the sum can overflow 16 bits, but anything past 255 * 255 + 254 ends up as 255 */
+        s = vqaddq_u16(vmulq_u16(s, d), vmulq_u16(d, inv));
+        s = vminq_u16(s, vdupq_n_u16(255 * 255 + 254));
+        return vorrq_u16(SDL_BlitAutoDiv255_NEON(s), v->mul_alpha);
+    }
+}
+
+SDL_FORCE_INLINE uint8x16_t
+SDL_BlitAutoPixels_NEON(const SDL_BlitAutoVectors_NEON *v, uint8x16_t s, uint8x16_t d, int mode)
+{
+    uint16x8_t lo, hi;
+
+    s = vorrq_u8(SDL_BlitAutoShuffle_NEON(s, v->shuffle_lo, v->shuffle_hi), v->fill);
+    if (mode == SDL_BLIT_AUTO_MODE_SRC && !v->modulated) {
+        return vandq_u8(s, v->mask);
+    }
+    lo = SDL_BlitAutoBlend_NEON(v, vmovl_u8(vget_low_u8(s)), vmovl_u8(vget_low_u8(d)), mode);
+    hi = SDL_BlitAutoBlend_NEON(v, vmovl_u8(vget_high_u8(s)), vmovl_u8(vget_high_u8(d)), mode);
+    return vandq_u8(vcombine_u8(vmovn_u16(lo), vmovn_u16(hi)), v->mask);
+}
+
+static void
+SDL_Blit_Auto_NEON(SDL_BlitInfo *info, int srcorder, int dstorder, int variant)
+{
+    SDL_BlitAutoSetup setup;
+    SDL_BlitAutoVectors_NEON v;
+
+    SDL_SetupBlitAuto(info, srcorder, dstorder, variant, &setup);
+    v.shuffle_lo = vld1_u8(&setup.shuffle[0]);
+    v.shuffle_hi = vld1_u8(&setup.shuffle[8]);
+    v.alpha_lo = vld1_u8(&setup.alpha[0]);
+    v.alpha_hi = vld1_u8(&setup.alpha[8]);
+    v.alpha_lane = vld1q_u16(setup.alpha_lane);
+    v.mul_alpha = vld1q_u16(setup.mul_alpha);
+    v.modulate = vld1q_u16(setup.modulate);
+    v.fill = vreinterpretq_u8_u32(vdupq_n_u32(setup.fill));
+    v.mask = vreinterpretq_u8_u32(vdupq_n_u32(setup.mask));
+    v.modulated = setup.modulated;
+
+    SDL_BLIT_AUTO_MODES(4, SDL_BlitAutoLoad_NEON, SDL_BlitAutoGather_NEON, SDL_BlitAutoStore_NEON, SDL_BlitAutoPixels_NEON);
+}
+
+#endif /* HAVE_NEON_INTRINSICS */
+
+__EOF__
+}
+
+sub output_simdfunc
+{
+    my $src = shift;
+    my $dst = shift;
+    my $modulate = shift;
+    my $blend = shift;
+    my $scale = shift;
+    my $target = shift;
+
+    my $src_has_alpha = ($src =~ /A/) ? 1 : 0;
+    my @variant = ();
+
+    if ( $modulate ) {
+        push(@variant, "SDL_BLIT_AUTO_MODULATE");
+    }
+    if ( $blend ) {
+        push(@variant, "SDL_BLIT_AUTO_BLEND");
+    }
+    if ( $scale ) {
+        push(@variant, "SDL_BLIT_AUTO_SCALE");
+    }
+    if ( !$modulate && !$blend && $src eq $dst ) {
+        push(@variant, "SDL_BLIT_AUTO_COPY");
+    }
+    # The same case as $A_is_const_FF in output_copyfunc()
+    if ( $blend && !$modulate && !$src_has_alpha ) {
+        push(@variant, "SDL_BLIT_AUTO_MUL_ALPHA_FF");
+    }
+    my $variant = join(" | ", @variant);
+
+    output_copyfuncname("static void", $src, $dst, $modulate, $blend, $scale, 1, "\n", $target);
+    print FILE <<__EOF__;
+{
+    SDL_Blit_Auto_${target}(info, $format_order{$src}, $format_order{$dst}, $variant);
+}
+
+__EOF__
+}
+
+sub output_simdfunc_c
+{
+    foreach my $simd (@simd_targets) {
+        my ($target, $have) = @$simd;
+        print FILE "#if $have\n\n";
+        for (my $i = 0; $i <= $#src_formats; ++$i) {
+            for (my $j = 0; $j <= $#dst_formats; ++$j) {
+                for (my $modulate = 0; $modulate <= 1; ++$modulate) {
+                    for (my $blend = 0; $blend <= 1; ++$blend) {
+                        for (my $scale = 0; $scale <= 1; ++$scale) {
+                            if ( $modulate || $blend || $scale ) {
+                                output_simdfunc($src_formats[$i], $dst_formats[$j], $modulate, $blend, $scale, $target);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+        print FILE "#endif /* $have */\n\n";
+    }
+}
+
 sub output_copyfunc_h
 {
 }
@@ -614,7 +1254,6 @@ __EOF__
                 for (my $blend = 0; $blend <= 1; ++$blend) {
                     for (my $scale = 0; $scale <= 1; ++$scale) {
                         if ( $modulate || $blend || $scale ) {
-                            print FILE "    { SDL_PIXELFORMAT_$src, SDL_PIXELFORMAT_$dst, ";
                             my $flags = "";
                             my $flag = "";
                             if ( $modulate ) {
@@ -644,6 +1283,14 @@ __EOF__
                             if ( $flags eq "" ) {
                                 $flags = "0";
                             }
+                            foreach my $simd (@simd_targets) {
+                                my ($target, $have, $cpu) = @$simd;
+                                print FILE "#if $have\n";
+                                print FILE "    { SDL_PIXELFORMAT_$src, SDL_PIXELFORMAT_$dst, ($flags), $cpu,";
+                                output_copyfuncname("", $src_formats[$i], $dst_formats[$j], $modulate, $blend, $scale, 0, " },\n", $target);
+                                print FILE "#endif\n";
+                            }
+                            print FILE "    { SDL_PIXELFORMAT_$src, SDL_PIXELFORMAT_$dst, ";
                             print FILE "($flags), SDL_CPU_ANY,";
                             output_copyfuncname("", $src_formats[$i], $dst_formats[$j], $modulate, $blend, $scale, 0, " },\n");
                         }
@@ -692,5 +1339,7 @@ for (my $i = 0; $i <= $#src_formats; ++$i) {
         output_copyfunc_c($src_formats[$i], $dst_formats[$j]);
     }
 }
+output_simdcore();
+output_simdfunc_c();
 output_copyfunctable();
 close_file("SDL_blit_auto.c");
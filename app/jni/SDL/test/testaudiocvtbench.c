@@ -0,0 +1,204 @@
+/*
+  Copyright (C) 1997-2023 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Microbenchmark of SDL_ConvertAudio between every pair of sample formats,
+   in stereo, and of channel conversions, including the ones the fused S16
+   to float filters cover.  The rate stays the same, so only the format and channel filters
+   run.  Prints the best time of several runs of each, in nanoseconds per
+   source sample.
+
+   SDL uses the widest converters the CPU has (AVX2, SSE2, NEON or plain C).
+
+   Usage: testaudiocvtbench [frames] [runs]
+ */
+
+#include <stdlib.h>
+
+#include "SDL.h"
+
+#define DEFAULT_FRAMES  4096
+#define DEFAULT_RUNS    200
+
+static const struct
+{
+    SDL_AudioFormat format;
+    const char *name;
+} formats[] = {
+    { AUDIO_S8, "S8" },
+    { AUDIO_U8, "U8" },
+    { AUDIO_S16LSB, "S16LSB" },
+    { AUDIO_S16MSB, "S16MSB" },
+    { AUDIO_U16LSB, "U16LSB" },
+    { AUDIO_U16MSB, "U16MSB" },
+    { AUDIO_S32LSB, "S32LSB" },
+    { AUDIO_S32MSB, "S32MSB" },
+    { AUDIO_F32LSB, "F32LSB" },
+    { AUDIO_F32MSB, "F32MSB" }
+};
+
+static const struct
+{
+    Uint8 src_channels;
+    Uint8 dst_channels;
+} layouts[] = {
+    { 2, 1 },
+    { 1, 2 },
+    { 6, 2 },
+    { 2, 6 }
+};
+
+static int frames = DEFAULT_FRAMES;
+static int runs = DEFAULT_RUNS;
+static Uint8 *source;
+static Uint8 *buffer;
+
+static SDL_bool
+Bench(SDL_AudioFormat src_format, Uint8 src_channels, SDL_AudioFormat dst_format, Uint8 dst_channels, double *result)
+{
+    SDL_AudioCVT cvt;
+    const int len = frames * src_channels * (SDL_AUDIO_BITSIZE(src_format) / 8);
+    const Uint8 *samples = source;
+    Uint64 best = ~(Uint64)0;
+    int i;
+
+    if (SDL_BuildAudioCVT(&cvt, src_format, src_channels, 48000, dst_format, dst_channels, 48000) < 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't build converter: %s\n", SDL_GetError());
+        return SDL_FALSE;
+    }
+    cvt.buf = buffer;
+    if (SDL_AUDIO_ISFLOAT(src_format) && src_format != AUDIO_F32SYS) {
+        samples += frames * 8 * sizeof(float);
+    }
+
+    for (i = 0; i < runs; ++i) {
+        Uint64 start, elapsed;
+
+        /* Random samples, since float input out of range takes other paths */
+        SDL_memcpy(buffer, samples, len);
+        cvt.len = len;
+        start = SDL_GetPerformanceCounter();
+        if (SDL_ConvertAudio(&cvt) < 0) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't convert: %s\n", SDL_GetError());
+            return SDL_FALSE;
+        }
+        elapsed = SDL_GetPerformanceCounter() - start;
+        best = SDL_min(best, elapsed);
+    }
+
+    *result = (double)best * 1e9 / SDL_GetPerformanceFrequency() / ((double)frames * src_channels);
+    return SDL_TRUE;
+}
+
+static void
+FillSource(void)
+{
+    /* Floats from -1 to 1, native and byte swapped; integer formats take any bits */
+    float *samples = (float *)source;
+    float *swapped = (float *)(source + frames * 8 * sizeof(float));
+    int i;
+
+    for (i = 0; i < frames * 8; ++i) {
+        samples[i] = ((float)(rand() % 65536) / 32768.0f) - 1.0f;
+        swapped[i] = SDL_SwapFloat(samples[i]);
+    }
+}
+
+int
+main(int argc, char *argv[])
+{
+    SDL_bool ok = SDL_TRUE;
+    double result;
+    int i, j;
+
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    if (argc > 1) {
+        frames = SDL_max(SDL_atoi(argv[1]), 1);
+    }
+    if (argc > 2) {
+        runs = SDL_max(SDL_atoi(argv[2]), 1);
+    }
+
+    if (SDL_Init(0) < 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return 1;
+    }
+
+    /* Enough for six channels of 32-bit samples, grown up to eight times by
+       the conversion, and a byte swapped copy for the big endian floats */
+    source = (Uint8 *)SDL_malloc((size_t)frames * 8 * sizeof(float) * 2);
+    buffer = (Uint8 *)SDL_malloc((size_t)frames * 6 * sizeof(float) * 8);
+    if (!source || !buffer) {
+        SDL_OutOfMemory();
+        return 1;
+    }
+    FillSource();
+
+    SDL_Log("%d frames, best of %d runs, ns per source sample\n", frames, runs);
+    SDL_Log("AVX2 %d, SSE2 %d, NEON %d\n", SDL_HasAVX2(), SDL_HasSSE2(), SDL_HasNEON());
+
+    SDL_Log("Stereo, from row to column:\n");
+    {
+        char line[256];
+        int pos;
+
+        pos = SDL_snprintf(line, sizeof(line), "%-8s", "");
+        for (j = 0; j < SDL_arraysize(formats); ++j) {
+            pos += SDL_snprintf(line + pos, sizeof(line) - pos, "%7s", formats[j].name);
+        }
+        SDL_Log("%s\n", line);
+
+        for (i = 0; i < SDL_arraysize(formats); ++i) {
+            pos = SDL_snprintf(line, sizeof(line), "%-8s", formats[i].name);
+            for (j = 0; j < SDL_arraysize(formats); ++j) {
+                if (i == j) {
+                    pos += SDL_snprintf(line + pos, sizeof(line) - pos, "%7s", "-");
+                } else if (Bench(formats[i].format, 2, formats[j].format, 2, &result)) {
+                    pos += SDL_snprintf(line + pos, sizeof(line) - pos, "%7.3f", result);
+                } else {
+                    pos += SDL_snprintf(line + pos, sizeof(line) - pos, "%7s", "error");
+                    ok = SDL_FALSE;
+                }
+            }
+            SDL_Log("%s\n", line);
+        }
+    }
+
+    SDL_Log("Channel conversions:\n");
+    for (i = 0; i < SDL_arraysize(layouts); ++i) {
+        static const SDL_AudioFormat pairs[][2] = {
+            { AUDIO_S16SYS, AUDIO_F32SYS },
+            { AUDIO_S16SYS, AUDIO_S16SYS },
+            { AUDIO_F32SYS, AUDIO_F32SYS }
+        };
+
+        for (j = 0; j < SDL_arraysize(pairs); ++j) {
+            const Uint8 src_channels = layouts[i].src_channels;
+            const Uint8 dst_channels = layouts[i].dst_channels;
+
+            if (Bench(pairs[j][0], src_channels, pairs[j][1], dst_channels, &result)) {
+                SDL_Log("%-4s %d -> %-4s %d: %7.3f\n",
+                        SDL_AUDIO_ISFLOAT(pairs[j][0]) ? "F32" : "S16", (int)src_channels,
+                        SDL_AUDIO_ISFLOAT(pairs[j][1]) ? "F32" : "S16", (int)dst_channels, result);
+            } else {
+                ok = SDL_FALSE;
+            }
+        }
+    }
+
+    SDL_free(buffer);
+    SDL_free(source);
+    SDL_Quit();
+    return ok ? 0 : 1;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
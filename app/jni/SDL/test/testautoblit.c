@@ -0,0 +1,416 @@
+/*
+  Copyright (C) 1997-2023 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Checks that the SIMD versions of the generated blitters in SDL_blit_auto.c
+   produce exactly what the C versions do.
+
+   Every pair of formats the generated blitters handle is blitted with every
+   blend mode, with and without color and alpha modulation, unscaled and
+   scaled, at random sizes and pitches, and each case's destination pixels
+   are digested.  Then for every pair and blend mode an exhaustive sweep
+   blits a 4096x4096 surface holding every combination of source alpha,
+   source channel and destination channel.
+
+   SDL reads SDL_BLIT_CPU_FEATURES once per process, so record the digests
+   with the C blitters and compare them in a second run:
+
+     SDL_BLIT_CPU_FEATURES=0 testautoblit --record blits.txt
+     testautoblit --compare blits.txt
+     SDL_BLIT_CPU_FEATURES=64 testautoblit --compare blits.txt   (SSE4.1 only)
+
+   Plain alpha blending without modulation is done by SDL_blit_A.c, which
+   testblitalpha checks more thoroughly.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "SDL.h"
+
+#define TRIALS      8
+#define SWEEP_SIZE  4096
+#define MAX_REPORTS 20
+
+static const Uint32 src_formats[] = {
+    SDL_PIXELFORMAT_RGB888,
+    SDL_PIXELFORMAT_BGR888,
+    SDL_PIXELFORMAT_ARGB8888,
+    SDL_PIXELFORMAT_RGBA8888,
+    SDL_PIXELFORMAT_ABGR8888,
+    SDL_PIXELFORMAT_BGRA8888
+};
+
+static const Uint32 dst_formats[] = {
+    SDL_PIXELFORMAT_RGB888,
+    SDL_PIXELFORMAT_BGR888,
+    SDL_PIXELFORMAT_ARGB8888
+};
+
+static const SDL_BlendMode blend_modes[] = {
+    SDL_BLENDMODE_NONE,
+    SDL_BLENDMODE_BLEND,
+    SDL_BLENDMODE_ADD,
+    SDL_BLENDMODE_MOD,
+    SDL_BLENDMODE_MUL
+};
+
+static const char *blend_names[] = { "none", "blend", "add", "mod", "mul" };
+
+/* Color and alpha modulation: none, color only, alpha only, both */
+static const Uint8 modulations[][4] = {
+    { 255, 255, 255, 255 },
+    { 128, 192, 64, 255 },
+    { 255, 255, 255, 96 },
+    { 77, 254, 1, 200 }
+};
+
+static Uint32 seed = 12345;
+
+static FILE *record_file;
+static char **expected;
+static int num_expected;
+static int num_cases;
+static int failures;
+
+static Uint32
+Random(void)
+{
+    seed = seed * 1664525u + 1013904223u;
+    return seed >> 8;
+}
+
+/* Mostly random bytes, with plenty of the 0 and 255 edge cases */
+static Uint8
+RandomByte(void)
+{
+    Uint32 r = Random();
+
+    switch ((r >> 8) % 6) {
+    case 0:
+        return 0;
+    case 1:
+        return 255;
+    default:
+        return (Uint8)r;
+    }
+}
+
+static Uint64
+Digest(Uint64 hash, const void *data, size_t len)
+{
+    const Uint32 *words = (const Uint32 *)data;
+    size_t i;
+
+    for (i = 0; i < len / 4; ++i) {
+        hash = (hash ^ words[i]) * 0x100000001B3ULL;
+    }
+    return hash;
+}
+
+static const char *
+FormatName(Uint32 format)
+{
+    return SDL_GetPixelFormatName(format) + SDL_strlen("SDL_PIXELFORMAT_");
+}
+
+static void
+ReportCase(const char *name, Uint64 hash)
+{
+    char line[128];
+
+    SDL_snprintf(line, sizeof(line), "%s %08x%08x", name, (Uint32)(hash >> 32), (Uint32)hash);
+
+    if (record_file) {
+        fprintf(record_file, "%s\n", line);
+    } else if (expected) {
+        if (num_cases >= num_expected || SDL_strcmp(expected[num_cases], line) != 0) {
+            if (failures < MAX_REPORTS) {
+                SDL_Log("MISMATCH: %s, expected %s", line, num_cases < num_expected ? expected[num_cases] : "nothing");
+            }
+            ++failures;
+        }
+    } else {
+        printf("%s\n", line);
+    }
+    ++num_cases;
+}
+
+static SDL_Surface *
+CreateSurface(Uint32 format, int w, int h, int pitch)
+{
+    void *pixels = SDL_malloc((size_t)pitch * h);
+    SDL_Surface *surface;
+
+    if (!pixels) {
+        return NULL;
+    }
+    surface = SDL_CreateRGBSurfaceWithFormatFrom(pixels, w, h, 32, pitch, format);
+    if (!surface) {
+        SDL_free(pixels);
+        return NULL;
+    }
+    /* Let SDL_FreeSurface() free the pixels */
+    surface->flags &= ~SDL_PREALLOC;
+    return surface;
+}
+
+static void
+SetupBlit(SDL_Surface *src, SDL_BlendMode mode, const Uint8 *mod)
+{
+    SDL_SetSurfaceBlendMode(src, mode);
+    SDL_SetSurfaceColorMod(src, mod[0], mod[1], mod[2]);
+    SDL_SetSurfaceAlphaMod(src, mod[3]);
+}
+
+/* Blits random pixels between random sizes and pitches, including one wide
+   row so the vector loops run long enough to matter */
+static SDL_bool
+RandomBlit(Uint32 src_format, Uint32 dst_format, SDL_BlendMode mode, const Uint8 *mod, SDL_bool scaled, int trial, Uint64 *hash)
+{
+    int src_w, src_h, dst_w, dst_h, x, y, i;
+    SDL_Surface *src, *dst;
+    SDL_Rect rect;
+    int result;
+
+    if (trial == 0) {
+        rect.w = 1920 + Random() % 8;
+        rect.h = 3;
+        src_w = scaled ? 1 + Random() % 4000 : rect.w;
+        src_h = scaled ? 5 : rect.h;
+    } else {
+        rect.w = 1 + Random() % 67;
+        rect.h = 1 + Random() % 13;
+        src_w = scaled ? 1 + Random() % 90 : rect.w;
+        src_h = scaled ? 1 + Random() % 17 : rect.h;
+    }
+    rect.x = Random() % 5;
+    rect.y = Random() % 3;
+    dst_w = rect.x + rect.w + Random() % 5;
+    dst_h = rect.y + rect.h + Random() % 3;
+
+    src = CreateSurface(src_format, src_w, src_h, (src_w + Random() % 4) * 4);
+    dst = CreateSurface(dst_format, dst_w, dst_h, (dst_w + Random() % 4) * 4);
+    if (!src || !dst) {
+        SDL_FreeSurface(src);
+        SDL_FreeSurface(dst);
+        return SDL_FALSE;
+    }
+    for (y = 0; y < src->h; ++y) {
+        Uint8 *row = (Uint8 *)src->pixels + y * src->pitch;
+        for (x = 0; x < src->pitch; ++x) {
+            row[x] = RandomByte();
+        }
+    }
+    /* The padding is random too, so writes past the rectangle show up */
+    for (i = 0; i < dst->h * dst->pitch; ++i) {
+        ((Uint8 *)dst->pixels)[i] = RandomByte();
+    }
+
+    SetupBlit(src, mode, mod);
+    if (scaled) {
+        result = SDL_BlitScaled(src, NULL, dst, &rect);
+    } else {
+        result = SDL_BlitSurface(src, NULL, dst, &rect);
+    }
+    if (result < 0) {
+        SDL_Log("Blit failed: %s", SDL_GetError());
+    }
+    *hash = Digest(*hash, dst->pixels, (size_t)dst->h * dst->pitch);
+
+    SDL_FreeSurface(src);
+    SDL_FreeSurface(dst);
+    return result == 0 ? SDL_TRUE : SDL_FALSE;
+}
+
+/* Pixel i holds alpha i >> 16 and channel value (i >> 8) & 0xFF in the
+   source, and channel value i & 0xFF in the destination.  Green holds the
+   inverted values, so each channel sees every combination either way. */
+static void
+FillSweep(SDL_Surface *surface, int alpha_bits, int channel_bits)
+{
+    const SDL_PixelFormat *format = surface->format;
+    /* Formats without alpha get it in their unused top byte */
+    const int alpha_shift = format->Amask ? format->Ashift : 24;
+    Uint32 *pixels = (Uint32 *)surface->pixels;
+    Uint32 i;
+
+    for (i = 0; i < SWEEP_SIZE * SWEEP_SIZE; ++i) {
+        const Uint32 alpha = (i >> alpha_bits) & 0xFF;
+        const Uint32 channel = (i >> channel_bits) & 0xFF;
+
+        pixels[i] = (alpha << alpha_shift) |
+                    (channel << format->Rshift) |
+                    ((255 - channel) << format->Gshift) |
+                    (channel << format->Bshift);
+    }
+}
+
+static SDL_bool
+RunSweeps(void)
+{
+    void *src_pixels = SDL_malloc(SWEEP_SIZE * SWEEP_SIZE * 4);
+    void *dst_pixels = SDL_malloc(SWEEP_SIZE * SWEEP_SIZE * 4);
+    int s, d, m, n;
+
+    if (!src_pixels || !dst_pixels) {
+        SDL_Log("Couldn't allocate the sweep surfaces");
+        SDL_free(src_pixels);
+        SDL_free(dst_pixels);
+        return SDL_FALSE;
+    }
+
+    for (s = 0; s < SDL_arraysize(src_formats); ++s) {
+        SDL_Surface *src = SDL_CreateRGBSurfaceWithFormatFrom(src_pixels, SWEEP_SIZE, SWEEP_SIZE, 32, SWEEP_SIZE * 4, src_formats[s]);
+
+        if (src) {
+            FillSweep(src, 16, 8);
+        }
+        for (d = 0; src && d < SDL_arraysize(dst_formats); ++d) {
+            SDL_Surface *dst = SDL_CreateRGBSurfaceWithFormatFrom(dst_pixels, SWEEP_SIZE, SWEEP_SIZE, 32, SWEEP_SIZE * 4, dst_formats[d]);
+
+            for (m = 0; dst && m < SDL_arraysize(blend_modes); ++m) {
+                /* Without modulation, and with color and alpha modulation */
+                for (n = 0; n < SDL_arraysize(modulations); n += 3) {
+                    char name[96];
+                    Uint64 hash = 0xCBF29CE484222325ULL;
+
+                    FillSweep(dst, 0, 0);
+                    SetupBlit(src, blend_modes[m], modulations[n]);
+                    if (SDL_BlitSurface(src, NULL, dst, NULL) < 0) {
+                        SDL_Log("Blit failed: %s", SDL_GetError());
+                    }
+                    hash = Digest(hash, dst->pixels, (size_t)SWEEP_SIZE * SWEEP_SIZE * 4);
+
+                    SDL_snprintf(name, sizeof(name), "sweep %s->%s %s mod%d",
+                                 FormatName(src_formats[s]), FormatName(dst_formats[d]), blend_names[m], n);
+                    ReportCase(name, hash);
+                }
+            }
+            SDL_FreeSurface(dst);
+        }
+        SDL_FreeSurface(src);
+    }
+    SDL_free(src_pixels);
+    SDL_free(dst_pixels);
+    return SDL_TRUE;
+}
+
+static SDL_bool
+LoadExpected(const char *file)
+{
+    SDL_RWops *rw = SDL_RWFromFile(file, "rb");
+    Sint64 size;
+    char *text, *line;
+
+    if (!rw) {
+        SDL_Log("Couldn't open %s: %s", file, SDL_GetError());
+        return SDL_FALSE;
+    }
+    size = SDL_RWsize(rw);
+    text = (char *)SDL_malloc((size_t)size + 1);
+    if (!text || SDL_RWread(rw, text, 1, (size_t)size) != (size_t)size) {
+        SDL_Log("Couldn't read %s", file);
+        SDL_RWclose(rw);
+        return SDL_FALSE;
+    }
+    SDL_RWclose(rw);
+    text[size] = '\0';
+
+    for (line = text; *line; ) {
+        char *end = SDL_strchr(line, '\n');
+        char **lines;
+
+        if (end) {
+            *end = '\0';
+        }
+        lines = (char **)SDL_realloc(expected, (num_expected + 1) * sizeof(*expected));
+        if (!lines) {
+            return SDL_FALSE;
+        }
+        expected = lines;
+        expected[num_expected++] = line;
+        if (!end) {
+            break;
+        }
+        line = end + 1;
+    }
+    return SDL_TRUE;
+}
+
+int
+main(int argc, char *argv[])
+{
+    const char *features = SDL_getenv("SDL_BLIT_CPU_FEATURES");
+    SDL_bool ok = SDL_TRUE;
+    int s, d, m, n, scaled, trial;
+
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    if (argc == 3 && SDL_strcmp(argv[1], "--record") == 0) {
+        record_file = fopen(argv[2], "w");
+        if (!record_file) {
+            SDL_Log("Couldn't create %s", argv[2]);
+            return 1;
+        }
+    } else if (argc == 3 && SDL_strcmp(argv[1], "--compare") == 0) {
+        if (!LoadExpected(argv[2])) {
+            return 1;
+        }
+    } else if (argc != 1) {
+        SDL_Log("Usage: %s [--record file | --compare file]", argv[0]);
+        return 1;
+    }
+
+    if (SDL_Init(0) < 0) {
+        SDL_Log("Couldn't initialize SDL: %s", SDL_GetError());
+        return 1;
+    }
+    SDL_Log("SDL_BLIT_CPU_FEATURES=%s", features ? features : "(all available)");
+
+    for (s = 0; s < SDL_arraysize(src_formats); ++s) {
+        for (d = 0; d < SDL_arraysize(dst_formats); ++d) {
+            for (m = 0; m < SDL_arraysize(blend_modes); ++m) {
+                for (n = 0; n < SDL_arraysize(modulations); ++n) {
+                    for (scaled = 0; scaled <= 1; ++scaled) {
+                        char name[96];
+                        Uint64 hash = 0xCBF29CE484222325ULL;
+
+                        for (trial = 0; trial < TRIALS; ++trial) {
+                            ok &= RandomBlit(src_formats[s], dst_formats[d], blend_modes[m], modulations[n], scaled, trial, &hash);
+                        }
+                        SDL_snprintf(name, sizeof(name), "%s->%s %s mod%d%s",
+                                     FormatName(src_formats[s]), FormatName(dst_formats[d]),
+                                     blend_names[m], n, scaled ? " scaled" : "");
+                        ReportCase(name, hash);
+                    }
+                }
+            }
+        }
+    }
+    ok &= RunSweeps();
+
+    if (record_file) {
+        fclose(record_file);
+        SDL_Log("Recorded %d cases", num_cases);
+    } else if (expected) {
+        if (num_cases != num_expected) {
+            SDL_Log("Ran %d cases, expected %d", num_cases, num_expected);
+            ++failures;
+        }
+        SDL_Log("%d of %d cases matched", num_cases - failures, num_cases);
+    }
+
+    SDL_Quit();
+    return (ok && failures == 0) ? 0 : 1;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -0,0 +1,419 @@
+/*
+  Copyright (C) 1997-2023 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Checks that the SIMD alpha blitters in SDL_blit_A.c produce exactly what
+   the C versions do.
+
+   Every pair of the 32-bit and RGB565 formats is alpha blended, per pixel
+   from sources with alpha and per surface from sources without, at random
+   sizes, offsets and pitches, and each case's destination pixels are
+   digested.  Then exhaustive sweeps blend every combination of alpha,
+   source channel and destination channel: per pixel for each pair with a
+   32-bit destination and for ARGB8888 to RGB565, and per surface, with
+   every alpha modulation, for each 32-bit pair.
+
+   SDL reads SDL_BLIT_CPU_FEATURES once per process, so record the digests
+   with the C blitters and compare them in a second run:
+
+     SDL_BLIT_CPU_FEATURES=0 testblitalpha --record blits.txt
+     testblitalpha --compare blits.txt
+     SDL_BLIT_CPU_FEATURES=64 testblitalpha --compare blits.txt   (SSE4.1 only)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "SDL.h"
+
+#define TRIALS      16
+#define SWEEP_SIZE  4096
+#define MAX_REPORTS 20
+
+static const Uint32 formats[] = {
+    SDL_PIXELFORMAT_ARGB8888,
+    SDL_PIXELFORMAT_ABGR8888,
+    SDL_PIXELFORMAT_RGBA8888,
+    SDL_PIXELFORMAT_BGRA8888,
+    SDL_PIXELFORMAT_XRGB8888,
+    SDL_PIXELFORMAT_XBGR8888,
+    SDL_PIXELFORMAT_RGBX8888,
+    SDL_PIXELFORMAT_BGRX8888,
+    SDL_PIXELFORMAT_RGB565
+};
+
+static Uint32 seed = 24680;
+
+static FILE *record_file;
+static char **expected;
+static int num_expected;
+static int num_cases;
+static int failures;
+
+static Uint32
+Random(void)
+{
+    seed = seed * 1664525u + 1013904223u;
+    return seed >> 8;
+}
+
+/* Mostly random bytes, with plenty of the 0 and 255 edge cases */
+static Uint8
+RandomByte(void)
+{
+    Uint32 r = Random();
+
+    switch ((r >> 8) % 6) {
+    case 0:
+        return 0;
+    case 1:
+        return 255;
+    default:
+        return (Uint8)r;
+    }
+}
+
+static Uint64
+Digest(Uint64 hash, const void *data, size_t len)
+{
+    const Uint8 *bytes = (const Uint8 *)data;
+    size_t i;
+
+    for (i = 0; i < len; ++i) {
+        hash = (hash ^ bytes[i]) * 0x100000001B3ULL;
+    }
+    return hash;
+}
+
+static const char *
+FormatName(Uint32 format)
+{
+    return SDL_GetPixelFormatName(format) + SDL_strlen("SDL_PIXELFORMAT_");
+}
+
+static void
+ReportCase(const char *name, Uint64 hash)
+{
+    char line[128];
+
+    SDL_snprintf(line, sizeof(line), "%s %08x%08x", name, (Uint32)(hash >> 32), (Uint32)hash);
+
+    if (record_file) {
+        fprintf(record_file, "%s\n", line);
+    } else if (expected) {
+        if (num_cases >= num_expected || SDL_strcmp(expected[num_cases], line) != 0) {
+            if (failures < MAX_REPORTS) {
+                SDL_Log("MISMATCH: %s, expected %s", line, num_cases < num_expected ? expected[num_cases] : "nothing");
+            }
+            ++failures;
+        }
+    } else {
+        printf("%s\n", line);
+    }
+    ++num_cases;
+}
+
+static SDL_Surface *
+CreateSurface(Uint32 format, int w, int h, int pitch)
+{
+    void *pixels = SDL_malloc((size_t)pitch * h);
+    SDL_Surface *surface;
+
+    if (!pixels) {
+        return NULL;
+    }
+    surface = SDL_CreateRGBSurfaceWithFormatFrom(pixels, w, h, SDL_BITSPERPIXEL(format), pitch, format);
+    if (!surface) {
+        SDL_free(pixels);
+        return NULL;
+    }
+    /* Let SDL_FreeSurface() free the pixels */
+    surface->flags &= ~SDL_PREALLOC;
+    return surface;
+}
+
+/* Blends random pixels between random sizes, offsets and pitches, including
+   one wide row so the vector loops run long enough to matter */
+static SDL_bool
+RandomBlit(Uint32 src_format, Uint32 dst_format, Uint8 alpha, int trial, Uint64 *hash)
+{
+    const int src_bpp = SDL_BYTESPERPIXEL(src_format);
+    const int dst_bpp = SDL_BYTESPERPIXEL(dst_format);
+    SDL_Surface *src, *dst;
+    SDL_Rect rect;
+    int x, y, i;
+    int result;
+
+    if (trial == 0) {
+        rect.w = 1920 + Random() % 8;
+        rect.h = 3;
+    } else {
+        rect.w = 1 + Random() % 67;
+        rect.h = 1 + Random() % 13;
+    }
+    rect.x = Random() % 5;
+    rect.y = Random() % 3;
+
+    src = CreateSurface(src_format, rect.w, rect.h, (rect.w + Random() % 4) * src_bpp);
+    dst = CreateSurface(dst_format, rect.x + rect.w + Random() % 5, rect.y + rect.h + Random() % 3,
+                        (rect.x + rect.w + 5 + Random() % 4) * dst_bpp);
+    if (!src || !dst) {
+        SDL_FreeSurface(src);
+        SDL_FreeSurface(dst);
+        return SDL_FALSE;
+    }
+    for (y = 0; y < src->h; ++y) {
+        Uint8 *row = (Uint8 *)src->pixels + y * src->pitch;
+        for (x = 0; x < src->pitch; ++x) {
+            row[x] = RandomByte();
+        }
+    }
+    /* The padding is random too, so writes past the rectangle show up */
+    for (i = 0; i < dst->h * dst->pitch; ++i) {
+        ((Uint8 *)dst->pixels)[i] = RandomByte();
+    }
+
+    SDL_SetSurfaceBlendMode(src, SDL_BLENDMODE_BLEND);
+    SDL_SetSurfaceAlphaMod(src, alpha);
+    result = SDL_BlitSurface(src, NULL, dst, &rect);
+    if (result < 0) {
+        SDL_Log("Blit failed: %s", SDL_GetError());
+    }
+    *hash = Digest(*hash, dst->pixels, (size_t)dst->h * dst->pitch);
+
+    SDL_FreeSurface(src);
+    SDL_FreeSurface(dst);
+    return result == 0 ? SDL_TRUE : SDL_FALSE;
+}
+
+/* Pixel i holds alpha i >> 16 and channel value (i >> 8) & 0xFF in the
+   source, and channel value i & 0xFF in the destination.  Green holds the
+   inverted values, so each channel sees every combination either way.  An
+   RGB565 destination holds every 16-bit value for each source alpha. */
+static void
+FillSweep(SDL_Surface *surface, int alpha_bits, int channel_bits)
+{
+    const SDL_PixelFormat *format = surface->format;
+    const int count = surface->w * surface->h;
+    int i;
+
+    if (format->BytesPerPixel == 2) {
+        Uint16 *pixels = (Uint16 *)surface->pixels;
+
+        for (i = 0; i < count; ++i) {
+            /* Odd multiplier, so not just the source channel again */
+            pixels[i] = (Uint16)(i * 40503);
+        }
+    } else {
+        /* Formats without alpha get it in their unused byte */
+        const int alpha_shift = format->Amask ? format->Ashift : ((format->Rshift == 24 || format->Bshift == 24) ? 0 : 24);
+        Uint32 *pixels = (Uint32 *)surface->pixels;
+
+        for (i = 0; i < count; ++i) {
+            const Uint32 alpha = ((Uint32)i >> alpha_bits) & 0xFF;
+            const Uint32 channel = ((Uint32)i >> channel_bits) & 0xFF;
+
+            pixels[i] = (alpha << alpha_shift) |
+                        (channel << format->Rshift) |
+                        ((255 - channel) << format->Gshift) |
+                        (channel << format->Bshift);
+        }
+    }
+}
+
+/* Blends src onto dst, once, or once for each alpha modulation */
+static void
+Sweep(const char *what, SDL_Surface *src, SDL_Surface *dst, SDL_bool every_alpha)
+{
+    char name[96];
+    Uint64 hash = 0xCBF29CE484222325ULL;
+    int alpha;
+
+    FillSweep(src, 16, 8);
+    SDL_SetSurfaceBlendMode(src, SDL_BLENDMODE_BLEND);
+    for (alpha = every_alpha ? 0 : 255; alpha <= 255; ++alpha) {
+        FillSweep(dst, 0, 0);
+        SDL_SetSurfaceAlphaMod(src, (Uint8)alpha);
+        if (SDL_BlitSurface(src, NULL, dst, NULL) < 0) {
+            SDL_Log("Blit failed: %s", SDL_GetError());
+        }
+        hash = Digest(hash, dst->pixels, (size_t)dst->h * dst->pitch);
+    }
+
+    SDL_snprintf(name, sizeof(name), "sweep %s %s->%s", what,
+                 FormatName(src->format->format), FormatName(dst->format->format));
+    ReportCase(name, hash);
+}
+
+static SDL_bool
+RunSweeps(void)
+{
+    void *src_pixels = SDL_malloc(SWEEP_SIZE * SWEEP_SIZE * 4);
+    void *dst_pixels = SDL_malloc(SWEEP_SIZE * SWEEP_SIZE * 4);
+    int s, d;
+
+    if (!src_pixels || !dst_pixels) {
+        SDL_Log("Couldn't allocate the sweep surfaces");
+        SDL_free(src_pixels);
+        SDL_free(dst_pixels);
+        return SDL_FALSE;
+    }
+
+    for (s = 0; s < SDL_arraysize(formats); ++s) {
+        const Uint32 src_format = formats[s];
+
+        if (SDL_BYTESPERPIXEL(src_format) != 4) {
+            continue;
+        }
+        for (d = 0; d < SDL_arraysize(formats); ++d) {
+            const Uint32 dst_format = formats[d];
+            SDL_Surface *src = NULL, *dst = NULL;
+
+            if (SDL_ISPIXELFORMAT_ALPHA(src_format)) {
+                /* Per pixel: every alpha, source and destination channel in
+                   one blit */
+                if (SDL_BYTESPERPIXEL(dst_format) == 2 && src_format != SDL_PIXELFORMAT_ARGB8888) {
+                    continue;
+                }
+                src = SDL_CreateRGBSurfaceWithFormatFrom(src_pixels, SWEEP_SIZE, SWEEP_SIZE, 32, SWEEP_SIZE * 4, src_format);
+                dst = SDL_CreateRGBSurfaceWithFormatFrom(dst_pixels, SWEEP_SIZE, SWEEP_SIZE, SDL_BITSPERPIXEL(dst_format),
+                                                         SWEEP_SIZE * SDL_BYTESPERPIXEL(dst_format), dst_format);
+                if (src && dst) {
+                    Sweep("pixel", src, dst, SDL_FALSE);
+                }
+            } else if (SDL_BYTESPERPIXEL(dst_format) == 4) {
+                /* Per surface: every source and destination channel, once
+                   for each alpha modulation */
+                src = SDL_CreateRGBSurfaceWithFormatFrom(src_pixels, 256, 256, 32, 256 * 4, src_format);
+                dst = SDL_CreateRGBSurfaceWithFormatFrom(dst_pixels, 256, 256, 32, 256 * 4, dst_format);
+                if (src && dst) {
+                    Sweep("surface", src, dst, SDL_TRUE);
+                }
+            }
+            SDL_FreeSurface(src);
+            SDL_FreeSurface(dst);
+        }
+    }
+    SDL_free(src_pixels);
+    SDL_free(dst_pixels);
+    return SDL_TRUE;
+}
+
+static SDL_bool
+LoadExpected(const char *file)
+{
+    SDL_RWops *rw = SDL_RWFromFile(file, "rb");
+    Sint64 size;
+    char *text, *line;
+
+    if (!rw) {
+        SDL_Log("Couldn't open %s: %s", file, SDL_GetError());
+        return SDL_FALSE;
+    }
+    size = SDL_RWsize(rw);
+    text = (char *)SDL_malloc((size_t)size + 1);
+    if (!text || SDL_RWread(rw, text, 1, (size_t)size) != (size_t)size) {
+        SDL_Log("Couldn't read %s", file);
+        SDL_RWclose(rw);
+        return SDL_FALSE;
+    }
+    SDL_RWclose(rw);
+    text[size] = '\0';
+
+    for (line = text; *line; ) {
+        char *end = SDL_strchr(line, '\n');
+        char **lines;
+
+        if (end) {
+            *end = '\0';
+        }
+        lines = (char **)SDL_realloc(expected, (num_expected + 1) * sizeof(*expected));
+        if (!lines) {
+            return SDL_FALSE;
+        }
+        expected = lines;
+        expected[num_expected++] = line;
+        if (!end) {
+            break;
+        }
+        line = end + 1;
+    }
+    return SDL_TRUE;
+}
+
+int
+main(int argc, char *argv[])
+{
+    /* Opaque, transparent and partial per-surface alpha */
+    static const Uint8 alphas[] = { 255, 0, 1, 128, 254 };
+    const char *features = SDL_getenv("SDL_BLIT_CPU_FEATURES");
+    SDL_bool ok = SDL_TRUE;
+    int s, d, a, trial;
+
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    if (argc == 3 && SDL_strcmp(argv[1], "--record") == 0) {
+        record_file = fopen(argv[2], "w");
+        if (!record_file) {
+            SDL_Log("Couldn't create %s", argv[2]);
+            return 1;
+        }
+    } else if (argc == 3 && SDL_strcmp(argv[1], "--compare") == 0) {
+        if (!LoadExpected(argv[2])) {
+            return 1;
+        }
+    } else if (argc != 1) {
+        SDL_Log("Usage: %s [--record file | --compare file]", argv[0]);
+        return 1;
+    }
+
+    if (SDL_Init(0) < 0) {
+        SDL_Log("Couldn't initialize SDL: %s", SDL_GetError());
+        return 1;
+    }
+    SDL_Log("SDL_BLIT_CPU_FEATURES=%s", features ? features : "(all available)");
+
+    for (s = 0; s < SDL_arraysize(formats); ++s) {
+        for (d = 0; d < SDL_arraysize(formats); ++d) {
+            /* Alpha modulation of a source with alpha isn't done here */
+            const int num_alphas = SDL_ISPIXELFORMAT_ALPHA(formats[s]) ? 1 : SDL_arraysize(alphas);
+
+            for (a = 0; a < num_alphas; ++a) {
+                char name[96];
+                Uint64 hash = 0xCBF29CE484222325ULL;
+
+                for (trial = 0; trial < TRIALS; ++trial) {
+                    ok &= RandomBlit(formats[s], formats[d], alphas[a], trial, &hash);
+                }
+                SDL_snprintf(name, sizeof(name), "%s->%s alpha %d",
+                             FormatName(formats[s]), FormatName(formats[d]), (int)alphas[a]);
+                ReportCase(name, hash);
+            }
+        }
+    }
+    ok &= RunSweeps();
+
+    if (record_file) {
+        fclose(record_file);
+        SDL_Log("Recorded %d cases", num_cases);
+    } else if (expected) {
+        if (num_cases != num_expected) {
+            SDL_Log("Ran %d cases, expected %d", num_cases, num_expected);
+            ++failures;
+        }
+        SDL_Log("%d of %d cases matched", num_cases - failures, num_cases);
+    }
+
+    SDL_Quit();
+    return (ok && failures == 0) ? 0 : 1;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -0,0 +1,150 @@
+/*
+  Copyright (C) 1997-2023 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Benchmark of the alpha blitters in SDL_blit_A.c, one 1920x1080 blend for
+   each format pair and kind of alpha they handle.  Prints the best time of
+   several runs of each.
+
+   SDL picks the blitters for the CPU.  Set SDL_BLIT_CPU_FEATURES to time
+   others, 0 for the C blitters, 1 for MMX, 64 for SSE4.1 and 128 for AVX2:
+
+       for f in 0 1 64 128; do SDL_BLIT_CPU_FEATURES=$f ./testblitalphabench; done
+
+   Usage: testblitalphabench [runs]
+ */
+
+#include <stdlib.h>
+
+#include "SDL.h"
+
+#define DEFAULT_RUNS    20
+#define WIDTH           1920
+#define HEIGHT          1080
+
+static const struct
+{
+    Uint32 src_format;
+    Uint32 dst_format;
+    SDL_bool surface_alpha;
+} cases[] = {
+    /* Per pixel alpha */
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, SDL_FALSE },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, SDL_FALSE },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ABGR8888, SDL_FALSE },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGBA8888, SDL_FALSE },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ABGR8888, SDL_FALSE },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, SDL_FALSE },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XBGR8888, SDL_FALSE },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB565, SDL_FALSE },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR565, SDL_FALSE },
+    /* Per surface alpha */
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, SDL_TRUE },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, SDL_TRUE },
+    { SDL_PIXELFORMAT_RGBX8888, SDL_PIXELFORMAT_RGBA8888, SDL_TRUE },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, SDL_TRUE },
+    { SDL_PIXELFORMAT_RGB565, SDL_PIXELFORMAT_RGB565, SDL_TRUE }
+};
+
+static int runs = DEFAULT_RUNS;
+
+static double
+Milliseconds(void)
+{
+    return (double)SDL_GetPerformanceCounter() * 1000.0 / SDL_GetPerformanceFrequency();
+}
+
+static SDL_Surface *
+CreateRandomSurface(Uint32 format)
+{
+    SDL_Surface *surface = SDL_CreateRGBSurfaceWithFormat(0, WIDTH, HEIGHT, 0, format);
+    int i;
+
+    if (!surface) {
+        SDL_Log("Couldn't create %s surface: %s", SDL_GetPixelFormatName(format), SDL_GetError());
+        return NULL;
+    }
+    for (i = 0; i < surface->pitch * surface->h; ++i) {
+        ((Uint8 *)surface->pixels)[i] = (Uint8)rand();
+    }
+    return surface;
+}
+
+static SDL_bool
+Bench(Uint32 src_format, Uint32 dst_format, SDL_bool surface_alpha)
+{
+    SDL_Surface *src = CreateRandomSurface(src_format);
+    SDL_Surface *dst = CreateRandomSurface(dst_format);
+    double best = 1e9;
+    char name[64];
+    int i;
+
+    if (!src || !dst) {
+        SDL_FreeSurface(src);
+        SDL_FreeSurface(dst);
+        return SDL_FALSE;
+    }
+    SDL_SetSurfaceBlendMode(src, SDL_BLENDMODE_BLEND);
+    if (surface_alpha) {
+        SDL_SetSurfaceAlphaMod(src, 100);
+    }
+
+    for (i = 0; i < runs; ++i) {
+        double start = Milliseconds();
+        double elapsed;
+
+        SDL_BlitSurface(src, NULL, dst, NULL);
+        elapsed = Milliseconds() - start;
+        best = SDL_min(best, elapsed);
+    }
+
+    SDL_snprintf(name, sizeof(name), "%s -> %s",
+                 SDL_GetPixelFormatName(src_format) + SDL_strlen("SDL_PIXELFORMAT_"),
+                 SDL_GetPixelFormatName(dst_format) + SDL_strlen("SDL_PIXELFORMAT_"));
+    SDL_Log("%-24s %-7s %8.2f ms", name, surface_alpha ? "surface" : "pixel", best);
+
+    SDL_FreeSurface(src);
+    SDL_FreeSurface(dst);
+    return SDL_TRUE;
+}
+
+int
+main(int argc, char *argv[])
+{
+    const char *features = SDL_getenv("SDL_BLIT_CPU_FEATURES");
+    SDL_bool ok = SDL_TRUE;
+    int i;
+
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    if (argc > 1) {
+        runs = SDL_max(SDL_atoi(argv[1]), 1);
+    }
+
+    if (SDL_Init(0) < 0) {
+        SDL_Log("Couldn't initialize SDL: %s", SDL_GetError());
+        return 1;
+    }
+
+    /* One band, so this times the blitters rather than the threads */
+    SDL_SetHint(SDL_HINT_VIDEO_PARALLEL_BLIT, "0");
+
+    SDL_Log("SDL_BLIT_CPU_FEATURES=%s, %dx%d, best of %d runs",
+            features ? features : "(all available)", WIDTH, HEIGHT, runs);
+    for (i = 0; i < SDL_arraysize(cases); ++i) {
+        ok &= Bench(cases[i].src_format, cases[i].dst_format, cases[i].surface_alpha);
+    }
+
+    SDL_Quit();
+    return ok ? 0 : 1;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -0,0 +1,137 @@
+/*
+  Copyright (C) 1997-2023 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Throughput benchmark of SDL_crc32 over buffers from 16 bytes to 1 MB, and
+   a check of its results against the original bit at a time algorithm at
+   random offsets and lengths.
+
+   SDL picks the fastest implementation for the CPU.  Set SDL_CRC32_IMPL to
+   "table", "pclmul" (x86) or "arm" (ARMv8 CRC32) to time a particular one;
+   one the compiler or CPU doesn't support falls back to the tables, which
+   shows up as table throughput:
+
+       for impl in table pclmul arm; do SDL_CRC32_IMPL=$impl ./testcrc32bench; done
+
+   Usage: testcrc32bench [megabytes per size]
+ */
+
+#include <stdlib.h>
+
+#include "SDL.h"
+
+#define DEFAULT_MEGABYTES   256
+#define BUFFER_SIZE         (1024 * 1024)
+#define CHECKS              20000
+
+static const int sizes[] = { 16, 64, 256, 4096, 65536, BUFFER_SIZE };
+
+/* The implementation SDL_crc32 used before it was table driven */
+static Uint32
+ReferenceCRC32(Uint32 crc, const Uint8 *data, size_t len)
+{
+    size_t i;
+    int bit;
+
+    for (i = 0; i < len; ++i) {
+        Uint32 r = (Uint8)crc ^ data[i];
+
+        for (bit = 0; bit < 8; ++bit) {
+            r = ((r & 1) ? 0 : (Uint32)0xEDB88320L) ^ r >> 1;
+        }
+        crc = (r ^ (Uint32)0xFF000000L) ^ crc >> 8;
+    }
+    return crc;
+}
+
+static int
+CheckResults(const Uint8 *buffer)
+{
+    int failures = 0;
+    int i;
+
+    for (i = 0; i < CHECKS; ++i) {
+        /* Mostly short lengths, where the alignment and tail handling is */
+        const size_t offset = rand() % 64;
+        const size_t len = rand() % ((i % 10) ? 300 : 70000);
+        const Uint32 seed = (Uint32)rand();
+        const Uint32 expected = ReferenceCRC32(seed, buffer + offset, len);
+        const Uint32 actual = SDL_crc32(seed, buffer + offset, len);
+
+        if (actual != expected) {
+            if (failures < 10) {
+                SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Offset %d, length %d: 0x%.8x, expected 0x%.8x\n",
+                             (int)offset, (int)len, actual, expected);
+            }
+            ++failures;
+        }
+    }
+    return failures;
+}
+
+int
+main(int argc, char *argv[])
+{
+    const char *impl = SDL_getenv("SDL_CRC32_IMPL");
+    Sint64 megabytes = DEFAULT_MEGABYTES;
+    Uint8 *buffer;
+    Uint32 crc = 0;
+    int failures;
+    int i;
+
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    if (argc > 1) {
+        megabytes = SDL_max(SDL_atoi(argv[1]), 1);
+    }
+
+    if (SDL_Init(0) < 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return 1;
+    }
+
+    /* Room for the misaligned starts of the checks */
+    buffer = (Uint8 *)SDL_malloc(BUFFER_SIZE + 64);
+    if (!buffer) {
+        SDL_OutOfMemory();
+        return 1;
+    }
+    for (i = 0; i < BUFFER_SIZE + 64; ++i) {
+        buffer[i] = (Uint8)rand();
+    }
+
+    SDL_Log("Implementation: %s\n", (impl && *impl) ? impl : "automatic");
+
+    failures = CheckResults(buffer);
+    SDL_Log("%d of %d random checks matched\n", CHECKS - failures, CHECKS);
+
+    for (i = 0; i < SDL_arraysize(sizes); ++i) {
+        const Sint64 loops = SDL_max(megabytes * 1024 * 1024 / sizes[i], 1);
+        Uint64 start;
+        double seconds;
+        Sint64 loop;
+
+        start = SDL_GetPerformanceCounter();
+        for (loop = 0; loop < loops; ++loop) {
+            crc = SDL_crc32(crc, buffer, sizes[i]);
+        }
+        seconds = (double)(SDL_GetPerformanceCounter() - start) / SDL_GetPerformanceFrequency();
+        SDL_Log("%8d bytes: %8.1f MB/s\n", sizes[i], (double)loops * sizes[i] / seconds / (1024.0 * 1024.0));
+    }
+    /* Keep the loops from being optimized away */
+    SDL_Log("Final CRC: 0x%.8x\n", crc);
+
+    SDL_free(buffer);
+    SDL_Quit();
+    return failures ? 1 : 0;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -0,0 +1,125 @@
+/*
+  Copyright (C) 1997-2023 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Benchmark of the event queue with many threads pushing events while the
+   main thread drains them, as a game does with input, audio and network
+   threads.  Checks that no event is lost and that the events of each thread
+   arrive in the order they were pushed, and reports the event rate and how
+   long the main thread spends in SDL_PeepEvents().
+
+   Usage: testeventring [threads] [events per thread]
+ */
+
+#include <stdlib.h>
+
+#include "SDL.h"
+
+#define DEFAULT_THREADS 8
+#define DEFAULT_EVENTS  200000
+#define MAX_THREADS     64
+
+static int num_events = DEFAULT_EVENTS;
+
+static int SDLCALL
+Producer(void *data)
+{
+    SDL_Event event;
+    int i;
+
+    SDL_zero(event);
+    event.type = SDL_USEREVENT;
+    event.user.code = (int)(intptr_t)data;
+    for (i = 0; i < num_events; ++i) {
+        event.user.data1 = (void *)(intptr_t)i;
+        /* The queue is bounded, wait for the main thread when it's full */
+        while (SDL_PushEvent(&event) <= 0) {
+            SDL_Delay(0);
+        }
+    }
+    return 0;
+}
+
+int
+main(int argc, char *argv[])
+{
+    SDL_Thread *threads[MAX_THREADS];
+    int last[MAX_THREADS];
+    SDL_Event events[64];
+    int num_threads = DEFAULT_THREADS;
+    int i, received = 0, out_of_order = 0, calls = 0;
+    Uint64 start, total = 0, worst = 0;
+    double freq = (double)SDL_GetPerformanceFrequency();
+    double seconds;
+
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    if (argc > 1) {
+        num_threads = SDL_clamp(SDL_atoi(argv[1]), 1, MAX_THREADS);
+    }
+    if (argc > 2) {
+        num_events = SDL_max(SDL_atoi(argv[2]), 1);
+    }
+
+    if (SDL_Init(SDL_INIT_EVENTS) < 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return 1;
+    }
+
+    SDL_Log("%d threads pushing %d events each on %d CPUs\n", num_threads, num_events, SDL_GetCPUCount());
+
+    for (i = 0; i < num_threads; ++i) {
+        last[i] = -1;
+    }
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < num_threads; ++i) {
+        threads[i] = SDL_CreateThread(Producer, "Producer", (void *)(intptr_t)i);
+    }
+
+    while (received < num_threads * num_events) {
+        Uint64 before = SDL_GetPerformanceCounter();
+        int count = SDL_PeepEvents(events, SDL_arraysize(events), SDL_GETEVENT, SDL_USEREVENT, SDL_USEREVENT);
+        Uint64 elapsed = SDL_GetPerformanceCounter() - before;
+
+        total += elapsed;
+        worst = SDL_max(worst, elapsed);
+        ++calls;
+
+        for (i = 0; i < count; ++i) {
+            int thread = events[i].user.code;
+            int sequence = (int)(intptr_t)events[i].user.data1;
+            if (sequence != last[thread] + 1) {
+                ++out_of_order;
+            }
+            last[thread] = sequence;
+        }
+        received += count;
+        if (count == 0) {
+            SDL_Delay(0);
+        }
+    }
+    seconds = (SDL_GetPerformanceCounter() - start) / freq;
+
+    for (i = 0; i < num_threads; ++i) {
+        SDL_WaitThread(threads[i], NULL);
+    }
+
+    SDL_Log("%d events in %.3f seconds, %.2f million events/s\n", received, seconds, received / seconds / 1000000.0);
+    SDL_Log("SDL_PeepEvents(): %d calls, %.2f us average, %.1f us worst\n", calls, total * 1000000.0 / freq / calls, worst * 1000000.0 / freq);
+    if (out_of_order) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "%d events arrived out of order\n", out_of_order);
+    }
+
+    SDL_Quit();
+    return out_of_order ? 1 : 0;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
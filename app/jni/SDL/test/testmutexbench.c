@@ -0,0 +1,242 @@
+/*
+  Copyright (C) 1997-2023 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Benchmark of SDL_mutex and SDL_cond against the pthread primitives they
+   used to wrap: uncontended lock/unlock, many threads incrementing a counter
+   under one lock, and two threads handing a turn back and forth through a
+   condition variable.  The counter is checked, so a broken lock fails the
+   run.  Build SDL with -DSDL_THREAD_FUTEX=0 to compare the old SDL mutex.
+
+   Usage: testmutexbench [threads] [iterations per thread]
+ */
+
+#include <stdlib.h>
+
+#include "SDL.h"
+
+#if defined(__LINUX__) || defined(__ANDROID__) || defined(__MACOSX__)
+#define HAVE_PTHREAD_BENCH 1
+#include <pthread.h>
+#endif
+
+#define DEFAULT_THREADS     4
+#define DEFAULT_ITERATIONS  1000000
+#define MAX_THREADS         64
+#define UNCONTENDED_LOOPS   10000000
+#define HANDOFFS            20000
+
+static int num_iterations = DEFAULT_ITERATIONS;
+static int counter;
+static int turn;
+
+static SDL_mutex *mutex;
+static SDL_cond *cond;
+static SDL_sem *idle_sem;
+
+static double
+Seconds(Uint64 start)
+{
+    return (double)(SDL_GetPerformanceCounter() - start) / SDL_GetPerformanceFrequency();
+}
+
+static int SDLCALL
+Idle(void *unused)
+{
+    SDL_SemWait(idle_sem);
+    return 0;
+}
+
+static int SDLCALL
+Increment(void *unused)
+{
+    int i;
+
+    for (i = 0; i < num_iterations; ++i) {
+        SDL_LockMutex(mutex);
+        ++counter;
+        SDL_UnlockMutex(mutex);
+    }
+    return 0;
+}
+
+static int SDLCALL
+PingPong(void *data)
+{
+    int me = (int)(intptr_t)data;
+    int i;
+
+    for (i = 0; i < HANDOFFS; ++i) {
+        SDL_LockMutex(mutex);
+        while (turn != me) {
+            SDL_CondWait(cond, mutex);
+        }
+        turn = !me;
+        SDL_CondSignal(cond);
+        SDL_UnlockMutex(mutex);
+    }
+    return 0;
+}
+
+#ifdef HAVE_PTHREAD_BENCH
+static pthread_mutex_t pmutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t pcond = PTHREAD_COND_INITIALIZER;
+
+static void *
+PthreadIncrement(void *unused)
+{
+    int i;
+
+    for (i = 0; i < num_iterations; ++i) {
+        pthread_mutex_lock(&pmutex);
+        ++counter;
+        pthread_mutex_unlock(&pmutex);
+    }
+    return NULL;
+}
+
+static void *
+PthreadPingPong(void *data)
+{
+    int me = (int)(intptr_t)data;
+    int i;
+
+    for (i = 0; i < HANDOFFS; ++i) {
+        pthread_mutex_lock(&pmutex);
+        while (turn != me) {
+            pthread_cond_wait(&pcond, &pmutex);
+        }
+        turn = !me;
+        pthread_cond_signal(&pcond);
+        pthread_mutex_unlock(&pmutex);
+    }
+    return NULL;
+}
+#endif /* HAVE_PTHREAD_BENCH */
+
+static SDL_bool
+CheckCounter(const char *what, int expected)
+{
+    if (counter != expected) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "%s: counter is %d, expected %d\n", what, counter, expected);
+        return SDL_FALSE;
+    }
+    return SDL_TRUE;
+}
+
+int
+main(int argc, char *argv[])
+{
+    SDL_Thread *threads[MAX_THREADS];
+    SDL_Thread *idle;
+    int num_threads = DEFAULT_THREADS;
+    SDL_bool ok = SDL_TRUE;
+    Uint64 start;
+    double seconds;
+    int i;
+#ifdef HAVE_PTHREAD_BENCH
+    pthread_t pthreads[MAX_THREADS];
+#endif
+
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    if (argc > 1) {
+        num_threads = SDL_clamp(SDL_atoi(argv[1]), 1, MAX_THREADS);
+    }
+    if (argc > 2) {
+        num_iterations = SDL_max(SDL_atoi(argv[2]), 1);
+    }
+
+    if (SDL_Init(0) < 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return 1;
+    }
+    mutex = SDL_CreateMutex();
+    cond = SDL_CreateCond();
+    idle_sem = SDL_CreateSemaphore(0);
+    if (!mutex || !cond || !idle_sem) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create mutex: %s\n", SDL_GetError());
+        return 1;
+    }
+
+    SDL_Log("%d threads, %d iterations each, on %d CPUs\n", num_threads, num_iterations, SDL_GetCPUCount());
+
+    /* glibc skips the atomic operations while a process has one thread, which
+       no real SDL program has, so keep another thread around */
+    idle = SDL_CreateThread(Idle, "Idle", NULL);
+
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < UNCONTENDED_LOOPS; ++i) {
+        SDL_LockMutex(mutex);
+        SDL_UnlockMutex(mutex);
+    }
+    SDL_Log("Uncontended lock/unlock:  SDL %6.2f ns", Seconds(start) * 1e9 / UNCONTENDED_LOOPS);
+#ifdef HAVE_PTHREAD_BENCH
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < UNCONTENDED_LOOPS; ++i) {
+        pthread_mutex_lock(&pmutex);
+        pthread_mutex_unlock(&pmutex);
+    }
+    SDL_Log("                      pthread %6.2f ns", Seconds(start) * 1e9 / UNCONTENDED_LOOPS);
+#endif
+
+    counter = 0;
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < num_threads; ++i) {
+        threads[i] = SDL_CreateThread(Increment, "Increment", NULL);
+    }
+    for (i = 0; i < num_threads; ++i) {
+        SDL_WaitThread(threads[i], NULL);
+    }
+    seconds = Seconds(start);
+    SDL_Log("Contended increments:     SDL %6.2f million/s", (double)num_threads * num_iterations / seconds / 1e6);
+    ok &= CheckCounter("SDL", num_threads * num_iterations);
+#ifdef HAVE_PTHREAD_BENCH
+    counter = 0;
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < num_threads; ++i) {
+        pthread_create(&pthreads[i], NULL, PthreadIncrement, NULL);
+    }
+    for (i = 0; i < num_threads; ++i) {
+        pthread_join(pthreads[i], NULL);
+    }
+    seconds = Seconds(start);
+    SDL_Log("                      pthread %6.2f million/s", (double)num_threads * num_iterations / seconds / 1e6);
+    ok &= CheckCounter("pthread", num_threads * num_iterations);
+#endif
+
+    turn = 0;
+    start = SDL_GetPerformanceCounter();
+    threads[0] = SDL_CreateThread(PingPong, "Ping", (void *)(intptr_t)0);
+    threads[1] = SDL_CreateThread(PingPong, "Pong", (void *)(intptr_t)1);
+    SDL_WaitThread(threads[0], NULL);
+    SDL_WaitThread(threads[1], NULL);
+    SDL_Log("Condition handoff:        SDL %6.2f us", Seconds(start) * 1e6 / (2 * HANDOFFS));
+#ifdef HAVE_PTHREAD_BENCH
+    turn = 0;
+    start = SDL_GetPerformanceCounter();
+    pthread_create(&pthreads[0], NULL, PthreadPingPong, (void *)(intptr_t)0);
+    pthread_create(&pthreads[1], NULL, PthreadPingPong, (void *)(intptr_t)1);
+    pthread_join(pthreads[0], NULL);
+    pthread_join(pthreads[1], NULL);
+    SDL_Log("                      pthread %6.2f us", Seconds(start) * 1e6 / (2 * HANDOFFS));
+#endif
+
+    SDL_SemPost(idle_sem);
+    SDL_WaitThread(idle, NULL);
+    SDL_DestroySemaphore(idle_sem);
+    SDL_DestroyCond(cond);
+    SDL_DestroyMutex(mutex);
+    SDL_Quit();
+    return ok ? 0 : 1;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -0,0 +1,254 @@
+/*
+  Copyright (C) 1997-2023 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Checks that blits, scaled blits, stretches and fills split across threads
+   with SDL_HINT_VIDEO_PARALLEL_BLIT produce exactly what they do on one
+   thread.  Formats, rectangles (including clipped ones), blend modes and
+   modulation are random.  The threshold is set very low so that even small
+   operations are split.
+
+   Nothing is split on a single CPU machine, the test then passes trivially.
+
+   Usage: testparallelblit [trials]
+ */
+
+#include <stdlib.h>
+
+#include "SDL.h"
+
+#define DEFAULT_TRIALS  200
+#define MAX_REPORTS     10
+
+static const Uint32 formats[] = {
+    SDL_PIXELFORMAT_ARGB8888,
+    SDL_PIXELFORMAT_XRGB8888,
+    SDL_PIXELFORMAT_ABGR8888,
+    SDL_PIXELFORMAT_RGBA8888,
+    SDL_PIXELFORMAT_RGB565,
+    SDL_PIXELFORMAT_RGB24,
+    SDL_PIXELFORMAT_ARGB2101010,
+    SDL_PIXELFORMAT_INDEX8      /* source only */
+};
+
+static const SDL_BlendMode blend_modes[] = {
+    SDL_BLENDMODE_NONE,
+    SDL_BLENDMODE_BLEND,
+    SDL_BLENDMODE_ADD,
+    SDL_BLENDMODE_MOD,
+    SDL_BLENDMODE_MUL
+};
+
+static Uint32 seed = 777;
+static int checks;
+static int failures;
+
+static Uint32
+Random(void)
+{
+    seed = seed * 1664525u + 1013904223u;
+    return seed >> 8;
+}
+
+static void
+FillRandom(SDL_Surface *surface)
+{
+    Uint8 *pixels = (Uint8 *)surface->pixels;
+    int i;
+
+    for (i = 0; i < surface->pitch * surface->h; ++i) {
+        pixels[i] = (Uint8)Random();
+    }
+}
+
+static SDL_Surface *
+CreateRandomSurface(Uint32 format, int w, int h)
+{
+    SDL_Surface *surface = SDL_CreateRGBSurfaceWithFormat(0, w, h, 0, format);
+
+    if (!surface) {
+        SDL_Log("Couldn't create %s surface: %s", SDL_GetPixelFormatName(format), SDL_GetError());
+        exit(2);
+    }
+    if (surface->format->palette) {
+        SDL_Color colors[256];
+        int i;
+
+        for (i = 0; i < SDL_arraysize(colors); ++i) {
+            colors[i].r = (Uint8)Random();
+            colors[i].g = (Uint8)Random();
+            colors[i].b = (Uint8)Random();
+            colors[i].a = (Uint8)Random();
+        }
+        SDL_SetPaletteColors(surface->format->palette, colors, 0, SDL_arraysize(colors));
+    }
+    FillRandom(surface);
+    return surface;
+}
+
+static SDL_Surface *
+CopySurface(SDL_Surface *surface)
+{
+    SDL_Surface *copy = SDL_CreateRGBSurfaceWithFormat(0, surface->w, surface->h, 0, surface->format->format);
+
+    if (!copy) {
+        SDL_Log("Couldn't copy surface: %s", SDL_GetError());
+        exit(2);
+    }
+    SDL_memcpy(copy->pixels, surface->pixels, (size_t)surface->pitch * surface->h);
+    return copy;
+}
+
+static void
+Compare(const char *what, SDL_Surface *single, SDL_Surface *split, Uint32 src_format, SDL_BlendMode mode)
+{
+    ++checks;
+    if (SDL_memcmp(single->pixels, split->pixels, (size_t)single->pitch * single->h) != 0) {
+        if (failures < MAX_REPORTS) {
+            SDL_Log("MISMATCH: %s %s -> %s, blend mode %d, %dx%d destination", what,
+                    SDL_GetPixelFormatName(src_format), SDL_GetPixelFormatName(single->format->format),
+                    (int)mode, single->w, single->h);
+        }
+        ++failures;
+    }
+}
+
+typedef enum
+{
+    OP_BLIT,
+    OP_BLIT_SCALED,
+    OP_STRETCH,
+    OP_STRETCH_LINEAR,
+    OP_FILL
+} Operation;
+
+static const char *operation_names[] = {
+    "blit", "scaled blit", "stretch", "linear stretch", "fill"
+};
+
+static void
+Run(Operation op, SDL_Surface *src, const SDL_Rect *srcrect, SDL_Surface *dst, const SDL_Rect *dstrect, Uint32 color)
+{
+    SDL_Rect rect = *dstrect;
+
+    switch (op) {
+    case OP_BLIT:
+        SDL_BlitSurface(src, srcrect, dst, &rect);
+        break;
+    case OP_BLIT_SCALED:
+        SDL_BlitScaled(src, srcrect, dst, &rect);
+        break;
+    case OP_STRETCH:
+        SDL_SoftStretch(src, srcrect, dst, &rect);
+        break;
+    case OP_STRETCH_LINEAR:
+        SDL_SoftStretchLinear(src, srcrect, dst, &rect);
+        break;
+    case OP_FILL:
+        SDL_FillRect(dst, &rect, color);
+        break;
+    }
+}
+
+/* Runs the operation once on one thread and once split, on copies of dst */
+static void
+Check(Operation op, SDL_Surface *src, const SDL_Rect *srcrect, SDL_Surface *dst, const SDL_Rect *dstrect, Uint32 color, SDL_BlendMode mode)
+{
+    SDL_Surface *single = CopySurface(dst);
+    SDL_Surface *split = CopySurface(dst);
+
+    SDL_SetHint(SDL_HINT_VIDEO_PARALLEL_BLIT, "0");
+    Run(op, src, srcrect, single, dstrect, color);
+    SDL_SetHint(SDL_HINT_VIDEO_PARALLEL_BLIT, "64");
+    Run(op, src, srcrect, split, dstrect, color);
+    Compare(operation_names[op], single, split, src ? src->format->format : dst->format->format, mode);
+
+    SDL_FreeSurface(single);
+    SDL_FreeSurface(split);
+}
+
+int
+main(int argc, char *argv[])
+{
+    int trials = DEFAULT_TRIALS;
+    int trial;
+
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    if (argc > 1) {
+        trials = SDL_max(SDL_atoi(argv[1]), 1);
+    }
+
+    if (SDL_Init(0) < 0) {
+        SDL_Log("Couldn't initialize SDL: %s", SDL_GetError());
+        return 1;
+    }
+    SDL_Log("%d CPUs", SDL_GetCPUCount());
+    if (SDL_GetCPUCount() < 2) {
+        SDL_Log("Nothing is split on a single CPU, this run only checks that the hint is harmless");
+    }
+
+    for (trial = 0; trial < trials; ++trial) {
+        const Uint32 src_format = formats[Random() % SDL_arraysize(formats)];
+        const Uint32 dst_format = formats[Random() % (SDL_arraysize(formats) - 1)];
+        const SDL_BlendMode mode = blend_modes[Random() % SDL_arraysize(blend_modes)];
+        const int src_w = 1 + Random() % 300, src_h = 1 + Random() % 300;
+        const int dst_w = 1 + Random() % 300, dst_h = 1 + Random() % 300;
+        SDL_Surface *src = CreateRandomSurface(src_format, src_w, src_h);
+        SDL_Surface *dst = CreateRandomSurface(dst_format, dst_w, dst_h);
+        SDL_Surface *same;
+        SDL_Rect srcrect, dstrect, rect;
+
+        SDL_SetSurfaceBlendMode(src, mode);
+        if (Random() & 1) {
+            SDL_SetSurfaceColorMod(src, (Uint8)Random(), (Uint8)Random(), (Uint8)Random());
+        }
+        if (Random() & 1) {
+            SDL_SetSurfaceAlphaMod(src, (Uint8)Random());
+        }
+
+        srcrect.x = Random() % src_w;
+        srcrect.y = Random() % src_h;
+        srcrect.w = 1 + Random() % (src_w - srcrect.x);
+        srcrect.h = 1 + Random() % (src_h - srcrect.y);
+        /* Partly outside the destination, so clipping is exercised too */
+        dstrect.x = (int)(Random() % (dst_w + 20)) - 10;
+        dstrect.y = (int)(Random() % (dst_h + 20)) - 10;
+        dstrect.w = 1 + Random() % 320;
+        dstrect.h = 1 + Random() % 320;
+
+        Check(OP_BLIT, src, &srcrect, dst, &dstrect, 0, mode);
+        Check(OP_BLIT_SCALED, src, &srcrect, dst, &dstrect, 0, mode);
+        Check(OP_FILL, NULL, NULL, dst, &dstrect, Random(), SDL_BLENDMODE_NONE);
+
+        /* The stretches need a source of the destination's format, and a
+           rectangle inside the destination */
+        same = CreateRandomSurface(dst_format, src_w, src_h);
+        rect.x = Random() % dst_w;
+        rect.y = Random() % dst_h;
+        rect.w = 1 + Random() % (dst_w - rect.x);
+        rect.h = 1 + Random() % (dst_h - rect.y);
+        Check(OP_STRETCH, same, &srcrect, dst, &rect, 0, SDL_BLENDMODE_NONE);
+        if (SDL_BYTESPERPIXEL(dst_format) == 4 && dst_format != SDL_PIXELFORMAT_ARGB2101010) {
+            Check(OP_STRETCH_LINEAR, same, &srcrect, dst, &rect, 0, SDL_BLENDMODE_NONE);
+        }
+
+        SDL_FreeSurface(same);
+        SDL_FreeSurface(src);
+        SDL_FreeSurface(dst);
+    }
+
+    SDL_Log("%d of %d checks matched", checks - failures, checks);
+    SDL_Quit();
+    return failures ? 1 : 0;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -0,0 +1,145 @@
+/*
+  Copyright (C) 1997-2023 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Benchmark of 1080p and 4K software blits, scaling and fills with
+   SDL_HINT_VIDEO_PARALLEL_BLIT off and on.  Prints the best time of several
+   runs of each.
+
+   Usage: testscalebench [runs]
+ */
+
+#include <stdlib.h>
+
+#include "SDL.h"
+
+#define DEFAULT_RUNS 10
+
+typedef enum
+{
+    BENCH_BLEND,
+    BENCH_SCALE,
+    BENCH_SCALE_BLEND,
+    BENCH_SCALE_LINEAR,
+    BENCH_FILL
+} Benchmark;
+
+static int runs = DEFAULT_RUNS;
+static SDL_Surface *source;
+
+static double
+Milliseconds(void)
+{
+    return (double)SDL_GetPerformanceCounter() * 1000.0 / SDL_GetPerformanceFrequency();
+}
+
+static void
+Run(Benchmark which, SDL_Surface *dst)
+{
+    SDL_Rect rect;
+
+    rect.x = 0;
+    rect.y = 0;
+    rect.w = dst->w;
+    rect.h = dst->h;
+
+    switch (which) {
+    case BENCH_BLEND:
+        SDL_SetSurfaceBlendMode(source, SDL_BLENDMODE_BLEND);
+        SDL_BlitSurface(source, NULL, dst, &rect);
+        break;
+    case BENCH_SCALE:
+        SDL_SetSurfaceBlendMode(source, SDL_BLENDMODE_NONE);
+        SDL_BlitScaled(source, NULL, dst, &rect);
+        break;
+    case BENCH_SCALE_BLEND:
+        SDL_SetSurfaceBlendMode(source, SDL_BLENDMODE_BLEND);
+        SDL_BlitScaled(source, NULL, dst, &rect);
+        break;
+    case BENCH_SCALE_LINEAR:
+        SDL_SoftStretchLinear(source, NULL, dst, &rect);
+        break;
+    case BENCH_FILL:
+        SDL_FillRect(dst, NULL, 0x12345678);
+        break;
+    }
+}
+
+static void
+Bench(const char *name, Benchmark which, int w, int h)
+{
+    SDL_Surface *dst = SDL_CreateRGBSurfaceWithFormat(0, w, h, 0, SDL_PIXELFORMAT_ARGB8888);
+    double best[2];
+    int hint, i;
+
+    if (!dst) {
+        SDL_Log("Couldn't create %dx%d surface: %s", w, h, SDL_GetError());
+        return;
+    }
+    for (hint = 0; hint < 2; ++hint) {
+        SDL_SetHint(SDL_HINT_VIDEO_PARALLEL_BLIT, hint ? "1" : "0");
+        best[hint] = 1e9;
+        for (i = 0; i < runs; ++i) {
+            double start = Milliseconds();
+            double elapsed;
+
+            Run(which, dst);
+            elapsed = Milliseconds() - start;
+            best[hint] = SDL_min(best[hint], elapsed);
+        }
+    }
+    SDL_Log("%-30s %8.2f ms %8.2f ms %6.2fx", name, best[0], best[1], best[0] / best[1]);
+    SDL_FreeSurface(dst);
+}
+
+int
+main(int argc, char *argv[])
+{
+    Uint32 *pixels;
+    int i;
+
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    if (argc > 1) {
+        runs = SDL_max(SDL_atoi(argv[1]), 1);
+    }
+
+    if (SDL_Init(0) < 0) {
+        SDL_Log("Couldn't initialize SDL: %s", SDL_GetError());
+        return 1;
+    }
+
+    source = SDL_CreateRGBSurfaceWithFormat(0, 1920, 1080, 0, SDL_PIXELFORMAT_ARGB8888);
+    if (!source) {
+        SDL_Log("Couldn't create source surface: %s", SDL_GetError());
+        return 1;
+    }
+    pixels = (Uint32 *)source->pixels;
+    for (i = 0; i < source->w * source->h; ++i) {
+        pixels[i] = (Uint32)rand() * 2654435761u;
+    }
+
+    SDL_Log("%d CPUs, best of %d runs", SDL_GetCPUCount(), runs);
+    SDL_Log("%-30s %11s %11s %7s", "", "hint 0", "hint 1", "speedup");
+    Bench("blend 1080p", BENCH_BLEND, 1920, 1080);
+    Bench("nearest 1080p -> 1080p", BENCH_SCALE, 1920, 1080);
+    Bench("nearest 1080p -> 4K", BENCH_SCALE, 3840, 2160);
+    Bench("nearest blend 1080p -> 4K", BENCH_SCALE_BLEND, 3840, 2160);
+    Bench("linear 1080p -> 4K", BENCH_SCALE_LINEAR, 3840, 2160);
+    Bench("fill 1080p", BENCH_FILL, 1920, 1080);
+    Bench("fill 4K", BENCH_FILL, 3840, 2160);
+
+    SDL_FreeSurface(source);
+    SDL_Quit();
+    return 0;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
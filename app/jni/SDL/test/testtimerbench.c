@@ -0,0 +1,193 @@
+/*
+  Copyright (C) 1997-2023 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Benchmark of SDL_AddTimer and SDL_RemoveTimer with many timers active,
+   like a server with a watchdog timer per client:
+
+   - adding the timers, far enough out that none of them fire
+   - removing a timer and adding a new one, while they are all active
+   - removing all of them
+   - how late timers spread over a second fire, with all of them active
+
+   The timer thread does most of the work of adding and removing timers, so
+   the first three are timed until a timer added last has fired, which the
+   timer thread only gets to after taking in everything added before it.
+
+   The last part fails the run if a timer fires early or not at all.
+
+   Usage: testtimerbench [timers]
+ */
+
+#include <stdlib.h>
+
+#include "SDL.h"
+
+#define DEFAULT_TIMERS  10000
+#define CHURN_LOOPS     100000
+#define FIRE_SPREAD_MS  1000
+#define FIRE_DELAY_MS   100
+
+static int num_timers = DEFAULT_TIMERS;
+static SDL_TimerID *ids;
+static Uint64 *due;
+
+/* Written by the timer thread only, read once they have all fired */
+static SDL_atomic_t fired;
+static int early;
+static Uint64 total_late;
+static Uint64 worst_late;
+
+static Uint64
+Now(void)
+{
+    const Uint64 counter = SDL_GetPerformanceCounter();
+    const Uint64 frequency = SDL_GetPerformanceFrequency();
+
+    /* Microseconds */
+    return (counter / frequency) * 1000000 + ((counter % frequency) * 1000000) / frequency;
+}
+
+static double
+Nanoseconds(Uint64 start, int count)
+{
+    return (double)(Now() - start) * 1000.0 / count;
+}
+
+static Uint32 SDLCALL
+Never(Uint32 interval, void *param)
+{
+    SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Timer %d fired too soon\n", (int)(intptr_t)param);
+    return 0;
+}
+
+static Uint32 SDLCALL
+Synced(Uint32 interval, void *param)
+{
+    SDL_AtomicSet((SDL_atomic_t *)param, 1);
+    return 0;
+}
+
+/* Waits for the timer thread to catch up with everything done so far */
+static void
+Sync(void)
+{
+    SDL_atomic_t synced;
+
+    SDL_AtomicSet(&synced, 0);
+    SDL_AddTimer(0, Synced, &synced);
+    while (!SDL_AtomicGet(&synced)) {
+        SDL_Delay(0);
+    }
+}
+
+static Uint32 SDLCALL
+Fire(Uint32 interval, void *param)
+{
+    const int i = (int)(intptr_t)param;
+    const Uint64 now = Now();
+
+    if (now < due[i]) {
+        ++early;
+    } else {
+        const Uint64 late = now - due[i];
+
+        total_late += late;
+        worst_late = SDL_max(worst_late, late);
+    }
+    SDL_AtomicIncRef(&fired);
+    return 0;
+}
+
+int
+main(int argc, char *argv[])
+{
+    SDL_bool ok = SDL_TRUE;
+    Uint64 start;
+    int i, waited;
+
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    if (argc > 1) {
+        num_timers = SDL_max(SDL_atoi(argv[1]), 1);
+    }
+
+    if (SDL_Init(SDL_INIT_TIMER) < 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return 1;
+    }
+    ids = (SDL_TimerID *)SDL_calloc(num_timers, sizeof(*ids));
+    due = (Uint64 *)SDL_calloc(num_timers, sizeof(*due));
+    if (!ids || !due) {
+        SDL_OutOfMemory();
+        return 1;
+    }
+
+    SDL_Log("%d timers on %d CPUs\n", num_timers, SDL_GetCPUCount());
+
+    /* Different intervals, so they aren't all added at the end of the queue */
+    start = Now();
+    for (i = 0; i < num_timers; ++i) {
+        ids[i] = SDL_AddTimer(1000000 + (i * 7919) % 1000000, Never, (void *)(intptr_t)i);
+    }
+    Sync();
+    SDL_Log("Add:             %8.0f ns per timer\n", Nanoseconds(start, num_timers));
+
+    start = Now();
+    for (i = 0; i < CHURN_LOOPS; ++i) {
+        const int which = i % num_timers;
+
+        SDL_RemoveTimer(ids[which]);
+        ids[which] = SDL_AddTimer(1000000 + (i * 7919) % 1000000, Never, (void *)(intptr_t)which);
+    }
+    Sync();
+    SDL_Log("Remove and add:  %8.0f ns per pair\n", Nanoseconds(start, CHURN_LOOPS));
+
+    start = Now();
+    for (i = 0; i < num_timers; ++i) {
+        if (!SDL_RemoveTimer(ids[i])) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't remove timer %d\n", i);
+            ok = SDL_FALSE;
+        }
+    }
+    Sync();
+    SDL_Log("Remove:          %8.0f ns per timer\n", Nanoseconds(start, num_timers));
+
+    /* Now let them all fire, spread over a second */
+    for (i = 0; i < num_timers; ++i) {
+        const Uint32 interval = FIRE_DELAY_MS + (Uint32)(((Uint64)i * FIRE_SPREAD_MS) / num_timers);
+
+        due[i] = Now() + (Uint64)interval * 1000;
+        ids[i] = SDL_AddTimer(interval, Fire, (void *)(intptr_t)i);
+    }
+    for (waited = 0; SDL_AtomicGet(&fired) < num_timers && waited < FIRE_DELAY_MS + FIRE_SPREAD_MS + 5000; waited += 10) {
+        SDL_Delay(10);
+    }
+
+    if (SDL_AtomicGet(&fired) < num_timers) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Only %d of %d timers fired\n", SDL_AtomicGet(&fired), num_timers);
+        ok = SDL_FALSE;
+    } else {
+        SDL_Log("Fire:            %8.1f us late on average, %.1f us at worst\n",
+                (double)total_late / (num_timers - early), (double)worst_late);
+    }
+    if (early) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "%d timers fired early\n", early);
+        ok = SDL_FALSE;
+    }
+
+    SDL_free(due);
+    SDL_free(ids);
+    SDL_Quit();
+    return ok ? 0 : 1;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -29,12 +29,22 @@
 #include FT_OUTLINE_H
 #include FT_STROKER_H
 #include FT_GLYPH_H
+#include FT_SIZES_H
 #include FT_TRUETYPE_IDS_H
 
 #include "SDL.h"
 #include "SDL_endian.h"
 #include "SDL_ttf.h"
 
+/* Fonts opened by file name are memory mapped and their faces shared */
+#if defined(__unix__) || defined(__APPLE__) || defined(__ANDROID__)
+#define TTF_USE_MMAP
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
 /* FIXME: Right now we assume the gray-scale renderer Freetype is using
    supports 256 shades of gray, but we should instead key off of num_grays
    in the result FT_Bitmap after the FT_Render_Glyph() call. */
@@ -51,6 +61,7 @@
 #define CACHED_METRICS  0x10
 #define CACHED_BITMAP   0x01
 #define CACHED_PIXMAP   0x02
+#define CACHED_SDF      0x04
 
 /* Cached glyph information */
 typedef struct cached_glyph {
@@ -58,6 +69,7 @@ typedef struct cached_glyph {
     FT_UInt index;
     FT_Bitmap bitmap;
     FT_Bitmap pixmap;
+    FT_Bitmap sdf;
     int minx;
     int maxx;
     int miny;
@@ -67,6 +79,28 @@ typedef struct cached_glyph {
     SDL_bool is_cached;
 } c_glyph;
 
+/* A memory mapped font file face, shared by all the fonts opened from it */
+typedef struct TTF_SharedFace {
+    FT_Face face;
+    long index;
+    int refcount;
+
+    /* Serializes access to the face for every font using it */
+    SDL_mutex *lock;
+
+#ifdef TTF_USE_MMAP
+    /* File identity, used to find the face again */
+    dev_t dev;
+    ino_t ino;
+    off_t size;
+    time_t mtime;
+#endif
+    void *map;
+    size_t map_size;
+
+    struct TTF_SharedFace *next;
+} TTF_SharedFace;
+
 /* The structure used to hold internal font information */
 struct _TTF_Font {
     /* Freetype2 maintains all sorts of useful info itself */
@@ -98,9 +132,18 @@ struct _TTF_Font {
     int strikethrough_top_row;
 
     /* Cache for style-transformed glyphs */
-    c_glyph *current;
     c_glyph cache[257]; /* 257 is a prime */
 
+    /* Incremented whenever the cache is flushed, so glyph atlases know */
+    int generation;
+
+    /* Serializes access to the glyph cache and the settings across threads */
+    SDL_mutex *lock;
+
+    /* Set when the face is shared with other fonts, each with its own size */
+    TTF_SharedFace *shared;
+    FT_Size size;
+
     /* We are responsible for closing the font stream */
     SDL_RWops *src;
     int freesrc;
@@ -108,6 +151,18 @@ struct _TTF_Font {
 
     /* really just flags passed into FT_Load_Glyph */
     int hinting;
+
+    /* Copies of the font with their own face and glyph cache, used by
+       threads that find the font busy; see TTF_AcquireFont() */
+    int ptsize;
+    int serial;
+    SDL_mutex *clone_lock;
+    TTF_Font *clones;
+    TTF_Font *next_clone;
+    int num_clones;
+
+    /* The font file read into memory, for the faces of the clones */
+    void *data;
 };
 
 /* Handle a style only if the font does not already handle it */
@@ -126,6 +181,48 @@ static FT_Library library;
 static int TTF_initialized = 0;
 static int TTF_byteswapped = 0;
 
+/* FreeType only allows one thread at a time to create or destroy objects
+   owned by the library, so face and stroker lifetime goes through this.
+   It also protects the list of shared faces. */
+static SDL_SpinLock TTF_init_lock = 0;
+static SDL_mutex *TTF_library_lock = NULL;
+static TTF_SharedFace *TTF_shared_faces = NULL;
+
+#define TTF_LockLibrary()   SDL_LockMutex(TTF_library_lock)
+#define TTF_UnlockLibrary() SDL_UnlockMutex(TTF_library_lock)
+
+/* A font may be shared between threads; the face and the glyph cache are
+   only touched with the font lock held.  SDL mutexes are recursive, so
+   public functions calling each other is fine. */
+#define TTF_LockFont(font)      SDL_LockMutex((font)->lock)
+#define TTF_TryLockFont(font)   SDL_TryLockMutex((font)->lock)
+#define TTF_UnlockFont(font)    SDL_UnlockMutex((font)->lock)
+
+/* Fonts sharing a face also take the face lock, inside the font lock,
+   around the FreeType calls on the face, and make their own size the
+   active one while holding it. */
+static void TTF_LockFace(const TTF_Font *font)
+{
+    if (font->shared) {
+        SDL_LockMutex(font->shared->lock);
+        FT_Activate_Size(font->size);
+    }
+}
+
+static void TTF_UnlockFace(const TTF_Font *font)
+{
+    if (font->shared) {
+        SDL_UnlockMutex(font->shared->lock);
+    }
+}
+
+/* The settings the clones copy are only changed with both locks held */
+#define TTF_LockClones(font)    SDL_LockMutex((font)->clone_lock)
+#define TTF_UnlockClones(font)  SDL_UnlockMutex((font)->clone_lock)
+
+/* The most clones a font makes, past that threads wait for the font */
+#define TTF_MAX_CLONES  16
+
 #define TTF_CHECKPOINTER(p, errval)                 \
     if (!TTF_initialized) {                   \
         TTF_SetError("Library not initialized");        \
@@ -168,6 +265,41 @@ static void TTF_drawLine_Blended(const TTF_Font *font, const SDL_Surface *textbu
     }
 }
 
+/* Draw the distance field of a line of underline_height at the given row.
+   The row is relative to the unpadded text, the line spans the text width. */
+static void TTF_drawLine_SDF(const TTF_Font *font, const SDL_Surface *textbuf, int row, Uint32 color)
+{
+    const int pad = TTF_SDF_SPREAD;
+    const float scale = 127.0f / TTF_SDF_SPREAD;
+    int top = row + pad;
+    int bottom = top + font->underline_height - 1;
+    int left = pad;
+    int right = textbuf->w - pad - 1;
+    int x, y;
+
+    for (y = SDL_max(top - pad, 0); y <= SDL_min(bottom + pad, textbuf->h - 1); ++y) {
+        Uint32 *dst = (Uint32 *)textbuf->pixels + y * textbuf->pitch/4;
+        int dy = SDL_max(SDL_max(top - y, y - bottom), 0);
+        for (x = 0; x < textbuf->w; ++x) {
+            int dx = SDL_max(SDL_max(left - x, x - right), 0);
+            float dist;
+            int value;
+
+            if (dx == 0 && dy == 0) {
+                int inner = SDL_min(SDL_min(y - top, bottom - y), SDL_min(x - left, right - x));
+                dist = inner + 0.5f;
+            } else {
+                dist = 0.5f - SDL_sqrtf((float)(dx * dx + dy * dy));
+            }
+            value = 128 + (int)SDL_floorf(dist * scale + 0.5f);
+            value = SDL_max(0, SDL_min(value, 255));
+            if ((Uint32)value > (dst[x] >> 24)) {
+                dst[x] = color | ((Uint32)value << 24);
+            }
+        }
+    }
+}
+
 /* rcg06192001 get linked library's version. */
 const SDL_version *TTF_Linked_Version(void)
 {
@@ -221,19 +353,123 @@ int TTF_Init(void)
 {
     int status = 0;
 
+    SDL_AtomicLock(&TTF_init_lock);
     if (!TTF_initialized) {
         FT_Error error = FT_Init_FreeType(&library);
         if (error) {
             TTF_SetFTError("Couldn't init FreeType engine", error);
             status = -1;
+        } else {
+            TTF_library_lock = SDL_CreateMutex();
+            if (!TTF_library_lock) {
+                FT_Done_FreeType(library);
+                status = -1;
+            }
         }
     }
     if (status == 0) {
         ++TTF_initialized;
     }
+    SDL_AtomicUnlock(&TTF_init_lock);
     return status;
 }
 
+/* Pick a Unicode charmap for a freshly opened face */
+static void TTF_SelectCharmap(FT_Face face)
+{
+    FT_CharMap found;
+    int i;
+
+    found = 0;
+#if 0 /* Font debug code */
+    for (i = 0; i < face->num_charmaps; i++) {
+        FT_CharMap charmap = face->charmaps[i];
+        SDL_Log("Found charmap: platform id %d, encoding id %d", charmap->platform_id, charmap->encoding_id);
+    }
+#endif
+    if (!found) {
+        for (i = 0; i < face->num_charmaps; i++) {
+            FT_CharMap charmap = face->charmaps[i];
+            if (charmap->platform_id == 3 && charmap->encoding_id == 10) { /* UCS-4 Unicode */
+                found = charmap;
+                break;
+            }
+        }
+    }
+    if (!found) {
+        for (i = 0; i < face->num_charmaps; i++) {
+            FT_CharMap charmap = face->charmaps[i];
+            if ((charmap->platform_id == 3 && charmap->encoding_id == 1) /* Windows Unicode */
+             || (charmap->platform_id == 3 && charmap->encoding_id == 0) /* Windows Symbol */
+             || (charmap->platform_id == 2 && charmap->encoding_id == 1) /* ISO Unicode */
+             || (charmap->platform_id == 0)) { /* Apple Unicode */
+                found = charmap;
+                break;
+            }
+        }
+    }
+    if (found) {
+        /* If this fails, continue using the default charmap */
+        FT_Set_Charmap(face, found);
+    }
+}
+
+/* Set up the style and size of a font whose face is open and whose
+   size, if it has one, is active */
+static int TTF_SetupFont(TTF_Font *font, int ptsize)
+{
+    FT_Face face = font->face;
+    FT_Error error;
+
+    font->ptsize = ptsize;
+    font->outline = 0;
+    font->kerning = 1;
+    font->use_kerning = FT_HAS_KERNING(face);
+
+    /* Initialize the font face style */
+    font->face_style = TTF_STYLE_NORMAL;
+    if (font->face->style_flags & FT_STYLE_FLAG_BOLD) {
+        font->face_style |= TTF_STYLE_BOLD;
+    }
+    if (font->face->style_flags & FT_STYLE_FLAG_ITALIC) {
+        font->face_style |= TTF_STYLE_ITALIC;
+    }
+
+    /* Set the default font style */
+    font->style = font->face_style;
+
+    /* Make sure that our font face is scalable (global metrics) */
+    if (FT_IS_SCALABLE(face)) {
+        /* Set the character size and use default DPI (72) */
+        error = FT_Set_Char_Size(font->face, 0, ptsize * 64, 0, 0);
+        if (error) {
+            TTF_SetFTError("Couldn't set font size", error);
+            return -1;
+        }
+    } else {
+        /* Non-scalable font case.  ptsize determines which family
+         * or series of fonts to grab from the non-scalable format.
+         * It is not the point size of the font.
+         * */
+        if (font->face->num_fixed_sizes <= 0) {
+            TTF_SetError("Couldn't select size : no num_fixed_sizes");
+            return -1;
+        }
+
+        /* within [0; num_fixed_sizes - 1] */
+        ptsize = SDL_max(ptsize, 0);
+        ptsize = SDL_min(ptsize, font->face->num_fixed_sizes - 1);
+
+        error = FT_Select_Size(face, ptsize);
+        if (error) {
+            TTF_SetFTError("Couldn't select size", error);
+            return -1;
+        }
+    }
+
+    return TTF_initFontMetrics(font);
+}
+
 static unsigned long RWread(
     FT_Stream stream,
     unsigned long offset,
@@ -255,11 +491,8 @@ TTF_Font* TTF_OpenFontIndexRW(SDL_RWops *src, int freesrc, int ptsize, long inde
 {
     TTF_Font *font;
     FT_Error error;
-    FT_Face face;
     FT_Stream stream;
-    FT_CharMap found;
     Sint64 position;
-    int i;
 
     if (!TTF_initialized) {
         TTF_SetError("Library not initialized");
@@ -297,6 +530,13 @@ TTF_Font* TTF_OpenFontIndexRW(SDL_RWops *src, int freesrc, int ptsize, long inde
     font->src = src;
     font->freesrc = freesrc;
 
+    font->lock = SDL_CreateMutex();
+    font->clone_lock = SDL_CreateMutex();
+    if (font->lock == NULL || font->clone_lock == NULL) {
+        TTF_CloseFont(font);
+        return NULL;
+    }
+
     stream = (FT_Stream)SDL_malloc(sizeof(*stream));
     if (stream == NULL) {
         TTF_SetError("Out of memory");
@@ -313,96 +553,19 @@ TTF_Font* TTF_OpenFontIndexRW(SDL_RWops *src, int freesrc, int ptsize, long inde
     font->args.flags = FT_OPEN_STREAM;
     font->args.stream = stream;
 
+    TTF_LockLibrary();
     error = FT_Open_Face(library, &font->args, index, &font->face);
+    TTF_UnlockLibrary();
     if (error) {
         TTF_SetFTError("Couldn't load font file", error);
         TTF_CloseFont(font);
         return NULL;
     }
-    face = font->face;
-
-    /* Set charmap for loaded font */
-    found = 0;
-#if 0 /* Font debug code */
-    for (i = 0; i < face->num_charmaps; i++) {
-        FT_CharMap charmap = face->charmaps[i];
-        SDL_Log("Found charmap: platform id %d, encoding id %d", charmap->platform_id, charmap->encoding_id);
-    }
-#endif
-    if (!found) {
-        for (i = 0; i < face->num_charmaps; i++) {
-            FT_CharMap charmap = face->charmaps[i];
-            if (charmap->platform_id == 3 && charmap->encoding_id == 10) { /* UCS-4 Unicode */
-                found = charmap;
-                break;
-            }
-        }
-    }
-    if (!found) {
-        for (i = 0; i < face->num_charmaps; i++) {
-            FT_CharMap charmap = face->charmaps[i];
-            if ((charmap->platform_id == 3 && charmap->encoding_id == 1) /* Windows Unicode */
-             || (charmap->platform_id == 3 && charmap->encoding_id == 0) /* Windows Symbol */
-             || (charmap->platform_id == 2 && charmap->encoding_id == 1) /* ISO Unicode */
-             || (charmap->platform_id == 0)) { /* Apple Unicode */
-                found = charmap;
-                break;
-            }
-        }
-    }
-    if (found) {
-        /* If this fails, continue using the default charmap */
-        FT_Set_Charmap(face, found);
-    }
-
-    font->outline = 0;
-    TTF_SetFontKerning(font, 1);
-
-    /* Initialize the font face style */
-    font->face_style = TTF_STYLE_NORMAL;
-    if (font->face->style_flags & FT_STYLE_FLAG_BOLD) {
-        font->face_style |= TTF_STYLE_BOLD;
-    }
-    if (font->face->style_flags & FT_STYLE_FLAG_ITALIC) {
-        font->face_style |= TTF_STYLE_ITALIC;
-    }
-
-    /* Set the default font style */
-    font->style = font->face_style;
-
-    /* Make sure that our font face is scalable (global metrics) */
-    if (FT_IS_SCALABLE(face)) {
-        /* Set the character size and use default DPI (72) */
-        error = FT_Set_Char_Size(font->face, 0, ptsize * 64, 0, 0);
-        if (error) {
-            TTF_SetFTError("Couldn't set font size", error);
-            TTF_CloseFont(font);
-            return NULL;
-        }
-    } else {
-        /* Non-scalable font case.  ptsize determines which family
-         * or series of fonts to grab from the non-scalable format.
-         * It is not the point size of the font.
-         * */
-        if (font->face->num_fixed_sizes <= 0) {
-            TTF_SetError("Couldn't select size : no num_fixed_sizes");
-            TTF_CloseFont(font);
-            return NULL;
-        }
-
-        /* within [0; num_fixed_sizes - 1] */
-        ptsize = SDL_max(ptsize, 0);
-        ptsize = SDL_min(ptsize, font->face->num_fixed_sizes - 1);
 
-        error = FT_Select_Size(face, ptsize);
-        if (error) {
-            TTF_SetFTError("Couldn't select size", error);
-            TTF_CloseFont(font);
-            return NULL;
-        }
-    }
+    TTF_SelectCharmap(font->face);
 
-    if (TTF_initFontMetrics(font) < 0) {
+    if (TTF_SetupFont(font, ptsize) < 0) {
+        TTF_CloseFont(font);
         return NULL;
     }
 
@@ -413,12 +576,14 @@ TTF_Font* TTF_OpenFontIndexRW(SDL_RWops *src, int freesrc, int ptsize, long inde
 static int TTF_initFontMetrics(TTF_Font *font)
 {
     FT_Face face = font->face;
+    /* The active size of a shared face may belong to another font */
+    const FT_Size_Metrics *size = font->size ? &font->size->metrics : &face->size->metrics;
 
     /* Make sure that our font face is scalable (global metrics) */
     if (FT_IS_SCALABLE(face)) {
 
         /* Get the scalable font metrics for this font */
-        FT_Fixed scale = face->size->metrics.y_scale;
+        FT_Fixed scale = size->y_scale;
         font->ascent   = FT_CEIL(FT_MulFix(face->ascender, scale));
         font->descent  = FT_CEIL(FT_MulFix(face->descender, scale));
         font->height   = FT_CEIL(FT_MulFix(face->ascender - face->descender, scale));
@@ -428,10 +593,10 @@ static int TTF_initFontMetrics(TTF_Font *font)
 
     } else {
         /* Get the font metrics for this font, for the selected size */
-        font->ascent   = FT_CEIL(face->size->metrics.ascender);
-        font->descent  = FT_CEIL(face->size->metrics.descender);
-        font->height   = FT_CEIL(face->size->metrics.height);
-        font->lineskip = FT_CEIL(face->size->metrics.height);
+        font->ascent   = FT_CEIL(size->ascender);
+        font->descent  = FT_CEIL(size->descender);
+        font->height   = FT_CEIL(size->height);
+        font->lineskip = FT_CEIL(size->height);
         /* face->underline_position and face->underline_height are only
          * relevant for scalable formats (see freetype.h FT_FaceRec)*/
         font->underline_offset = font->descent / 2;
@@ -481,7 +646,7 @@ static int TTF_initFontMetrics(TTF_Font *font)
     SDL_Log("scalable=%d", FT_IS_SCALABLE(face));
 #endif
 
-    font->glyph_overhang = face->size->metrics.y_ppem / 10;
+    font->glyph_overhang = size->y_ppem / 10;
 
     return 0;
 }
@@ -491,61 +656,362 @@ TTF_Font* TTF_OpenFontRW(SDL_RWops *src, int freesrc, int ptsize)
     return TTF_OpenFontIndexRW(src, freesrc, ptsize, 0);
 }
 
-TTF_Font* TTF_OpenFontIndex(const char *file, int ptsize, long index)
+#ifdef TTF_USE_MMAP
+/* Map a font file and open a face on it; the library lock must be held */
+static TTF_SharedFace *TTF_MapSharedFace(int fd, const struct stat *st, long index)
 {
-    SDL_RWops *rw = SDL_RWFromFile(file, "rb");
-    if (rw == NULL) {
+    TTF_SharedFace *shared;
+    FT_Error error;
+
+    shared = (TTF_SharedFace *)SDL_calloc(1, sizeof(*shared));
+    if (shared == NULL) {
         return NULL;
     }
-    return TTF_OpenFontIndexRW(rw, 1, ptsize, index);
-}
 
-TTF_Font* TTF_OpenFont(const char *file, int ptsize)
-{
-    return TTF_OpenFontIndex(file, ptsize, 0);
-}
+    shared->map_size = (size_t)st->st_size;
+    shared->map = mmap(NULL, shared->map_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (shared->map == MAP_FAILED) {
+        SDL_free(shared);
+        return NULL;
+    }
 
-static void Flush_Glyph(c_glyph *glyph)
-{
-    glyph->stored = 0;
-    glyph->index = 0;
-    if (glyph->bitmap.buffer) {
-        SDL_free(glyph->bitmap.buffer);
-        glyph->bitmap.buffer = 0;
+    error = FT_New_Memory_Face(library, (const FT_Byte *)shared->map, (FT_Long)shared->map_size, index, &shared->face);
+    if (error) {
+        munmap(shared->map, shared->map_size);
+        SDL_free(shared);
+        return NULL;
     }
-    if (glyph->pixmap.buffer) {
-        SDL_free(glyph->pixmap.buffer);
-        glyph->pixmap.buffer = 0;
+
+    shared->lock = SDL_CreateMutex();
+    if (shared->lock == NULL) {
+        FT_Done_Face(shared->face);
+        munmap(shared->map, shared->map_size);
+        SDL_free(shared);
+        return NULL;
     }
-    glyph->is_cached = SDL_FALSE;
+
+    TTF_SelectCharmap(shared->face);
+    shared->index = index;
+    shared->dev = st->st_dev;
+    shared->ino = st->st_ino;
+    shared->size = st->st_size;
+    shared->mtime = st->st_mtime;
+    return shared;
 }
 
-static void Flush_Cache(TTF_Font *font)
+/* Find the shared face for a font file, mapping it if it isn't open yet.
+   Returns NULL if the file can't be mapped, e.g. it is an Android asset. */
+static TTF_SharedFace *TTF_AcquireSharedFace(const char *file, long index)
 {
-    int i;
-    int size = sizeof(font->cache) / sizeof(font->cache[0]);
+    TTF_SharedFace *shared;
+    struct stat st;
+    int fd;
 
-    for (i = 0; i < size; ++i) {
-        if (font->cache[i].is_cached) {
-            Flush_Glyph(&font->cache[i]);
+    fd = open(file, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return NULL;
+    }
+    if (fstat(fd, &st) < 0 || !S_ISREG(st.st_mode) || st.st_size <= 0) {
+        close(fd);
+        return NULL;
+    }
+
+    TTF_LockLibrary();
+    for (shared = TTF_shared_faces; shared; shared = shared->next) {
+        if (shared->dev == st.st_dev && shared->ino == st.st_ino &&
+            shared->size == st.st_size && shared->mtime == st.st_mtime &&
+            shared->index == index) {
+            ++shared->refcount;
+            break;
+        }
+    }
+    if (shared == NULL) {
+        shared = TTF_MapSharedFace(fd, &st, index);
+        if (shared) {
+            shared->refcount = 1;
+            shared->next = TTF_shared_faces;
+            TTF_shared_faces = shared;
         }
     }
+    TTF_UnlockLibrary();
+
+    close(fd);
+    return shared;
 }
 
-static FT_Error Load_Glyph(TTF_Font *font, Uint32 idx, c_glyph *cached, int want)
+static void TTF_ReleaseSharedFace(TTF_SharedFace *shared)
 {
-    FT_Face face;
-    FT_Error error;
-    FT_GlyphSlot glyph;
-    FT_Glyph_Metrics *metrics;
-    FT_Outline *outline;
+    TTF_LockLibrary();
+    if (--shared->refcount == 0) {
+        TTF_SharedFace **prev = &TTF_shared_faces;
+        while (*prev != shared) {
+            prev = &(*prev)->next;
+        }
+        *prev = shared->next;
 
-    if (!font || !font->face) {
-        return FT_Err_Invalid_Handle;
+        FT_Done_Face(shared->face);
+        munmap(shared->map, shared->map_size);
+        SDL_DestroyMutex(shared->lock);
+        SDL_free(shared);
     }
+    TTF_UnlockLibrary();
+}
+
+/* Create a font with its own size on a shared face */
+static TTF_Font *TTF_OpenFontShared(TTF_SharedFace *shared, int ptsize)
+{
+    TTF_Font *font;
+    FT_Error error;
+
+    font = (TTF_Font*)SDL_malloc(sizeof *font);
+    if (font == NULL) {
+        TTF_SetError("Out of memory");
+        TTF_ReleaseSharedFace(shared);
+        return NULL;
+    }
+    SDL_memset(font, 0, sizeof(*font));
+
+    font->shared = shared;
+    font->face = shared->face;
+
+    font->lock = SDL_CreateMutex();
+    font->clone_lock = SDL_CreateMutex();
+    if (font->lock == NULL || font->clone_lock == NULL) {
+        TTF_CloseFont(font);
+        return NULL;
+    }
+
+    SDL_LockMutex(shared->lock);
+    error = FT_New_Size(font->face, &font->size);
+    if (error) {
+        SDL_UnlockMutex(shared->lock);
+        TTF_SetFTError("Couldn't create font size", error);
+        TTF_CloseFont(font);
+        return NULL;
+    }
+    FT_Activate_Size(font->size);
+
+    if (TTF_SetupFont(font, ptsize) < 0) {
+        SDL_UnlockMutex(shared->lock);
+        TTF_CloseFont(font);
+        return NULL;
+    }
+    SDL_UnlockMutex(shared->lock);
+
+    return font;
+}
+#endif /* TTF_USE_MMAP */
+
+TTF_Font* TTF_OpenFontIndex(const char *file, int ptsize, long index)
+{
+    SDL_RWops *rw;
+
+#ifdef TTF_USE_MMAP
+    if (TTF_initialized && file) {
+        TTF_SharedFace *shared = TTF_AcquireSharedFace(file, index);
+        if (shared) {
+            return TTF_OpenFontShared(shared, ptsize);
+        }
+    }
+#endif
+
+    rw = SDL_RWFromFile(file, "rb");
+    if (rw == NULL) {
+        return NULL;
+    }
+    return TTF_OpenFontIndexRW(rw, 1, ptsize, index);
+}
+
+TTF_Font* TTF_OpenFont(const char *file, int ptsize)
+{
+    return TTF_OpenFontIndex(file, ptsize, 0);
+}
+
+static void Flush_Glyph(c_glyph *glyph)
+{
+    glyph->stored = 0;
+    glyph->index = 0;
+    if (glyph->bitmap.buffer) {
+        SDL_free(glyph->bitmap.buffer);
+        glyph->bitmap.buffer = 0;
+    }
+    if (glyph->pixmap.buffer) {
+        SDL_free(glyph->pixmap.buffer);
+        glyph->pixmap.buffer = 0;
+    }
+    if (glyph->sdf.buffer) {
+        SDL_free(glyph->sdf.buffer);
+        glyph->sdf.buffer = 0;
+    }
+    glyph->is_cached = SDL_FALSE;
+}
+
+static void Flush_Cache(TTF_Font *font)
+{
+    int i;
+    int size = sizeof(font->cache) / sizeof(font->cache[0]);
+
+    for (i = 0; i < size; ++i) {
+        if (font->cache[i].is_cached) {
+            Flush_Glyph(&font->cache[i]);
+        }
+    }
+    ++font->generation;
+}
+
+/* Offset to the nearest seed pixel, used by the distance transform */
+typedef struct {
+    int dx, dy;
+} SDF_Point;
+
+#define SDF_FAR         9999
+
+static SDL_INLINE int SDF_Dist2(const SDF_Point *p)
+{
+    return p->dx * p->dx + p->dy * p->dy;
+}
+
+static SDL_INLINE void SDF_Compare(SDF_Point *grid, int w, int h, int x, int y, int ox, int oy)
+{
+    SDF_Point other;
+    SDF_Point *p = &grid[y * w + x];
+
+    if (x + ox < 0 || x + ox >= w || y + oy < 0 || y + oy >= h) {
+        return;
+    }
+    other = grid[(y + oy) * w + (x + ox)];
+    other.dx += ox;
+    other.dy += oy;
+    if (SDF_Dist2(&other) < SDF_Dist2(p)) {
+        *p = other;
+    }
+}
+
+/* Two pass 8-point sequential signed Euclidean distance transform (8SSEDT) */
+static void SDF_Propagate(SDF_Point *grid, int w, int h)
+{
+    int x, y;
+
+    for (y = 0; y < h; ++y) {
+        for (x = 0; x < w; ++x) {
+            SDF_Compare(grid, w, h, x, y, -1,  0);
+            SDF_Compare(grid, w, h, x, y,  0, -1);
+            SDF_Compare(grid, w, h, x, y, -1, -1);
+            SDF_Compare(grid, w, h, x, y,  1, -1);
+        }
+        for (x = w - 1; x >= 0; --x) {
+            SDF_Compare(grid, w, h, x, y,  1,  0);
+        }
+    }
+    for (y = h - 1; y >= 0; --y) {
+        for (x = w - 1; x >= 0; --x) {
+            SDF_Compare(grid, w, h, x, y,  1,  0);
+            SDF_Compare(grid, w, h, x, y,  0,  1);
+            SDF_Compare(grid, w, h, x, y, -1,  1);
+            SDF_Compare(grid, w, h, x, y,  1,  1);
+        }
+        for (x = 0; x < w; ++x) {
+            SDF_Compare(grid, w, h, x, y, -1,  0);
+        }
+    }
+}
+
+/* Build the signed distance field of a cached pixmap.  The field is padded
+   by TTF_SDF_SPREAD pixels on every side; 128 is the glyph edge, larger
+   values are inside and each TTF_SDF_SPREAD pixels away from the edge
+   moves the value by 127. */
+static FT_Error Build_GlyphSDF(c_glyph *cached)
+{
+    const FT_Bitmap *src = &cached->pixmap;
+    FT_Bitmap *dst = &cached->sdf;
+    const int pad = TTF_SDF_SPREAD;
+    const float scale = 127.0f / TTF_SDF_SPREAD;
+    int w = (int)src->width + 2 * pad;
+    int h = (int)src->rows + 2 * pad;
+    SDF_Point *inside, *outside;
+    int x, y;
+
+    inside = (SDF_Point *)SDL_malloc(2 * w * h * sizeof(SDF_Point));
+    dst->buffer = (unsigned char *)SDL_malloc(w * h);
+    if (!inside || !dst->buffer) {
+        SDL_free(inside);
+        SDL_free(dst->buffer);
+        dst->buffer = NULL;
+        return FT_Err_Out_Of_Memory;
+    }
+    outside = inside + w * h;
+
+    /* Seed: 'inside' holds the offset to the nearest inside pixel,
+       'outside' the offset to the nearest outside pixel. */
+    for (y = 0; y < h; ++y) {
+        for (x = 0; x < w; ++x) {
+            int sx = x - pad, sy = y - pad;
+            int coverage = 0;
+            SDF_Point seed = { 0, 0 };
+            SDF_Point far = { SDF_FAR, SDF_FAR };
+
+            if (sx >= 0 && sx < (int)src->width && sy >= 0 && sy < (int)src->rows) {
+                coverage = src->buffer[sy * src->pitch + sx];
+            }
+            if (coverage >= NUM_GRAYS / 2) {
+                inside[y * w + x] = seed;
+                outside[y * w + x] = far;
+            } else {
+                inside[y * w + x] = far;
+                outside[y * w + x] = seed;
+            }
+        }
+    }
+
+    SDF_Propagate(inside, w, h);
+    SDF_Propagate(outside, w, h);
+
+    for (y = 0; y < h; ++y) {
+        for (x = 0; x < w; ++x) {
+            int sx = x - pad, sy = y - pad;
+            int coverage = 0;
+            float dist;
+            int value;
+
+            if (sx >= 0 && sx < (int)src->width && sy >= 0 && sy < (int)src->rows) {
+                coverage = src->buffer[sy * src->pitch + sx];
+            }
+            if (coverage > 0 && coverage < NUM_GRAYS - 1) {
+                /* Anti-aliased edge pixel: coverage gives a sub-pixel distance */
+                dist = (float)coverage / (NUM_GRAYS - 1) - 0.5f;
+            } else if (coverage >= NUM_GRAYS / 2) {
+                dist = SDL_sqrtf((float)SDF_Dist2(&outside[y * w + x])) - 0.5f;
+            } else {
+                dist = 0.5f - SDL_sqrtf((float)SDF_Dist2(&inside[y * w + x]));
+            }
+            value = 128 + (int)SDL_floorf(dist * scale + 0.5f);
+            dst->buffer[y * w + x] = (unsigned char)SDL_max(0, SDL_min(value, 255));
+        }
+    }
+    SDL_free(inside);
+
+    dst->width = w;
+    dst->rows = h;
+    dst->pitch = w;
+    dst->pixel_mode = FT_PIXEL_MODE_GRAY;
+    cached->stored |= CACHED_SDF;
+    return 0;
+}
+
+static FT_Error Load_Glyph(TTF_Font *font, Uint32 idx, c_glyph *cached, int want)
+{
+    FT_Face face;
+    FT_Error error;
+    FT_GlyphSlot glyph;
+    FT_Glyph_Metrics *metrics;
+    FT_Outline *outline;
+
+    if (!font || !font->face) {
+        return FT_Err_Invalid_Handle;
+    }
+
+    face = font->face;
 
-    face = font->face;
-
     /* Load the glyph */
     cached->index = idx;
 
@@ -631,13 +1097,18 @@ static FT_Error Load_Glyph(TTF_Font *font, Uint32 idx, c_glyph *cached, int want
         if ((font->outline > 0) && glyph->format != FT_GLYPH_FORMAT_BITMAP) {
             FT_Stroker stroker;
             FT_Get_Glyph(glyph, &bitmap_glyph);
+            TTF_LockLibrary();
             error = FT_Stroker_New(library, &stroker);
+            TTF_UnlockLibrary();
             if (error) {
+                FT_Done_Glyph(bitmap_glyph);
                 return error;
             }
             FT_Stroker_Set(stroker, font->outline * 64, FT_STROKER_LINECAP_ROUND, FT_STROKER_LINEJOIN_ROUND, 0);
             FT_Glyph_Stroke(&bitmap_glyph, stroker, 1 /* delete the original glyph */);
+            TTF_LockLibrary();
             FT_Stroker_Done(stroker);
+            TTF_UnlockLibrary();
             /* Render the glyph */
             error = FT_Glyph_To_Bitmap(&bitmap_glyph, mono ? ft_render_mode_mono : ft_render_mode_normal, 0, 1);
             if (error) {
@@ -858,35 +1329,94 @@ static FT_Error Load_Glyph(TTF_Font *font, Uint32 idx, c_glyph *cached, int want
     return 0;
 }
 
-static FT_Error Find_GlyphByIndex(TTF_Font *font, FT_UInt idx, int want)
+/* The returned glyph stays valid until the next lookup on this font, so the
+   font lock must be held from the lookup until the glyph is no longer used. */
+static FT_Error Find_GlyphByIndex(TTF_Font *font, FT_UInt idx, int want, c_glyph **out_glyph)
 {
     int retval = 0;
     int hsize = sizeof(font->cache) / sizeof(font->cache[0]);
 
     int h = idx % hsize;
-    font->current = &font->cache[h];
+    c_glyph *glyph = &font->cache[h];
 
-    if (font->current->is_cached && font->current->index != idx) {
-        Flush_Glyph(font->current);
+    if (want & CACHED_SDF) {
+        want |= CACHED_PIXMAP;
     }
 
-    if ((font->current->stored & want) != want) {
-        retval = Load_Glyph(font, idx, font->current, want);
+    if (glyph->is_cached && glyph->index != idx) {
+        Flush_Glyph(glyph);
     }
+
+    if ((glyph->stored & want & ~CACHED_SDF) != (want & ~CACHED_SDF)) {
+        TTF_LockFace(font);
+        retval = Load_Glyph(font, idx, glyph, want);
+        TTF_UnlockFace(font);
+    }
+
+    /* The distance field is derived from the gray-scale pixmap, so it
+       doesn't need the face */
+    if (!retval && (want & CACHED_SDF) && !(glyph->stored & CACHED_SDF) &&
+        (glyph->stored & CACHED_PIXMAP)) {
+        retval = Build_GlyphSDF(glyph);
+    }
+    *out_glyph = glyph;
     return retval;
 }
 
-static FT_Error Find_Glyph(TTF_Font *font, Uint32 ch, int want) {
-    Uint32 idx = FT_Get_Char_Index(font->face, ch);
-    return Find_GlyphByIndex(font, idx, want);
+static FT_Error Find_Glyph(TTF_Font *font, Uint32 ch, int want, c_glyph **out_glyph) {
+    Uint32 idx;
+
+    TTF_LockFace(font);
+    idx = FT_Get_Char_Index(font->face, ch);
+    TTF_UnlockFace(font);
+    return Find_GlyphByIndex(font, idx, want, out_glyph);
+}
+
+static FT_Error Get_Kerning(TTF_Font *font, FT_UInt prev_index, FT_UInt index, FT_Vector *delta)
+{
+    FT_Error error;
+
+    TTF_LockFace(font);
+    error = FT_Get_Kerning(font->face, prev_index, index, ft_kerning_default, delta);
+    TTF_UnlockFace(font);
+    return error;
 }
 
 void TTF_CloseFont(TTF_Font *font)
 {
+    if (font) {
+        while (font->clones) {
+            TTF_Font *clone = font->clones;
+            font->clones = clone->next_clone;
+            TTF_CloseFont(clone);
+        }
+        if (font->clone_lock) {
+            SDL_DestroyMutex(font->clone_lock);
+        }
+        SDL_free(font->data);
+    }
+#ifdef TTF_USE_MMAP
+    if (font && font->shared) {
+        Flush_Cache(font);
+        if (font->size) {
+            SDL_LockMutex(font->shared->lock);
+            FT_Done_Size(font->size);
+            SDL_UnlockMutex(font->shared->lock);
+        }
+        TTF_ReleaseSharedFace(font->shared);
+        if (font->lock) {
+            SDL_DestroyMutex(font->lock);
+        }
+        SDL_free(font);
+        return;
+    }
+#endif
     if (font) {
         Flush_Cache(font);
         if (font->face) {
+            TTF_LockLibrary();
             FT_Done_Face(font->face);
+            TTF_UnlockLibrary();
         }
         if (font->args.stream) {
             SDL_free(font->args.stream);
@@ -894,10 +1424,141 @@ void TTF_CloseFont(TTF_Font *font)
         if (font->freesrc) {
             SDL_RWclose(font->src);
         }
+        if (font->lock) {
+            SDL_DestroyMutex(font->lock);
+        }
         SDL_free(font);
     }
 }
 
+/* Create a copy of a font with its own face and glyph cache, opened on the
+   same font data.  The font lock must be held; the clone comes back locked. */
+static TTF_Font *TTF_CloneFont(TTF_Font *font)
+{
+    TTF_Font *clone;
+    const FT_Byte *data;
+    FT_Long data_size;
+    FT_Error error;
+
+#ifdef TTF_USE_MMAP
+    if (font->shared) {
+        data = (const FT_Byte *)font->shared->map;
+        data_size = (FT_Long)font->shared->map_size;
+    } else
+#endif
+    {
+        FT_Stream stream = font->args.stream;
+
+        /* The font stream can't be read by two faces at once */
+        if (font->data == NULL) {
+            font->data = SDL_malloc(stream->size);
+            if (font->data == NULL) {
+                return NULL;
+            }
+            if (RWread(stream, 0, (unsigned char *)font->data, stream->size) != stream->size) {
+                SDL_free(font->data);
+                font->data = NULL;
+                return NULL;
+            }
+        }
+        data = (const FT_Byte *)font->data;
+        data_size = (FT_Long)stream->size;
+    }
+
+    clone = (TTF_Font *)SDL_calloc(1, sizeof(*clone));
+    if (clone == NULL) {
+        return NULL;
+    }
+    clone->lock = SDL_CreateMutex();
+    if (clone->lock == NULL) {
+        SDL_free(clone);
+        return NULL;
+    }
+
+    TTF_LockLibrary();
+    error = FT_New_Memory_Face(library, data, data_size, font->face->face_index, &clone->face);
+    TTF_UnlockLibrary();
+    if (error) {
+        TTF_CloseFont(clone);
+        return NULL;
+    }
+    TTF_SelectCharmap(clone->face);
+
+    if (TTF_SetupFont(clone, font->ptsize) < 0) {
+        TTF_CloseFont(clone);
+        return NULL;
+    }
+    clone->style = font->style;
+    clone->outline = font->outline;
+    clone->hinting = font->hinting;
+    clone->kerning = font->kerning;
+    clone->use_kerning = font->use_kerning;
+    clone->serial = font->serial;
+    TTF_initFontMetrics(clone);
+
+    SDL_LockMutex(clone->lock);
+    TTF_LockClones(font);
+    clone->next_clone = font->clones;
+    font->clones = clone;
+    ++font->num_clones;
+    TTF_UnlockClones(font);
+    return clone;
+}
+
+/* Lock a font for rendering.  If another thread is using the font, this
+   picks one of its idle clones instead, or makes a new one, so threads
+   sharing a font don't wait for each other.  The clones pick up setting
+   changes here, and they render the same glyphs as the font would.
+   Unlock the returned font with TTF_UnlockFont() when done. */
+static TTF_Font *TTF_AcquireFont(TTF_Font *font)
+{
+    TTF_Font *clone;
+    SDL_bool changed = SDL_FALSE;
+    SDL_bool full;
+
+    if (TTF_TryLockFont(font) == 0) {
+        return font;
+    }
+
+    TTF_LockClones(font);
+    for (clone = font->clones; clone; clone = clone->next_clone) {
+        if (SDL_TryLockMutex(clone->lock) == 0) {
+            break;
+        }
+    }
+    if (clone && clone->serial != font->serial) {
+        clone->style = font->style;
+        clone->outline = font->outline;
+        clone->hinting = font->hinting;
+        clone->kerning = font->kerning;
+        clone->serial = font->serial;
+        changed = SDL_TRUE;
+    }
+    full = (font->num_clones >= TTF_MAX_CLONES);
+    TTF_UnlockClones(font);
+
+    if (clone) {
+        if (changed) {
+            clone->use_kerning = FT_HAS_KERNING(clone->face) && clone->kerning;
+            TTF_initFontMetrics(clone);
+            Flush_Cache(clone);
+        }
+        return clone;
+    }
+
+    /* Every clone is busy, wait for the font.  The font data can only be
+       read with the font locked, so that is when new clones are made. */
+    TTF_LockFont(font);
+    if (!full) {
+        clone = TTF_CloneFont(font);
+        if (clone) {
+            TTF_UnlockFont(font);
+            return clone;
+        }
+    }
+    return font;
+}
+
 /* Gets the number of bytes needed to convert a Latin-1 string to UTF-8 */
 static size_t LATIN1_to_UTF8_len(const char *text)
 {
@@ -1094,8 +1755,13 @@ int TTF_GetFontKerning(const TTF_Font *font)
 
 void TTF_SetFontKerning(TTF_Font *font, int allowed)
 {
+    TTF_LockFont(font);
+    TTF_LockClones(font);
     font->kerning = allowed;
+    ++font->serial;
+    TTF_UnlockClones(font);
     font->use_kerning = FT_HAS_KERNING(font->face) && font->kerning;
+    TTF_UnlockFont(font);
 }
 
 long TTF_FontFaces(const TTF_Font *font)
@@ -1120,35 +1786,46 @@ char *TTF_FontFaceStyleName(const TTF_Font *font)
 
 int TTF_GlyphIsProvided(const TTF_Font *font, Uint16 ch)
 {
-    return FT_Get_Char_Index(font->face, ch);
+    int retval;
+
+    TTF_LockFont(font);
+    TTF_LockFace(font);
+    retval = FT_Get_Char_Index(font->face, ch);
+    TTF_UnlockFace(font);
+    TTF_UnlockFont(font);
+    return retval;
 }
 
 int TTF_GlyphMetrics(TTF_Font *font, Uint16 ch,
                      int *minx, int *maxx, int *miny, int *maxy, int *advance)
 {
+    c_glyph *glyph;
     FT_Error error;
 
-    error = Find_Glyph(font, ch, CACHED_METRICS);
+    font = TTF_AcquireFont(font);
+    error = Find_Glyph(font, ch, CACHED_METRICS, &glyph);
     if (error) {
+        TTF_UnlockFont(font);
         TTF_SetFTError("Couldn't find glyph", error);
         return -1;
     }
 
     if (minx) {
-        *minx = font->current->minx;
+        *minx = glyph->minx;
     }
     if (maxx) {
-        *maxx = font->current->maxx;
+        *maxx = glyph->maxx;
     }
     if (miny) {
-        *miny = font->current->miny;
+        *miny = glyph->miny;
     }
     if (maxy) {
-        *maxy = font->current->maxy;
+        *maxy = glyph->maxy;
     }
     if (advance) {
-        *advance = font->current->advance;
+        *advance = glyph->advance;
     }
+    TTF_UnlockFont(font);
     return 0;
 }
 
@@ -1192,17 +1869,16 @@ static int TTF_SizeUTF8_Internal(TTF_Font *font, const char *text, int *w, int *
             continue;
         }
 
-        error = Find_Glyph(font, c, CACHED_METRICS);
+        error = Find_Glyph(font, c, CACHED_METRICS, &glyph);
         if (error) {
             TTF_SetFTError("Couldn't find glyph", error);
             return -1;
         }
-        glyph = font->current;
 
         /* handle kerning */
         if (font->use_kerning && prev_index && glyph->index) {
             FT_Vector delta;
-            FT_Get_Kerning(font->face, prev_index, glyph->index, ft_kerning_default, &delta);
+            Get_Kerning(font, prev_index, glyph->index, &delta);
             x += delta.x >> 6;
         }
 
@@ -1240,7 +1916,14 @@ static int TTF_SizeUTF8_Internal(TTF_Font *font, const char *text, int *w, int *
 }
 
 int TTF_SizeUTF8(TTF_Font *font, const char *text, int *w, int *h) {
-    return TTF_SizeUTF8_Internal(font, text, w, h, NULL, NULL);
+    int status;
+
+    TTF_CHECKPOINTER(font, -1);
+
+    font = TTF_AcquireFont(font);
+    status = TTF_SizeUTF8_Internal(font, text, w, h, NULL, NULL);
+    TTF_UnlockFont(font);
+    return status;
 }
 
 int TTF_SizeUNICODE(TTF_Font *font, const Uint16 *text, int *w, int *h)
@@ -1280,7 +1963,7 @@ SDL_Surface *TTF_RenderText_Solid(TTF_Font *font,
     return surface;
 }
 
-SDL_Surface *TTF_RenderUTF8_Solid(TTF_Font *font,
+static SDL_Surface *TTF_RenderUTF8_Solid_Internal(TTF_Font *font,
                 const char *text, SDL_Color fg)
 {
     int xstart, ystart;
@@ -1330,19 +2013,18 @@ SDL_Surface *TTF_RenderUTF8_Solid(TTF_Font *font,
             continue;
         }
 
-        error = Find_Glyph(font, c, CACHED_METRICS|CACHED_BITMAP);
+        error = Find_Glyph(font, c, CACHED_METRICS|CACHED_BITMAP, &glyph);
         if (error) {
             TTF_SetFTError("Couldn't find glyph", error);
             SDL_FreeSurface(textbuf);
             return NULL;
         }
-        glyph = font->current;
         current = &glyph->bitmap;
 
         /* handle kerning */
         if (font->use_kerning && prev_index && glyph->index) {
             FT_Vector delta;
-            FT_Get_Kerning(font->face, prev_index, glyph->index, ft_kerning_default, &delta);
+            Get_Kerning(font, prev_index, glyph->index, &delta);
             xstart += delta.x >> 6;
         }
 
@@ -1374,6 +2056,21 @@ SDL_Surface *TTF_RenderUTF8_Solid(TTF_Font *font,
     return textbuf;
 }
 
+SDL_Surface *TTF_RenderUTF8_Solid(TTF_Font *font,
+                const char *text, SDL_Color fg)
+{
+    SDL_Surface *textbuf;
+
+    TTF_CHECKPOINTER(font, NULL);
+
+    SDL_TRACE_ZONE_BEGIN("TTF_RenderUTF8_Solid");
+    font = TTF_AcquireFont(font);
+    textbuf = TTF_RenderUTF8_Solid_Internal(font, text, fg);
+    TTF_UnlockFont(font);
+    SDL_TRACE_ZONE_END();
+    return textbuf;
+}
+
 SDL_Surface *TTF_RenderUNICODE_Solid(TTF_Font *font,
                 const Uint16 *text, SDL_Color fg)
 {
@@ -1425,7 +2122,7 @@ SDL_Surface *TTF_RenderText_Shaded(TTF_Font *font,
 
 /* Convert the UTF-8 text to UNICODE and render it
 */
-SDL_Surface *TTF_RenderUTF8_Shaded(TTF_Font *font,
+static SDL_Surface *TTF_RenderUTF8_Shaded_Internal(TTF_Font *font,
                 const char *text, SDL_Color fg, SDL_Color bg)
 {
     int xstart, ystart;
@@ -1507,19 +2204,18 @@ SDL_Surface *TTF_RenderUTF8_Shaded(TTF_Font *font,
             continue;
         }
 
-        error = Find_Glyph(font, c, CACHED_METRICS|CACHED_PIXMAP);
+        error = Find_Glyph(font, c, CACHED_METRICS|CACHED_PIXMAP, &glyph);
         if (error) {
             TTF_SetFTError("Couldn't find glyph", error);
             SDL_FreeSurface(textbuf);
             return NULL;
         }
-        glyph = font->current;
         current = &glyph->pixmap;
 
         /* handle kerning */
         if (font->use_kerning && prev_index && glyph->index) {
             FT_Vector delta;
-            FT_Get_Kerning(font->face, prev_index, glyph->index, ft_kerning_default, &delta);
+            Get_Kerning(font, prev_index, glyph->index, &delta);
             xstart += delta.x >> 6;
         }
 
@@ -1551,6 +2247,21 @@ SDL_Surface *TTF_RenderUTF8_Shaded(TTF_Font *font,
     return textbuf;
 }
 
+SDL_Surface *TTF_RenderUTF8_Shaded(TTF_Font *font,
+                const char *text, SDL_Color fg, SDL_Color bg)
+{
+    SDL_Surface *textbuf;
+
+    TTF_CHECKPOINTER(font, NULL);
+
+    SDL_TRACE_ZONE_BEGIN("TTF_RenderUTF8_Shaded");
+    font = TTF_AcquireFont(font);
+    textbuf = TTF_RenderUTF8_Shaded_Internal(font, text, fg, bg);
+    TTF_UnlockFont(font);
+    SDL_TRACE_ZONE_END();
+    return textbuf;
+}
+
 SDL_Surface* TTF_RenderUNICODE_Shaded(TTF_Font* font,
                        const Uint16* text,
                        SDL_Color fg,
@@ -1605,7 +2316,7 @@ SDL_Surface *TTF_RenderText_Blended(TTF_Font *font,
     return surface;
 }
 
-SDL_Surface *TTF_RenderUTF8_Blended(TTF_Font *font,
+static SDL_Surface *TTF_RenderUTF8_Blended_Internal(TTF_Font *font,
                 const char *text, SDL_Color fg)
 {
     unsigned int i;
@@ -1664,19 +2375,18 @@ SDL_Surface *TTF_RenderUTF8_Blended(TTF_Font *font,
             continue;
         }
 
-        error = Find_Glyph(font, c, CACHED_METRICS|CACHED_PIXMAP);
+        error = Find_Glyph(font, c, CACHED_METRICS|CACHED_PIXMAP, &glyph);
         if (error) {
             TTF_SetFTError("Couldn't find glyph", error);
             SDL_FreeSurface(textbuf);
             return NULL;
         }
-        glyph = font->current;
         current = &glyph->pixmap;
 
         /* handle kerning */
         if (font->use_kerning && prev_index && glyph->index) {
             FT_Vector delta;
-            FT_Get_Kerning(font->face, prev_index, glyph->index, ft_kerning_default, &delta);
+            Get_Kerning(font, prev_index, glyph->index, &delta);
             xstart += delta.x >> 6;
         }
 
@@ -1709,6 +2419,21 @@ SDL_Surface *TTF_RenderUTF8_Blended(TTF_Font *font,
     return textbuf;
 }
 
+SDL_Surface *TTF_RenderUTF8_Blended(TTF_Font *font,
+                const char *text, SDL_Color fg)
+{
+    SDL_Surface *textbuf;
+
+    TTF_CHECKPOINTER(font, NULL);
+
+    SDL_TRACE_ZONE_BEGIN("TTF_RenderUTF8_Blended");
+    font = TTF_AcquireFont(font);
+    textbuf = TTF_RenderUTF8_Blended_Internal(font, text, fg);
+    TTF_UnlockFont(font);
+    SDL_TRACE_ZONE_END();
+    return textbuf;
+}
+
 SDL_Surface *TTF_RenderUNICODE_Blended(TTF_Font *font,
                 const Uint16 *text, SDL_Color fg)
 {
@@ -1758,7 +2483,7 @@ static SDL_bool CharacterIsDelimiter(char c, const char *delimiters)
     return SDL_FALSE;
 }
 
-SDL_Surface *TTF_RenderUTF8_Blended_Wrapped(TTF_Font *font,
+static SDL_Surface *TTF_RenderUTF8_Blended_Wrapped_Internal(TTF_Font *font,
                                     const char *text, SDL_Color fg, Uint32 wrapLength)
 {
     unsigned int i;
@@ -1925,7 +2650,7 @@ SDL_Surface *TTF_RenderUTF8_Blended_Wrapped(TTF_Font *font,
                 continue;
             }
 
-            error = Find_Glyph(font, c, CACHED_METRICS|CACHED_PIXMAP);
+            error = Find_Glyph(font, c, CACHED_METRICS|CACHED_PIXMAP, &glyph);
             if (error) {
                 TTF_SetFTError("Couldn't find glyph", error);
                 SDL_FreeSurface(textbuf);
@@ -1935,13 +2660,12 @@ SDL_Surface *TTF_RenderUTF8_Blended_Wrapped(TTF_Font *font,
                 }
                 return NULL;
             }
-            glyph = font->current;
             current = &glyph->pixmap;
 
             /* handle kerning */
             if (font->use_kerning && prev_index && glyph->index) {
                 FT_Vector delta;
-                FT_Get_Kerning(font->face, prev_index, glyph->index, ft_kerning_default, &delta);
+                Get_Kerning(font, prev_index, glyph->index, &delta);
                 xstart += delta.x >> 6;
             }
 
@@ -1985,6 +2709,21 @@ SDL_Surface *TTF_RenderUTF8_Blended_Wrapped(TTF_Font *font,
     return textbuf;
 }
 
+SDL_Surface *TTF_RenderUTF8_Blended_Wrapped(TTF_Font *font,
+                const char *text, SDL_Color fg, Uint32 wrapLength)
+{
+    SDL_Surface *textbuf;
+
+    TTF_CHECKPOINTER(font, NULL);
+
+    SDL_TRACE_ZONE_BEGIN("TTF_RenderUTF8_Blended_Wrapped");
+    font = TTF_AcquireFont(font);
+    textbuf = TTF_RenderUTF8_Blended_Wrapped_Internal(font, text, fg, wrapLength);
+    TTF_UnlockFont(font);
+    SDL_TRACE_ZONE_END();
+    return textbuf;
+}
+
 SDL_Surface *TTF_RenderUNICODE_Blended_Wrapped(TTF_Font *font, const Uint16* text,
                                                SDL_Color fg, Uint32 wrapLength)
 {
@@ -2015,31 +2754,1153 @@ SDL_Surface *TTF_RenderGlyph_Blended(TTF_Font *font, Uint16 ch, SDL_Color fg)
     return TTF_RenderUTF8_Blended(font, (char *)utf8, fg);
 }
 
-void TTF_SetFontStyle(TTF_Font* font, int style)
+SDL_Surface *TTF_RenderText_SDF(TTF_Font *font,
+                const char *text, SDL_Color fg)
 {
-    int prev_style = font->style;
-    font->style = style | font->face_style;
+    SDL_Surface *surface = NULL;
+    Uint8 *utf8;
 
-    TTF_initFontMetrics(font);
+    TTF_CHECKPOINTER(text, NULL);
 
-    /* Flush the cache if the style has changed.
-     * Ignore UNDERLINE which does not impact glyph drawning.
-     * */
-    if ((font->style | TTF_STYLE_NO_GLYPH_CHANGE) != (prev_style | TTF_STYLE_NO_GLYPH_CHANGE)) {
-        Flush_Cache(font);
+    utf8 = SDL_stack_alloc(Uint8, LATIN1_to_UTF8_len(text));
+    if (utf8) {
+        LATIN1_to_UTF8(text, utf8);
+        surface = TTF_RenderUTF8_SDF(font, (char *)utf8, fg);
+        SDL_stack_free(utf8);
+    } else {
+        SDL_OutOfMemory();
     }
+    return surface;
 }
 
-int TTF_GetFontStyle(const TTF_Font* font)
+static SDL_Surface *TTF_RenderUTF8_SDF_Internal(TTF_Font *font,
+                const char *text, SDL_Color fg)
+{
+    const int pad = TTF_SDF_SPREAD;
+    int xstart, ystart;
+    int width, height;
+    SDL_Surface *textbuf;
+    Uint32 pixel;
+    Uint8 *src;
+    Uint32 *dst;
+    unsigned int row, col;
+    c_glyph *glyph;
+    FT_Bitmap *current;
+    FT_Error error;
+    FT_UInt prev_index = 0;
+    size_t textlen;
+
+    TTF_CHECKPOINTER(text, NULL);
+
+    /* Get the dimensions of the text surface */
+    if ((TTF_SizeUTF8_Internal(font, text, &width, &height, &xstart, &ystart) < 0) || !width) {
+        TTF_SetError("Text has zero width");
+        return NULL;
+    }
+
+    /* Create the target surface, with room for the field around the text */
+    textbuf = SDL_CreateRGBSurface(SDL_SWSURFACE, width + 2 * pad, height + 2 * pad, 32,
+                               0x00FF0000, 0x0000FF00, 0x000000FF, 0xFF000000);
+    if (textbuf == NULL) {
+        return NULL;
+    }
+
+    /* Load and render each character */
+    textlen = SDL_strlen(text);
+    pixel = (fg.r<<16)|(fg.g<<8)|fg.b;
+    SDL_FillRect(textbuf, NULL, pixel); /* Initialize with fg and 0 distance (far outside) */
+    while (textlen > 0) {
+        Uint32 c = UTF8_getch(&text, &textlen);
+        if (c == UNICODE_BOM_NATIVE || c == UNICODE_BOM_SWAPPED) {
+            continue;
+        }
+
+        error = Find_Glyph(font, c, CACHED_METRICS|CACHED_SDF, &glyph);
+        if (error) {
+            TTF_SetFTError("Couldn't find glyph", error);
+            SDL_FreeSurface(textbuf);
+            return NULL;
+        }
+        current = &glyph->sdf;
+
+        /* handle kerning */
+        if (font->use_kerning && prev_index && glyph->index) {
+            FT_Vector delta;
+            Get_Kerning(font, prev_index, glyph->index, &delta);
+            xstart += delta.x >> 6;
+        }
+
+        /* The glyph field is padded like the surface, so the offsets cancel
+           out.  Overlapping glyphs keep the value closest to the inside. */
+        for (row = 0; row < current->rows; ++row) {
+            dst = (Uint32 *)textbuf->pixels +
+                (row + ystart + glyph->yoffset) * textbuf->pitch/4 +
+                xstart + glyph->minx;
+            src = (Uint8*)current->buffer + row * current->pitch;
+            for (col = current->width; col > 0; --col) {
+                Uint32 value = *src++;
+                if (value > (*dst >> 24)) {
+                    *dst = pixel | (value << 24);
+                }
+                ++dst;
+            }
+        }
+
+        xstart += glyph->advance;
+        prev_index = glyph->index;
+    }
+
+    /* Handle the underline style */
+    if (TTF_HANDLE_STYLE_UNDERLINE(font)) {
+        int first_row = font->underline_top_row + ystart;
+        TTF_drawLine_SDF(font, textbuf, first_row, pixel);
+    }
+
+    /* Handle the strikethrough style */
+    if (TTF_HANDLE_STYLE_STRIKETHROUGH(font)) {
+        int first_row = font->strikethrough_top_row + ystart;
+        TTF_drawLine_SDF(font, textbuf, first_row, pixel);
+    }
+    return textbuf;
+}
+
+SDL_Surface *TTF_RenderUTF8_SDF(TTF_Font *font,
+                const char *text, SDL_Color fg)
+{
+    SDL_Surface *textbuf;
+
+    TTF_CHECKPOINTER(font, NULL);
+
+    SDL_TRACE_ZONE_BEGIN("TTF_RenderUTF8_SDF");
+    font = TTF_AcquireFont(font);
+    textbuf = TTF_RenderUTF8_SDF_Internal(font, text, fg);
+    TTF_UnlockFont(font);
+    SDL_TRACE_ZONE_END();
+    return textbuf;
+}
+
+SDL_Surface *TTF_RenderUNICODE_SDF(TTF_Font *font,
+                const Uint16 *text, SDL_Color fg)
+{
+    SDL_Surface *surface = NULL;
+    Uint8 *utf8;
+
+    TTF_CHECKPOINTER(text, NULL);
+
+    utf8 = SDL_stack_alloc(Uint8, UCS2_to_UTF8_len(text));
+    if (utf8) {
+        UCS2_to_UTF8(text, utf8);
+        surface = TTF_RenderUTF8_SDF(font, (char *)utf8, fg);
+        SDL_stack_free(utf8);
+    } else {
+        SDL_OutOfMemory();
+    }
+    return surface;
+}
+
+static SDL_Surface *TTF_CreateSDFAtlas_Internal(TTF_Font *font, const char *text,
+                TTF_SDFGlyph *glyphs, int maxglyphs, int *numglyphs)
+{
+    SDL_Surface *atlas;
+    c_glyph *glyph;
+    FT_Error error;
+    size_t textlen;
+    int count = 0;
+    int area = 0, max_w = 1;
+    int atlas_w, atlas_h;
+    int x, y, shelf_h;
+    int i, row;
+
+    TTF_CHECKPOINTER(text, NULL);
+    TTF_CHECKPOINTER(glyphs, NULL);
+
+    /* Collect the distinct glyphs and their field sizes */
+    textlen = SDL_strlen(text);
+    while (textlen > 0 && count < maxglyphs) {
+        Uint32 c = UTF8_getch(&text, &textlen);
+        if (c == UNICODE_BOM_NATIVE || c == UNICODE_BOM_SWAPPED) {
+            continue;
+        }
+        for (i = 0; i < count; ++i) {
+            if (glyphs[i].ch == c) {
+                break;
+            }
+        }
+        if (i < count) {
+            continue;
+        }
+
+        error = Find_Glyph(font, c, CACHED_METRICS|CACHED_SDF, &glyph);
+        if (error) {
+            TTF_SetFTError("Couldn't find glyph", error);
+            return NULL;
+        }
+        glyphs[count].ch = c;
+        glyphs[count].rect.w = glyph->sdf.width;
+        glyphs[count].rect.h = glyph->sdf.rows;
+        glyphs[count].xoffset = glyph->minx - TTF_SDF_SPREAD;
+        glyphs[count].yoffset = glyph->yoffset - TTF_SDF_SPREAD;
+        glyphs[count].advance = glyph->advance;
+        area += (glyphs[count].rect.w + 1) * (glyphs[count].rect.h + 1);
+        max_w = SDL_max(max_w, glyphs[count].rect.w + 1);
+        ++count;
+    }
+    if (count == 0) {
+        TTF_SetError("No glyphs to put in the atlas");
+        return NULL;
+    }
+
+    /* Shelf pack into a power of two wide atlas, roughly square */
+    atlas_w = 1;
+    while (atlas_w < max_w || atlas_w * atlas_w < area) {
+        atlas_w <<= 1;
+    }
+    x = y = shelf_h = 0;
+    for (i = 0; i < count; ++i) {
+        if (x + glyphs[i].rect.w > atlas_w) {
+            x = 0;
+            y += shelf_h + 1;
+            shelf_h = 0;
+        }
+        glyphs[i].rect.x = x;
+        glyphs[i].rect.y = y;
+        x += glyphs[i].rect.w + 1;
+        shelf_h = SDL_max(shelf_h, glyphs[i].rect.h);
+    }
+    atlas_h = y + shelf_h;
+
+    atlas = SDL_CreateRGBSurface(SDL_SWSURFACE, atlas_w, atlas_h, 32,
+                               0x00FF0000, 0x0000FF00, 0x000000FF, 0xFF000000);
+    if (atlas == NULL) {
+        return NULL;
+    }
+    SDL_FillRect(atlas, NULL, 0x00FFFFFF);
+
+    /* Copy each field into the alpha channel */
+    for (i = 0; i < count; ++i) {
+        error = Find_Glyph(font, glyphs[i].ch, CACHED_METRICS|CACHED_SDF, &glyph);
+        if (error) {
+            TTF_SetFTError("Couldn't find glyph", error);
+            SDL_FreeSurface(atlas);
+            return NULL;
+        }
+        for (row = 0; row < glyphs[i].rect.h; ++row) {
+            Uint32 *dst = (Uint32 *)atlas->pixels +
+                (glyphs[i].rect.y + row) * atlas->pitch/4 + glyphs[i].rect.x;
+            const Uint8 *src = glyph->sdf.buffer + row * glyph->sdf.pitch;
+            int col;
+            for (col = 0; col < glyphs[i].rect.w; ++col) {
+                dst[col] = 0x00FFFFFF | ((Uint32)src[col] << 24);
+            }
+        }
+    }
+
+    if (numglyphs) {
+        *numglyphs = count;
+    }
+    return atlas;
+}
+
+SDL_Surface *TTF_CreateSDFAtlas(TTF_Font *font, const char *text,
+                TTF_SDFGlyph *glyphs, int maxglyphs, int *numglyphs)
+{
+    SDL_Surface *atlas;
+
+    TTF_CHECKPOINTER(font, NULL);
+
+    font = TTF_AcquireFont(font);
+    atlas = TTF_CreateSDFAtlas_Internal(font, text, glyphs, maxglyphs, numglyphs);
+    TTF_UnlockFont(font);
+    return atlas;
+}
+
+SDL_Surface *TTF_ScaleSDF(SDL_Surface *sdf, float scale)
+{
+    SDL_Surface *textbuf;
+    Uint32 pixel;
+    float edge;
+    int width, height;
+    int x, y;
+
+    TTF_CHECKPOINTER(sdf, NULL);
+
+    if (sdf->format->format != SDL_PIXELFORMAT_ARGB8888) {
+        TTF_SetError("Distance field must be an ARGB8888 surface");
+        return NULL;
+    }
+    if (scale <= 0.0f) {
+        TTF_SetError("Invalid scale");
+        return NULL;
+    }
+
+    width = SDL_max(1, (int)(sdf->w * scale + 0.5f));
+    height = SDL_max(1, (int)(sdf->h * scale + 0.5f));
+    textbuf = SDL_CreateRGBSurface(SDL_SWSURFACE, width, height, 32,
+                               0x00FF0000, 0x0000FF00, 0x000000FF, 0xFF000000);
+    if (textbuf == NULL) {
+        return NULL;
+    }
+
+    if (SDL_LockSurface(sdf) < 0) {
+        SDL_FreeSurface(textbuf);
+        return NULL;
+    }
+    pixel = *(Uint32 *)sdf->pixels & 0x00FFFFFF;
+
+    /* Half an output pixel on each side of the edge, in field units */
+    edge = (0.5f / scale) * (127.0f / TTF_SDF_SPREAD);
+
+    for (y = 0; y < height; ++y) {
+        Uint32 *dst = (Uint32 *)textbuf->pixels + y * textbuf->pitch/4;
+        float sy = SDL_max((y + 0.5f) / scale - 0.5f, 0.0f);
+        int y0 = SDL_min((int)sy, sdf->h - 1);
+        int y1 = SDL_min(y0 + 1, sdf->h - 1);
+        float fy = sy - y0;
+        const Uint32 *row0 = (const Uint32 *)sdf->pixels + y0 * sdf->pitch/4;
+        const Uint32 *row1 = (const Uint32 *)sdf->pixels + y1 * sdf->pitch/4;
+
+        for (x = 0; x < width; ++x) {
+            float sx = SDL_max((x + 0.5f) / scale - 0.5f, 0.0f);
+            int x0 = SDL_min((int)sx, sdf->w - 1);
+            int x1 = SDL_min(x0 + 1, sdf->w - 1);
+            float fx = sx - x0;
+            float top = (row0[x0] >> 24) * (1.0f - fx) + (row0[x1] >> 24) * fx;
+            float bottom = (row1[x0] >> 24) * (1.0f - fx) + (row1[x1] >> 24) * fx;
+            float value = top * (1.0f - fy) + bottom * fy;
+            float alpha = (value - 128.0f + edge) / (2.0f * edge);
+
+            alpha = SDL_max(0.0f, SDL_min(alpha, 1.0f));
+            dst[x] = pixel | ((Uint32)(alpha * 255.0f + 0.5f) << 24);
+        }
+    }
+    SDL_UnlockSurface(sdf);
+
+    return textbuf;
+}
+
+/* Glyph atlas textures
+
+   Each glyph is rendered once into a system memory copy of the atlas and
+   uploaded to the texture only when it first shows up, so drawing text that
+   is already resident is one SDL_RenderGeometry() call and no uploads.
+   Glyphs are shelf packed: a shelf is a full width strip of the atlas, and
+   glyphs go on the shortest shelf that fits them.  When no shelf fits, a new
+   one is started; when the atlas is full it doubles in size up to the
+   renderer's maximum texture size, and after that the least recently used
+   shelf is emptied and reused.
+*/
+
+#define ATLAS_INITIAL_SIZE  256
+#define ATLAS_DEFAULT_MAX   4096
+
+/* Glyphs are spaced by a pixel so filtering doesn't bleed between them */
+#define ATLAS_PADDING       1
+
+/* A solid white block in the top left corner is used to draw lines, and
+   shelves start below it */
+#define ATLAS_SOLID_SIZE    2
+#define ATLAS_SHELVES_TOP   (ATLAS_SOLID_SIZE + ATLAS_PADDING)
+
+/* Special values of TTF_AtlasGlyph::shelf */
+#define ATLAS_SHELF_NONE    -1  /* Resident glyph without any pixels */
+#define ATLAS_SHELF_FREE    -2  /* Unused entry, on the free list */
+
+/* Errors returned by Atlas_PackRect() */
+#define ATLAS_PACK_FULL     -1  /* No room until the next batch */
+#define ATLAS_PACK_ERROR    -2  /* Out of memory or no texture, error is set */
+
+typedef struct {
+    Uint32 ch;
+    FT_UInt index;
+    int shelf;
+    SDL_Rect rect;
+    int minx;
+    int maxx;
+    int yoffset;
+    int advance;
+    int next;
+} TTF_AtlasGlyph;
+
+typedef struct {
+    int y;
+    int h;
+    int x;
+    Uint32 last_used;
+} TTF_AtlasShelf;
+
+struct _TTF_GlyphAtlas {
+    TTF_Font *font;
+    SDL_Renderer *renderer;
+    SDL_Texture *texture;
+    SDL_Surface *pixels;
+    int max_w;
+    int max_h;
+    int generation;
+
+    /* Region of pixels not uploaded to the texture yet */
+    SDL_Rect dirty;
+
+    /* Incremented for each batch of geometry, shelves used in the current
+       batch can't be evicted */
+    Uint32 tick;
+
+    TTF_AtlasShelf *shelves;
+    int num_shelves;
+    int max_shelves;
+    int shelves_bottom;
+
+    /* Resident glyphs, hashed by character */
+    TTF_AtlasGlyph *glyphs;
+    int max_glyphs;
+    int free_glyphs;
+    int *buckets;
+    int num_buckets;
+
+    /* Geometry for the current batch, texture coordinates in pixels */
+    SDL_Vertex *vertices;
+    int *indices;
+    int num_quads;
+    int max_quads;
+};
+
+static void Atlas_Dirty(TTF_GlyphAtlas *atlas, const SDL_Rect *rect)
+{
+    if (SDL_RectEmpty(&atlas->dirty)) {
+        atlas->dirty = *rect;
+    } else {
+        SDL_UnionRect(&atlas->dirty, rect, &atlas->dirty);
+    }
+}
+
+static int Atlas_CreateTexture(TTF_GlyphAtlas *atlas, int w, int h)
+{
+    SDL_Surface *pixels;
+    SDL_Texture *texture;
+    SDL_Rect rect;
+
+    pixels = SDL_CreateRGBSurface(SDL_SWSURFACE, w, h, 32,
+                               0x00FF0000, 0x0000FF00, 0x000000FF, 0xFF000000);
+    if (pixels == NULL) {
+        return -1;
+    }
+    texture = SDL_CreateTexture(atlas->renderer, SDL_PIXELFORMAT_ARGB8888,
+                                SDL_TEXTUREACCESS_STATIC, w, h);
+    if (texture == NULL) {
+        SDL_FreeSurface(pixels);
+        return -1;
+    }
+    SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+
+    /* Keep what is already packed, glyphs don't move when the atlas grows */
+    SDL_FillRect(pixels, NULL, 0x00FFFFFF);
+    if (atlas->pixels) {
+        SDL_SetSurfaceBlendMode(atlas->pixels, SDL_BLENDMODE_NONE);
+        SDL_BlitSurface(atlas->pixels, NULL, pixels, NULL);
+        SDL_FreeSurface(atlas->pixels);
+    }
+    rect.x = 0;
+    rect.y = 0;
+    rect.w = ATLAS_SOLID_SIZE;
+    rect.h = ATLAS_SOLID_SIZE;
+    SDL_FillRect(pixels, &rect, 0xFFFFFFFF);
+
+    if (atlas->texture) {
+        SDL_DestroyTexture(atlas->texture);
+    }
+    atlas->pixels = pixels;
+    atlas->texture = texture;
+
+    rect.w = w;
+    rect.h = h;
+    atlas->dirty = rect;
+    return 0;
+}
+
+static void Atlas_RehashGlyphs(TTF_GlyphAtlas *atlas)
+{
+    int i;
+
+    for (i = 0; i < atlas->num_buckets; ++i) {
+        atlas->buckets[i] = -1;
+    }
+    atlas->free_glyphs = -1;
+    for (i = atlas->max_glyphs - 1; i >= 0; --i) {
+        TTF_AtlasGlyph *glyph = &atlas->glyphs[i];
+        int *head;
+
+        if (glyph->shelf == ATLAS_SHELF_FREE) {
+            head = &atlas->free_glyphs;
+        } else {
+            head = &atlas->buckets[glyph->ch & (atlas->num_buckets - 1)];
+        }
+        glyph->next = *head;
+        *head = i;
+    }
+}
+
+/* Forget every glyph, used when the font changes the way glyphs look */
+static void Atlas_Clear(TTF_GlyphAtlas *atlas)
+{
+    SDL_Rect rect;
+    int i;
+
+    for (i = 0; i < atlas->max_glyphs; ++i) {
+        atlas->glyphs[i].shelf = ATLAS_SHELF_FREE;
+    }
+    Atlas_RehashGlyphs(atlas);
+
+    /* Old glyphs would show through the padding of the new ones */
+    rect.x = 0;
+    rect.y = ATLAS_SHELVES_TOP;
+    rect.w = atlas->pixels->w;
+    rect.h = atlas->shelves_bottom - ATLAS_SHELVES_TOP;
+    if (rect.h > 0) {
+        SDL_FillRect(atlas->pixels, &rect, 0x00FFFFFF);
+        Atlas_Dirty(atlas, &rect);
+    }
+    atlas->num_shelves = 0;
+    atlas->shelves_bottom = ATLAS_SHELVES_TOP;
+    atlas->generation = atlas->font->generation;
+}
+
+static TTF_AtlasGlyph *Atlas_LookupGlyph(const TTF_GlyphAtlas *atlas, Uint32 ch)
+{
+    int i = atlas->buckets[ch & (atlas->num_buckets - 1)];
+
+    while (i >= 0) {
+        TTF_AtlasGlyph *glyph = &atlas->glyphs[i];
+        if (glyph->ch == ch) {
+            return glyph;
+        }
+        i = glyph->next;
+    }
+    return NULL;
+}
+
+/* Double the number of entries, keeping two buckets per entry */
+static int Atlas_GrowGlyphs(TTF_GlyphAtlas *atlas)
+{
+    int max_glyphs = atlas->max_glyphs ? atlas->max_glyphs * 2 : 128;
+    TTF_AtlasGlyph *glyphs;
+    int *buckets;
+    int i;
+
+    glyphs = (TTF_AtlasGlyph *)SDL_realloc(atlas->glyphs, max_glyphs * sizeof(*glyphs));
+    if (glyphs == NULL) {
+        return SDL_OutOfMemory();
+    }
+    atlas->glyphs = glyphs;
+    buckets = (int *)SDL_realloc(atlas->buckets, 2 * max_glyphs * sizeof(*buckets));
+    if (buckets == NULL) {
+        return SDL_OutOfMemory();
+    }
+    atlas->buckets = buckets;
+    for (i = atlas->max_glyphs; i < max_glyphs; ++i) {
+        glyphs[i].shelf = ATLAS_SHELF_FREE;
+    }
+    atlas->max_glyphs = max_glyphs;
+    atlas->num_buckets = 2 * max_glyphs;
+    Atlas_RehashGlyphs(atlas);
+    return 0;
+}
+
+static TTF_AtlasGlyph *Atlas_NewGlyph(TTF_GlyphAtlas *atlas, Uint32 ch)
+{
+    TTF_AtlasGlyph *glyph;
+    int *bucket;
+
+    if (atlas->free_glyphs < 0 && Atlas_GrowGlyphs(atlas) < 0) {
+        return NULL;
+    }
+
+    glyph = &atlas->glyphs[atlas->free_glyphs];
+    atlas->free_glyphs = glyph->next;
+
+    bucket = &atlas->buckets[ch & (atlas->num_buckets - 1)];
+    glyph->ch = ch;
+    glyph->shelf = ATLAS_SHELF_NONE;
+    glyph->next = *bucket;
+    *bucket = (int)(glyph - atlas->glyphs);
+    return glyph;
+}
+
+static void Atlas_EvictShelf(TTF_GlyphAtlas *atlas, int shelf)
+{
+    SDL_Rect rect;
+    int i;
+
+    for (i = 0; i < atlas->max_glyphs; ++i) {
+        if (atlas->glyphs[i].shelf == shelf) {
+            atlas->glyphs[i].shelf = ATLAS_SHELF_FREE;
+        }
+    }
+    Atlas_RehashGlyphs(atlas);
+    atlas->shelves[shelf].x = 0;
+
+    /* Old glyphs would show through the padding of the new ones */
+    rect.x = 0;
+    rect.y = atlas->shelves[shelf].y;
+    rect.w = atlas->pixels->w;
+    rect.h = atlas->shelves[shelf].h;
+    SDL_FillRect(atlas->pixels, &rect, 0x00FFFFFF);
+    Atlas_Dirty(atlas, &rect);
+}
+
+/* Returns 0 if the atlas grew, 1 if it is as large as it gets, or -1 on error */
+static int Atlas_Grow(TTF_GlyphAtlas *atlas)
+{
+    int w = atlas->pixels->w;
+    int h = atlas->pixels->h;
+
+    if (w <= h && w < atlas->max_w) {
+        w = SDL_min(w * 2, atlas->max_w);
+    } else if (h < atlas->max_h) {
+        h = SDL_min(h * 2, atlas->max_h);
+    } else {
+        return 1;
+    }
+    return Atlas_CreateTexture(atlas, w, h);
+}
+
+/* Find room for a w x h glyph, padding included.
+   Returns the shelf index, ATLAS_PACK_FULL if the atlas is full for this
+   batch, or ATLAS_PACK_ERROR on error. */
+static int Atlas_PackRect(TTF_GlyphAtlas *atlas, int w, int h, SDL_Rect *rect)
+{
+    int shelf_h = (h + 3) & ~3;
+    int best = -1;
+    int status;
+    int i;
+
+    for (;;) {
+        /* The shortest shelf with room, not wasting too much height */
+        for (i = 0; i < atlas->num_shelves; ++i) {
+            const TTF_AtlasShelf *shelf = &atlas->shelves[i];
+            if (shelf->h >= h && shelf->h <= shelf_h * 2 &&
+                shelf->x + w <= atlas->pixels->w &&
+                (best < 0 || shelf->h < atlas->shelves[best].h)) {
+                best = i;
+            }
+        }
+        if (best >= 0) {
+            break;
+        }
+
+        /* Start a new shelf */
+        if (w <= atlas->pixels->w &&
+            atlas->shelves_bottom + shelf_h <= atlas->pixels->h) {
+            if (atlas->num_shelves == atlas->max_shelves) {
+                int max_shelves = atlas->max_shelves ? atlas->max_shelves * 2 : 16;
+                TTF_AtlasShelf *shelves = (TTF_AtlasShelf *)SDL_realloc(atlas->shelves, max_shelves * sizeof(*shelves));
+                if (shelves == NULL) {
+                    TTF_SetError("Out of memory");
+                    return ATLAS_PACK_ERROR;
+                }
+                atlas->shelves = shelves;
+                atlas->max_shelves = max_shelves;
+            }
+            best = atlas->num_shelves++;
+            atlas->shelves[best].y = atlas->shelves_bottom;
+            atlas->shelves[best].h = shelf_h;
+            atlas->shelves[best].x = 0;
+            atlas->shelves[best].last_used = atlas->tick;
+            atlas->shelves_bottom += shelf_h;
+            break;
+        }
+
+        status = Atlas_Grow(atlas);
+        if (status == 0) {
+            continue;
+        }
+        if (status < 0) {
+            return ATLAS_PACK_ERROR;
+        }
+
+        /* Reuse the least recently used shelf that the glyph fits on */
+        for (i = 0; i < atlas->num_shelves; ++i) {
+            const TTF_AtlasShelf *shelf = &atlas->shelves[i];
+            if (shelf->h >= h && w <= atlas->pixels->w && shelf->last_used != atlas->tick &&
+                (best < 0 || (Sint32)(shelf->last_used - atlas->shelves[best].last_used) < 0)) {
+                best = i;
+            }
+        }
+        if (best < 0) {
+            return ATLAS_PACK_FULL;
+        }
+        Atlas_EvictShelf(atlas, best);
+        break;
+    }
+
+    rect->x = atlas->shelves[best].x;
+    rect->y = atlas->shelves[best].y;
+    rect->w = w - ATLAS_PADDING;
+    rect->h = h - ATLAS_PADDING;
+    atlas->shelves[best].x += w;
+    return best;
+}
+
+/* Look up a glyph, rendering it into the atlas if it isn't there yet.
+   Returns -1 on error, 1 if it doesn't fit until the next batch. */
+static int Atlas_FindGlyph(TTF_GlyphAtlas *atlas, Uint32 ch, TTF_AtlasGlyph **out_glyph)
+{
+    TTF_AtlasGlyph *entry;
+    c_glyph *glyph;
+    FT_Error error;
+    SDL_Rect rect;
+    int shelf = ATLAS_SHELF_NONE;
+    int row, col;
+
+    entry = Atlas_LookupGlyph(atlas, ch);
+    if (entry) {
+        if (entry->shelf >= 0) {
+            atlas->shelves[entry->shelf].last_used = atlas->tick;
+        }
+        *out_glyph = entry;
+        return 0;
+    }
+
+    error = Find_Glyph(atlas->font, ch, CACHED_METRICS|CACHED_PIXMAP, &glyph);
+    if (error) {
+        TTF_SetFTError("Couldn't find glyph", error);
+        return -1;
+    }
+
+    if (glyph->pixmap.width && glyph->pixmap.rows) {
+        shelf = Atlas_PackRect(atlas, glyph->pixmap.width + ATLAS_PADDING,
+                               glyph->pixmap.rows + ATLAS_PADDING, &rect);
+        if (shelf == ATLAS_PACK_ERROR) {
+            return -1;
+        }
+        if (shelf == ATLAS_PACK_FULL) {
+            return 1;
+        }
+        atlas->shelves[shelf].last_used = atlas->tick;
+
+        /* Coverage goes in the alpha channel, the color comes from the vertices */
+        for (row = 0; row < rect.h; ++row) {
+            Uint32 *dst = (Uint32 *)atlas->pixels->pixels +
+                (rect.y + row) * atlas->pixels->pitch/4 + rect.x;
+            const Uint8 *src = glyph->pixmap.buffer + row * glyph->pixmap.pitch;
+            for (col = 0; col < rect.w; ++col) {
+                dst[col] = 0x00FFFFFF | ((Uint32)src[col] << 24);
+            }
+        }
+        Atlas_Dirty(atlas, &rect);
+    } else {
+        SDL_zero(rect);
+    }
+
+    entry = Atlas_NewGlyph(atlas, ch);
+    if (entry == NULL) {
+        return -1;
+    }
+    entry->index = glyph->index;
+    entry->shelf = shelf;
+    entry->rect = rect;
+    entry->minx = glyph->minx;
+    entry->maxx = glyph->maxx;
+    entry->yoffset = glyph->yoffset;
+    entry->advance = glyph->advance;
+    *out_glyph = entry;
+    return 0;
+}
+
+static int Atlas_AddQuad(TTF_GlyphAtlas *atlas, float x, float y, float w, float h,
+                         const SDL_Rect *src, SDL_Color color)
+{
+    SDL_Vertex *vertex;
+    int *index;
+    int first;
+
+    if (atlas->num_quads == atlas->max_quads) {
+        int max_quads = atlas->max_quads ? atlas->max_quads * 2 : 64;
+        SDL_Vertex *vertices;
+        int *indices;
+
+        vertices = (SDL_Vertex *)SDL_realloc(atlas->vertices, 4 * max_quads * sizeof(*vertices));
+        if (vertices == NULL) {
+            return SDL_OutOfMemory();
+        }
+        atlas->vertices = vertices;
+        indices = (int *)SDL_realloc(atlas->indices, 6 * max_quads * sizeof(*indices));
+        if (indices == NULL) {
+            return SDL_OutOfMemory();
+        }
+        atlas->indices = indices;
+        atlas->max_quads = max_quads;
+    }
+
+    first = 4 * atlas->num_quads;
+    vertex = &atlas->vertices[first];
+    vertex[0].position.x = x;
+    vertex[0].position.y = y;
+    vertex[0].tex_coord.x = (float)src->x;
+    vertex[0].tex_coord.y = (float)src->y;
+    vertex[1].position.x = x + w;
+    vertex[1].position.y = y;
+    vertex[1].tex_coord.x = (float)(src->x + src->w);
+    vertex[1].tex_coord.y = (float)src->y;
+    vertex[2].position.x = x + w;
+    vertex[2].position.y = y + h;
+    vertex[2].tex_coord.x = (float)(src->x + src->w);
+    vertex[2].tex_coord.y = (float)(src->y + src->h);
+    vertex[3].position.x = x;
+    vertex[3].position.y = y + h;
+    vertex[3].tex_coord.x = (float)src->x;
+    vertex[3].tex_coord.y = (float)(src->y + src->h);
+    vertex[0].color = vertex[1].color = vertex[2].color = vertex[3].color = color;
+
+    index = &atlas->indices[6 * atlas->num_quads];
+    index[0] = first;
+    index[1] = first + 1;
+    index[2] = first + 2;
+    index[3] = first;
+    index[4] = first + 2;
+    index[5] = first + 3;
+
+    ++atlas->num_quads;
+    return 0;
+}
+
+/* Upload new glyphs and draw the geometry collected so far */
+static int Atlas_Flush(TTF_GlyphAtlas *atlas)
+{
+    int status = 0;
+
+    if (!SDL_RectEmpty(&atlas->dirty)) {
+        const SDL_Rect *dirty = &atlas->dirty;
+        const Uint8 *pixels = (const Uint8 *)atlas->pixels->pixels +
+            dirty->y * atlas->pixels->pitch + dirty->x * 4;
+
+        if (SDL_UpdateTexture(atlas->texture, dirty, pixels, atlas->pixels->pitch) < 0) {
+            atlas->num_quads = 0;
+            return -1;
+        }
+        SDL_zero(atlas->dirty);
+    }
+
+    if (atlas->num_quads > 0) {
+        const float scale_x = 1.0f / atlas->pixels->w;
+        const float scale_y = 1.0f / atlas->pixels->h;
+        int i;
+
+        /* The atlas may have grown since the vertices were added */
+        for (i = 0; i < 4 * atlas->num_quads; ++i) {
+            atlas->vertices[i].tex_coord.x *= scale_x;
+            atlas->vertices[i].tex_coord.y *= scale_y;
+        }
+        status = SDL_RenderGeometry(atlas->renderer, atlas->texture,
+                                    atlas->vertices, 4 * atlas->num_quads,
+                                    atlas->indices, 6 * atlas->num_quads);
+        atlas->num_quads = 0;
+    }
+    ++atlas->tick;
+    return status;
+}
+
+static int Atlas_AddLine(TTF_GlyphAtlas *atlas, float x, float y, int w, SDL_Color color)
+{
+    SDL_Rect solid;
+
+    /* Sample the middle of the solid block, so every texel is white */
+    solid.x = ATLAS_SOLID_SIZE / 2;
+    solid.y = ATLAS_SOLID_SIZE / 2;
+    solid.w = 0;
+    solid.h = 0;
+    return Atlas_AddQuad(atlas, x, y, (float)w, (float)atlas->font->underline_height, &solid, color);
+}
+
+TTF_GlyphAtlas *TTF_CreateGlyphAtlas(TTF_Font *font, SDL_Renderer *renderer)
+{
+    TTF_GlyphAtlas *atlas;
+    SDL_RendererInfo info;
+    int size;
+
+    TTF_CHECKPOINTER(font, NULL);
+    TTF_CHECKPOINTER(renderer, NULL);
+
+    if (SDL_GetRendererInfo(renderer, &info) < 0) {
+        return NULL;
+    }
+
+    atlas = (TTF_GlyphAtlas *)SDL_calloc(1, sizeof(*atlas));
+    if (atlas == NULL) {
+        SDL_OutOfMemory();
+        return NULL;
+    }
+    atlas->font = font;
+    atlas->renderer = renderer;
+    atlas->max_w = info.max_texture_width ? info.max_texture_width : ATLAS_DEFAULT_MAX;
+    atlas->max_h = info.max_texture_height ? info.max_texture_height : ATLAS_DEFAULT_MAX;
+    atlas->max_w = SDL_min(atlas->max_w, ATLAS_DEFAULT_MAX);
+    atlas->max_h = SDL_min(atlas->max_h, ATLAS_DEFAULT_MAX);
+
+    size = SDL_min(ATLAS_INITIAL_SIZE, SDL_min(atlas->max_w, atlas->max_h));
+    if (Atlas_CreateTexture(atlas, size, size) < 0) {
+        TTF_DestroyGlyphAtlas(atlas);
+        return NULL;
+    }
+    if (Atlas_GrowGlyphs(atlas) < 0) {
+        TTF_DestroyGlyphAtlas(atlas);
+        return NULL;
+    }
+
+    TTF_LockFont(font);
+    Atlas_Clear(atlas);
+    TTF_UnlockFont(font);
+    return atlas;
+}
+
+SDL_Texture *TTF_GetGlyphAtlasTexture(TTF_GlyphAtlas *atlas)
+{
+    TTF_CHECKPOINTER(atlas, NULL);
+
+    return atlas->texture;
+}
+
+static int TTF_RenderUTF8_Geometry_Internal(TTF_GlyphAtlas *atlas,
+                const char *text, int x, int y, SDL_Color fg)
+{
+    TTF_Font *font = atlas->font;
+    TTF_AtlasGlyph *glyph;
+    c_glyph *metrics;
+    FT_Error error;
+    FT_UInt prev_index;
+    const char *p;
+    size_t textlen;
+    int xstart, ystart;
+    int pen, minx, maxx, miny;
+    int status;
+
+    TTF_CHECKPOINTER(text, -1);
+
+    if (atlas->generation != font->generation) {
+        Atlas_Clear(atlas);
+    }
+
+    /* Support alpha blending */
+    if (!fg.a) {
+        fg.a = SDL_ALPHA_OPAQUE;
+    }
+
+    /* Find the text origin the same way TTF_SizeUTF8() does, so the text
+       lands where a TTF_RenderUTF8_Blended() surface drawn at x,y would */
+    pen = minx = maxx = miny = 0;
+    prev_index = 0;
+    p = text;
+    textlen = SDL_strlen(text);
+    while (textlen > 0) {
+        Uint32 c = UTF8_getch(&p, &textlen);
+        FT_UInt index;
+        int glyph_minx, glyph_maxx, yoffset, advance;
+
+        if (c == UNICODE_BOM_NATIVE || c == UNICODE_BOM_SWAPPED) {
+            continue;
+        }
+
+        glyph = Atlas_LookupGlyph(atlas, c);
+        if (glyph) {
+            index = glyph->index;
+            glyph_minx = glyph->minx;
+            glyph_maxx = glyph->maxx;
+            yoffset = glyph->yoffset;
+            advance = glyph->advance;
+        } else {
+            error = Find_Glyph(font, c, CACHED_METRICS, &metrics);
+            if (error) {
+                TTF_SetFTError("Couldn't find glyph", error);
+                return -1;
+            }
+            index = metrics->index;
+            glyph_minx = metrics->minx;
+            glyph_maxx = metrics->maxx;
+            yoffset = metrics->yoffset;
+            advance = metrics->advance;
+        }
+
+        if (font->use_kerning && prev_index && index) {
+            FT_Vector delta;
+            Get_Kerning(font, prev_index, index, &delta);
+            pen += delta.x >> 6;
+        }
+        minx = SDL_min(minx, pen + glyph_minx);
+        maxx = SDL_max(maxx, pen + glyph_maxx);
+        maxx = SDL_max(maxx, pen + advance);
+        miny = SDL_min(miny, yoffset);
+
+        pen += advance;
+        prev_index = index;
+    }
+    xstart = x + ((minx < 0) ? -minx : 0);
+    ystart = y + ((miny < 0) ? -miny : 0);
+
+    /* Emit a quad for each glyph, drawing early if the atlas fills up */
+    pen = xstart;
+    prev_index = 0;
+    textlen = SDL_strlen(text);
+    while (textlen > 0) {
+        Uint32 c = UTF8_getch(&text, &textlen);
+        if (c == UNICODE_BOM_NATIVE || c == UNICODE_BOM_SWAPPED) {
+            continue;
+        }
+
+        status = Atlas_FindGlyph(atlas, c, &glyph);
+        if (status > 0) {
+            if (Atlas_Flush(atlas) < 0) {
+                return -1;
+            }
+            status = Atlas_FindGlyph(atlas, c, &glyph);
+            if (status > 0) {
+                TTF_SetError("Glyph is too large for the atlas");
+                return -1;
+            }
+        }
+        if (status < 0) {
+            return -1;
+        }
+
+        if (font->use_kerning && prev_index && glyph->index) {
+            FT_Vector delta;
+            Get_Kerning(font, prev_index, glyph->index, &delta);
+            pen += delta.x >> 6;
+        }
+
+        if (glyph->shelf >= 0) {
+            if (Atlas_AddQuad(atlas, (float)(pen + glyph->minx), (float)(ystart + glyph->yoffset),
+                              (float)glyph->rect.w, (float)glyph->rect.h, &glyph->rect, fg) < 0) {
+                return -1;
+            }
+        }
+
+        pen += glyph->advance;
+        prev_index = glyph->index;
+    }
+
+    /* Handle the underline style */
+    if (TTF_HANDLE_STYLE_UNDERLINE(font)) {
+        if (Atlas_AddLine(atlas, (float)x, (float)(ystart + font->underline_top_row), maxx - minx, fg) < 0) {
+            return -1;
+        }
+    }
+
+    /* Handle the strikethrough style */
+    if (TTF_HANDLE_STYLE_STRIKETHROUGH(font)) {
+        if (Atlas_AddLine(atlas, (float)x, (float)(ystart + font->strikethrough_top_row), maxx - minx, fg) < 0) {
+            return -1;
+        }
+    }
+
+    return Atlas_Flush(atlas);
+}
+
+int TTF_RenderText_Geometry(TTF_GlyphAtlas *atlas,
+                const char *text, int x, int y, SDL_Color fg)
+{
+    int status = -1;
+    Uint8 *utf8;
+
+    TTF_CHECKPOINTER(text, -1);
+
+    utf8 = SDL_stack_alloc(Uint8, LATIN1_to_UTF8_len(text));
+    if (utf8) {
+        LATIN1_to_UTF8(text, utf8);
+        status = TTF_RenderUTF8_Geometry(atlas, (char *)utf8, x, y, fg);
+        SDL_stack_free(utf8);
+    } else {
+        SDL_OutOfMemory();
+    }
+    return status;
+}
+
+int TTF_RenderUTF8_Geometry(TTF_GlyphAtlas *atlas,
+                const char *text, int x, int y, SDL_Color fg)
+{
+    int status;
+
+    TTF_CHECKPOINTER(atlas, -1);
+
+    SDL_TRACE_ZONE_BEGIN("TTF_RenderUTF8_Geometry");
+    TTF_LockFont(atlas->font);
+    status = TTF_RenderUTF8_Geometry_Internal(atlas, text, x, y, fg);
+    TTF_UnlockFont(atlas->font);
+    SDL_TRACE_ZONE_END();
+    return status;
+}
+
+int TTF_RenderUNICODE_Geometry(TTF_GlyphAtlas *atlas,
+                const Uint16 *text, int x, int y, SDL_Color fg)
+{
+    int status = -1;
+    Uint8 *utf8;
+
+    TTF_CHECKPOINTER(text, -1);
+
+    utf8 = SDL_stack_alloc(Uint8, UCS2_to_UTF8_len(text));
+    if (utf8) {
+        UCS2_to_UTF8(text, utf8);
+        status = TTF_RenderUTF8_Geometry(atlas, (char *)utf8, x, y, fg);
+        SDL_stack_free(utf8);
+    } else {
+        SDL_OutOfMemory();
+    }
+    return status;
+}
+
+void TTF_DestroyGlyphAtlas(TTF_GlyphAtlas *atlas)
+{
+    if (atlas) {
+        if (atlas->texture) {
+            SDL_DestroyTexture(atlas->texture);
+        }
+        if (atlas->pixels) {
+            SDL_FreeSurface(atlas->pixels);
+        }
+        SDL_free(atlas->shelves);
+        SDL_free(atlas->glyphs);
+        SDL_free(atlas->buckets);
+        SDL_free(atlas->vertices);
+        SDL_free(atlas->indices);
+        SDL_free(atlas);
+    }
+}
+
+void TTF_SetFontStyle(TTF_Font* font, int style)
+{
+    int prev_style;
+
+    TTF_LockFont(font);
+    TTF_LockClones(font);
+    prev_style = font->style;
+    font->style = style | font->face_style;
+    ++font->serial;
+    TTF_UnlockClones(font);
+
+    TTF_initFontMetrics(font);
+
+    /* Flush the cache if the style has changed.
+     * Ignore UNDERLINE which does not impact glyph drawning.
+     * */
+    if ((font->style | TTF_STYLE_NO_GLYPH_CHANGE) != (prev_style | TTF_STYLE_NO_GLYPH_CHANGE)) {
+        Flush_Cache(font);
+    }
+    TTF_UnlockFont(font);
+}
+
+int TTF_GetFontStyle(const TTF_Font* font)
 {
     return font->style;
 }
 
 void TTF_SetFontOutline(TTF_Font* font, int outline)
 {
+    TTF_LockFont(font);
+    TTF_LockClones(font);
     font->outline = SDL_max(0, outline);
+    ++font->serial;
+    TTF_UnlockClones(font);
     TTF_initFontMetrics(font);
     Flush_Cache(font);
+    TTF_UnlockFont(font);
 }
 
 int TTF_GetFontOutline(const TTF_Font* font)
@@ -2049,6 +3910,8 @@ int TTF_GetFontOutline(const TTF_Font* font)
 
 void TTF_SetFontHinting(TTF_Font* font, int hinting)
 {
+    TTF_LockFont(font);
+    TTF_LockClones(font);
     if (hinting == TTF_HINTING_LIGHT)
         font->hinting = FT_LOAD_TARGET_LIGHT;
     else if (hinting == TTF_HINTING_MONO)
@@ -2057,8 +3920,11 @@ void TTF_SetFontHinting(TTF_Font* font, int hinting)
         font->hinting = FT_LOAD_NO_HINTING;
     else
         font->hinting = 0;
+    ++font->serial;
+    TTF_UnlockClones(font);
 
     Flush_Cache(font);
+    TTF_UnlockFont(font);
 }
 
 int TTF_GetFontHinting(const TTF_Font* font)
@@ -2074,11 +3940,15 @@ int TTF_GetFontHinting(const TTF_Font* font)
 
 void TTF_Quit(void)
 {
+    SDL_AtomicLock(&TTF_init_lock);
     if (TTF_initialized) {
         if (--TTF_initialized == 0) {
             FT_Done_FreeType(library);
+            SDL_DestroyMutex(TTF_library_lock);
+            TTF_library_lock = NULL;
         }
     }
+    SDL_AtomicUnlock(&TTF_init_lock);
 }
 
 int TTF_WasInit(void)
@@ -2090,13 +3960,16 @@ int TTF_WasInit(void)
 int TTF_GetFontKerningSize(TTF_Font* font, int prev_index, int index)
 {
     FT_Vector delta;
-    FT_Get_Kerning(font->face, prev_index, index, ft_kerning_default, &delta);
+    TTF_LockFont(font);
+    Get_Kerning(font, prev_index, index, &delta);
+    TTF_UnlockFont(font);
     return (delta.x >> 6);
 }
 
 int TTF_GetFontKerningSizeGlyphs(TTF_Font *font, Uint16 previous_ch, Uint16 ch)
 {
     int error;
+    c_glyph *glyph;
     FT_UInt glyph_index, prev_index;
     FT_Vector delta;
 
@@ -2108,21 +3981,25 @@ int TTF_GetFontKerningSizeGlyphs(TTF_Font *font, Uint16 previous_ch, Uint16 ch)
         return 0;
     }
 
-    error = Find_Glyph(font, ch, CACHED_METRICS);
+    TTF_LockFont(font);
+    error = Find_Glyph(font, ch, CACHED_METRICS, &glyph);
     if (error) {
+        TTF_UnlockFont(font);
         TTF_SetFTError("Couldn't find glyph", error);
         return -1;
     }
-    glyph_index = font->current->index;
+    glyph_index = glyph->index;
 
-    error = Find_Glyph(font, previous_ch, CACHED_METRICS);
+    error = Find_Glyph(font, previous_ch, CACHED_METRICS, &glyph);
     if (error) {
+        TTF_UnlockFont(font);
         TTF_SetFTError("Couldn't find glyph", error);
         return -1;
     }
-    prev_index = font->current->index;
+    prev_index = glyph->index;
 
-    error = FT_Get_Kerning(font->face, prev_index, glyph_index, ft_kerning_default, &delta);
+    error = Get_Kerning(font, prev_index, glyph_index, &delta);
+    TTF_UnlockFont(font);
     if (error) {
         TTF_SetFTError("Couldn't get glyph kerning", error);
         return -1;
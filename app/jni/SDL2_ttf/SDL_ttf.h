@@ -94,7 +94,12 @@ extern DECLSPEC const SDL_version * SDLCALL TTF_Linked_Version(void);
 */
 extern DECLSPEC void SDLCALL TTF_ByteSwappedUNICODE(int swapped);
 
-/* The internal structure containing font information */
+/* The internal structure containing font information.
+   A font may be used from several threads at once.  Threads rendering
+   with a font that is busy get a private copy of its FreeType face and
+   glyph cache, so they render in parallel instead of waiting.  Glyph
+   atlases and font settings still serialize on the font.
+ */
 typedef struct _TTF_Font TTF_Font;
 
 /* Initialize the TTF engine - returns 0 if successful, -1 on error */
@@ -103,7 +108,10 @@ extern DECLSPEC int SDLCALL TTF_Init(void);
 /* Open a font file and create a font of the specified point size.
  * Some .fon fonts will have several sizes embedded in the file, so the
  * point size becomes the index of choosing which size.  If the value
- * is too high, the last indexed size will be the default. */
+ * is too high, the last indexed size will be the default.
+ * Where the platform supports it, fonts opened from a file are memory
+ * mapped, and all the fonts opened from the same file and face index share
+ * one mapping and one parsed face, whatever their point size. */
 extern DECLSPEC TTF_Font * SDLCALL TTF_OpenFont(const char *file, int ptsize);
 extern DECLSPEC TTF_Font * SDLCALL TTF_OpenFontIndex(const char *file, int ptsize, long index);
 extern DECLSPEC TTF_Font * SDLCALL TTF_OpenFontRW(SDL_RWops *src, int freesrc, int ptsize);
@@ -251,6 +259,94 @@ extern DECLSPEC SDL_Surface * SDLCALL TTF_RenderUNICODE_Blended_Wrapped(TTF_Font
 extern DECLSPEC SDL_Surface * SDLCALL TTF_RenderGlyph_Blended(TTF_Font *font,
                         Uint16 ch, SDL_Color fg);
 
+/* Signed distance fields are padded by this many pixels on every side and
+   encode the distance to the glyph edge in the alpha channel: 128 is the
+   edge, 255 is TTF_SDF_SPREAD pixels inside and 0 is TTF_SDF_SPREAD pixels
+   outside.  Drawing a field scaled with an alpha threshold around 128
+   (e.g. in a shader, or with TTF_ScaleSDF()) gives crisp text at any size
+   from a single rasterization at the font's point size.
+*/
+#define TTF_SDF_SPREAD  8
+
+/* Create a 32-bit ARGB surface holding the signed distance field of the
+   given text, with the text color in the color channels.  The surface is
+   2*TTF_SDF_SPREAD pixels larger than the TTF_SizeUTF8() size of the text
+   in each dimension.  The alpha of the text color is not used.
+   This function returns the new surface, or NULL if there was an error.
+*/
+extern DECLSPEC SDL_Surface * SDLCALL TTF_RenderText_SDF(TTF_Font *font,
+                const char *text, SDL_Color fg);
+extern DECLSPEC SDL_Surface * SDLCALL TTF_RenderUTF8_SDF(TTF_Font *font,
+                const char *text, SDL_Color fg);
+extern DECLSPEC SDL_Surface * SDLCALL TTF_RenderUNICODE_SDF(TTF_Font *font,
+                const Uint16 *text, SDL_Color fg);
+
+/* Placement of a glyph in a distance field atlas.  The offsets and the
+   advance are in pixels at the font's point size; multiply them by the
+   drawing scale.  The top left of 'rect' is drawn at
+   (pen x + xoffset, line top + yoffset).
+*/
+typedef struct TTF_SDFGlyph
+{
+    Uint32 ch;
+    SDL_Rect rect;
+    int xoffset;
+    int yoffset;
+    int advance;
+} TTF_SDFGlyph;
+
+/* Create a 32-bit ARGB atlas holding the distance fields of each distinct
+   character of the given UTF-8 text, white in the color channels.  Up to
+   maxglyphs entries of 'glyphs' are filled in and their count is returned
+   in 'numglyphs'.
+   This function returns the new surface, or NULL if there was an error.
+*/
+extern DECLSPEC SDL_Surface * SDLCALL TTF_CreateSDFAtlas(TTF_Font *font,
+                const char *text, TTF_SDFGlyph *glyphs, int maxglyphs, int *numglyphs);
+
+/* Resample a distance field created by TTF_RenderUTF8_SDF() or
+   TTF_CreateSDFAtlas() into an anti-aliased 32-bit ARGB surface scaled by
+   the given factor, ready to be blended like TTF_RenderUTF8_Blended().
+   This function returns the new surface, or NULL if there was an error.
+*/
+extern DECLSPEC SDL_Surface * SDLCALL TTF_ScaleSDF(SDL_Surface *sdf, float scale);
+
+/* A texture holding the glyphs of one font for one renderer, used to draw
+   text as textured quads with SDL_RenderGeometry().  Glyphs are uploaded the
+   first time they are drawn; the atlas grows up to the renderer's maximum
+   texture size and then reuses the space of the least recently drawn glyphs.
+   Changing the font style, outline or hinting empties the atlas.
+   An atlas must be destroyed before its font and its renderer, and should be
+   recreated after an SDL_RENDER_DEVICE_RESET event.
+*/
+typedef struct _TTF_GlyphAtlas TTF_GlyphAtlas;
+
+/* Create an empty glyph atlas for drawing the font with the renderer.
+   This function returns the new atlas, or NULL if there was an error.
+*/
+extern DECLSPEC TTF_GlyphAtlas * SDLCALL TTF_CreateGlyphAtlas(TTF_Font *font,
+                SDL_Renderer *renderer);
+
+/* Draw the given text with the atlas' renderer, blended in the color fg,
+   with the top left corner where a TTF_RenderUTF8_Blended() surface of the
+   same text would have it at x, y.  Missing glyphs are added to the atlas
+   and the text is usually drawn with a single SDL_RenderGeometry() call.
+   This function returns 0, or -1 if there was an error.
+*/
+extern DECLSPEC int SDLCALL TTF_RenderText_Geometry(TTF_GlyphAtlas *atlas,
+                const char *text, int x, int y, SDL_Color fg);
+extern DECLSPEC int SDLCALL TTF_RenderUTF8_Geometry(TTF_GlyphAtlas *atlas,
+                const char *text, int x, int y, SDL_Color fg);
+extern DECLSPEC int SDLCALL TTF_RenderUNICODE_Geometry(TTF_GlyphAtlas *atlas,
+                const Uint16 *text, int x, int y, SDL_Color fg);
+
+/* Get the texture of the atlas, e.g. to inspect it.  The texture changes
+   when the atlas grows. */
+extern DECLSPEC SDL_Texture * SDLCALL TTF_GetGlyphAtlasTexture(TTF_GlyphAtlas *atlas);
+
+/* Free the atlas and its texture */
+extern DECLSPEC void SDLCALL TTF_DestroyGlyphAtlas(TTF_GlyphAtlas *atlas);
+
 /* For compatibility with previous versions, here are the old functions */
 #define TTF_RenderText(font, text, fg, bg)  \
     TTF_RenderText_Shaded(font, text, fg, bg)
@@ -0,0 +1,239 @@
+/*
+  threadfont:  A stress test of rendering with the TTF library from many threads.
+  Copyright (C) 2001-2019 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+/* Renders the same strings from several threads at once with fonts shared
+   between the threads, and checks every surface against the one rendered
+   on a single thread.  The fonts are opened by file name, which shares the
+   face between sizes, and from a stream. */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "SDL.h"
+#include "SDL_ttf.h"
+
+#define DEFAULT_PTSIZE      18
+#define DEFAULT_THREADS     8
+#define DEFAULT_ITERATIONS  2000
+
+#define TTF_THREADFONT_USAGE \
+"Usage: %s [-threads N] [-iterations N] <font>.ttf [ptsize]\n"
+
+#define NUM_FONTS   3
+#define NUM_MODES   5
+#define NUM_TEXTS   (int)(sizeof(texts) / sizeof(texts[0]))
+
+static const char *texts[] = {
+    "The quick brown fox jumped over the lazy dog",
+    "Sphinx of black quartz, judge my vow!",
+    "0123456789 +-*/=()[]{}<>",
+    "AVAVAV WAWAWA To Ty Yo",
+    "\xC3\x89t\xC3\xA9 \xC3\xA0 l'h\xC3\xB4tel, na\xC3\xAFve fa\xC3\xA7" "ade",
+    "Pack my box with five dozen liquor jugs. How vexingly quick daft zebras jump!",
+};
+
+static TTF_Font *fonts[NUM_FONTS];
+static SDL_Surface *expected[NUM_FONTS][NUM_MODES][NUM_TEXTS];
+static int iterations = DEFAULT_ITERATIONS;
+static SDL_atomic_t failures;
+
+static SDL_Surface *Render(TTF_Font *font, int mode, const char *text)
+{
+    SDL_Color fg = { 0x20, 0x40, 0xC0, 0xFF };
+    SDL_Color bg = { 0xFF, 0xFF, 0xE0, 0xFF };
+
+    switch (mode) {
+    case 0:
+        return TTF_RenderUTF8_Solid(font, text, fg);
+    case 1:
+        return TTF_RenderUTF8_Shaded(font, text, fg, bg);
+    case 2:
+        return TTF_RenderUTF8_Blended(font, text, fg);
+    case 3:
+        return TTF_RenderUTF8_Blended_Wrapped(font, text, fg, 200);
+    default:
+        return TTF_RenderUTF8_SDF(font, text, fg);
+    }
+}
+
+static SDL_bool SameSurface(SDL_Surface *a, SDL_Surface *b)
+{
+    int y, row;
+
+    if (!a || !b) {
+        return (a == b);
+    }
+    if (a->w != b->w || a->h != b->h || a->format->format != b->format->format) {
+        return SDL_FALSE;
+    }
+    row = a->w * a->format->BytesPerPixel;
+    for (y = 0; y < a->h; ++y) {
+        if (SDL_memcmp((Uint8 *)a->pixels + y * a->pitch, (Uint8 *)b->pixels + y * b->pitch, row) != 0) {
+            return SDL_FALSE;
+        }
+    }
+    return SDL_TRUE;
+}
+
+static void RenderExpected(void)
+{
+    int f, m, t;
+
+    for (f = 0; f < NUM_FONTS; ++f) {
+        for (m = 0; m < NUM_MODES; ++m) {
+            for (t = 0; t < NUM_TEXTS; ++t) {
+                SDL_FreeSurface(expected[f][m][t]);
+                expected[f][m][t] = Render(fonts[f], m, texts[t]);
+            }
+        }
+    }
+}
+
+static int SDLCALL RenderThread(void *data)
+{
+    Uint32 seed = (Uint32)(uintptr_t)data * 2654435761u + 1;
+    int i;
+
+    for (i = 0; i < iterations; ++i) {
+        int f, m, t;
+        SDL_Surface *surface;
+
+        seed = seed * 1664525u + 1013904223u;
+        f = (seed >> 8) % NUM_FONTS;
+        m = (seed >> 12) % NUM_MODES;
+        t = (seed >> 16) % NUM_TEXTS;
+
+        surface = Render(fonts[f], m, texts[t]);
+        if (!SameSurface(surface, expected[f][m][t])) {
+            if (SDL_AtomicAdd(&failures, 1) < 10) {
+                SDL_Log("Mismatch: font %d, mode %d, text %d", f, m, t);
+            }
+        }
+        SDL_FreeSurface(surface);
+    }
+    return 0;
+}
+
+static double RunThreads(int num_threads)
+{
+    SDL_Thread **threads;
+    Uint64 start;
+    int i;
+
+    threads = (SDL_Thread **)SDL_calloc(num_threads, sizeof(*threads));
+    if (!threads) {
+        return 0.0;
+    }
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < num_threads; ++i) {
+        threads[i] = SDL_CreateThread(RenderThread, "threadfont", (void *)(uintptr_t)(i + 1));
+    }
+    for (i = 0; i < num_threads; ++i) {
+        SDL_WaitThread(threads[i], NULL);
+    }
+    SDL_free(threads);
+    return (double)(SDL_GetPerformanceCounter() - start) / SDL_GetPerformanceFrequency();
+}
+
+static void Report(const char *what, int num_threads, double seconds)
+{
+    SDL_Log("%-24s %2d thread(s): %8.0f renders/s", what, num_threads,
+            (double)num_threads * iterations / seconds);
+}
+
+int main(int argc, char *argv[])
+{
+    char *argv0 = argv[0];
+    int num_threads = DEFAULT_THREADS;
+    int ptsize = DEFAULT_PTSIZE;
+    int i;
+
+    for (argc--, argv++; argc > 0 && argv[0][0] == '-'; argc--, argv++) {
+        if (SDL_strcmp(argv[0], "-threads") == 0 && argv[1]) {
+            num_threads = SDL_max(SDL_atoi(argv[1]), 1);
+            argc--, argv++;
+        } else if (SDL_strcmp(argv[0], "-iterations") == 0 && argv[1]) {
+            iterations = SDL_max(SDL_atoi(argv[1]), 1);
+            argc--, argv++;
+        } else {
+            SDL_Log(TTF_THREADFONT_USAGE, argv0);
+            return 1;
+        }
+    }
+    if (argc < 1) {
+        SDL_Log(TTF_THREADFONT_USAGE, argv0);
+        return 1;
+    }
+    if (argc > 1) {
+        ptsize = SDL_atoi(argv[1]);
+    }
+
+    if (SDL_Init(0) < 0 || TTF_Init() < 0) {
+        SDL_Log("Couldn't initialize: %s", SDL_GetError());
+        return 2;
+    }
+
+    /* Two sizes sharing the face of a mapped file, and one from a stream */
+    fonts[0] = TTF_OpenFont(argv[0], ptsize);
+    fonts[1] = TTF_OpenFont(argv[0], ptsize * 2);
+    fonts[2] = TTF_OpenFontRW(SDL_RWFromFile(argv[0], "rb"), 1, ptsize + 3);
+    for (i = 0; i < NUM_FONTS; ++i) {
+        if (!fonts[i]) {
+            SDL_Log("Couldn't load %d pt font from %s: %s", ptsize, argv[0], SDL_GetError());
+            return 2;
+        }
+    }
+    TTF_SetFontOutline(fonts[2], 1);
+
+    RenderExpected();
+    Report("Single thread", 1, RunThreads(1));
+    Report("Shared fonts", num_threads, RunThreads(num_threads));
+
+    /* The threads must pick up setting changes made between runs */
+    TTF_SetFontStyle(fonts[0], TTF_STYLE_BOLD | TTF_STYLE_UNDERLINE);
+    TTF_SetFontStyle(fonts[1], TTF_STYLE_ITALIC);
+    TTF_SetFontHinting(fonts[2], TTF_HINTING_MONO);
+    TTF_SetFontKerning(fonts[2], 0);
+    RenderExpected();
+    Report("Shared fonts, restyled", num_threads, RunThreads(num_threads));
+
+    if (SDL_AtomicGet(&failures)) {
+        SDL_Log("FAILED: %d surfaces didn't match", SDL_AtomicGet(&failures));
+    } else {
+        SDL_Log("All surfaces matched");
+    }
+
+    for (i = 0; i < NUM_FONTS; ++i) {
+        int m, t;
+        for (m = 0; m < NUM_MODES; ++m) {
+            for (t = 0; t < NUM_TEXTS; ++t) {
+                SDL_FreeSurface(expected[i][m][t]);
+            }
+        }
+        TTF_CloseFont(fonts[i]);
+    }
+    TTF_Quit();
+    SDL_Quit();
+    return SDL_AtomicGet(&failures) ? 1 : 0;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -1,12 +1,12 @@
 #ifndef ANDROID_PROJECT_COMMON_H
 #define ANDROID_PROJECT_COMMON_H
 
-#include <android/log.h>
+#include <SDL_log.h>
 
-#define TAG "SDL"
-
-#define LOG_INFO(...)    __android_log_print(ANDROID_LOG_INFO, TAG, __VA_ARGS__)
-#define LOG_ERROR(...)   __android_log_print(ANDROID_LOG_ERROR, TAG, __VA_ARGS__)
+/* Logged through SDL so that, with SDL_HINT_LOG_ASYNC, the render thread
+   doesn't wait on logd.  SDL tags the messages "SDL/APP" in logcat. */
+#define LOG_INFO(...)    SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, __VA_ARGS__)
+#define LOG_ERROR(...)   SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, __VA_ARGS__)
 
 #define LOGI(fmt, args...)  LOG_INFO("[INFO ] %s %d() " fmt "\n", __func__, __LINE__, ##args);
 #define LOGE(fmt, args...)  LOG_ERROR("[ERROR] %s %d() " fmt "\n", __func__, __LINE__, ##args);
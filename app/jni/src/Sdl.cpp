@@ -106,6 +106,7 @@ int32_t Sdl::Init()
     rc = socketInit();
 
     if (SUCCEED(rc)) {
+        SDL_SetHint(SDL_HINT_LOG_ASYNC, "1");
         if (SDL_Init(SDL_INIT_VIDEO)) {
             LOGE("Could not initialize SDL - %s", SDL_GetError());
             rc = EXTERNAL_ERROR;